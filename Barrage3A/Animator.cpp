@@ -12,48 +12,103 @@ Animator::Animator(std::shared_ptr<GameObject> owner) : AppBase("Animator", owne
 
 }
 
+void Animator::Rebuild(const std::vector<AnimatorDef::AnimatorState>& stateDefs,
+                       const std::vector<std::pair<std::string, AnimatorDef::AnimatorParameterType>>& parameterDefs) {
+    auto next = AnimatorDef::AnimatorGraph::Compile(stateDefs, parameterDefs);
+
+    // ̃p[^l͖Oƌ^v̂p
+    std::vector<AnimatorDef::AnimatorParameter> values = next->defaultParameters;
+    if (graph) {
+        for (int i = 0; i < next->GetParameterCount(); ++i) {
+            int old = graph->GetParameterId(next->parameterNames[i]);
+            if (old != AnimatorDef::InvalidId && old < static_cast<int>(parameters.size()) &&
+                parameters[old].type == values[i].type) {
+                values[i] = parameters[old];
+            }
+        }
+    }
+    parameters = std::move(values);
+    clipOverrides.resize(next->states.size());
+    graph = std::move(next);
+}
+
+void Animator::DetachGraph() {
+    if (graph && graph.use_count() > 1) {
+        graph = std::make_shared<AnimatorDef::AnimatorGraph>(*graph);
+    }
+}
+
+const std::shared_ptr<AnimatorDef::AnimationClip>& Animator::GetClip(int stateId) const {
+    const auto& ov = clipOverrides[stateId];
+    return ov ? ov : graph->states[stateId].clip;
+}
+
+AnimatorDef::AnimatorParameter* Animator::GetParameter(int id, AnimatorDef::AnimatorParameterType type) {
+    if (id < 0 || id >= static_cast<int>(parameters.size())) return nullptr;
+    auto& param = parameters[id];
+    return param.type == type ? &param : nullptr;
+}
+
 void Animator::AddState(const AnimatorDef::AnimatorState& state) {
-    states[state.name] = state;
-    if (currentStateName.empty()) {
-        currentStateName = state.name;
-        defaultStateName = state.name;
+    std::vector<AnimatorDef::AnimatorState> stateDefs;
+    std::vector<std::pair<std::string, AnimatorDef::AnimatorParameterType>> parameterDefs;
+    if (graph) {
+        stateDefs = graph->states;
+        parameterDefs = graph->GetParameterDefs();
+    }
+    stateDefs.push_back(state);
+    Rebuild(stateDefs, parameterDefs);
+
+    if (currentState == AnimatorDef::InvalidId) {
+        currentState = 0;
         if (state.onEnter) state.onEnter();
     }
 }
 void Animator::AddParameter(const std::string& name, AnimatorDef::AnimatorParameterType type) {
-    AnimatorDef::AnimatorParameter param;
-    param.type = type;
-    if      (type == AnimatorDef::AnimatorParameterType::Bool ) param.boolValue  = false;
-    else if (type == AnimatorDef::AnimatorParameterType::Float) param.floatValue = 0.0f;
-    parameters[name] = param;
+    std::vector<AnimatorDef::AnimatorState> stateDefs;
+    std::vector<std::pair<std::string, AnimatorDef::AnimatorParameterType>> parameterDefs;
+    if (graph) {
+        stateDefs = graph->states;
+        parameterDefs = graph->GetParameterDefs();
+    }
+    parameterDefs.emplace_back(name, type);
+    Rebuild(stateDefs, parameterDefs);
+
+    // ōĒ`ꍇ͏lɖ߂
+    int id = graph->GetParameterId(name);
+    parameters[id] = graph->defaultParameters[id];
+}
+
+int Animator::GetStateId(const std::string& name) const {
+    return graph ? graph->GetStateId(name) : AnimatorDef::InvalidId;
+}
+
+int Animator::GetParameterId(const std::string& name) const {
+    return graph ? graph->GetParameterId(name) : AnimatorDef::InvalidId;
 }
 
 // --- p[^ݒ ---
-void Animator::SetTrigger(const std::string& name) {
-    auto it = parameters.find(name);
-    if (it != parameters.end() && it->second.type == AnimatorDef::AnimatorParameterType::Trigger) {
-        it->second.triggered = true;
+void Animator::SetTrigger(int id) {
+    if (auto p = GetParameter(id, AnimatorDef::AnimatorParameterType::Trigger)) {
+        p->triggered = true;
     }
 }
 
-void Animator::SetBool(const std::string& name, bool value) {
-    auto it = parameters.find(name);
-    if (it != parameters.end() && it->second.type == AnimatorDef::AnimatorParameterType::Bool) {
-        it->second.boolValue = value;
+void Animator::SetBool(int id, bool value) {
+    if (auto p = GetParameter(id, AnimatorDef::AnimatorParameterType::Bool)) {
+        p->boolValue = value;
     }
 }
 
-void Animator::SetFloat(const std::string& name, float value) {
-    auto it = parameters.find(name);
-    if (it != parameters.end() && it->second.type == AnimatorDef::AnimatorParameterType::Float) {
-        it->second.floatValue = value;
+void Animator::SetFloat(int id, float value) {
+    if (auto p = GetParameter(id, AnimatorDef::AnimatorParameterType::Float)) {
+        p->floatValue = value;
     }
 }
 
-void Animator::SetInt(const std::string& name, int value) {
-    auto it = parameters.find(name);
-    if (it != parameters.end() && it->second.type == AnimatorDef::AnimatorParameterType::Int) {
-        it->second.intValue = value;
+void Animator::SetInt(int id, int value) {
+    if (auto p = GetParameter(id, AnimatorDef::AnimatorParameterType::Int)) {
+        p->intValue = value;
     }
 }
 
@@ -70,28 +125,34 @@ float Animator::GetSpeed() const {
 }
 
 void Animator::SetOverrideController(std::shared_ptr<AnimatorDef::AnimatorOverride> overrideController) {
-    if (!overrideController) return;
+    if (!overrideController || !graph) return;
 
-    for (auto& [type,state] : states) {
-        auto newClip = overrideController->GetClip(state.name);
+    for (int id = 0; id < graph->GetStateCount(); ++id) {
+        auto newClip = overrideController->GetClip(graph->states[id].name);
         if (newClip) {
-            state.clip = newClip; // Ov Clip u
+            clipOverrides[id] = newClip; // Ov Clip u
         }
     }
 }
 
 void Animator::Play(const std::string& stateName) {
-    if (states.count(stateName)) {
-        auto& current = states[currentStateName];
-        if (current.onExit) current.onExit(); //  OXe[g̏I
+    Play(GetStateId(stateName));
+}
 
-        currentStateName = stateName;
-        time = 0.0f;
-        isPlaying = true;
+void Animator::Play(int stateId) {
+    if (!graph || stateId < 0 || stateId >= graph->GetStateCount()) return;
 
-        auto& next = states[stateName];
-        if (next.onEnter) next.onEnter(); //  VXe[g̊Jn
+    if (currentState != AnimatorDef::InvalidId) {
+        const auto& current = graph->states[currentState];
+        if (current.onExit) current.onExit(); //  OXe[g̏I
     }
+
+    currentState = stateId;
+    time = 0.0f;
+    isPlaying = true;
+
+    const auto& next = graph->states[stateId];
+    if (next.onEnter) next.onEnter(); //  VXe[g̊Jn
 }
 
 void Animator::Stop() {
@@ -108,8 +169,9 @@ void Animator::Resume() {
 }
 
 void Animator::Reset() {
-    if (!defaultStateName.empty()) {
-        Play(defaultStateName);
+    // ŏɒǉXe[g (ID 0) Xe[g
+    if (graph && graph->GetStateCount() > 0) {
+        Play(0);
     }
 }
 
@@ -126,7 +188,9 @@ bool Animator::IsPlaying() const {
 }
 
 const std::string& Animator::GetCurrentStateName() const {
-    return currentStateName;
+    static const std::string empty;
+    if (!graph || currentState == AnimatorDef::InvalidId) return empty;
+    return graph->states[currentState].name;
 }
 
 // AppBase Event.
@@ -136,24 +200,28 @@ void Animator::Start() {
 
 
 void Animator::Update() {
-    if (states.empty() || !isPlaying) return;
+    if (!graph || currentState == AnimatorDef::InvalidId || !isPlaying) return;
 
     float delta = isUpdateTimeScale ? Time.deltaTime * speed : Time.unscaledDeltaTime * speed;
     time += delta;
 
-    auto it = states.find(currentStateName);
-    if (it == states.end()) return;
-
-    AnimatorDef::AnimatorState& current = it->second;
+    // Otێ (R[obNɕĂQƂۂ)
+    const std::shared_ptr<AnimatorDef::AnimatorGraph> g = graph;
+    const int stateId = currentState;
+    const AnimatorDef::AnimatorState& current = g->states[stateId];
+    const auto& clip = GetClip(stateId);
 
     // 1. Jڔ
-    for (const AnimatorDef::AnimatorTransition& trans : current.transitions) {
-        if (trans.hasExitTime && current.clip && time < current.clip->duration) continue;
+    const auto range = g->stateTransitions[stateId];
+    for (uint32_t t = range.begin; t < range.end; ++t) {
+        const AnimatorDef::CompiledTransition& trans = g->transitions[t];
+        if (trans.toStateId == AnimatorDef::InvalidId) continue;
+        if (trans.hasExitTime && clip && time < clip->duration) continue;
 
         bool passed = true;
-        for (const AnimatorDef::AnimatorCondition& cond : trans.conditions) {
-            auto p = parameters.find(cond.parameterName);
-            if (p == parameters.end() || !cond.condition(p->second)) {
+        for (uint32_t c = trans.conditionBegin; c < trans.conditionEnd; ++c) {
+            const AnimatorDef::CompiledCondition& cond = g->conditions[c];
+            if (cond.parameterId == AnimatorDef::InvalidId || !cond.condition(parameters[cond.parameterId])) {
                 passed = false;
                 break;
             }
@@ -161,23 +229,22 @@ void Animator::Update() {
 
         if (passed) {
             if (current.onExit) current.onExit();
-            currentStateName = trans.toStateName;
+            currentState = trans.toStateId;
             time = 0.0f;
 
-            auto& nextState = states[currentStateName];
+            const auto& nextState = g->states[currentState];
             if (nextState.onEnter) nextState.onEnter();
 
             // TriggerZbg
-            for (auto& [k, v] : parameters)
-                if (v.type == AnimatorDef::AnimatorParameterType::Trigger) v.triggered = false;
+            for (int id : g->triggerIds) parameters[id].triggered = false;
 
             break;
         }
     }
 
     // 2. t[XV
-    if (current.clip) {
-        auto frame = current.clip->GetFrameAtTime(time);
+    if (clip) {
+        auto frame = clip->GetFrameAtTime(time);
         if (frame && gameObject) {
             auto re = ownerRenderer.lock();
             if (!re) {
@@ -4,56 +4,83 @@
 #include "AnimatorState.h"
 #include "AnimatorParameter.h"
 #include "AnimatorOverride.h"
+#include "AnimatorGraph.h"
 #include "SpriteRenderer.h"
 
 // Animator class and AppBase class
+// Xe[gJڂ AnimatorGraph (ID ς) 𕡐ԂŋL, CX^X̓p[^lƌ݃Xe[ĝݎ.
 class Animator : public AppBase {
 private:    // J.
-    std::unordered_map<std::string, AnimatorDef::AnimatorState> states;
-    std::unordered_map<std::string, AnimatorDef::AnimatorParameter> parameters;
+    std::shared_ptr<AnimatorDef::AnimatorGraph> graph;                      // RpCς݃Ot (L).
+    std::vector<AnimatorDef::AnimatorParameter> parameters;                 // p[^l (ID ).
+    std::vector<std::shared_ptr<AnimatorDef::AnimationClip>> clipOverrides; // Override ꂽ Clip (Xe[g ID ).
     std::weak_ptr<SpriteRenderer> ownerRenderer;
-    std::string currentStateName;
+    int currentState = AnimatorDef::InvalidId;
     float time  = 0.0f;
     float speed = 1.0f;
 
     bool isUpdateTimeScale;       // Scaleɉe󂯂邩.
     bool isPlaying = true;        // Update() ̍Đ.
     bool isPaused = false;        // Pause.
-    std::string defaultStateName; // Reset() Ŗ߂鏉Xe[g.
+
+    // `ύXăOtč\z.
+    void Rebuild(const std::vector<AnimatorDef::AnimatorState>& stateDefs,
+                 const std::vector<std::pair<std::string, AnimatorDef::AnimatorParameterType>>& parameterDefs);
+    // L̃Otpɕ.
+    void DetachGraph();
+    // Xe[g Clip (Override D)
+    const std::shared_ptr<AnimatorDef::AnimationClip>& GetClip(int stateId) const;
+    AnimatorDef::AnimatorParameter* GetParameter(int id, AnimatorDef::AnimatorParameterType type);
 public:     // J.
 
     // RXgN^.
     Animator();
     Animator(std::shared_ptr<GameObject>);
 
+    // --- \z (ZbgAbv) ---
     void AddState(const AnimatorDef::AnimatorState& state);
     void AddParameter(const std::string& name, AnimatorDef::AnimatorParameterType type);
 
-    void SetTrigger(const std::string& name);
-    void SetBool(const std::string& name, bool value);
-    void SetFloat(const std::string& name, float value);
-    void SetInt(const std::string& name, int value);
+    // O  ID. t[Ăԉӏ ID LbVĎg.
+    int GetStateId(const std::string& name) const;
+    int GetParameterId(const std::string& name) const;
+
+    // --- p[^ݒ (ID) ---
+    void SetTrigger(int id);
+    void SetBool(int id, bool value);
+    void SetFloat(int id, float value);
+    void SetInt(int id, int value);
+
+    // --- p[^ݒ (O) ---
+    void SetTrigger(const std::string& name)            { SetTrigger(GetParameterId(name)); }
+    void SetBool(const std::string& name, bool value)   { SetBool(GetParameterId(name), value); }
+    void SetFloat(const std::string& name, float value) { SetFloat(GetParameterId(name), value); }
+    void SetInt(const std::string& name, int value)     { SetInt(GetParameterId(name), value); }
+
     void SetSpeed(float s);
     void SetIsUpdateTimeScale(bool);
     float GetSpeed() const;
 
     // OŃXe[g擾iύX\j
+    // OtLĂꍇ͕ĂԂ. Jڂ̕ύX͔fȂ̂ AddState ōĒ`.
     AnimatorDef::AnimatorState* GetStatePtr(const std::string& name) {
-        auto it = states.find(name);
-        if (it != states.end()) return &it->second;
-        return nullptr;
+        int id = GetStateId(name);
+        if (id == AnimatorDef::InvalidId) return nullptr;
+        DetachGraph();
+        return &graph->states[id];
     }
 
     // OŃXe[g擾iconstj
     const AnimatorDef::AnimatorState* GetStatePtr(const std::string& name) const {
-        auto it = states.find(name);
-        if (it != states.end()) return &it->second;
-        return nullptr;
+        int id = GetStateId(name);
+        if (id == AnimatorDef::InvalidId) return nullptr;
+        return &graph->states[id];
     }
 
     void SetOverrideController(std::shared_ptr<AnimatorDef::AnimatorOverride> ov);
 
     void Play(const std::string& stateName);        // ɃXe[gJ
+    void Play(int stateId);                         // ɃXe[gJ (ID)
     void Stop();                                    // Aj[V~
     void Pause();                                   // Đꎞ~
     void Resume();                                  // ĊJ
@@ -62,6 +89,7 @@ public:     // 
     float GetTime() const;                          // ݂̍Đʒu
     void SetTime(float t);                          // wʒuĐ
     const std::string& GetCurrentStateName() const; // ݃Xe[g擾
+    int GetCurrentStateId() const { return currentState; }
     bool IsPlaying() const;                         // Đǂ
 
     // AppBase ֐.
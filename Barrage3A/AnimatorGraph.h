@@ -0,0 +1,137 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+#include "AnimatorState.h"
+#include "AnimatorParameter.h"
+
+namespace AnimatorDef {
+
+    // ȃXe[g / p[^ ID.
+    constexpr int InvalidId = -1;
+
+    // RpCς݂̑Jڏ (p[^ ID ŎQ).
+    struct CompiledCondition {
+        int parameterId = InvalidId;
+        std::function<bool(const AnimatorParameter&)> condition;
+    };
+
+    // RpCς݂̑J.  conditions[conditionBegin, conditionEnd).
+    struct CompiledTransition {
+        int toStateId = InvalidId;
+        bool hasExitTime = false;
+        uint32_t conditionBegin = 0;
+        uint32_t conditionEnd = 0;
+    };
+
+    // Xe[gƃp[^𖧂 ID ɕϊJڃOt.
+    // Compile ͕ύX,  Animator ԂŋL.
+    class AnimatorGraph {
+    public:
+        struct TransitionRange {
+            uint32_t begin = 0;
+            uint32_t end = 0;
+        };
+
+        std::vector<AnimatorState> states;                  // Xe[g` (ID , 擪Xe[g)
+        std::vector<TransitionRange> stateTransitions;      // Xe[g ID  transitions ͈̔
+        std::vector<CompiledTransition> transitions;
+        std::vector<CompiledCondition> conditions;
+
+        std::vector<std::string> parameterNames;            // p[^ (ID )
+        std::vector<AnimatorParameter> defaultParameters;   // p[^l (ID )
+        std::vector<int> triggerIds;                        // Trigger ^p[^ ID
+
+        std::unordered_map<std::string, int> stateIds;
+        std::unordered_map<std::string, int> parameterIds;
+
+    public:
+        int GetStateCount() const { return static_cast<int>(states.size()); }
+        int GetParameterCount() const { return static_cast<int>(defaultParameters.size()); }
+
+        // O  ID (Ȃ InvalidId)
+        int GetStateId(const std::string& name) const {
+            auto it = stateIds.find(name);
+            return it != stateIds.end() ? it->second : InvalidId;
+        }
+        int GetParameterId(const std::string& name) const {
+            auto it = parameterIds.find(name);
+            return it != parameterIds.end() ? it->second : InvalidId;
+        }
+
+        // p[^̏l.
+        static AnimatorParameter MakeDefaultParameter(AnimatorParameterType type) {
+            AnimatorParameter param;
+            param.type = type;
+            param.intValue = 0;
+            if      (type == AnimatorParameterType::Bool ) param.boolValue  = false;
+            else if (type == AnimatorParameterType::Float) param.floatValue = 0.0f;
+            return param;
+        }
+
+        // Xe[g`ƃp[^`Ot\z.
+        // ̃Xe[g / p[^͌ォǉŒu (ID ͍ŏ̈ʒû܂).
+        static std::shared_ptr<AnimatorGraph> Compile(
+            const std::vector<AnimatorState>& stateDefs,
+            const std::vector<std::pair<std::string, AnimatorParameterType>>& parameterDefs)
+        {
+            auto g = std::make_shared<AnimatorGraph>();
+
+            for (const auto& [name, type] : parameterDefs) {
+                auto [it, inserted] = g->parameterIds.try_emplace(name, g->GetParameterCount());
+                if (inserted) {
+                    g->parameterNames.push_back(name);
+                    g->defaultParameters.push_back(MakeDefaultParameter(type));
+                }
+                else {
+                    g->defaultParameters[it->second] = MakeDefaultParameter(type);
+                }
+            }
+            for (int i = 0; i < g->GetParameterCount(); ++i) {
+                if (g->defaultParameters[i].type == AnimatorParameterType::Trigger) g->triggerIds.push_back(i);
+            }
+
+            for (const auto& state : stateDefs) {
+                auto [it, inserted] = g->stateIds.try_emplace(state.name, g->GetStateCount());
+                if (inserted) g->states.push_back(state);
+                else          g->states[it->second] = state;
+            }
+
+            // JڐEp[^ ID ɉ.
+            g->stateTransitions.resize(g->states.size());
+            for (size_t s = 0; s < g->states.size(); ++s) {
+                auto& range = g->stateTransitions[s];
+                range.begin = static_cast<uint32_t>(g->transitions.size());
+
+                for (const auto& trans : g->states[s].transitions) {
+                    CompiledTransition ct;
+                    ct.toStateId = g->GetStateId(trans.toStateName);
+                    ct.hasExitTime = trans.hasExitTime;
+                    ct.conditionBegin = static_cast<uint32_t>(g->conditions.size());
+                    for (const auto& cond : trans.conditions) {
+                        g->conditions.push_back({ g->GetParameterId(cond.parameterName), cond.condition });
+                    }
+                    ct.conditionEnd = static_cast<uint32_t>(g->conditions.size());
+                    g->transitions.push_back(ct);
+                }
+                range.end = static_cast<uint32_t>(g->transitions.size());
+            }
+            return g;
+        }
+
+        // `o (č\zp).
+        std::vector<std::pair<std::string, AnimatorParameterType>> GetParameterDefs() const {
+            std::vector<std::pair<std::string, AnimatorParameterType>> defs;
+            defs.reserve(parameterNames.size());
+            for (size_t i = 0; i < parameterNames.size(); ++i) {
+                defs.emplace_back(parameterNames[i], defaultParameters[i].type);
+            }
+            return defs;
+        }
+    };
+}
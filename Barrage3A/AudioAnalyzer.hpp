@@ -10,101 +10,188 @@
 #include <string>
 #include <algorithm>
 #include <vector>
+#include <unordered_map>
+#include <filesystem>
+#include <cstring>
+#include <cstdint>
+#include <bit>
+#include <emmintrin.h>
+
+#include "SnapshotStream.h"
+#include "File.hpp"
 
 namespace System {
-    
+
+    namespace AudioScan {
+
+        // data[0, size)  value T. 16 oCgr.
+        inline size_t FindByte(const uint8_t* data, size_t size, uint8_t value) {
+            const __m128i key = _mm_set1_epi8(static_cast<char>(value));
+            size_t i = 0;
+            for (; i + 16 <= size; i += 16) {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                const int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(block, key));
+                if (mask != 0) return i + std::countr_zero(static_cast<unsigned>(mask));
+            }
+            for (; i < size; ++i) {
+                if (data[i] == value) return i;
+            }
+            return size;
+        }
+
+        // 擪oCg FindByte ŏEĂcׂ. Ȃ size.
+        inline size_t FindPattern(const uint8_t* data, size_t size, size_t from, const char* pattern, size_t length) {
+            while (from + length <= size) {
+                const size_t hit = from + FindByte(data + from, size - from - length + 1, static_cast<uint8_t>(pattern[0]));
+                if (hit + length > size) break;
+                if (std::memcmp(data + hit, pattern, length) == 0) return hit;
+                from = hit + 1;
+            }
+            return size;
+        }
+
+        // t@C̈ꕔ܂Ƃ߂ēǂŎĂ. ͈͊O߂ꂽ炻̈ʒuǂݒ.
+        class FileWindow {
+        private:
+            static constexpr size_t WindowSize = 64 * 1024;
+
+            std::ifstream file;
+            uint64_t fileSize = 0;
+            uint64_t offset = 0;
+            std::vector<uint8_t> buffer;
+        public:
+            explicit FileWindow(const std::string& filepath) : file(filepath, std::ios::binary) {
+                std::error_code ec;
+                fileSize = static_cast<uint64_t>(std::filesystem::file_size(filepath, ec));
+                if (ec) file.close();
+            }
+
+            bool IsOpen() const { return file.is_open(); }
+            uint64_t GetFileSize() const { return fileSize; }
+
+            // [pos, pos + length) w|C^. Ȃ nullptr.
+            const uint8_t* Get(uint64_t pos, size_t length) {
+                if (pos + length > fileSize) return nullptr;
+                if (pos >= offset && pos + length <= offset + buffer.size()) return buffer.data() + (pos - offset);
+                const size_t readSize = static_cast<size_t>((std::min<uint64_t>)(fileSize - pos, (std::max)(length, WindowSize)));
+                buffer.resize(readSize);
+                file.clear();
+                file.seekg(static_cast<std::streamoff>(pos), std::ios::beg);
+                if (!file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(readSize))) {
+                    buffer.clear();
+                    return nullptr;
+                }
+                offset = pos;
+                return buffer.data();
+            }
+
+            // pos ǂ߂邾 (ő WindowSize). ǂ߂oCg length ɕԂ.
+            const uint8_t* GetAvailable(uint64_t pos, size_t& length) {
+                length = static_cast<size_t>((std::min<uint64_t>)(pos < fileSize ? fileSize - pos : 0, WindowSize));
+                return length > 0 ? Get(pos, length) : nullptr;
+            }
+        };
+
+        // Ogg y[W granule position ̍ől (-1 = m̃y[W͏).
+        inline uint64_t FindLastGranule(const uint8_t* data, size_t size) {
+            uint64_t last = 0;
+            for (size_t pos = FindPattern(data, size, 0, "OggS", 4); pos + 14 <= size; pos = FindPattern(data, size, pos + 1, "OggS", 4)) {
+                uint64_t granule = 0;
+                std::memcpy(&granule, data + pos + 6, sizeof(granule));
+                if (granule != UINT64_MAX && granule > last) last = granule;
+            }
+            return last;
+        }
+    }
+
     // .mp3 ` .
     class MP3Info {
     public:
         static bool Parse(const std::string& filepath, double& duration, int& channels, int& sampleRate) {
-            std::ifstream file(filepath, std::ios::binary);
-            if (!file) return false;
+            AudioScan::FileWindow file(filepath);
+            if (!file.IsOpen()) return false;
 
             // ID3v2
-            char id3[10];
-            file.read(id3, 10);
-            int skip = 0;
-            if (std::memcmp(id3, "ID3", 3) == 0) {
-                skip =
-                    ((id3[6] & 0x7F) << 21) |
+            uint64_t pos = 0;
+            if (const uint8_t* id3 = file.Get(0, 10); id3 && std::memcmp(id3, "ID3", 3) == 0) {
+                pos = 10 +
+                    (((id3[6] & 0x7F) << 21) |
                     ((id3[7] & 0x7F) << 14) |
                     ((id3[8] & 0x7F) << 7) |
-                    (id3[9] & 0x7F);
-                file.seekg(10 + skip, std::ios::beg);
-            }
-            else {
-                file.seekg(0, std::ios::beg);
+                    (id3[9] & 0x7F));
             }
 
-            std::streampos frameStartPos;
-            uint8_t buffer[4];
-            while (file.read(reinterpret_cast<char*>(buffer), 4)) {
-                if (!IsFrameHeader(buffer)) {
-                    file.seekg(-3, std::ios::cur);
-                    continue;
+            // t[𑋂ƂɒT (̋ڂ܂ 3 oCgd˂).
+            uint64_t frame = 0;
+            bool found = false;
+            size_t length = 0;
+            while (!found) {
+                const uint8_t* data = file.GetAvailable(pos, length);
+                if (!data || length < 4) return false;
+                size_t i = 0;
+                while ((i += AudioScan::FindByte(data + i, length - 3 - i, 0xFF)) < length - 3) {
+                    if (IsFrameHeader(data + i)) {
+                        frame = pos + i;
+                        found = true;
+                        break;
+                    }
+                    ++i;
                 }
+                if (!found) pos += length - 3;
+            }
 
-                int bitrate = GetBitrate(buffer);
-                sampleRate = GetSampleRate(buffer);
-                channels = GetChannelMode(buffer);
-                if (bitrate == 0 || sampleRate == 0) return false;
-
-                int versionID = (buffer[1] >> 3) & 0x03;
-                int layer = (buffer[1] >> 1) & 0x03;
-                int samplesPerFrame = GetSamplesPerFrame(versionID, layer);
+            const uint8_t* header = file.Get(frame, 4);
+            int bitrate = GetBitrate(header);
+            sampleRate = GetSampleRate(header);
+            channels = GetChannelMode(header);
+            if (bitrate == 0 || sampleRate == 0) return false;
 
-                // t[擪ۑ
-                frameStartPos = file.tellg();
-                file.seekg(-4, std::ios::cur);
+            int versionID = (header[1] >> 3) & 0x03;
+            int layer = (header[1] >> 1) & 0x03;
+            int samplesPerFrame = GetSamplesPerFrame(versionID, layer);
+            const uint64_t frameStartPos = frame + 4;      // t[wb_[̒.
 
-                // Xing or Info
-                int xingOffset = (channels == 1) ? 21 : 36;
-                file.seekg(xingOffset, std::ios::cur);
-                char xing[4];
-                file.read(xing, 4);
+            // Xing or Info
+            int xingOffset = (channels == 1) ? 21 : 36;
+            if (const uint8_t* xing = file.Get(frame + xingOffset, 12)) {
                 if (std::memcmp(xing, "Xing", 4) == 0 || std::memcmp(xing, "Info", 4) == 0) {
-                    uint32_t flags = ReadBigEndianUInt32(file);
+                    uint32_t flags = ReadBigEndianUInt32(xing + 4);
                     if (flags & 0x0001) {
-                        uint32_t frames = ReadBigEndianUInt32(file);
-                        duration = static_cast<double>(frames * samplesPerFrame) / sampleRate;
+                        uint32_t frames = ReadBigEndianUInt32(xing + 8);
+                        duration = static_cast<double>(static_cast<uint64_t>(frames) * samplesPerFrame) / sampleRate;
                         return true;
                     }
                 }
+            }
 
-                // VBRI (Xinǧ݊)
-                file.seekg(frameStartPos + std::streamoff(32), std::ios::beg);
-                char vbri[4];
-                file.read(vbri, 4);
-                if (std::memcmp(vbri, "VBRI", 4) == 0) {
-                    file.seekg(6, std::ios::cur); // skip version/delay
-                    uint32_t frames = ReadBigEndianUInt32(file);
-                    duration = static_cast<double>(frames * samplesPerFrame) / sampleRate;
-                    return true;
-                }
-
-                // --- CBR fallback ---
-                file.seekg(0, std::ios::end);
-                std::streampos fileSize = file.tellg();
-                std::streampos audioSize = fileSize - frameStartPos;
-                duration = static_cast<double>(audioSize * 8) / (bitrate * 1000);
+            // VBRI (Xinǧ݊). ID, version, delay, quality, bytes ̌Ƀt[.
+            if (const uint8_t* vbri = file.Get(frameStartPos + 32, 18); vbri && std::memcmp(vbri, "VBRI", 4) == 0) {
+                uint32_t frames = ReadBigEndianUInt32(vbri + 14);
+                duration = static_cast<double>(static_cast<uint64_t>(frames) * samplesPerFrame) / sampleRate;
                 return true;
             }
 
-            return false;
+            // --- CBR fallback ---
+            const uint64_t audioSize = file.GetFileSize() - frameStartPos;
+            duration = static_cast<double>(audioSize * 8) / (bitrate * 1000);
+            return true;
         }
 
     private:
-        static bool IsFrameHeader(uint8_t* h) {
-            return (h[0] == 0xFF) && ((h[1] & 0xE0) == 0xE0);
+        // [hɉė\l (o[WEC[Erbg[gETv[g) e.
+        static bool IsFrameHeader(const uint8_t* h) {
+            if (h[0] != 0xFF || (h[1] & 0xE0) != 0xE0) return false;
+            if (((h[1] >> 3) & 0x03) == 1) return false;
+            if (((h[1] >> 1) & 0x03) == 0) return false;
+            if (((h[2] >> 4) & 0x0F) == 0x0F) return false;
+            return ((h[2] >> 2) & 0x03) != 3;
         }
 
-        static uint32_t ReadBigEndianUInt32(std::ifstream& f) {
-            uint8_t buf[4];
-            f.read(reinterpret_cast<char*>(buf), 4);
-            return (buf[0] << 24) | (buf[1] << 16) | (buf[2] << 8) | buf[3];
+        static uint32_t ReadBigEndianUInt32(const uint8_t* buf) {
+            return (static_cast<uint32_t>(buf[0]) << 24) | (buf[1] << 16) | (buf[2] << 8) | buf[3];
         }
 
-        static int GetBitrate(uint8_t* h) {
+        static int GetBitrate(const uint8_t* h) {
             static const int bitrates[2][16] = {
                 {0,32,40,48,56,64,80,96,112,128,160,192,224,256,320,0}, // MPEG1
                 {0,8,16,24,32,40,48,56,64,80,96,112,128,144,160,0}      // MPEG2/2.5
@@ -115,7 +202,7 @@ namespace System {
             return bitrates[row][bitrateIndex];
         }
 
-        static int GetSampleRate(uint8_t* h) {
+        static int GetSampleRate(const uint8_t* h) {
             static const int sampleRates[4] = { 44100, 48000, 32000, 0 };
             int version = (h[1] >> 3) & 0x03;
             int index = (h[2] >> 2) & 0x03;
@@ -125,7 +212,7 @@ namespace System {
             return base;                             // MPEG1
         }
 
-        static int GetChannelMode(uint8_t* h) {
+        static int GetChannelMode(const uint8_t* h) {
             int mode = (h[3] >> 6) & 0x03;
             return (mode == 3) ? 1 : 2;
         }
@@ -144,18 +231,11 @@ namespace System {
     class WAVInfo {
     public:
         static bool Parse(const std::string& filepath, double& duration, int& channels, int& sampleRate) {
-            std::ifstream file(filepath, std::ios::binary);
-            if (!file) return false;
+            AudioScan::FileWindow file(filepath);
+            if (!file.IsOpen()) return false;
 
-            char chunkId[4];
-            uint32_t chunkSize;
-            char format[4];
-
-            file.read(chunkId, 4);
-            file.read(reinterpret_cast<char*>(&chunkSize), 4);
-            file.read(format, 4);
-
-            if (std::string(chunkId, 4) != "RIFF" || std::string(format, 4) != "WAVE") return false;
+            const uint8_t* riff = file.Get(0, 12);
+            if (!riff || std::memcmp(riff, "RIFF", 4) != 0 || std::memcmp(riff + 8, "WAVE", 4) != 0) return false;
 
             uint16_t bitsPerSample = 0;
             bool gotFmt = false;
@@ -164,31 +244,34 @@ namespace System {
             channels = 0;
             sampleRate = 0;
 
-            while (file.read(chunkId, 4)) {
-                uint32_t subchunkSize;
-                file.read(reinterpret_cast<char*>(&subchunkSize), 4);
-                std::streampos chunkStart = file.tellg();
-
-                std::string id(chunkId, 4);
-                if (id == "fmt ") {
-                    uint16_t audioFormat = 0;
-                    file.read(reinterpret_cast<char*>(&audioFormat), 2);
-                    file.read(reinterpret_cast<char*>(&channels), 2);
-                    file.read(reinterpret_cast<char*>(&sampleRate), 4);
-                    file.seekg(6, std::ios::cur);
-                    file.read(reinterpret_cast<char*>(&bitsPerSample), 2);
+            // `N̓E (data ̒g͓ǂ܂Ȃ).
+            uint64_t pos = 12;
+            while (const uint8_t* chunk = file.Get(pos, 8)) {
+                uint32_t subchunkSize = 0;
+                std::memcpy(&subchunkSize, chunk + 4, 4);
+
+                if (std::memcmp(chunk, "fmt ", 4) == 0) {
+                    const uint8_t* fmt = file.Get(pos + 8, 16);
+                    if (!fmt) return false;
+                    uint16_t audioFormat = 0, channelCount = 0;
+                    uint32_t rate = 0;
+                    std::memcpy(&audioFormat, fmt, 2);
+                    std::memcpy(&channelCount, fmt + 2, 2);
+                    std::memcpy(&rate, fmt + 4, 4);
+                    std::memcpy(&bitsPerSample, fmt + 14, 2);
+                    channels = channelCount;
+                    sampleRate = static_cast<int>(rate);
 
                     if (audioFormat != 1 && audioFormat != 3 && audioFormat != 0xFFFE) return false;
                     gotFmt = true;
                 }
-                else if (id == "data") {
+                else if (std::memcmp(chunk, "data", 4) == 0) {
                     dataSize = subchunkSize;
                     gotData = true;
                 }
+                if (gotFmt && gotData) break;
 
-                file.seekg(chunkStart + static_cast<std::streamoff>(subchunkSize));
-                if (subchunkSize % 2 == 1)
-                    file.seekg(1, std::ios::cur);
+                pos += 8 + static_cast<uint64_t>(subchunkSize) + (subchunkSize % 2);
             }
 
             if (!gotFmt || !gotData) return false;
@@ -207,58 +290,29 @@ namespace System {
     class OGGInfo {
     public:
         static bool Parse(const std::string& filepath, double& duration, int& channels, int& sampleRate) {
-            std::ifstream file(filepath, std::ios::binary);
-            if (!file) return false;
+            AudioScan::FileWindow file(filepath);
+            if (!file.IsOpen()) return false;
 
             // --- wb_[ǂݍ ---
             const size_t initialScanSize = 4096;
-            std::vector<uint8_t> buffer(initialScanSize);
-            file.read(reinterpret_cast<char*>(buffer.data()), buffer.size());
-
-
-            bool foundInfo = false;
-            for (size_t i = 0; i + 15 < buffer.size(); ++i) {
-                if (buffer[i] == 1 && std::memcmp(&buffer[i + 1], "vorbis", 6) == 0) {
-                    channels = buffer[i + 11];
-                    sampleRate = buffer[i + 12] |
-                        (buffer[i + 13] << 8) |
-                        (buffer[i + 14] << 16) |
-                        (buffer[i + 15] << 24);
-                    foundInfo = true;
-                    break;
-                }
-            }
-            if (!foundInfo) return false;
-
-            // --- t@CTCY擾 ---
-            file.clear();
-            file.seekg(0, std::ios::end);
-            std::streampos fileSizePos = file.tellg();
-            if (fileSizePos == -1) return false;
-
-            std::streamoff fileSize = static_cast<std::streamoff>(fileSizePos);
-            const std::streamoff chunkSize = 4096;
-            std::streamoff readSize = std::min(chunkSize, fileSize);
-            if (readSize <= 0) return false;
-
-            std::vector<char> tailBuffer(static_cast<size_t>(readSize));
-            file.seekg(fileSize - readSize, std::ios::beg);
-            file.read(tailBuffer.data(), static_cast<std::streamsize>(readSize));
+            size_t headSize = 0;
+            const uint8_t* head = file.GetAvailable(0, headSize);
+            if (!head) return false;
+            headSize = (std::min)(headSize, initialScanSize);
+
+            const size_t info = AudioScan::FindPattern(head, headSize, 0, "\x01vorbis", 7);
+            if (info + 16 > headSize) return false;
+            channels = head[info + 11];
+            sampleRate = head[info + 12] |
+                (head[info + 13] << 8) |
+                (head[info + 14] << 16) |
+                (head[info + 15] << 24);
 
             // --- granule position o ---
-            uint64_t lastGranulePos = 0;
-            for (size_t i = 0; i + 27 < tailBuffer.size(); ++i) {
-                if (std::memcmp(&tailBuffer[i], "OggS", 4) == 0) {
-                    uint64_t granulePos = 0;
-                    for (int j = 0; j < 8; ++j) {
-                        granulePos |= static_cast<uint64_t>(
-                            static_cast<uint8_t>(tailBuffer[i + 6 + j])) << (j * 8);
-                    }
-                    if (granulePos > lastGranulePos) {
-                        lastGranulePos = granulePos;
-                    }
-                }
-            }
+            const size_t readSize = static_cast<size_t>((std::min<uint64_t>)(4096, file.GetFileSize()));
+            const uint8_t* tail = file.Get(file.GetFileSize() - readSize, readSize);
+            if (!tail) return false;
+            uint64_t lastGranulePos = AudioScan::FindLastGranule(tail, readSize);
 
             // --- ĐԂ̌vZ ---
             if (sampleRate > 0 && lastGranulePos > 0)
@@ -273,48 +327,23 @@ namespace System {
     class OPUSInfo {
     public:
         static bool Parse(const std::string& filepath, double& duration, int& channels, int& sampleRate) {
-            std::ifstream file(filepath, std::ios::binary);
-            if (!file) return false;
-
-            std::vector<uint8_t> buffer(256);
-            file.read(reinterpret_cast<char*>(buffer.data()), buffer.size());
-
-            bool foundOpusHead = false;
-            for (size_t i = 0; i + 19 < buffer.size(); ++i) {
-                if (std::memcmp(&buffer[i], "OpusHead", 8) == 0) {
-                    channels = buffer[i + 9];
-                    sampleRate = 48000;
-                    foundOpusHead = true;
-                    break;
-                }
-            }
-            if (!foundOpusHead) return false;
-
-            file.clear();
-            file.seekg(0, std::ios::end);
-            std::streamoff fileSize = file.tellg();
-            if (fileSize <= 0) return false;
-
-            const std::streamoff chunkSize = 65536;
-            std::streamoff readSize = std::min(chunkSize, fileSize);
-
-            std::vector<char> tailBuffer(static_cast<size_t>(readSize));
-            file.seekg(fileSize - readSize, std::ios::beg);
-            file.read(tailBuffer.data(), static_cast<std::streamsize>(readSize));
-
-            uint64_t lastGranulePos = 0;
-            for (size_t i = 0; i + 27 < tailBuffer.size(); ++i) {
-                if (std::memcmp(&tailBuffer[i], "OggS", 4) == 0) {
-                    uint64_t granulePos = 0;
-                    for (int j = 0; j < 8; ++j) {
-                        granulePos |= static_cast<uint64_t>(
-                            static_cast<uint8_t>(tailBuffer[i + 6 + j])) << (j * 8);
-                    }
-                    if (granulePos > lastGranulePos) {
-                        lastGranulePos = granulePos;
-                    }
-                }
-            }
+            AudioScan::FileWindow file(filepath);
+            if (!file.IsOpen()) return false;
+
+            size_t headSize = 0;
+            const uint8_t* head = file.GetAvailable(0, headSize);
+            if (!head) return false;
+            headSize = (std::min)(headSize, static_cast<size_t>(256));
+
+            const size_t opusHead = AudioScan::FindPattern(head, headSize, 0, "OpusHead", 8);
+            if (opusHead + 20 > headSize) return false;
+            channels = head[opusHead + 9];
+            sampleRate = 48000;
+
+            const size_t readSize = static_cast<size_t>((std::min<uint64_t>)(65536, file.GetFileSize()));
+            const uint8_t* tail = file.Get(file.GetFileSize() - readSize, readSize);
+            if (!tail) return false;
+            uint64_t lastGranulePos = AudioScan::FindLastGranule(tail, readSize);
 
             duration = (sampleRate > 0 && lastGranulePos > 0)
                 ? static_cast<double>(lastGranulePos) / sampleRate
@@ -324,4 +353,115 @@ namespace System {
         }
     };
 
-}
\ No newline at end of file
+    // ͌ʂ̍ (1 t@C). 傫ƍXVȂ͂Ȃ.
+    class AudioInfoCache {
+    private:
+        static constexpr uint32_t Magic = 0x49445541;       // "AUDI"
+        static constexpr uint32_t Version = 1;
+
+        struct Entry {
+            uint64_t size = 0;
+            int64_t time = 0;
+            double duration = 0.0;
+            int32_t channels = 0;
+            int32_t sampleRate = 0;
+        };
+
+        std::string indexPath;
+        std::unordered_map<std::string, Entry> entries;
+        bool dirty = false;
+
+        AudioInfoCache() = default;
+
+        static bool GetStamp(const std::string& filepath, uint64_t& size, int64_t& time) {
+            std::error_code ec;
+            size = static_cast<uint64_t>(std::filesystem::file_size(filepath, ec));
+            if (ec) return false;
+            const auto writeTime = std::filesystem::last_write_time(filepath, ec);
+            if (ec) return false;
+            time = static_cast<int64_t>(writeTime.time_since_epoch().count());
+            return true;
+        }
+    public:
+        static AudioInfoCache& GetInstance() {
+            static AudioInfoCache instance;
+            return instance;
+        }
+
+        // t@Cǂ. EĂꍇ͋󂩂n߂.
+        void Open(const std::string& filepath) {
+            indexPath = filepath;
+            entries.clear();
+            dirty = false;
+            if (!IO::File::Exists(filepath)) return;
+
+            std::string bytes;
+            try {
+                bytes = IO::File::ReadAllBytes(filepath);
+            }
+            catch (...) {
+                return;
+            }
+            SnapshotReader in(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size());
+            if (in.Read<uint32_t>() != Magic || in.Read<uint32_t>() != Version) return;
+            const uint32_t count = in.Read<uint32_t>();
+            for (uint32_t i = 0; i < count && !in.IsFailed(); ++i) {
+                std::string path;
+                in.ReadString(path);
+                Entry entry = in.Read<Entry>();
+                if (!in.IsFailed()) entries[path] = entry;
+            }
+            if (in.IsFailed()) entries.clear();
+        }
+
+        // ύXΏo. t@C͂̕ŗƂ.
+        void Save() {
+            if (!dirty || indexPath.empty()) return;
+            std::vector<uint8_t> buffer;
+            SnapshotWriter out(buffer);
+            out.Write(Magic);
+            out.Write(Version);
+            const size_t countPos = buffer.size();
+            out.Write(static_cast<uint32_t>(0));
+            uint32_t count = 0;
+            for (const auto& [path, entry] : entries) {
+                if (!IO::File::Exists(path)) continue;
+                out.WriteString(path);
+                out.Write(entry);
+                ++count;
+            }
+            std::memcpy(buffer.data() + countPos, &count, sizeof(count));
+            try {
+                IO::File::WriteAllBytes(indexPath, std::string(buffer.begin(), buffer.end()));
+                dirty = false;
+            }
+            catch (...) {
+                // ȂΎ͂邾.
+            }
+        }
+
+        bool Find(const std::string& filepath, double& duration, int& channels, int& sampleRate) const {
+            auto it = entries.find(filepath);
+            if (it == entries.end()) return false;
+            uint64_t size = 0;
+            int64_t time = 0;
+            if (!GetStamp(filepath, size, time) || size != it->second.size || time != it->second.time) return false;
+            duration = it->second.duration;
+            channels = it->second.channels;
+            sampleRate = it->second.sampleRate;
+            return true;
+        }
+
+        void Store(const std::string& filepath, double duration, int channels, int sampleRate) {
+            Entry entry{ 0, 0, duration, channels, sampleRate };
+            if (!GetStamp(filepath, entry.size, entry.time)) return;
+            entries[filepath] = entry;
+            dirty = true;
+        }
+
+        void Clear() {
+            entries.clear();
+            dirty = true;
+        }
+    };
+}
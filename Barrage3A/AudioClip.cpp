@@ -32,25 +32,32 @@ namespace GameEngine {
         }
 
         std::string ext = GetFileExtension(filepath);
-        bool parsed = false;
-        if (ext == ".mp3") {
-            parsed = System::MP3Info::Parse(filepath, durationSeconds, channels, sampleRate);
-        }
-        else if (ext == ".wav") {
-            parsed = System::WAVInfo::Parse(filepath, durationSeconds, channels, sampleRate);
-        }
-        else if (ext == ".ogg") {
-            parsed = System::OGGInfo::Parse(filepath, durationSeconds, channels, sampleRate);
-        }
-        else if (ext == ".opus") {
-            parsed = System::OPUSInfo::Parse(filepath, durationSeconds, channels, sampleRate);
-        }
-        else {
-            Debug::ErrorLog("ΉĂȂ `ł : {}", ext);
-        }
-
+        auto& infoCache = System::AudioInfoCache::GetInstance();
+        // 傫EXVOƓȂ͂Ȃ.
+        bool parsed = infoCache.Find(filepath, durationSeconds, channels, sampleRate);
         if (!parsed) {
-            Debug::WarningLog("̉͂Ɏs܂ : {0:}", filepath);          
+            if (ext == ".mp3") {
+                parsed = System::MP3Info::Parse(filepath, durationSeconds, channels, sampleRate);
+            }
+            else if (ext == ".wav") {
+                parsed = System::WAVInfo::Parse(filepath, durationSeconds, channels, sampleRate);
+            }
+            else if (ext == ".ogg") {
+                parsed = System::OGGInfo::Parse(filepath, durationSeconds, channels, sampleRate);
+            }
+            else if (ext == ".opus") {
+                parsed = System::OPUSInfo::Parse(filepath, durationSeconds, channels, sampleRate);
+            }
+            else {
+                Debug::ErrorLog("ΉĂȂ `ł : {}", ext);
+            }
+
+            if (!parsed) {
+                Debug::WarningLog("̉͂Ɏs܂ : {0:}", filepath);          
+            }
+            else {
+                infoCache.Store(filepath, durationSeconds, channels, sampleRate);
+            }
         }
         // ŏI.
         isLoaded = parsed;
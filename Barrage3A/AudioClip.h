@@ -31,6 +31,9 @@ namespace GameEngine {
         // ^Cg.
         std::string GetTitle() const;
 
+        // ǂݍ񂾃t@C̃pX.
+        const std::string& GetPath() const { return path; }
+
         // DxLib ̃TEhnh擾iĐɎgpj
         int GetSoundHandle() const;
 
@@ -0,0 +1,578 @@
+#include <DxLib.h>
+#include <emmintrin.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <sstream>
+
+#include "AudioMixer.h"
+#include "Debug.hpp"
+
+namespace GameEngine {
+
+    namespace {
+        constexpr float MaxPitch = 4.0f;
+        constexpr float MinPitch = 0.1f;
+        constexpr float LoadSmoothing = 0.05f;
+
+        uint8_t ToCategoryIndex(AudioCategory category) {
+            return static_cast<uint8_t>((std::min)(static_cast<size_t>(category), AudioMixer::CategoryCount - 1));
+        }
+
+        // dst += src * (gainL, gainR). count  float ̌ ().
+        void MixInto(float* dst, const float* src, size_t count, float gainL, float gainR) {
+            const __m128 gain = _mm_setr_ps(gainL, gainR, gainL, gainR);
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), gain)));
+            }
+            for (; i < count; i += 2) {
+                dst[i]     += src[i] * gainL;
+                dst[i + 1] += src[i + 1] * gainR;
+            }
+        }
+    }
+
+    // ---------------- CXbh ----------------
+
+    bool AudioMixer::Start(std::unique_ptr<IAudioOutput> device, bool threaded) {
+        Stop();
+        if (!device || !device->Open(SampleRate)) {
+            Debug::ErrorLog("AudioMixer: o͂J܂ł");
+            return false;
+        }
+        output = std::move(device);
+        voices.fill(Voice{});
+        // XbhOȂ̂Œږ߂Ă悢 (JnȎ̓L[ɐς܂Ȃ).
+        categoryGains.fill(1.0f);
+        masterGain = 1.0f;
+        renderedFrames = 0;
+        started = true;
+        if (threaded) {
+            running.store(true, std::memory_order_release);
+            thread = std::thread(&AudioMixer::ThreadLoop, this);
+        }
+        return true;
+    }
+
+    void AudioMixer::Stop() {
+        if (!started) return;
+        running.store(false, std::memory_order_release);
+        if (thread.joinable()) thread.join();
+        output->Close();
+        output.reset();
+        started = false;
+
+        // Xbh~܂̂Ŏc̃R}hƃ{CX͎̂ĂĂ悢.
+        Command command;
+        while (commands.TryPop(command)) {}
+        voices.fill(Voice{});
+        activeVoices = 0;
+        processedSerial = commandSerial;
+        retired.clear();
+    }
+
+    void AudioMixer::Update() {
+        if (!started) return;
+        output->Update();
+
+        const uint64_t processed = processedSerial.load(std::memory_order_acquire);
+        std::erase_if(retired, [processed](const RetiredBuffer& buffer) { return buffer.serial <= processed; });
+    }
+
+    void AudioMixer::Pump(int frames) {
+        if (!started || running.load(std::memory_order_acquire)) return;
+        while (frames > 0) {
+            const int count = (std::min)(frames, BlockFrames);
+            ProcessCommands();
+            RenderBlock(count);
+            output->Write(mixed.data(), count);
+            frames -= count;
+        }
+    }
+
+    bool AudioMixer::PushCommand(Command command) {
+        if (!started) return false;
+        command.serial = commandSerial + 1;
+        if (!commands.TryPush(command)) {
+            droppedCommands.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        ++commandSerial;
+        return true;
+    }
+
+    std::shared_ptr<const PcmBuffer> AudioMixer::LoadPcm(const std::string& filepath) {
+        if (auto it = pcmCache.find(filepath); it != pcmCache.end()) return it->second;
+        std::shared_ptr<const PcmBuffer> pcm = PcmDecoder::DecodeFile(filepath);
+        if (pcm) pcmCache.emplace(filepath, pcm);
+        return pcm;
+    }
+
+    void AudioMixer::UnloadPcm(const std::string& filepath) {
+        auto it = pcmCache.find(filepath);
+        if (it == pcmCache.end()) return;
+        const PcmBuffer* raw = it->second.get();
+        pcmCache.erase(it);
+
+        auto live = liveBuffers.find(raw);
+        if (live == liveBuffers.end()) return;
+        // 炵Ƃobt@̓~LT[̂mFĂ.
+        Command command;
+        command.type = Command::Type::ReleaseBuffer;
+        command.pcm = raw;
+        if (PushCommand(command)) {
+            retired.push_back({ std::move(live->second), commandSerial });
+            liveBuffers.erase(live);
+        }
+        else if (started) {
+            Debug::WarningLog("AudioMixer: R}hꂽ̂ŉ܂ [{}]", filepath);
+        }
+        else {
+            liveBuffers.erase(live);
+        }
+    }
+
+    void AudioMixer::UnloadAll() {
+        Command command;
+        command.type = Command::Type::StopAll;
+        if (started && !PushCommand(command)) {
+            Debug::WarningLog("AudioMixer: R}hꂽ̂ŉ܂");
+            return;
+        }
+        for (auto& [raw, pcm] : liveBuffers) retired.push_back({ std::move(pcm), commandSerial });
+        liveBuffers.clear();
+        pcmCache.clear();
+        if (!started) retired.clear();
+    }
+
+    AudioMixer::VoiceId AudioMixer::Play(const std::shared_ptr<const PcmBuffer>& pcm, AudioCategory category,
+        float volume, float pan, float pitch, bool loop) {
+        if (!pcm || pcm->GetFrameCount() == 0 || pcm->sampleRate <= 0) return InvalidVoice;
+
+        Command command;
+        command.type = Command::Type::Play;
+        command.voice = nextVoiceId;
+        command.pcm = pcm.get();
+        command.category = ToCategoryIndex(category);
+        command.value = Mathf::Clamp01(volume);
+        command.pan = Mathf::Clamp(pan, -1.0f, 1.0f);
+        command.pitch = Mathf::Clamp(pitch, MinPitch, MaxPitch);
+        command.loop = loop;
+        if (!PushCommand(command)) return InvalidVoice;
+
+        liveBuffers.try_emplace(pcm.get(), pcm);
+        if (++nextVoiceId == InvalidVoice) nextVoiceId = 1;
+        return command.voice;
+    }
+
+    void AudioMixer::StopVoice(VoiceId voice) {
+        Command command;
+        command.type = Command::Type::Stop;
+        command.voice = voice;
+        PushCommand(command);
+    }
+
+    void AudioMixer::SetVoiceVolume(VoiceId voice, float volume) {
+        Command command;
+        command.type = Command::Type::SetVolume;
+        command.voice = voice;
+        command.value = Mathf::Clamp01(volume);
+        PushCommand(command);
+    }
+
+    void AudioMixer::SetVoicePan(VoiceId voice, float pan) {
+        Command command;
+        command.type = Command::Type::SetPan;
+        command.voice = voice;
+        command.pan = Mathf::Clamp(pan, -1.0f, 1.0f);
+        PushCommand(command);
+    }
+
+    void AudioMixer::SetVoicePitch(VoiceId voice, float pitch) {
+        Command command;
+        command.type = Command::Type::SetPitch;
+        command.voice = voice;
+        command.pitch = Mathf::Clamp(pitch, MinPitch, MaxPitch);
+        PushCommand(command);
+    }
+
+    void AudioMixer::SetVoicePaused(VoiceId voice, bool paused) {
+        Command command;
+        command.type = Command::Type::SetPaused;
+        command.voice = voice;
+        command.value = paused ? 1.0f : 0.0f;
+        PushCommand(command);
+    }
+
+    void AudioMixer::SetVoiceLoop(VoiceId voice, bool loop) {
+        Command command;
+        command.type = Command::Type::SetLoop;
+        command.voice = voice;
+        command.loop = loop;
+        PushCommand(command);
+    }
+
+    void AudioMixer::SeekVoice(VoiceId voice, float seconds) {
+        Command command;
+        command.type = Command::Type::Seek;
+        command.voice = voice;
+        command.value = (std::max)(seconds, 0.0f);
+        PushCommand(command);
+    }
+
+    void AudioMixer::StopAllVoices() {
+        Command command;
+        command.type = Command::Type::StopAll;
+        PushCommand(command);
+    }
+
+    void AudioMixer::SetCategoryGain(AudioCategory category, float gain) {
+        Command command;
+        command.type = Command::Type::SetCategoryGain;
+        command.category = ToCategoryIndex(category);
+        command.value = Mathf::Clamp01(gain);
+        // OȂXbh܂Ȃ̂Œڏ.
+        if (!started) categoryGains[command.category] = command.value;
+        else PushCommand(command);
+    }
+
+    void AudioMixer::SetMasterGain(float gain) {
+        Command command;
+        command.type = Command::Type::SetMasterGain;
+        command.value = Mathf::Clamp01(gain);
+        if (!started) masterGain = command.value;
+        else PushCommand(command);
+    }
+
+    AudioMixer::Stats AudioMixer::GetStats() const {
+        Stats stats;
+        stats.renderedFrames = renderedFrames.load(std::memory_order_relaxed);
+        stats.droppedCommands = droppedCommands.load(std::memory_order_relaxed);
+        stats.stolenVoices = stolenVoices.load(std::memory_order_relaxed);
+        stats.underruns = output ? output->GetUnderrunCount() : 0;
+        stats.activeVoices = activeVoices.load(std::memory_order_relaxed);
+        stats.mixLoad = mixLoad.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    // ---------------- N ----------------
+
+    namespace {
+        std::vector<std::string> SplitArgs(const std::string& commandLine) {
+            std::istringstream iss(commandLine);
+            std::vector<std::string> args;
+            for (std::string arg; iss >> arg;) args.push_back(arg);
+            return args;
+        }
+
+        // -audiotest ̎菇 (1/60 bP). loop ̃{CX stopTick Ŏ~߂.
+        struct RegressionEvent {
+            int tick;
+            const char* clip;
+            AudioCategory category;
+            float volume, pan, pitch;
+            int stopTick;
+        };
+        constexpr int RegressionTicks = 120;
+        constexpr RegressionEvent RegressionScript[] = {
+            {  0, "enemy_shot",    AudioCategory::SE,  0.8f,  0.0f, 1.0f,  -1 },
+            { 10, "graze",         AudioCategory::SE,  0.6f, -0.8f, 1.5f,  -1 },   // Tv̌oH.
+            { 20, "enemy_damage",  AudioCategory::BGM, 0.5f,  0.8f, 0.75f, 90 },   // [v.
+            { 45, "enemy_destroy", AudioCategory::SE,  1.0f,  0.0f, 1.0f,  -1 },
+        };
+        constexpr int RegressionSeGainTick = 30;        // SE ̉ʂ𔼕.
+        constexpr int RegressionMasterGainTick = 60;    // }X^[ʂ 0.8 .
+        constexpr float RegressionTolerance = 1.5f / 32767.0f;  // 16bit ̊ۂ 1 i܂ŋ.
+    }
+
+    bool AudioMixer::StartFromCommandLine(const std::string& commandLine) {
+        for (const std::string& arg : SplitArgs(commandLine)) {
+            if (arg == "-mixer") return Start(std::make_unique<DxLibAudioOutput>(), true);
+        }
+        return false;
+    }
+
+    bool AudioMixer::RenderRegressionScript(const std::string& output) {
+        std::shared_ptr<const PcmBuffer> pcms[std::size(RegressionScript)];
+        for (size_t i = 0; i < std::size(RegressionScript); ++i) {
+            const auto clip = AudioResource::GetInstance().GetClip(RegressionScript[i].clip);
+            if (clip) pcms[i] = LoadPcm(*clip);
+            if (!pcms[i]) {
+                Debug::ErrorLog("AudioMixer: Ar̉܂ [{}]", RegressionScript[i].clip);
+                return false;
+            }
+        }
+        if (!Start(std::make_unique<WaveFileAudioOutput>(output), false)) return false;
+
+        VoiceId playing[std::size(RegressionScript)]{};
+        for (int tick = 0; tick < RegressionTicks; ++tick) {
+            for (size_t i = 0; i < std::size(RegressionScript); ++i) {
+                const RegressionEvent& e = RegressionScript[i];
+                if (e.tick == tick) playing[i] = Play(pcms[i], e.category, e.volume, e.pan, e.pitch, e.stopTick >= 0);
+                if (e.stopTick == tick) StopVoice(playing[i]);
+            }
+            if (tick == RegressionSeGainTick) SetCategoryGain(AudioCategory::SE, 0.5f);
+            if (tick == RegressionMasterGainTick) SetMasterGain(0.8f);
+            Pump(SampleRate / 60);
+        }
+        Stop();     //  WAV ̃wb_[m肷.
+        return true;
+    }
+
+    bool AudioMixer::RunRegressionFromCommandLine(const std::string& commandLine, bool& failed) {
+        const std::vector<std::string> args = SplitArgs(commandLine);
+        for (size_t i = 0; i < args.size(); ++i) {
+            if (args[i] != "-audiotest") continue;
+            //  '-' Ŏn܂Ȃ̂lƂĎ (-audiotest -mixer ̂悤ȕтɑΉ).
+            const auto isValue = [&](size_t j) { return j < args.size() && !args[j].empty() && args[j][0] != '-'; };
+            const std::string output = isValue(i + 1) ? args[i + 1] : "audiotest.wav";
+            const std::string reference = isValue(i + 1) && isValue(i + 2) ? args[i + 2] : "";
+
+            failed = !RenderRegressionScript(output);
+            if (failed || reference.empty()) {
+                if (!failed) Debug::Log("AudioMixer: Ar̉o܂ [{}]", output);
+                return true;
+            }
+
+            const auto rendered = PcmDecoder::DecodeFile(output);
+            const auto expected = PcmDecoder::DecodeFile(reference);
+            if (!rendered || !expected) {
+                failed = true;
+                return true;
+            }
+            float maxDiff = 0.0f;
+            const bool sameFormat = rendered->sampleRate == expected->sampleRate &&
+                rendered->channels == expected->channels && rendered->samples.size() == expected->samples.size();
+            if (sameFormat) {
+                for (size_t s = 0; s < rendered->samples.size(); ++s) {
+                    maxDiff = (std::max)(maxDiff, std::fabs(rendered->samples[s] - expected->samples[s]));
+                }
+            }
+            failed = !sameFormat || maxDiff > RegressionTolerance;
+            if (failed) {
+                Debug::ErrorLog("AudioMixer: Arv܂ [{}] `v {} / ő卷 {}", reference, sameFormat, maxDiff);
+            }
+            else {
+                Debug::Log("AudioMixer: Ar͈v܂ [{}] ő卷 {}", reference, maxDiff);
+            }
+            return true;
+        }
+        return false;
+    }
+
+    // ---------------- ~LT[̃Xbh ----------------
+
+    void AudioMixer::ThreadLoop() {
+        while (running.load(std::memory_order_acquire)) {
+            if (output->GetWritableFrames() < BlockFrames) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                continue;
+            }
+            ProcessCommands();
+            RenderBlock(BlockFrames);
+            output->Write(mixed.data(), BlockFrames);
+        }
+    }
+
+    AudioMixer::Voice* AudioMixer::FindVoice(VoiceId id) {
+        for (Voice& voice : voices) {
+            if (voice.pcm && voice.id == id) return &voice;
+        }
+        return nullptr;
+    }
+
+    void AudioMixer::ProcessCommands() {
+        Command command;
+        uint64_t last = 0;
+        while (commands.TryPop(command)) {
+            last = command.serial;
+            switch (command.type) {
+            case Command::Type::Play:
+                StartVoice(command);
+                break;
+            case Command::Type::Stop:
+                if (Voice* voice = FindVoice(command.voice)) *voice = Voice{};
+                break;
+            case Command::Type::SetVolume:
+                if (Voice* voice = FindVoice(command.voice)) voice->volume = command.value;
+                break;
+            case Command::Type::SetPan:
+                if (Voice* voice = FindVoice(command.voice)) voice->pan = command.pan;
+                break;
+            case Command::Type::SetPitch:
+                if (Voice* voice = FindVoice(command.voice)) {
+                    voice->pitch = command.pitch;
+                    voice->step = static_cast<double>(voice->pcm->sampleRate) / SampleRate * voice->pitch;
+                }
+                break;
+            case Command::Type::SetPaused:
+                if (Voice* voice = FindVoice(command.voice)) voice->paused = command.value != 0.0f;
+                break;
+            case Command::Type::SetLoop:
+                if (Voice* voice = FindVoice(command.voice)) voice->loop = command.loop;
+                break;
+            case Command::Type::Seek:
+                if (Voice* voice = FindVoice(command.voice)) {
+                    const double frame = static_cast<double>(command.value) * voice->pcm->sampleRate;
+                    voice->position = (std::min)(frame, static_cast<double>(voice->pcm->GetFrameCount()));
+                }
+                break;
+            case Command::Type::SetCategoryGain:
+                categoryGains[command.category] = command.value;
+                break;
+            case Command::Type::SetMasterGain:
+                masterGain = command.value;
+                break;
+            case Command::Type::StopAll:
+                voices.fill(Voice{});
+                break;
+            case Command::Type::ReleaseBuffer:
+                for (Voice& voice : voices) {
+                    if (voice.pcm == command.pcm) voice = Voice{};
+                }
+                break;
+            }
+        }
+        if (last != 0) processedSerial.store(last, std::memory_order_release);
+    }
+
+    void AudioMixer::StartVoice(const Command& command) {
+        Voice* target = nullptr;
+        for (Voice& voice : voices) {
+            if (!voice.pcm) { target = &voice; break; }
+        }
+        if (!target) {
+            // 󂫂ȂΈԌÂ{CX~߂. [v (BGM Ȃ) ͂Ȃׂc.
+            for (Voice& voice : voices) {
+                if (!target || (target->loop && !voice.loop) ||
+                    (target->loop == voice.loop && voice.id < target->id)) {
+                    target = &voice;
+                }
+            }
+            stolenVoices.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        Voice& voice = *target;
+        voice = Voice{};
+        voice.id = command.voice;
+        voice.pcm = command.pcm;
+        voice.pitch = command.pitch;
+        voice.step = static_cast<double>(command.pcm->sampleRate) / SampleRate * command.pitch;
+        voice.volume = command.value;
+        voice.pan = command.pan;
+        voice.category = command.category;
+        voice.loop = command.loop;
+    }
+
+    // scratch  2ch  frames . t[Ԃ (I[ɒB frames 菭Ȃ).
+    int AudioMixer::ResampleVoice(Voice& voice, int frames) {
+        const PcmBuffer& pcm = *voice.pcm;
+        const float* src = pcm.samples.data();
+        const size_t total = pcm.GetFrameCount();
+        const bool mono = pcm.channels == 1;
+        float* dst = scratch.data();
+        int produced = 0;
+
+        // Tv[gňʒuȂ炻̂܂܎ʂ.
+        if (voice.step == 1.0 && voice.position == std::floor(voice.position)) {
+            size_t pos = static_cast<size_t>(voice.position);
+            while (produced < frames) {
+                if (pos >= total) {
+                    if (!voice.loop) break;
+                    pos = 0;
+                }
+                const size_t count = (std::min)(static_cast<size_t>(frames - produced), total - pos);
+                float* out = dst + produced * 2;
+                if (mono) {
+                    for (size_t i = 0; i < count; ++i) out[i * 2] = out[i * 2 + 1] = src[pos + i];
+                }
+                else {
+                    std::memcpy(out, src + pos * 2, count * 2 * sizeof(float));
+                }
+                produced += static_cast<int>(count);
+                pos += count;
+            }
+            voice.position = static_cast<double>(pos);
+            return produced;
+        }
+
+        // `ԂŃTv.
+        double pos = voice.position;
+        for (; produced < frames; ++produced) {
+            if (pos >= total) {
+                if (!voice.loop) break;
+                pos = std::fmod(pos, static_cast<double>(total));
+            }
+            const size_t i0 = static_cast<size_t>(pos);
+            size_t i1 = i0 + 1;
+            if (i1 >= total) i1 = voice.loop ? 0 : i0;
+            const float t = static_cast<float>(pos - i0);
+            if (mono) {
+                const float v = src[i0] + (src[i1] - src[i0]) * t;
+                dst[produced * 2] = dst[produced * 2 + 1] = v;
+            }
+            else {
+                dst[produced * 2]     = src[i0 * 2] + (src[i1 * 2] - src[i0 * 2]) * t;
+                dst[produced * 2 + 1] = src[i0 * 2 + 1] + (src[i1 * 2 + 1] - src[i0 * 2 + 1]) * t;
+            }
+            pos += voice.step;
+        }
+        voice.position = pos;
+        return produced;
+    }
+
+    void AudioMixer::RenderBlock(int frames) {
+        const auto begin = std::chrono::steady_clock::now();
+        const size_t count = static_cast<size_t>(frames) * 2;
+        for (auto& bus : buses) std::fill_n(bus.data(), count, 0.0f);
+
+        int active = 0;
+        for (Voice& voice : voices) {
+            if (!voice.pcm) continue;
+            if (voice.paused) {
+                ++active;
+                continue;
+            }
+            const int produced = ResampleVoice(voice, frames);
+            if (produced > 0) {
+                const float left  = voice.volume * (std::min)(1.0f, 1.0f - voice.pan);
+                const float right = voice.volume * (std::min)(1.0f, 1.0f + voice.pan);
+                MixInto(buses[voice.category].data(), scratch.data(), static_cast<size_t>(produced) * 2, left, right);
+            }
+            if (produced < frames) voice = Voice{};     // I.
+            else ++active;
+        }
+
+        // JeSƂ̉ʂ| 1 {ɂ܂Ƃ߂.
+        const __m128 g0 = _mm_set1_ps(categoryGains[0] * masterGain);
+        const __m128 g1 = _mm_set1_ps(categoryGains[1] * masterGain);
+        const __m128 g2 = _mm_set1_ps(categoryGains[2] * masterGain);
+        const __m128 lo = _mm_set1_ps(-1.0f);
+        const __m128 hi = _mm_set1_ps(1.0f);
+        const float* b0 = buses[0].data();
+        const float* b1 = buses[1].data();
+        const float* b2 = buses[2].data();
+        float* out = mixed.data();
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            __m128 v = _mm_mul_ps(_mm_load_ps(b0 + i), g0);
+            v = _mm_add_ps(v, _mm_mul_ps(_mm_load_ps(b1 + i), g1));
+            v = _mm_add_ps(v, _mm_mul_ps(_mm_load_ps(b2 + i), g2));
+            _mm_store_ps(out + i, _mm_min_ps(_mm_max_ps(v, lo), hi));
+        }
+        for (; i < count; ++i) {
+            const float v = (b0[i] * categoryGains[0] + b1[i] * categoryGains[1] + b2[i] * categoryGains[2]) * masterGain;
+            out[i] = (std::min)((std::max)(v, -1.0f), 1.0f);
+        }
+
+        activeVoices.store(active, std::memory_order_relaxed);
+        renderedFrames.fetch_add(static_cast<uint64_t>(frames), std::memory_order_relaxed);
+
+        const double spent = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        const float load = static_cast<float>(spent * SampleRate / frames);
+        const float previous = mixLoad.load(std::memory_order_relaxed);
+        mixLoad.store(previous + (load - previous) * LoadSmoothing, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,181 @@
+/*
+    AudioMixer.h
+
+    :class
+        - AudioMixer
+
+    쐬         : 2026/10/19
+    ŏIύX     : 2026/10/19
+*/
+#pragma once
+
+#include <array>
+#include <vector>
+#include <memory>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <unordered_map>
+#include <cstdint>
+
+#include "AudioResource.hpp"
+#include "AudioOutput.h"
+#include "PcmDecoder.h"
+#include "SpscQueue.hpp"
+
+namespace GameEngine {
+
+    /// <summary>
+    /// GWŎ\tgEFA~LT[.
+    /// PcmBuffer {CXƂɃTvăJeS (BGM / SE / VOICE) ̃oXɑ,
+    /// JeSʁE}X^[ʂ| IAudioOutput ɓn. ݂ SSE  256 t[P.
+    /// ׂ͂ăR}hƂăbNȂ̃L[ɐς, ~LT[̃XbhubN̓ł܂Ƃ߂Ĕf.
+    /// XbhgȂꍇ Pump ŌĂяoi߂ (wbhX̌vEArp).
+    /// </summary>
+    class AudioMixer {
+    public:
+        using VoiceId = uint32_t;
+        static constexpr VoiceId InvalidVoice = 0;
+
+        static constexpr int SampleRate = 44100;
+        static constexpr int BlockFrames = 256;
+        static constexpr int MaxVoices = 64;
+        static constexpr size_t CommandCapacity = 1024;
+        static constexpr size_t CategoryCount = 3;      // AudioCategory ̐.
+
+        struct Stats {
+            uint64_t renderedFrames = 0;
+            uint32_t droppedCommands = 0;   // L[tŎ̂Ă.
+            uint32_t stolenVoices = 0;      // {CX肸Ɏ~߂.
+            uint32_t underruns = 0;         // o͂r؂ꂽ.
+            int activeVoices = 0;
+            float mixLoad = 0.0f;           // ~bNXɂ / 炵 ().
+        };
+    private:
+        struct Command {
+            enum class Type : uint8_t { Play, Stop, SetVolume, SetPan, SetPitch, SetPaused, SetLoop, Seek, SetCategoryGain, SetMasterGain, StopAll, ReleaseBuffer };
+            Type type = Type::Stop;
+            uint8_t category = 0;
+            bool loop = false;
+            VoiceId voice = InvalidVoice;
+            const PcmBuffer* pcm = nullptr;
+            float value = 0.0f;
+            float pan = 0.0f;
+            float pitch = 1.0f;
+            uint64_t serial = 0;
+        };
+
+        // ~LT[̃XbhG.
+        struct Voice {
+            VoiceId id = InvalidVoice;
+            const PcmBuffer* pcm = nullptr;
+            double position = 0.0;          // f[^̃t[ʒu.
+            double step = 1.0;              // o 1 t[ɐiޗ (Tv[g ~ sb`).
+            float pitch = 1.0f;
+            float volume = 1.0f;
+            float pan = 0.0f;
+            uint8_t category = 0;
+            bool loop = false;
+            bool paused = false;            // ʒuۂ܂܎~߂Ă.
+        };
+
+        // ҂̃obt@. ~LT[̃Xbh serial ̃R}hIĂ悢.
+        struct RetiredBuffer {
+            std::shared_ptr<const PcmBuffer> pcm;
+            uint64_t serial;
+        };
+
+        std::unique_ptr<IAudioOutput> output;
+        std::thread thread;
+        std::atomic<bool> running{ false };
+        bool started = false;
+
+        // ---- CXbh.
+        System::SpscQueue<Command, CommandCapacity> commands;
+        uint64_t commandSerial = 0;
+        VoiceId nextVoiceId = 1;
+        std::unordered_map<std::string, std::shared_ptr<const PcmBuffer>> pcmCache;
+        std::unordered_map<const PcmBuffer*, std::shared_ptr<const PcmBuffer>> liveBuffers;  // Đɓn.
+        std::vector<RetiredBuffer> retired;
+
+        // ---- ~LT[̃Xbh.
+        std::array<Voice, MaxVoices> voices{};
+        std::array<float, CategoryCount> categoryGains{ 1.0f, 1.0f, 1.0f };
+        float masterGain = 1.0f;
+        alignas(16) std::array<std::array<float, BlockFrames * 2>, CategoryCount> buses{};
+        alignas(16) std::array<float, BlockFrames * 2> scratch{};
+        alignas(16) std::array<float, BlockFrames * 2> mixed{};
+
+        // ---- 猩.
+        std::atomic<uint64_t> processedSerial{ 0 };
+        std::atomic<uint64_t> renderedFrames{ 0 };
+        std::atomic<uint32_t> droppedCommands{ 0 };
+        std::atomic<uint32_t> stolenVoices{ 0 };
+        std::atomic<int> activeVoices{ 0 };
+        std::atomic<float> mixLoad{ 0.0f };
+
+        AudioMixer() = default;
+
+        bool PushCommand(Command command);
+        void ThreadLoop();
+        void ProcessCommands();
+        void StartVoice(const Command& command);
+        Voice* FindVoice(VoiceId id);
+        void RenderBlock(int frames);
+        int ResampleVoice(Voice& voice, int frames);
+    public:
+        AudioMixer(const AudioMixer&) = delete;
+        AudioMixer& operator=(const AudioMixer&) = delete;
+        ~AudioMixer() { Stop(); }
+
+        static AudioMixer& GetInstance() {
+            static AudioMixer instance;
+            return instance;
+        }
+
+        // o͂Jă~LT[𓮂. threaded  false Ȃ Pump Ői߂.
+        bool Start(std::unique_ptr<IAudioOutput> device, bool threaded = true);
+        void Stop();
+        bool IsStarted() const { return started; }
+
+        // CXbhŖt[. o͂̎󂯓nƎgIobt@̉.
+        void Update();
+        // XbhȂ frames ~bNXďo͂ɓn.
+        void Pump(int frames);
+
+        // pXƂ 1 xfR[hċL.
+        std::shared_ptr<const PcmBuffer> LoadPcm(const std::string& filepath);
+        std::shared_ptr<const PcmBuffer> LoadPcm(const AudioClip& clip) { return LoadPcm(clip.GetPath()); }
+        // Ă{CX~߂ĂLbVO.
+        void UnloadPcm(const std::string& filepath);
+        void UnloadAll();
+
+        // 点Ȃ (L[tEobt@) ꍇ InvalidVoice.
+        VoiceId Play(const std::shared_ptr<const PcmBuffer>& pcm, AudioCategory category,
+            float volume = 1.0f, float pan = 0.0f, float pitch = 1.0f, bool loop = false);
+        void StopVoice(VoiceId voice);
+        void SetVoiceVolume(VoiceId voice, float volume);
+        void SetVoicePan(VoiceId voice, float pan);
+        void SetVoicePitch(VoiceId voice, float pitch);
+        // ʒuۂ܂܎~߂ / 炷.
+        void SetVoicePaused(VoiceId voice, bool paused);
+        void SetVoiceLoop(VoiceId voice, bool loop);
+        // Đʒu (b) ς.
+        void SeekVoice(VoiceId voice, float seconds);
+        void StopAllVoices();
+
+        void SetCategoryGain(AudioCategory category, float gain);
+        void SetMasterGain(float gain);
+
+        Stats GetStats() const;
+
+        // N -mixer: DxLib ̃\tgTEhɏo͂ăXbhœ.  true.
+        bool StartFromCommandLine(const std::string& commandLine);
+        // N -audiotest <o.wav> [r.wav]: ܂菇̍ĐXbhȂ WAV ɏo,
+        // rΓ˂킹.  true. oȂEvȂꍇ failed  true ɂ.
+        bool RunRegressionFromCommandLine(const std::string& commandLine, bool& failed);
+    private:
+        // -audiotest ̎菇 output ɏo.
+        bool RenderRegressionScript(const std::string& output);
+    };
+}
@@ -0,0 +1,141 @@
+#include <DxLib.h>
+#include <algorithm>
+#include <cmath>
+
+#include "AudioOutput.h"
+#include "Debug.hpp"
+
+namespace GameEngine {
+
+    namespace {
+        constexpr int Channels = 2;
+        constexpr int UnpacedWritableFrames = 4096;
+
+        int16_t ToPcm16(float v) {
+            v = (std::min)((std::max)(v, -1.0f), 1.0f);
+            return static_cast<int16_t>(std::lrintf(v * 32767.0f));
+        }
+
+        void PutU16(std::ofstream& f, uint16_t v) { f.write(reinterpret_cast<const char*>(&v), 2); }
+        void PutU32(std::ofstream& f, uint32_t v) { f.write(reinterpret_cast<const char*>(&v), 4); }
+    }
+
+    // ---------------- NullAudioOutput ----------------
+
+    bool NullAudioOutput::Open(int rate) {
+        sampleRate = rate;
+        latencyFrames = rate / 20;          // 50ms ܂Ŏ󂯎.
+        writtenFrames = 0;
+        startTime = std::chrono::steady_clock::now();
+        return true;
+    }
+
+    int NullAudioOutput::GetWritableFrames() {
+        if (!realtime) return UnpacedWritableFrames;
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        const int64_t played = static_cast<int64_t>(elapsed * sampleRate);
+        const int64_t queued = static_cast<int64_t>(writtenFrames) - played;
+        return static_cast<int>((std::max<int64_t>)(0, latencyFrames - queued));
+    }
+
+    // ---------------- WaveFileAudioOutput ----------------
+
+    bool WaveFileAudioOutput::Open(int rate) {
+        Close();
+        file.open(path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            Debug::ErrorLog("WaveFileAudioOutput: ߂܂ [{}]", path);
+            return false;
+        }
+        sampleRate = rate;
+        dataBytes = 0;
+        pacing.Open(rate);
+        WriteHeader();
+        return true;
+    }
+
+    void WaveFileAudioOutput::WriteHeader() {
+        const uint16_t blockAlign = Channels * sizeof(int16_t);
+        file.write("RIFF", 4);
+        PutU32(file, 36 + dataBytes);
+        file.write("WAVEfmt ", 8);
+        PutU32(file, 16);
+        PutU16(file, 1);
+        PutU16(file, Channels);
+        PutU32(file, static_cast<uint32_t>(sampleRate));
+        PutU32(file, static_cast<uint32_t>(sampleRate) * blockAlign);
+        PutU16(file, blockAlign);
+        PutU16(file, 16);
+        file.write("data", 4);
+        PutU32(file, dataBytes);
+    }
+
+    void WaveFileAudioOutput::Close() {
+        if (!file.is_open()) return;
+        // f[^̒܂̂Ńwb_[.
+        file.seekp(0);
+        WriteHeader();
+        file.close();
+    }
+
+    void WaveFileAudioOutput::Write(const float* interleaved, int frames) {
+        pacing.Write(interleaved, frames);
+        if (!file.is_open()) return;
+        buffer.resize(static_cast<size_t>(frames) * Channels);
+        for (size_t i = 0; i < buffer.size(); ++i) buffer[i] = ToPcm16(interleaved[i]);
+        file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size() * sizeof(int16_t));
+        dataBytes += static_cast<uint32_t>(buffer.size() * sizeof(int16_t));
+    }
+
+    // ---------------- DxLibAudioOutput ----------------
+
+    bool DxLibAudioOutput::Open(int rate) {
+        Close();
+        handle = MakeSoftSoundPlayerCustom(Channels, 16, rate);
+        if (handle == -1) {
+            Debug::ErrorLog("DxLibAudioOutput: \tgTEhvC[܂ ({}Hz)", rate);
+            return false;
+        }
+        staging.resize(RingFrames);
+        started = false;
+        return true;
+    }
+
+    void DxLibAudioOutput::Close() {
+        if (handle == -1) return;
+        StopSoftSoundPlayer(handle);
+        DeleteSoftSoundPlayer(handle);
+        handle = -1;
+        started = false;
+    }
+
+    void DxLibAudioOutput::Write(const float* interleaved, int frames) {
+        Frame block[256];
+        while (frames > 0) {
+            const int count = (std::min)(frames, 256);
+            for (int i = 0; i < count; ++i) {
+                block[i] = { ToPcm16(interleaved[i * 2]), ToPcm16(interleaved[i * 2 + 1]) };
+            }
+            ring.Push(block, count);
+            interleaved += count * Channels;
+            frames -= count;
+        }
+    }
+
+    void DxLibAudioOutput::Update() {
+        if (handle == -1) return;
+        if (started && CheckSoftSoundPlayerNoneData(handle) == TRUE) underruns.fetch_add(1, std::memory_order_relaxed);
+
+        int stock = GetStockDataLengthSoftSoundPlayer(handle);
+        while (stock < stockFrames) {
+            const size_t count = ring.Pop(staging.data(), static_cast<size_t>(stockFrames - stock));
+            if (count == 0) break;
+            AddDirectDataSoftSoundPlayer(handle, staging.data(), static_cast<int>(count));
+            stock += static_cast<int>(count);
+        }
+        if (!started && stock > 0) {
+            StartSoftSoundPlayer(handle);
+            started = true;
+        }
+    }
+}
@@ -0,0 +1,108 @@
+/*
+    AudioOutput.h
+
+    :class
+        - IAudioOutput
+        - NullAudioOutput
+        - WaveFileAudioOutput
+        - DxLibAudioOutput
+
+    쐬         : 2026/10/19
+    ŏIύX     : 2026/10/19
+*/
+#pragma once
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <chrono>
+#include <atomic>
+#include <cstdint>
+
+#include "SpscQueue.hpp"
+
+namespace GameEngine {
+
+    // AudioMixer ̏o͐. Open / Close / Update ̓CXbh, GetWritableFrames / Write ̓~LT[̃XbhĂ΂.
+    // nf[^ 2ch  float (-1 ~ 1).
+    class IAudioOutput {
+    public:
+        virtual ~IAudioOutput() = default;
+
+        virtual bool Open(int sampleRate) = 0;
+        virtual void Close() = 0;
+        // ł悢t[.
+        virtual int GetWritableFrames() = 0;
+        virtual void Write(const float* interleaved, int frames) = 0;
+        // CXbhŖt[.
+        virtual void Update() {}
+        // o͂r؂ꂽ.
+        virtual uint32_t GetUnderrunCount() const { return 0; }
+    };
+
+    // ̂Ă邾̏o. realtime ȂԂ̑ł󂯎Ȃ (ׂ̌vp).
+    class NullAudioOutput : public IAudioOutput {
+    private:
+        bool realtime;
+        int sampleRate = 0;
+        int latencyFrames = 0;
+        uint64_t writtenFrames = 0;
+        std::chrono::steady_clock::time_point startTime;
+    public:
+        explicit NullAudioOutput(bool realtime = false) : realtime(realtime) {}
+
+        bool Open(int rate) override;
+        void Close() override {}
+        int GetWritableFrames() override;
+        void Write(const float*, int frames) override { writtenFrames += frames; }
+
+        uint64_t GetWrittenFrames() const { return writtenFrames; }
+    };
+
+    // 16bit XeI WAV ɏo (wbhXłׁ̒EArp).
+    class WaveFileAudioOutput : public IAudioOutput {
+    private:
+        std::string path;
+        std::ofstream file;
+        NullAudioOutput pacing;             // realtime ̂Ƃ̎󂯎葬x.
+        int sampleRate = 0;
+        uint32_t dataBytes = 0;
+        std::vector<int16_t> buffer;
+
+        void WriteHeader();
+    public:
+        explicit WaveFileAudioOutput(std::string path, bool realtime = false)
+            : path(std::move(path)), pacing(realtime) {}
+        ~WaveFileAudioOutput() override { Close(); }
+
+        bool Open(int rate) override;
+        void Close() override;
+        int GetWritableFrames() override { return pacing.GetWritableFrames(); }
+        void Write(const float* interleaved, int frames) override;
+    };
+
+    // DxLib ̃\tgTEhvC[Ŗ炷.
+    // DxLib ̓XbhZ[tł͂Ȃ̂, ~LT[̃Xbh̓Oɐςނ DxLib ւ̎󂯓n Update ōs.
+    class DxLibAudioOutput : public IAudioOutput {
+    private:
+        struct Frame { int16_t left, right; };
+        static constexpr size_t RingFrames = 8192;
+
+        System::SpscQueue<Frame, RingFrames> ring;
+        std::vector<Frame> staging;
+        int handle = -1;
+        int stockFrames;                    // DxLib ɗ߂Ăt[.
+        bool started = false;
+        std::atomic<uint32_t> underruns{ 0 };
+    public:
+        explicit DxLibAudioOutput(int stockFrames = 2048) : stockFrames(stockFrames) {}
+        ~DxLibAudioOutput() override { Close(); }
+
+        bool Open(int rate) override;
+        void Close() override;
+        int GetWritableFrames() override { return static_cast<int>(ring.FreeSpace()); }
+        void Write(const float* interleaved, int frames) override;
+        void Update() override;
+        uint32_t GetUnderrunCount() const override { return underruns.load(std::memory_order_relaxed); }
+    };
+}
@@ -1,3 +1,4 @@
+#pragma once
 #include <unordered_map>
 #include <string>
 #include <memory>
@@ -6,6 +7,8 @@
 #include <iostream>
 #include <vector>
 #include "AudioClip.h"
+#include "AudioAnalyzer.hpp"
+#include "SEVoicePool.h"
 #include "Mathf.h"
 namespace GameEngine {
 
@@ -96,6 +99,8 @@ namespace GameEngine {
                     allSuccess = false;
                 }
             }
+            // V͂ɏ.
+            System::AudioInfoCache::GetInstance().Save();
             return allSuccess;
         }
 
@@ -110,6 +115,7 @@ namespace GameEngine {
                     }
                 }
             }
+            System::AudioInfoCache::GetInstance().Save();
             return allSuccess;
         }
 
@@ -118,6 +124,7 @@ namespace GameEngine {
         void UnloadGroup(const std::string& groupName) {
             for (auto it = clipMap.begin(); it != clipMap.end();) {
                 if (it->second.groupId == groupName) {
+                    SEVoicePool::GetInstance().Release(it->second.clip.get());
                     it = clipMap.erase(it);
                 }
                 else {
@@ -176,10 +183,15 @@ namespace GameEngine {
         }
 
         void Unload(const std::string& id) {
-            clipMap.erase(id);
+            auto it = clipMap.find(id);
+            if (it == clipMap.end()) return;
+            SEVoicePool::GetInstance().Release(it->second.clip.get());
+            clipMap.erase(it);
         }
 
         void Clear() {
+            // SE ̃{CXnhꏏɏ.
+            for (auto& [id, entry] : clipMap) SEVoicePool::GetInstance().Release(entry.clip.get());
             clipMap.clear();
             allEntries.clear();
         }
@@ -0,0 +1,838 @@
+#include "Project.h"
+#include "Vector.h"
+#include "GameEngine.h"
+#include "BenchmarkRunner.h"
+#include "GameObject.h"
+#include "GameObjectMgr.h"
+#include "Prefab.h"
+#include "Collider2D.h"
+#include "ColliderManager.h"
+#include "CollisionDispatcher.h"
+#include "BulletManager.h"
+#include "ShotScript.h"
+#include "ShotScriptManager.h"
+#include "EnemyScriptManager.h"
+#include "PatternCompiler.h"
+#include "PatternLibrary.h"
+#include "SEVoicePool.h"
+#include "AudioMixer.h"
+#include "AudioAnalyzer.hpp"
+#include "AudioResourceShortcut.hpp"
+#include "Texture2DManager.hpp"
+#include "JsonValue.hpp"
+#include "JsonDocument.h"
+#include "BuildUI.hpp"
+#include "Canvas.h"
+#include "GraphicRaycaster.h"
+#include "PathManager.h"
+#include "CsvReader.hpp"
+#include "Linq.hpp"
+#include "Metrics.h"
+#include "ParticleSystem.h"
+#include "JobSystem.hpp"
+#include "File.hpp"
+#include "Debug.hpp"
+#include "common.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+#include <thread>
+
+namespace {
+    double ElapsedNs(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    const char* ColumnName(size_t column) {
+        return column < Profiler::ZoneCount ? ProfileZoneNames[column] : "Scenario";
+    }
+
+    const JsonValue* FindMember(const JsonValue* value, const std::string& key) {
+        if (!value || !value->IsObject()) return nullptr;
+        const auto& obj = value->AsObject();
+        auto it = obj.find(key);
+        return it != obj.end() ? &it->second : nullptr;
+    }
+
+    // œKŏȂ悤Ɍʂސ.
+    volatile double sink = 0.0;
+
+    std::vector<std::string> ListFiles(const fs::path& directory) {
+        std::vector<std::string> paths;
+        std::error_code ec;
+        for (const auto& entry : fs::directory_iterator(directory, ec)) {
+            if (entry.is_regular_file()) paths.push_back(entry.path().string());
+        }
+        return paths;
+    }
+
+    // ---- ̃ViI ----------------------------------------------------
+
+    void SpawnColliders(size_t count) {
+        const Vector2D size = Window::GetInstance().GetMaxVector2D();
+        for (size_t i = 0; i < count; ++i) {
+            auto obj = GameObject::Instantiate("BenchCollider",
+                Vector2D(Random.Range(0.0f, size.x), Random.Range(0.0f, size.y)));
+            // Main ŗLɂĂ PlayerBullet vs Enemy ̑gݍ킹Ŕ肳.
+            obj->SetLayer(i % 2 == 0 ? Layer::PlayerBullet : Layer::Enemy);
+            obj->AddAppBase<CircleCollider>()->SetRadius(4);
+            BenchmarkRunner::GetInstance().TrackObject(obj);
+        }
+    }
+
+    void AddCollisionScenario(CollisionCheckMode mode, const char* modeName, size_t count) {
+        auto previous = std::make_shared<CollisionCheckMode>();
+        BenchmarkRunner::Scenario scenario;
+        scenario.name = std::string("collision_") + modeName + "_" + std::to_string(count);
+        scenario.frames = 120;
+        scenario.keyZone = ProfileZone::CheckCollisions;
+        scenario.setup = [mode, count, previous]() {
+            *previous = CollisionManager::GetInstance().GetColliderCheckMode();
+            CollisionManager::GetInstance().SetColliderCheckMode(mode);
+            SpawnColliders(count);
+        };
+        scenario.teardown = [previous]() {
+            CollisionManager::GetInstance().SetColliderCheckMode(*previous);
+        };
+        BenchmarkRunner::GetInstance().AddScenario(std::move(scenario));
+    }
+
+    // `̍̔rp. e (]) ̉ɉ~Ɣ݂ɒuRC_[, ̎Ԃ̗݌v.
+    struct ColliderShapeBench {
+        std::vector<std::weak_ptr<GameObject>> roots;
+        std::vector<std::shared_ptr<Collider2D>> colliders;
+        std::vector<ColliderShape> shapes;
+        double perPairNs = 0.0;
+        double prebuiltNs = 0.0;
+        uint32_t frames = 0;
+    };
+
+    // ߂ɕ񂾊eRC_[ƌ Neighbors ̑g𔻒肷 (l؂̌̑).
+    constexpr size_t ShapeBenchNeighbors = 8;
+
+    // ȑO̕: }ƌ̎o GetBounds  2 , 育Ƃɗ̌`蒼.
+    void CollidePerPair(const std::vector<std::shared_ptr<Collider2D>>& colliders) {
+        size_t hits = 0;
+        for (const auto& c : colliders) {
+            hits += c->GetBounds().width > 0 ? 1 : 0;
+            hits += c->GetBounds().height > 0 ? 1 : 0;
+        }
+        for (size_t i = 0; i < colliders.size(); ++i) {
+            const size_t end = (std::min)(colliders.size(), i + 1 + ShapeBenchNeighbors);
+            for (size_t j = i + 1; j < end; ++j) {
+                if (CollisionDispatcher::CheckCollision(colliders[i], colliders[j])) ++hits;
+            }
+        }
+        sink = sink + static_cast<double>(hits);
+    }
+
+    // ̕: RC_[Ƃ 1 x`, ȍ~͔z񂾂ǂ.
+    void CollidePrebuilt(const std::vector<std::shared_ptr<Collider2D>>& colliders, std::vector<ColliderShape>& shapes) {
+        shapes.resize(colliders.size());
+        for (size_t i = 0; i < colliders.size(); ++i) colliders[i]->BuildShape(shapes[i]);
+        size_t hits = 0;
+        for (const auto& s : shapes) {
+            hits += s.bounds.width > 0 ? 1 : 0;
+            hits += s.bounds.height > 0 ? 1 : 0;
+        }
+        for (size_t i = 0; i < shapes.size(); ++i) {
+            const size_t end = (std::min)(shapes.size(), i + 1 + ShapeBenchNeighbors);
+            for (size_t j = i + 1; j < end; ++j) {
+                if (CollisionDispatcher::CheckCollision(shapes[i], shapes[j])) ++hits;
+            }
+        }
+        sink = sink + static_cast<double>(hits);
+    }
+
+    // [ depth ̐eq̍ count { (Transform2D ̂. 擪, depth ).
+    std::vector<std::shared_ptr<Transform2D>> BuildTransformChains(size_t count, size_t depth) {
+        std::vector<std::shared_ptr<Transform2D>> nodes;
+        nodes.reserve(count * depth);
+        for (size_t i = 0; i < count; ++i) {
+            auto node = std::make_shared<Transform2D>();
+            node->SetPosition(Vector2D(static_cast<float>(i), 0.0f));
+            nodes.push_back(node);
+            for (size_t d = 1; d < depth; ++d) {
+                auto child = std::make_shared<Transform2D>();
+                child->SetPosition(Vector2D(1.0f, 1.0f));
+                node->AddChild(child);
+                nodes.push_back(child);
+                node = child;
+            }
+        }
+        return nodes;
+    }
+
+    // Sm[h̃[hWǂ. moveRoots Ȃɍ𓮂 (q͑SčČvZɂȂ).
+    void ReadTransformChains(const std::vector<std::shared_ptr<Transform2D>>& nodes, size_t depth, bool moveRoots) {
+        if (moveRoots) {
+            for (size_t i = 0; i < nodes.size(); i += depth) nodes[i]->Translate(Vector2D(0.0f, 1.0f));
+        }
+        float total = 0.0f;
+        for (const auto& node : nodes) total += node->GetWorldPosition().x;
+        sink = sink + total;
+    }
+
+    // p[eBNVXe count  cores Xbh (ĂяoXbh + [J[) ōXV.
+    void AddParticleScalingScenario(size_t count, size_t cores) {
+        auto previousWorkers = std::make_shared<size_t>();
+        BenchmarkRunner::Scenario scenario;
+        scenario.name = "particles_" + std::to_string(count) + "_systems_" + std::to_string(cores) + "_cores";
+        scenario.frames = 240;
+        scenario.keyZone = ProfileZone::UpdateGameLogic;   // Particles ̓XbhƂ̍vȂ̂ŕǎv͂.
+        scenario.setup = [count, cores, previousWorkers]() {
+            *previousWorkers = System::JobSystem::GetInstance().GetWorkerCount();
+            System::JobSystem::GetInstance().SetWorkerCount(cores - 1);
+            const Vector2D size = Window::GetInstance().GetMaxVector2D();
+            for (size_t i = 0; i < count; ++i) {
+                auto obj = GameObject::Instantiate("BenchParticle",
+                    Vector2D(Random.Range(0.0f, size.x), Random.Range(0.0f, size.y)));
+                auto particle = obj->AddAppBase<ParticleSystem>();
+                ParticleSettings& settings = particle->GetParticleSettings();
+                settings.maxParticles = 200;
+                settings.emissionInterval = 0.01f;
+                BenchmarkRunner::GetInstance().TrackObject(obj);
+            }
+        };
+        scenario.report = [cores]() {
+            return "\"cores\": " + std::to_string(cores) +
+                ", \"particles\": " + std::to_string(Metrics::GetInstance().Get(Metric::Particles));
+        };
+        scenario.teardown = [previousWorkers]() {
+            System::JobSystem::GetInstance().SetWorkerCount(*previousWorkers);
+        };
+        BenchmarkRunner::GetInstance().AddScenario(std::move(scenario));
+    }
+
+    void AddShotScenario(const std::string& shotName, int emitters) {
+        auto scripts = std::make_shared<std::vector<ShotScript>>();
+        BenchmarkRunner::Scenario scenario;
+        scenario.name = "shot_" + shotName;
+        scenario.frames = 600;
+        scenario.keyZone = ProfileZone::UpdateGameLogic;
+        scenario.setup = [scripts, shotName, emitters]() {
+            const ShotProgram* program = ShotScriptManager::GetInstance().FindProgram(shotName);
+            scripts->assign(static_cast<size_t>(emitters), ShotScript());
+            for (auto& script : *scripts) script.Start(program);
+        };
+        scenario.update = [scripts]() {
+            const Vector2D size = Window::GetInstance().GetMaxVector2D();
+            const float stepX = size.x / static_cast<float>(scripts->size() + 1);
+            for (size_t i = 0; i < scripts->size(); ++i) {
+                auto& script = (*scripts)[i];
+                // I猂Ēeɕۂ.
+                if (script.IsFinished()) script.Start(ShotScriptManager::GetInstance().GetProgram(script.GetProgramId()));
+                script.Update(Vector2D(stepX * static_cast<float>(i + 1), size.y * 0.25f));
+            }
+        };
+        scenario.teardown = [scripts]() {
+            scripts->clear();
+            BulletManager::Instance().AllDestroyLayer(Layer::EnemyBullet);
+        };
+        BenchmarkRunner::GetInstance().AddScenario(std::move(scenario));
+    }
+}
+
+// ---- o^ --------------------------------------------------------------------
+
+void BenchmarkRunner::AddDefaultBenchmarks() {
+    // 蔻 (e[h ~ ).
+    // Beta_LinearQuadTree  CheckCollisions ŉȂ̂ŌvȂ.
+    // Layer_Vs_Layer ͑ (O(n^2)) Ȃ̂ 10000 ܂łɂ.
+    for (size_t count : { 1000u, 10000u, 50000u }) {
+        AddCollisionScenario(CollisionCheckMode::QuadTree, "quadtree", count);
+    }
+    for (size_t count : { 1000u, 10000u }) {
+        AddCollisionScenario(CollisionCheckMode::Layer_Vs_Layer, "layer", count);
+    }
+
+    // `RC_[Ƃ 1 x (t[ňȑO̕ƍ̕𗼕点Ĕׂ).
+    // 5000 ̃RC_[ 1000 ̐ẻɒu, t[e񂵂ă[hϊ蒼.
+    {
+        auto bench = std::make_shared<ColliderShapeBench>();
+        Scenario scenario;
+        scenario.name = "collider_shapes_per_pair_vs_prebuilt_5000";
+        scenario.keyZone = ProfileZone::CheckCollisions;
+        scenario.setup = [this, bench]() {
+            *bench = ColliderShapeBench{};
+            const Vector2D size = Window::GetInstance().GetMaxVector2D();
+            for (int i = 0; i < 1000; ++i) {
+                auto root = GameObject::Instantiate("BenchColliderRoot",
+                    Vector2D(size.x * static_cast<float>(i % 40) / 40.0f, size.y * static_cast<float>(i / 40) / 25.0f));
+                bench->roots.push_back(root);
+                TrackObject(root);
+                for (int k = 0; k < 5; ++k) {
+                    auto obj = GameObject::Instantiate("BenchCollider", Vector2D(static_cast<float>(k * 6), 0.0f));
+                    obj->transform->SetParent(root->transform, false);
+                    obj->SetLayer(k % 2 == 0 ? Layer::PlayerBullet : Layer::Enemy);
+                    if (k % 2 == 0) {
+                        auto circle = obj->AddAppBase<CircleCollider>();
+                        circle->SetRadius(4);
+                        bench->colliders.push_back(circle);
+                    }
+                    else {
+                        auto box = obj->AddAppBase<BoxCollider>();
+                        box->SetSize(Vector2D(6.0f, 10.0f));
+                        bench->colliders.push_back(box);
+                    }
+                    TrackObject(obj);
+                }
+            }
+        };
+        scenario.update = [bench]() {
+            for (auto& weak : bench->roots) {
+                if (auto root = weak.lock()) root->transform->Rotate(1.0f);
+            }
+            auto start = std::chrono::steady_clock::now();
+            CollidePerPair(bench->colliders);
+            bench->perPairNs += ElapsedNs(start);
+            // ȑO̕ōꂽLbVgȂ悤, x񂵂Ă瑪.
+            for (auto& weak : bench->roots) {
+                if (auto root = weak.lock()) root->transform->Rotate(1.0f);
+            }
+            start = std::chrono::steady_clock::now();
+            CollidePrebuilt(bench->colliders, bench->shapes);
+            bench->prebuiltNs += ElapsedNs(start);
+            ++bench->frames;
+        };
+        scenario.report = [bench]() {
+            const double frames = static_cast<double>((std::max)(bench->frames, 1u));
+            const double perPairMs = bench->perPairNs / frames / 1000000.0;
+            const double prebuiltMs = bench->prebuiltNs / frames / 1000000.0;
+            char text[160];
+            std::snprintf(text, sizeof(text), "\"perPairMs\": %.4f, \"prebuiltMs\": %.4f, \"speedup\": %.2f",
+                perPairMs, prebuiltMs, prebuiltMs > 0.0 ? perPairMs / prebuiltMs : 0.0);
+            return std::string(text);
+        };
+        scenario.teardown = [bench]() {
+            bench->colliders.clear();
+            bench->roots.clear();
+        };
+        AddScenario(std::move(scenario));
+    }
+    // GameObject ̐Ej̓ւ (t[O񕪂jč蒼).
+    {
+        Scenario scenario;
+        scenario.name = "gameobject_churn_1000";
+        scenario.update = [this]() {
+            DestroyTracked();
+            for (int i = 0; i < 1000; ++i) TrackObject(GameObject::Instantiate("BenchChurn"));
+        };
+        AddScenario(std::move(scenario));
+    }
+    // vnu̐.
+    {
+        Scenario scenario;
+        scenario.name = "prefab_instantiate_300";
+        scenario.update = [this]() {
+            DestroyTracked();
+            for (int i = 0; i < 300; ++i) {
+                for (auto& obj : PrefabMgr.Instantiate("Bullet_Base")) TrackObject(obj);
+            }
+        };
+        AddScenario(std::move(scenario));
+    }
+    // UI vnu̐ (V[Jڎ̃^CgEQ[ʂ̃LoX).
+    for (const char* file : { "title_ui_ux_data.json", "ui_data.json" }) {
+        const std::string path = (LoadFilePath / "Canvas" / file).string();
+        Scenario scenario;
+        scenario.name = std::string("ui_instantiate_") + file;
+        scenario.setup = [path]() { UiLayoutManager::GetInstance().Get(path); };
+        scenario.update = [this, path]() {
+            DestroyTracked();
+            if (auto layout = UiLayoutManager::GetInstance().Get(path)) {
+                for (auto& obj : CreateUI::InstantiateAll(*layout)) TrackObject(obj);
+            }
+        };
+        AddScenario(std::move(scenario));
+    }
+    // UI ̃LbV (Canvas / GraphicRaycaster) , ʂ̃[g̃IuWFNg̐EjŎ̂ĂȂ.
+    // Q[ʂ̃LoXu܂ܖt[ 200 蒼, qbgʂɏo.
+    {
+        const std::string path = (LoadFilePath / "Canvas" / "ui_data.json").string();
+        auto canvases = std::make_shared<std::vector<std::weak_ptr<Canvas>>>();
+        auto churn = std::make_shared<std::vector<std::weak_ptr<GameObject>>>();
+        Scenario scenario;
+        scenario.name = "ui_cache_with_churn_200";
+        scenario.setup = [this, path, canvases]() {
+            canvases->clear();
+            if (auto layout = UiLayoutManager::GetInstance().Get(path)) {
+                for (auto& obj : CreateUI::InstantiateAll(*layout)) {
+                    if (auto canvas = obj->GetAppBase<Canvas>()) canvases->push_back(canvas);
+                    TrackObject(obj);
+                }
+            }
+            Canvas::uiBasesCacheStats = {};
+            GraphicRaycaster::uiBasesCacheStats = {};
+            GraphicRaycaster::indexCacheStats = {};
+        };
+        scenario.update = [canvases, churn]() {
+            for (auto& weak : *churn) {
+                if (auto obj = weak.lock()) Object.DestroyGameObject(obj);
+            }
+            churn->clear();
+            for (int i = 0; i < 200; ++i) {
+                auto obj = GameObject::Instantiate("BenchChurn");
+                obj->SetActive(i % 2 == 0);
+                churn->push_back(obj);
+            }
+            // `悵Ȃ̂ Canvas::Draw ̑Ɉꗗ.
+            size_t total = 0;
+            for (auto& weak : *canvases) {
+                if (auto canvas = weak.lock()) total += canvas->GetUiBases().size();
+            }
+            sink = sink + static_cast<double>(total);
+        };
+        scenario.report = []() {
+            char text[192];
+            std::snprintf(text, sizeof(text),
+                "\"canvasListHitRate\": %.4f, \"raycasterListHitRate\": %.4f, \"raycasterIndexHitRate\": %.4f",
+                Canvas::uiBasesCacheStats.HitRate(),
+                GraphicRaycaster::uiBasesCacheStats.HitRate(),
+                GraphicRaycaster::indexCacheStats.HitRate());
+            return std::string(text);
+        };
+        scenario.teardown = [churn]() {
+            for (auto& weak : *churn) {
+                if (auto obj = weak.lock()) Object.DestroyGameObject(obj);
+            }
+            churn->clear();
+        };
+        AddScenario(std::move(scenario));
+    }
+    // GameObject ̐eq ([ 8 ̍ 500 {). t[, LateUpdate Ń[hϊXV.
+    {
+        auto roots = std::make_shared<std::vector<std::weak_ptr<GameObject>>>();
+        Scenario scenario;
+        scenario.name = "transform_hierarchy_500x8";
+        scenario.keyZone = ProfileZone::LateUpdate;
+        scenario.setup = [this, roots]() {
+            roots->clear();
+            const Vector2D size = Window::GetInstance().GetMaxVector2D();
+            for (int i = 0; i < 500; ++i) {
+                auto parent = GameObject::Instantiate("BenchTransform",
+                    Vector2D(Random.Range(0.0f, size.x), Random.Range(0.0f, size.y)));
+                roots->push_back(parent);
+                TrackObject(parent);
+                for (int d = 1; d < 8; ++d) {
+                    auto child = GameObject::Instantiate("BenchTransform", Vector2D(4.0f, 0.0f));
+                    child->transform->SetParent(parent->transform, false);
+                    TrackObject(child);
+                    parent = child;
+                }
+            }
+        };
+        scenario.update = [roots]() {
+            for (auto& weak : *roots) {
+                if (auto root = weak.lock()) root->transform->Rotate(1.0f);
+            }
+        };
+        AddScenario(std::move(scenario));
+    }
+    // p[eBN̐Ej (t[ 5 VXeĕoō, oI玩Ŕj).
+    {
+        Scenario scenario;
+        scenario.name = "particles_burst_churn_5";
+        scenario.keyZone = ProfileZone::UpdateGameLogic;
+        scenario.update = [this]() {
+            const Vector2D size = Window::GetInstance().GetMaxVector2D();
+            for (int i = 0; i < 5; ++i) {
+                auto obj = GameObject::Instantiate("BenchParticle",
+                    Vector2D(Random.Range(0.0f, size.x), Random.Range(0.0f, size.y)));
+                auto particle = obj->AddAppBase<ParticleSystem>();
+                ParticleSettings& settings = particle->GetParticleSettings();
+                settings.burstCount = 200;
+                settings.maxParticles = 200;
+                particle->SetEndDestroy(true);
+                TrackObject(obj);
+            }
+        };
+        AddScenario(std::move(scenario));
+    }
+    // p[eBNXṼRAɂXP[O (1, 2, 4, ... ƃn[hEFÃXbh).
+    {
+        const size_t hardwareThreads = (std::max)(std::thread::hardware_concurrency(), 1u);
+        for (size_t cores = 1; cores < hardwareThreads; cores *= 2) AddParticleScalingScenario(500, cores);
+        AddParticleScalingScenario(500, hardwareThreads);
+    }
+    // ۂ̒ep^[ (ShotScript ̉ + BulletScript t̒e̍XV).
+    AddShotScenario("elite_enemy_rotating_wave_36way", 8);
+    AddShotScenario("wave_rotating_7way", 16);
+
+    // ---- ǂݍ݁E ----
+    AddMeasure({ "json_parse_bullet_type_data", 50, []() {
+        static const std::string text = System::IO::File::ReadAllText(LoadBulletTypeDataJson.string());
+        JsonParser parser(text);
+        JsonValue root = parser.Parse();
+        sink = sink + (root.IsObject() ? static_cast<double>(root.AsObject().size()) : 0.0);
+    } });
+    AddMeasure({ "json_document_parse_bullet_type_data", 50, []() {
+        static const std::string text = System::IO::File::ReadAllText(LoadBulletTypeDataJson.string());
+        static JsonDocument document;   // A[ig񂵂Ƃ̑.
+        const JsonNode& root = document.Parse(std::string_view(text));
+        sink = sink + static_cast<double>(root.Size());
+    } });
+    AddMeasure({ "json_document_parse_enemy_move_path", 200, []() {
+        static const std::string text = System::IO::File::ReadAllText((LoadFilePath / "EnemyMovePath" / "path0.json").string());
+        JsonDocument document;
+        const JsonNode& root = document.Parse(std::string_view(text));
+        const JsonNode* points = root.Find("points");
+        sink = sink + (points ? static_cast<double>(points->Size()) : 0.0);
+    } });
+    AddMeasure({ "path_evaluate_1000_enemies", 1000, []() {
+        // oH 1000 ̂̈ʒu܂Ƃ߂ċ߂.
+        static const std::shared_ptr<Path2D> path = []() {
+            PathManager::GetInstance().AddJsonPath(-1, (LoadFilePath / "EnemyMovePath" / "path0.json").string());
+            return PathManager::GetInstance().GetPath(-1);
+        }();
+        static std::vector<float> ts = []() {
+            std::vector<float> v(1000);
+            for (size_t i = 0; i < v.size(); ++i) v[i] = static_cast<float>(i) / static_cast<float>(v.size());
+            return v;
+        }();
+        static std::vector<Vector2D> positions(ts.size());
+        if (!path) return;
+        path->GetPositionsAt(ts, positions);
+        sink = sink + positions.back().x;
+    } });
+    AddMeasure({ "json_parse_game_canvas", 50, []() {
+        static const std::string text = System::IO::File::ReadAllText((LoadFilePath / "Canvas" / "ui_data.json").string());
+        JsonParser parser(text);
+        JsonValue root = parser.Parse();
+        sink = sink + (root.IsObject() ? static_cast<double>(root.AsObject().size()) : 0.0);
+    } });
+    AddMeasure({ "ui_layout_load_game_canvas", 50, []() {
+        static const std::string text = System::IO::File::ReadAllText((LoadFilePath / "Canvas" / "ui_data.json").string());
+        auto layout = UiLayout::FromJson(std::string(text));
+        sink = sink + static_cast<double>(layout->GetNodes().size());
+    } });
+    AddMeasure({ "json_roundtrip_ui_game_canvas", 50, []() {
+        // UiJsonCommon.hpp ̌^ ToJson  FromJson.
+        static const UI ui = JsonUtility::FromJson<UI>(System::IO::File::ReadAllText((LoadFilePath / "Canvas" / "ui_data.json").string()));
+        static std::string buffer;
+        buffer.clear();
+        JsonUtility::ToJson(ui, buffer);
+        const UI back = JsonUtility::FromJson<UI>(buffer);
+        sink = sink + static_cast<double>(buffer.size() + back.elements.size());
+    } });
+    AddMeasure({ "enemy_script_start_1000", 100, []() {
+        // o 1000 Ԃ̖ߗ̈ĂƎsԂ̏.
+        static std::vector<EnemyScript> scripts(1000);
+        for (auto& script : scripts) script.Start(EnemyScriptManager::GetInstance().FindProgram("Enemy01"));
+        sink = sink + static_cast<double>(scripts.back().GetProgramId());
+    } });
+    AddMeasure({ "pattern_compile", 50, []() {
+        static const std::string text = System::IO::File::ReadAllText(LoadPatternScript.string());
+        const auto entries = PatternCompiler::Compile(text);
+        sink = sink + static_cast<double>(entries.size());
+    } });
+    AddMeasure({ "pattern_load_cached", 50, []() {
+        // 2 ڈȍ~ "<pat>.bin" ̓ǂݍ݂Ɠo^̍ւ.
+        sink = sink + (PatternLibrary::GetInstance().Load(LoadPatternScript.string()) ? 1.0 : 0.0);
+    } });
+    AddMeasure({ "se_voice_pool_burst_200", 100, []() {
+        // Ȓe 1 t[Ԃ PlaySE ( SE ʂɏdȂ).
+        static const std::shared_ptr<GameEngine::AudioClip> clips[] = {
+            GameEngine::Sounds["enemy_shot"], GameEngine::Sounds["enemy_bullet_change"], GameEngine::Sounds["graze"], GameEngine::Sounds["enemy_damage"],
+        };
+        auto& pool = GameEngine::SEVoicePool::GetInstance();
+        for (int i = 0; i < 200; ++i) pool.Play(clips[i % 4], 0.5f);
+        sink = sink + static_cast<double>(pool.GetActiveVoiceCount());
+    } });
+    AddMeasure({ "audio_analyze_se_parse", 100, []() {
+        static const std::vector<std::string> files = ListFiles(SE_FilePath);
+        double duration = 0.0;
+        int channels = 0, sampleRate = 0;
+        for (const std::string& file : files) System::WAVInfo::Parse(file, duration, channels, sampleRate);
+        sink = sink + duration;
+    } });
+    AddMeasure({ "audio_analyze_se_cached", 100, []() {
+        // N 2 ڈȍ~̌oH (đ傫ƍXVׂ邾).
+        static const std::vector<std::string> files = ListFiles(SE_FilePath);
+        double duration = 0.0;
+        int channels = 0, sampleRate = 0;
+        for (const std::string& file : files) System::AudioInfoCache::GetInstance().Find(file, duration, channels, sampleRate);
+        sink = sink + duration;
+    } });
+    AddMeasure({ "pcm_decode_se_wav", 50, []() {
+        static const std::string path = GameEngine::Sounds["enemy_damage"]->GetPath();
+        const auto pcm = GameEngine::PcmDecoder::DecodeFile(path);
+        sink = sink + (pcm ? static_cast<double>(pcm->GetFrameCount()) : 0.0);
+    } });
+    AddMeasure({ "audio_mixer_32_voices_100ms", 100, []() {
+        // XbhȂÊĂ邾̏o͂, ~bNX̂̂̎Ԃ𑪂.
+        auto& mixer = GameEngine::AudioMixer::GetInstance();
+        static const std::shared_ptr<const GameEngine::PcmBuffer> pcms[] = {
+            mixer.LoadPcm(*GameEngine::Sounds["enemy_shot"]), mixer.LoadPcm(*GameEngine::Sounds["graze"]),
+            mixer.LoadPcm(*GameEngine::Sounds["enemy_damage"]), mixer.LoadPcm(*GameEngine::Sounds["enemy_destroy"]),
+        };
+        // ŗグ~LT[͎~߂Ă (cƃQ[ SEEBGM ~LT[ɉ, ȂȂ).
+        const bool startedHere = !mixer.IsStarted();
+        if (startedHere) mixer.Start(std::make_unique<GameEngine::NullAudioOutput>(), false);
+        for (int i = 0; i < 32; ++i) {
+            // sb`U炵ăTv̌oHʂ.
+            mixer.Play(pcms[i % 4], i % 2 ? GameEngine::AudioCategory::SE : GameEngine::AudioCategory::BGM,
+                0.25f, (i % 5 - 2) * 0.5f, i % 3 ? 1.0f : 1.25f, true);
+        }
+        mixer.Pump(GameEngine::AudioMixer::SampleRate / 10);
+        mixer.StopAllVoices();
+        sink = sink + static_cast<double>(mixer.GetStats().renderedFrames);
+        if (startedHere) mixer.Stop();
+    } });
+    AddMeasure({ "csv_parse_enemy_spawn", 200, []() {
+        static const std::string text = System::IO::File::ReadAllText(LoadStage1CSV.string());
+        auto rows = System::IO::CsvReader::ParseCsvText(text);
+        sink = sink + static_cast<double>(rows.size());
+    } });
+    // [hϊ̎Q (1000 { x [ 8). static ͕ύXȂ̓ǂݎ̂, moving ͖񍪂𓮂.
+    AddMeasure({ "transform_world_read_static_1000x8", 200, []() {
+        static const auto nodes = BuildTransformChains(1000, 8);
+        ReadTransformChains(nodes, 8, false);
+    } });
+    AddMeasure({ "transform_world_read_moving_1000x8", 200, []() {
+        static const auto nodes = BuildTransformChains(1000, 8);
+        ReadTransformChains(nodes, 8, true);
+    } });
+    AddMeasure({ "texture_lookup", 10000, []() {
+        auto texture = Texture2DManager::GetInstance().GetTexture2D("Effects/Leaf", "Leaf01");
+        sink = sink + (texture ? 1.0 : 0.0);
+    } });
+    AddMeasure({ "linq_select_orderby_sum_10000", 100, []() {
+        static const std::vector<int> values = []() {
+            std::vector<int> v(10000);
+            for (int i = 0; i < static_cast<int>(v.size()); ++i) v[i] = (i * 7919) % 10007;
+            return v;
+        }();
+        auto sum = System::Linq::Linq<std::vector<int>>(values)
+            .Select([](int v) { return v % 1000; })
+            .OrderBy(std::less<int>())
+            .Sum();
+        sink = sink + static_cast<double>(sum);
+    } });
+}
+
+// ---- s --------------------------------------------------------------------
+
+bool BenchmarkRunner::StartFromCommandLine(const std::string& commandLine) {
+    std::istringstream iss(commandLine);
+    std::vector<std::string> args;
+    for (std::string arg; iss >> arg;) args.push_back(arg);
+
+    for (size_t i = 0; i < args.size(); ++i) {
+        if (args[i] != "-bench") continue;
+        //  '-' Ŏn܂Ȃ̂lƂĎ (-bench -trace ̂悤ȕтɑΉ).
+        const auto isValue = [&](size_t j) { return j < args.size() && !args[j].empty() && args[j][0] != '-'; };
+        const std::string output = isValue(i + 1) ? args[i + 1] : "benchmark.json";
+        const std::string baselineFile = isValue(i + 1) && isValue(i + 2) ? args[i + 2] : "";
+        AddDefaultBenchmarks();
+        return Start(output, baselineFile);
+    }
+    return false;
+}
+
+bool BenchmarkRunner::Start(const std::string& output, const std::string& baselineFile) {
+    if (running) return false;
+    outputPath = output;
+    baselinePath = baselineFile;
+    regressions = 0;
+    measureJson.clear();
+    scenarioJson.clear();
+    baseline.reset();
+
+    if (!baselinePath.empty()) {
+        try {
+            JsonParser parser(System::IO::File::ReadAllText(baselinePath));
+            baseline = std::make_shared<JsonValue>(parser.Parse());
+        }
+        catch (const std::exception& e) {
+            GameEngine::Debug::WarningLog("Benchmark baseline not loaded: {}", e.what());
+        }
+    }
+
+    // `Ƒҋ@Ȃ, 1 t[ŒXebvŐi߂.
+    Engine::Instance().SetHeadless(true);
+    Time.SetFixedStep(true);
+    Profiler::GetInstance().SetEnabled(true);
+    Metrics::SetAllocationTracking(true);
+
+    RunMeasures();
+
+    running = true;
+    current = 0;
+    if (scenarios.empty()) {
+        Finish();
+        return true;
+    }
+    BeginScenario();
+    return true;
+}
+
+void BenchmarkRunner::RunMeasures() {
+    char line[256];
+    for (const auto& measure : measures) {
+        double nsPerIter = -1.0;
+        try {
+            measure.body();     // 1  (̓ǂݍ݁Em) ͏.
+            const auto start = std::chrono::steady_clock::now();
+            for (uint32_t i = 0; i < measure.iterations; ++i) measure.body();
+            nsPerIter = ElapsedNs(start) / static_cast<double>(measure.iterations);
+        }
+        catch (const std::exception& e) {
+            GameEngine::Debug::WarningLog("Benchmark {} failed: {}", measure.name, e.what());
+        }
+
+        const double base = FindBaseline("measures", measure.name, nullptr, "nsPerIter");
+        const bool regression = nsPerIter >= 0.0 && base > 0.0 && nsPerIter > base * (1.0 + tolerance);
+        if (regression) ++regressions;
+
+        if (!measureJson.empty()) measureJson += ",\n";
+        std::snprintf(line, sizeof(line),
+            "    \"%s\": {\"iterations\": %u, \"nsPerIter\": %.1f, \"baseline\": %.1f, \"regression\": %s}",
+            measure.name.c_str(), measure.iterations, nsPerIter, base, regression ? "true" : "false");
+        measureJson += line;
+    }
+}
+
+void BenchmarkRunner::BeginScenario() {
+    frameInScenario = 0;
+    for (auto& column : samples) column.clear();
+    allocationSamples.clear();
+
+    Scenario& scenario = scenarios[current];
+    for (auto& column : samples) column.reserve(scenario.frames);
+    allocationSamples.reserve(scenario.frames);
+    if (scenario.warmupFrames == 0) Metrics::GetInstance().ResetSeries();
+    if (scenario.setup) scenario.setup();
+}
+
+void BenchmarkRunner::EndFrame() {
+    if (!running) return;
+    Scenario& scenario = scenarios[current];
+
+    // Õt[̌ʂL^ (EH[Abv͎̂Ă).
+    if (frameInScenario >= scenario.warmupFrames) {
+        const Profiler& profiler = Profiler::GetInstance();
+        for (size_t z = 0; z < Profiler::ZoneCount; ++z) {
+            samples[z].push_back(profiler.GetLastFrameMs(static_cast<ProfileZone>(z)));
+        }
+        samples[Profiler::ZoneCount].push_back(lastUpdateMs);
+        allocationSamples.push_back(static_cast<float>(Metrics::GetInstance().Get(Metric::Allocations)));
+    }
+    else if (frameInScenario + 1 == scenario.warmupFrames) {
+        Metrics::GetInstance().ResetSeries();   // vl̏Wṽ͎t[ (v) .
+    }
+
+    if (++frameInScenario >= scenario.warmupFrames + scenario.frames) {
+        FinishScenario();
+        if (++current >= scenarios.size()) {
+            Finish();
+            return;
+        }
+        BeginScenario();
+        return;
+    }
+
+    if (scenario.update) {
+        const auto start = std::chrono::steady_clock::now();
+        scenario.update();
+        lastUpdateMs = static_cast<float>(ElapsedNs(start) / 1000000.0);
+    }
+    else {
+        lastUpdateMs = 0.0f;
+    }
+}
+
+void BenchmarkRunner::FinishScenario() {
+    Scenario& scenario = scenarios[current];
+    const std::string extra = scenario.report ? scenario.report() : std::string();
+    if (scenario.teardown) scenario.teardown();
+    DestroyTracked();
+
+    char line[256];
+    if (!scenarioJson.empty()) scenarioJson += ",\n";
+    double allocations = 0.0;
+    for (float v : allocationSamples) allocations += v;
+    if (!allocationSamples.empty()) allocations /= static_cast<double>(allocationSamples.size());
+
+    std::snprintf(line, sizeof(line), "    \"%s\": {\"frames\": %u, \"keyZone\": \"%s\", \"allocationsPerFrame\": %.1f, \"zones\": {\n",
+        scenario.name.c_str(), scenario.frames, ProfileZoneNames[static_cast<size_t>(scenario.keyZone)], allocations);
+    scenarioJson += line;
+
+    ProfileZoneStats key;
+    for (size_t column = 0; column < ColumnCount; ++column) {
+        const ProfileZoneStats s = Profiler::ComputeStats(samples[column]);
+        if (column == static_cast<size_t>(scenario.keyZone)) key = s;
+        std::snprintf(line, sizeof(line),
+            "      \"%s\": {\"avg\": %.4f, \"p50\": %.4f, \"p95\": %.4f, \"p99\": %.4f, \"max\": %.4f}%s\n",
+            ColumnName(column), s.average, s.p50, s.p95, s.p99, s.max, column + 1 < ColumnCount ? "," : "");
+        scenarioJson += line;
+    }
+
+    // OlɈɂ p95 Ŕׂ.
+    const char* keyName = ProfileZoneNames[static_cast<size_t>(scenario.keyZone)];
+    const double base = FindBaseline("scenarios", scenario.name, keyName, "p95");
+    const bool regression = base > 0.0 && key.p95 > base * (1.0 + tolerance);
+    if (regression) {
+        ++regressions;
+        GameEngine::Debug::WarningLog("Benchmark regression: {} {} p95 {:.3f}ms (baseline {:.3f}ms)",
+            scenario.name, keyName, key.p95, base);
+    }
+    std::snprintf(line, sizeof(line), "    }, \"baseline\": %.4f, \"regression\": %s", base, regression ? "true" : "false");
+    scenarioJson += line;
+    if (!extra.empty()) scenarioJson += ", " + extra;
+    scenarioJson += ", \"metrics\": {";
+    const Metrics& metrics = Metrics::GetInstance();
+    const double frames = static_cast<double>((std::max<uint64_t>)(metrics.GetFrameCount(), 1));
+    for (size_t i = 0; i < Metrics::MetricCount; ++i) {
+        const Metrics::Series& s = metrics.GetSeries(static_cast<Metric>(i));
+        std::snprintf(line, sizeof(line), "%s\"%s\": {\"avg\": %.1f, \"max\": %lld}",
+            i > 0 ? ", " : "", MetricNames[i], s.sum / frames, static_cast<long long>(s.max));
+        scenarioJson += line;
+    }
+    scenarioJson += "}}";
+}
+
+void BenchmarkRunner::Finish() {
+    running = false;
+    Metrics::SetAllocationTracking(false);
+    Time.SetFixedStep(false);
+    Engine::Instance().SetHeadless(false);
+
+    char line[128];
+    std::string out;
+    out.reserve(measureJson.size() + scenarioJson.size() + 256);
+    std::snprintf(line, sizeof(line), "{\n  \"version\": 1,\n  \"tolerance\": %.3f,\n  \"regressions\": %d,\n  \"allocationHook\": %s,\n",
+        tolerance, regressions, Metrics::IsAllocationHookAvailable() ? "true" : "false");
+    out += line;
+    out += "  \"measures\": {\n" + measureJson + "\n  },\n";
+    out += "  \"scenarios\": {\n" + scenarioJson + "\n  }\n}\n";
+
+    try {
+        System::IO::File::WriteAllText(outputPath, out);
+    }
+    catch (const std::exception& e) {
+        GameEngine::Debug::ErrorLog("Benchmark output failed: {}", e.what());
+    }
+    GameEngine::Debug::Log("Benchmark finished: {} ({} regressions)", outputPath, regressions);
+
+    if (quitOnFinish) GameEngine::Application::GetInstanse().Quit();
+}
+
+// ---- ⏕ --------------------------------------------------------------------
+
+double BenchmarkRunner::FindBaseline(const char* group, const std::string& name, const char* zone, const char* key) const {
+    const JsonValue* entry = FindMember(FindMember(baseline.get(), group), name);
+    if (zone) entry = FindMember(FindMember(entry, "zones"), zone);
+    const JsonValue* value = FindMember(entry, key);
+    if (!value || !value->IsPrimitive()) return -1.0;
+    const auto* number = std::get_if<double>(&value->AsPrimitive());
+    return number ? *number : -1.0;
+}
+
+void BenchmarkRunner::DestroyTracked() {
+    for (auto& weak : spawned) {
+        if (auto obj = weak.lock()) Object.DestroyGameObject(obj);
+    }
+    spawned.clear();
+}
@@ -0,0 +1,111 @@
+/*
+    BenchmarkRunner.h
+
+    :class
+        - BenchmarkRunner
+
+    쐬         : 2026/10/19
+    ŏIύX     : 2026/10/19
+*/
+#pragma once
+
+#include <vector>
+#include <array>
+#include <memory>
+#include <string>
+#include <functional>
+#include <cstdint>
+
+#include "Profiler.h"
+
+class GameObject;
+struct JsonValue;
+
+/// <summary>
+/// Q[{̂ɑgݍ񂾐\v (N -bench Ŏs).
+/// `ȂwbhX, ViI (蔻EIuWFNg̐jEep^[) 
+/// ܂t[, Profiler ̋ԂƂ̃p[Z^CW߂.
+/// ǂݍ݁EȂǃt[ɏȂ͔񐔂̎Ԃ𑪂.
+/// ʂ JSON ŏo, Ǒ (x[XC) nƈڂɈt.
+/// </summary>
+class BenchmarkRunner {
+public:
+    // t[Pʂ̃ViI. setup / update / teardown ̓t[̏IɌĂ΂.
+    struct Scenario {
+        std::string name;
+        uint32_t warmupFrames = 30;
+        uint32_t frames = 240;
+        ProfileZone keyZone = ProfileZone::Frame;   // x[XCƔׂ.
+        std::function<void()> setup;
+        std::function<void()> update;               // t[ (vԂ "Scenario" ƂċL^).
+        std::function<void()> teardown;
+        std::function<std::string()> report;        // ʂɉ鍀 ("key": value, ...). teardown ̑OɌĂ.
+    };
+    // 1 ̌Ăяo̎Ԃ𑪂鏈.
+    struct Measure {
+        std::string name;
+        uint32_t iterations = 100;
+        std::function<void()> body;
+    };
+
+    // ԂƂ̗ + ViI update ̗.
+    static constexpr size_t ColumnCount = Profiler::ZoneCount + 1;
+private:
+    std::vector<Scenario> scenarios;
+    std::vector<Measure> measures;
+
+    bool running = false;
+    bool quitOnFinish = true;
+    size_t current = 0;
+    uint32_t frameInScenario = 0;
+    float lastUpdateMs = 0.0f;
+    std::array<std::vector<float>, ColumnCount> samples;
+    std::vector<float> allocationSamples;
+
+    std::string outputPath;
+    std::string baselinePath;
+    float tolerance = 0.10f;                // ̊𒴂ĒxȂ爫Ƃ݂Ȃ.
+    int regressions = 0;
+    std::string measureJson;
+    std::string scenarioJson;
+    std::shared_ptr<JsonValue> baseline;
+
+    // ViIIuWFNg (teardown Ŕj).
+    std::vector<std::weak_ptr<GameObject>> spawned;
+
+    BenchmarkRunner() = default;
+    ~BenchmarkRunner() = default;
+
+    void RunMeasures();
+    void BeginScenario();
+    void FinishScenario();
+    void Finish();
+    double FindBaseline(const char* group, const std::string& name, const char* zone, const char* key) const;
+public:
+    static BenchmarkRunner& GetInstance() {
+        static BenchmarkRunner instance;
+        return instance;
+    }
+
+    void AddScenario(Scenario scenario) { scenarios.push_back(std::move(scenario)); }
+    void AddMeasure(Measure measure) { measures.push_back(std::move(measure)); }
+    // GW̎vȏΏۂɂ̃ViIEvo^.
+    // e Script.h œo^ς݂ ShotScript ĝ, ̌ɌĂԂ.
+    void AddDefaultBenchmarks();
+
+    // vJn. ǂݍ݌nɑ, ViĨ͎t[珇ɉ.
+    bool Start(const std::string& output, const std::string& baselineFile = "");
+    // N "-bench [o.json] [x[XC.json]" Ί̌vJn.
+    bool StartFromCommandLine(const std::string& commandLine);
+    // Engine::Run ̃t[ (Profiler::EndFrame ̌) ŌĂ.
+    void EndFrame();
+
+    bool IsRunning() const { return running; }
+    int GetRegressionCount() const { return regressions; }
+    void SetTolerance(float rate) { tolerance = rate; }
+    void SetQuitOnFinish(bool quit) { quitOnFinish = quit; }
+
+    // ViIp. IuWFNg teardown ł܂Ƃ߂Ĕj.
+    void TrackObject(const std::shared_ptr<GameObject>& obj) { spawned.push_back(obj); }
+    void DestroyTracked();
+};
@@ -1,4 +1,5 @@
 #include "BombManager.h"
+#include "SnapshotStream.h"
 
 void BombManager::AddBombs(int value) {
     bombs += value;
@@ -61,4 +62,14 @@ bool BombManager::IsBom() const {
 
 void BombManager::ResetOnRespawn() {
     bombs = 3;
-}
\ No newline at end of file
+}
+
+void BombManager::SaveState(SnapshotWriter& out) const {
+    out.Write(bombs);
+    out.Write(bombFragments);
+}
+
+void BombManager::LoadState(SnapshotReader& in) {
+    in.Read(bombs);
+    in.Read(bombFragments);
+}
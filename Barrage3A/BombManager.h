@@ -1,5 +1,8 @@
 #pragma once
 
+class SnapshotWriter;
+class SnapshotReader;
+
 class BombManager {
 private:
     int bombs = 3;                 // ݕێ{
@@ -41,4 +44,8 @@ public:
     bool IsBom() const;
 
     void ResetOnRespawn();
+
+    // XibvVbg.
+    void SaveState(SnapshotWriter& out) const;
+    void LoadState(SnapshotReader& in);
 };
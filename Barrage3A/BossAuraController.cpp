@@ -26,7 +26,7 @@ void BossAuraController::Start() {
 
 void BossAuraController::Update() {
 
-	transform->position = GameWorldManager::GetInstance().ScreenToWorld(Input.GetMousePoint_F());
+	transform->SetPosition(GameWorldManager::GetInstance().ScreenToWorld(Input.GetMousePoint_F()));
 
 	if (!auraRenderer.lock()) return;
 
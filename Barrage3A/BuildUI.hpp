@@ -7,6 +7,7 @@
 #include "Vector.h"
 #include "Texture2DManager.hpp"
 #include "UiJsonCommon.hpp"
+#include "UiLayout.h"
 
 // Componentn.
 #include "RectTransform2D.h"
@@ -16,185 +17,111 @@
 #include "Button.h"
 #include "Text.h"
 
-struct TextData {
-    std::string text = "";
-    Color color{};
-    int fontSize = 0;
-
-    int alignment = 0;
-	int horizontalOverflow = 0;
-    int verticalOverflow = 0;
-    float lineSpacing = 0.0f;
-    int fontStyle = 0;
-
-    std::string systemFontName = "";
-
-	JSON(text, color, fontSize, alignment, horizontalOverflow, verticalOverflow, lineSpacing, fontStyle, systemFontName)
-};
-
-// C++  FontStyle enum `i
-enum class FontStyle : int {
-    Normal = 0,
-    Bold = 1,
-    Italic = 2,
-    BoldAndItalic = 3
-};
-
-struct ColorBlockData {
-    Color normalColor		= Color(0xFFFFFFFF);
-    Color highlightedColor	= Color(0xFFFFFFFF);
-    Color pressedColor		= Color(0xFFFFFFFF);
-    Color disabledColor		= Color(0xFFFFFFFF);
-    float colorMultiplier = 0;
-    float fadeDuration = 0;
-	JSON(normalColor, highlightedColor, pressedColor, disabledColor, colorMultiplier, fadeDuration)
-};
-
-struct ButtonData {
-    bool interactable = 0;
-    Color color;
-    int transition = 0;
-    ColorBlockData colors;
-	JSON(interactable, color, transition, colors)
-};
-
-
-struct PasKeyData
-{
-    std::string pathKey = "";    // fBNgȂǂɎgL[
-    std::string key = "";        // \[X̃L[
-    std::string textKey = "";    // \peLXgL[
-    std::string spritePath = ""; // XvCg\[X̃pX
-	JSON(pathKey, key, textKey, spritePath)
-};
-
-struct ImageData
-{
-    Color color = Color(0xFFFFFFFF);
-    PasKeyData imgKey;      // PasKeyf[^CX^X
-    int type = 0;               // Image.Type  int ɂĊi[
-    bool preserveAspect = false;
-	JSON(color, imgKey, type, preserveAspect)
-};
-
-struct CanvasData {
-    int canvasOrder = 0;
-    int renderMode = 0;  // RenderMode enum  int ɕϊiFScreenSpaceOverlay = 0 j
-    int scaleMode = 0;   // CanvasScaler::ScaleMode enum  int
-    Vector2D referenceResolution = { 800.0f, 600.0f };
-
-    JSON(canvasOrder, renderMode, scaleMode, referenceResolution)
-};
-
 class CreateUI
 {
-public:
-
-    static std::shared_ptr<GameObject> CreateElement(const UIElement& element) {
-        auto go = GameObject::Instantiate(element.gameObject.name);
-        go->SetTag(element.gameObject.tag);
-        go->SetActive(element.gameObject.isActive);
+private:
+    static std::shared_ptr<GameObject> CreateGameObject(const UiLayout::Node& node) {
+        auto go = GameObject::Instantiate(node.gameObject.name);
+        go->SetTag(node.gameObject.tag);
+        go->SetActive(node.gameObject.isActive);
         // RectTransform
         {
             auto rect = go->AddAppBase<RectTransform2D>();
-            rect->anchoredPosition = element.rectTransform.anchoredPosition;
-            rect->SetSize(element.rectTransform.sizeDelta);
-            rect->anchorMin = element.rectTransform.anchorMin;
-            rect->anchorMax = element.rectTransform.anchorMax;
-			rect->pivot = element.rectTransform.pivot;
+            rect->SetAnchoredPosition(node.rectTransform.anchoredPosition);
+            rect->SetSize(node.rectTransform.sizeDelta);
+            rect->SetAnchors(node.rectTransform.anchorMin, node.rectTransform.anchorMax);
+			rect->SetPivot(node.rectTransform.pivot);
 			// Transform2Dݒ.
-            Vector2D position(element.gameObject.position.x, element.gameObject.position.y);
-            Vector2D scale(element.gameObject.scale.x, element.gameObject.scale.y);
-            float  rotation = element.gameObject.rotation.z;
-            go->transform->position = position;
-            go->transform->rotation = rotation;
-            go->transform->scale = scale;
+            Vector2D position(node.gameObject.position.x, node.gameObject.position.y);
+            Vector2D scale(node.gameObject.scale.x, node.gameObject.scale.y);
+            float  rotation = node.gameObject.rotation.z;
+            go->transform->SetPosition(position);
+            go->transform->SetRotation(rotation);
+            go->transform->SetScale(scale);
         }
+        return go;
+    }
 
-        // Components
-        for (const auto& comp : element.components) {
-            if (comp.type == "Canvas") {
-                auto canvas = go->AddAppBase<Canvas>();
-				auto canvasData = JsonUtility::FromJson<CanvasData>(comp.json);
-				canvas->SetOrder(canvasData.canvasOrder);
-				canvas->SetRenderMode(static_cast<RenderMode>(canvasData.renderMode));
-				canvas->SetScaleMode(static_cast<CanvasScaler::ScaleMode>(canvasData.scaleMode));
-                canvas->SetReferenceResolution(Vector2D(canvasData.referenceResolution.x, canvasData.referenceResolution.y));
-            }
-            else if (comp.type == "GraphicRaycaster") {
-                auto raycaster = go->AddAppBase<GraphicRaycaster>();
-            }
-            else if (comp.type == "Image") {
-                auto img = go->AddAppBase<Image>();
-				auto imageData = JsonUtility::FromJson<ImageData>(comp.json);
-                img->GetColor() = imageData.color;
-                img->SetImageType(static_cast<Image::ImageType>(imageData.type));
-                if (!imageData.imgKey.pathKey.empty()) {
-                    auto sprite = Texture2DManager::GetInstance().GetTexture2D(imageData.imgKey.pathKey, imageData.imgKey.key);
-                    if (sprite) {
-                        img->SetSprite(sprite->GetTextureData(imageData.imgKey.textKey));
-                    }
-				}
-                else
-                {
-                    img->SetSprite(nullptr);
+    static void AddComponent(const std::shared_ptr<GameObject>& go, const UiComponentData& comp) {
+        if (auto canvasData = std::get_if<CanvasData>(&comp)) {
+            auto canvas = go->AddAppBase<Canvas>();
+			canvas->SetOrder(canvasData->canvasOrder);
+			canvas->SetRenderMode(static_cast<RenderMode>(canvasData->renderMode));
+			canvas->SetScaleMode(static_cast<CanvasScaler::ScaleMode>(canvasData->scaleMode));
+            canvas->SetReferenceResolution(Vector2D(canvasData->referenceResolution.x, canvasData->referenceResolution.y));
+        }
+        else if (std::holds_alternative<GraphicRaycasterData>(comp)) {
+            go->AddAppBase<GraphicRaycaster>();
+        }
+        else if (auto imageData = std::get_if<ImageData>(&comp)) {
+            auto img = go->AddAppBase<Image>();
+            img->GetColor() = imageData->color;
+            img->SetImageType(static_cast<Image::ImageType>(imageData->type));
+            if (!imageData->imgKey.pathKey.empty()) {
+                auto sprite = Texture2DManager::GetInstance().GetTexture2D(imageData->imgKey.pathKey, imageData->imgKey.key);
+                if (sprite) {
+                    img->SetSprite(sprite->GetTextureData(imageData->imgKey.textKey));
                 }
-            }
-            else if (comp.type == "Button") {
-                auto btn = go->AddAppBase<Button>();
-				auto buttonData = JsonUtility::FromJson<ButtonData>(comp.json);
-				ColorBlock colorBlock;
-                colorBlock.normalColor = buttonData.colors.normalColor;
-                colorBlock.highlightedColor = buttonData.colors.highlightedColor;
-                colorBlock.pressedColor = buttonData.colors.pressedColor;
-                colorBlock.disabledColor = buttonData.colors.disabledColor;
-				btn->SetFadeDuration(buttonData.colors.fadeDuration);
-                btn->SetColorBlock(colorBlock);
-            }
-            else if (comp.type == "Text") {
-                auto txt = go->AddAppBase<Text>();
-				auto textData = JsonUtility::FromJson<TextData>(comp.json);
-                txt->SetText(textData.text);
-                txt->SetColor(textData.color);
-				txt->SetTextAnchor(static_cast<TextAnchor>(textData.alignment));
-				txt->SetHorizontalOverflow(static_cast<HorizontalOverflow>(textData.horizontalOverflow));
-				txt->SetVerticalOverflow(static_cast<VerticalOverflow>(textData.verticalOverflow));
-                txt->SetFontSize(textData.fontSize);
-                if(!textData.systemFontName.empty())
-                    txt->SetFont(std::make_shared<Font>(textData.systemFontName, textData.fontSize, ((textData.fontStyle + 1) % 2 == 0) ? 8 : 0));
-            }
-            else {
-                // sȃR|[lg
+			}
+            else
+            {
+                img->SetSprite(nullptr);
             }
         }
-
-        // qvf
-        for (const auto& child : element.children) {
-            auto childGo = CreateElement(child);
-            go->transform->AddChild(childGo->transform);
+        else if (auto buttonData = std::get_if<ButtonData>(&comp)) {
+            auto btn = go->AddAppBase<Button>();
+			ColorBlock colorBlock;
+            colorBlock.normalColor = buttonData->colors.normalColor;
+            colorBlock.highlightedColor = buttonData->colors.highlightedColor;
+            colorBlock.pressedColor = buttonData->colors.pressedColor;
+            colorBlock.disabledColor = buttonData->colors.disabledColor;
+			btn->SetFadeDuration(buttonData->colors.fadeDuration);
+            btn->SetColorBlock(colorBlock);
+        }
+        else if (auto textData = std::get_if<TextData>(&comp)) {
+            auto txt = go->AddAppBase<Text>();
+            txt->SetText(textData->text);
+            txt->SetColor(textData->color);
+			txt->SetTextAnchor(static_cast<TextAnchor>(textData->alignment));
+			txt->SetHorizontalOverflow(static_cast<HorizontalOverflow>(textData->horizontalOverflow));
+			txt->SetVerticalOverflow(static_cast<VerticalOverflow>(textData->verticalOverflow));
+            txt->SetFontSize(textData->fontSize);
+            if(!textData->systemFontName.empty())
+                txt->SetFont(std::make_shared<Font>(textData->systemFontName, textData->fontSize, ((textData->fontStyle + 1) % 2 == 0) ? 8 : 0));
         }
-
-        return go;
     }
 
+public:
+    // CAEg̗vf擪珇ɐ. ߂l͐ (擪).
+    // e͕KɐĂ̂, q̓R|[lgtŐeɌqł悢.
+    static std::vector<std::shared_ptr<GameObject>> InstantiateAll(const UiLayout& layout) {
+        const auto& nodes = layout.GetNodes();
+        std::vector<std::shared_ptr<GameObject>> created;
+        created.reserve(nodes.size());
+        for (const auto& node : nodes) {
+            auto go = CreateGameObject(node);
+            for (const auto& comp : layout.GetComponents(node)) {
+                AddComponent(go, comp);
+            }
+            if (node.parent >= 0) {
+                created[node.parent]->transform->AddChild(go->transform);
+            }
+            created.push_back(std::move(go));
+        }
+        return created;
+    }
 
+    static std::shared_ptr<GameObject> Instantiate(const UiLayout& layout) {
+        if (layout.IsEmpty()) return nullptr;
+        return InstantiateAll(layout).front();
+    }
 
-public:
+	// JSON ̉߂͏񂾂 (UiLayoutManager ێ).
 	static std::shared_ptr<GameObject> CreateUiJsonData(const std::string& file) {
-		std::string jsonText;
-		try {
-			jsonText = System::IO::File::ReadAllText(file);
-		}
-		catch (...) {
-            Debug::ErrorLog("Failed to read file: " + file);
-			return nullptr; // t@Cǂݍݎs
-		}
-		auto uiData = JsonUtility::FromJson<UI>(jsonText);
-
-		if (uiData.elements.empty()) {
-			return nullptr; // UIf[^
+		auto layout = UiLayoutManager::GetInstance().Get(file);
+		if (!layout || layout->IsEmpty()) {
+			return nullptr; // ǂݍݎs or UIf[^
 		}
-
-        return CreateElement(uiData.elements[0]);
+        return Instantiate(*layout);
 	}
-};
\ No newline at end of file
+};
@@ -10,6 +10,9 @@
 #include "BulletBase.h"
 #include "GameObject.h"
 #include "GameObjectMgr.h"
+#include "BulletScript.h"
+#include "BulletScriptManager.h"
+#include "SnapshotStream.h"
 
 // AppBase Event.
 
@@ -28,9 +31,12 @@ void BulletBase::Tick() {
     // カスタム挙動（優先される）
     if (controller) controller->Update(transform, this);
 
-    // 向きに基づいて移動
-    Vector2D direction = Vector2D::FromAngle(transform->rotation);
-    transform->position += direction * speed;
+    // 向きに基づいて移動 (回転が変わった時だけ三角関数を計算)
+    if (transform->rotation != directionAngle) {
+        directionAngle = transform->rotation;
+        direction = Vector2D::FromAngle(directionAngle);
+    }
+    transform->Translate(direction * speed);
 
     // 画面外チェック
     Vector2D pos = transform->position;
@@ -49,6 +55,7 @@ void BulletBase::SetBulletType(BulletParentID id, BulletColor color) {
     if (!collider || !renderer) return;
 
     auto& typeManager = BulletTypeManager::GetInstance();
+    SetSpawnType(id, color);
 
     // データ取得
     if (!typeManager.HasBulletType(id)) {
@@ -77,4 +84,42 @@ void BulletBase::SetBulletType(BulletParentID id, BulletColor color) {
     // ヒットボックス半径を変更
     float radius = data.hitboxSize;
     collider->SetRadius(radius);
-}
\ No newline at end of file
+}
+
+void BulletBase::SaveState(SnapshotWriter& out) const {
+    MotionState motion;
+    motion.position = transform->position;
+    motion.rotation = transform->rotation;
+    motion.speed    = speed;
+    motion.accel    = accel;
+    motion.angle    = angle;
+    motion.rotVel   = rotVel;
+    motion.damage   = damage;
+    out.Write(motion);
+
+    // 任意の BulletControllerBase は保存できないので BulletScript のみ.
+    auto script = std::dynamic_pointer_cast<BulletScript>(controller);
+    out.Write(script ? script->GetProgramId() : BulletScript::NoProgram);
+    if (script) script->SaveState(out);
+}
+
+void BulletBase::LoadState(SnapshotReader& in) {
+    const auto motion = in.Read<MotionState>();
+    transform->SetPosition(motion.position);
+    transform->SetRotation(motion.rotation);
+    speed   = motion.speed;
+    accel   = motion.accel;
+    angle   = motion.angle;
+    rotVel  = motion.rotVel;
+    damage  = motion.damage;
+
+    const uint32_t programId = in.Read<uint32_t>();
+    if (programId == BulletScript::NoProgram) {
+        controller.reset();
+        return;
+    }
+    auto script = BulletScriptManager::GetInstance().CloneBulletScript(programId);
+    BulletScript discard;   // 登録が消えていても読み位置は進める
+    (script ? *script : discard).LoadState(in);
+    controller = script;
+}
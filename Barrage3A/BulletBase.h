@@ -6,13 +6,38 @@
 #include "BulletControllerBase.h"
 #include "BulletType.h"
 
+class SnapshotWriter;
+class SnapshotReader;
+
 class BulletBase : public TouhouBase {
+    friend class BulletManager;
+private:
+    size_t managerIndex = SIZE_MAX;     // BulletManager 内の位置 (未登録なら SIZE_MAX)
+
+    // 生成時の種類と色 (スナップショットからの再生成用).
+    BulletParentID bulletType = BulletParentID::B1;
+    BulletColor bulletColor = BulletColor::Red;
 protected:
+    // スナップショットに memcpy でそのまま書く移動状態.
+    struct MotionState {
+        Vector2D position;
+        float rotation = 0.0f;
+        float speed = 0.0f;
+        float accel = 0.0f;
+        float angle = 0.0f;
+        float rotVel = 0.0f;
+        int damage = 0;
+    };
+
     float speed = 0.0f;
     float accel = 0.0f;
     float angle = 0.0f;   // 現在角度
     float rotVel = 0.0f;   // 角速度（回転レート）
 
+    // 移動の向き. transform の回転が directionAngle から変わった時だけ計算し直す.
+    Vector2D direction;
+    float directionAngle = std::numeric_limits<float>::quiet_NaN();
+
     int damage = 0;
 
     System::WeakAccessor<Collider2D> collider;
@@ -53,12 +78,23 @@ public:
     // 「回転レート」と「角度」を分離
     void SetRotationRate(float r) { rotVel = r; }
     void SetAngle(float a) { angle = a; }
+    // 生成時にまとめて計算した向き (angleDeg は transform の回転と同じ値).
+    void SetDirection(float angleDeg, const Vector2D& dir) { directionAngle = angleDeg; direction = dir; }
 
     void SetDamage(int d) { damage = d; }
     int  GetDamage() const { return damage; }
 
     // ---- Appearance ----
     void SetBulletType(BulletParentID, BulletColor);
+    // 見た目は変えずに種類と色だけ記録 (CreateBullet で生成済みの場合).
+    void SetSpawnType(BulletParentID id, BulletColor color) { bulletType = id; bulletColor = color; }
+    BulletParentID GetBulletTypeId() const { return bulletType; }
+    BulletColor    GetBulletColor()  const { return bulletColor; }
+
+    // ---- Snapshot ----
+    // 移動状態と制御スクリプト (BulletScript のみ) を保存する.
+    virtual void SaveState(SnapshotWriter& out) const;
+    virtual void LoadState(SnapshotReader& in);
 
 protected:
     virtual std::shared_ptr<AppBase> Clone() const override = 0;
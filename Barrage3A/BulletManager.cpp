@@ -2,22 +2,141 @@
 #include "MyBullet.h"
 #include "Collider2D.h"
 #include "BulletType.h"
+#include "EnemyBullet.h"
+#include "BulletScript.h"
+#include "ColliderManager.h"
+#include "RendererManager.h"
+#include "GameObjectMgr.h"
+#include "SnapshotStream.h"
+#include "Metrics.h"
 
 void BulletManager::AddBullet(const std::shared_ptr<BulletBase>& obj) {
+	if (!obj || obj->managerIndex != SIZE_MAX) return;
+	obj->managerIndex = bullets.size();
 	bullets.push_back(obj);
+	Metrics::GetInstance().Set(Metric::Bullets, bullets.size());
 }
 
 void BulletManager::RemoveBullet(const std::shared_ptr<BulletBase>& obj) {
-	bullets.erase(
-		std::remove(bullets.begin(), bullets.end(), obj),
-		bullets.end()
-	);
+	if (!obj) return;
+	const size_t index = obj->managerIndex;
+	if (index >= bullets.size() || bullets[index] != obj) return;
+
+	// Ɠւč폜 (͕ێȂ)
+	if (index != bullets.size() - 1) {
+		bullets[index] = std::move(bullets.back());
+		bullets[index]->managerIndex = index;
+	}
+	bullets.pop_back();
+	obj->managerIndex = SIZE_MAX;
+	Metrics::GetInstance().Set(Metric::Bullets, bullets.size());
 }
 
 void BulletManager::AllDestroyLayer(Layer layer) {
-	for(const auto& bullet : bullets) {
-		if (bullet->GetGameObject()->GetLayer() == layer) {
-			bullet->Destroy();
+	// GameObjectMgr ŃC[ 1 ō폜҂ (o^͈ꊇ)
+	Object.DestroyByLayer(layer);
+}
+
+
+size_t BulletManager::SpawnBatch(const BulletSpawnDesc& desc, const std::vector<BulletSpawn>& spawns) {
+	if (spawns.empty()) return 0;
+	ALLOCATION_SCOPE("BulletManager::SpawnBatch");
+
+	auto& types = BulletTypeManager::GetInstance();
+	const auto sprite = types.GetSprite(desc.type, desc.color);
+	if (!sprite) return 0;
+	const float radius = types.GetHitboxSize(desc.type);
+
+	const size_t count = spawns.size();
+	bullets.reserve(bullets.size() + count);
+
+	// ͐̑Oɂ܂Ƃ߂ČvZ (eƂ̐̊ԂɎOp֐܂Ȃ)
+	directionScratch.resize(count);
+	for (size_t i = 0; i < count; ++i) directionScratch[i] = Vector2D::FromAngle(spawns[i].angle);
+
+	// ̃RC_[E_[͗߂Ă, Ō 1 xœo^
+	auto& renderers = RendererManager::GetInstance();
+	auto& collisions = CollisionManager::GetInstance();
+	renderers.BeginBatch();
+	collisions.BeginBatch();
+
+	size_t spawned = 0;
+	for (size_t i = 0; i < count; ++i) {
+		const BulletSpawn& spawn = spawns[i];
+		auto bulletGO = types.CreateBullet(sprite, radius);
+		if (!bulletGO) continue;
+
+		bulletGO->transform->SetPosition(spawn.position);
+		bulletGO->transform->SetRotation(spawn.angle);
+
+		auto bullet = bulletGO->AddAppBase<EnemyBullet>();
+		bullet->SetSpawnType(desc.type, desc.color);
+		bullet->SetSpeed(desc.bulletSpeed.value_or(spawn.speed));
+		bullet->SetRotationRate(desc.angularVelocity);
+		bullet->SetAcceleration(desc.acceleration);
+		bullet->SetDirection(spawn.angle, directionScratch[i]);
+
+		if (desc.program) {
+			auto bs = desc.program->Clone();
+			bs->InitSpeed(spawn.speed);
+			bs->InitAngle(spawn.angle);
+			bullet->SetBulletControllerInstance(bs);
+		}
+		++spawned;
+	}
+
+	collisions.EndBatch();
+	renderers.EndBatch();
+	return spawned;
+}
+
+void BulletManager::SaveState(SnapshotWriter& out) const {
+	auto isAlive = [](const std::shared_ptr<BulletBase>& bullet) {
+		const auto& go = bullet->GetGameObject();
+		return go && go->IsActive() && !go->IsPendingDestroy();
+	};
+
+	uint32_t count = 0;
+	for (const auto& bullet : bullets) {
+		if (isAlive(bullet)) ++count;
+	}
+	out.Write(count);
+
+	for (const auto& bullet : bullets) {
+		if (!isAlive(bullet)) continue;
+		out.Write(bullet->GetGameObject()->GetInstanceID());
+		out.Write(bullet->GetBulletTypeId());
+		out.Write(bullet->GetBulletColor());
+		const size_t block = out.BeginBlock();
+		bullet->SaveState(out);
+		out.EndBlock(block);
+	}
+}
+
+void BulletManager::LoadState(SnapshotReader& in) {
+	auto& types = BulletTypeManager::GetInstance();
+	const uint32_t count = in.Read<uint32_t>();
+	if (in.IsFailed()) return;
+
+	bullets.reserve(bullets.size() + count);
+	RendererManager::GetInstance().BeginBatch();
+	CollisionManager::GetInstance().BeginBatch();
+
+	for (uint32_t i = 0; i < count && !in.IsFailed(); ++i) {
+		const auto instanceId = in.Read<uint64_t>();
+		const auto type  = in.Read<BulletParentID>();
+		const auto color = in.Read<BulletColor>();
+		const size_t end = in.BeginBlock();
+
+		// e̓o^ȂĂ΂̒e͔΂.
+		if (auto bulletGO = types.CreateBullet(type, color)) {
+			bulletGO->RestoreInstanceID(instanceId);
+			auto bullet = bulletGO->AddAppBase<EnemyBullet>();
+			bullet->SetSpawnType(type, color);
+			bullet->LoadState(in);
 		}
+		in.EndBlock(end);
 	}
+	CollisionManager::GetInstance().EndBatch();
+	RendererManager::GetInstance().EndBatch();
 }
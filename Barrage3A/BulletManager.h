@@ -2,11 +2,35 @@
 
 #include "GameObject.h"
 #include "BulletBase.h"
+#include "BulletType.h"
+#include <optional>
+
+class BulletScript;
+class SnapshotWriter;
+class SnapshotReader;
+
+// ꊇe 1 .
+struct BulletSpawn {
+	Vector2D position;
+	float angle = 0.f;
+	float speed = 0.f;
+};
+
+// ꊇŋʂ̐ݒ.
+struct BulletSpawnDesc {
+	BulletParentID type = BulletParentID::B1;
+	BulletColor color = BulletColor::Red;
+	std::shared_ptr<BulletScript> program;		// eƂ Clone Đݒ (nullptr Ȃ疳)
+	float angularVelocity = 0.f;
+	float acceleration = 0.f;
+	std::optional<float> bulletSpeed;			// w莞͑Sȇx (wȂ BulletSpawn::speed)
+};
 
 class BulletManager {
 private:
 
 	std::vector<std::shared_ptr<BulletBase>> bullets;
+	std::vector<Vector2D> directionScratch;		// SpawnBatch ̌ (g)
 
 	BulletManager() {}
 public:
@@ -19,4 +43,14 @@ public:
 	void RemoveBullet(const std::shared_ptr<BulletBase>&);
 
 	void AllDestroyLayer(Layer layer);
+
+	// ނ̒e܂Ƃ߂Đ. ށEFESprite ̉ƌ̌vZ͍ŏ 1 xs,
+	// RC_[E_[̓o^͍Ō 1 xōs. e̐Ԃ.
+	size_t SpawnBatch(const BulletSpawnDesc& desc, const std::vector<BulletSpawn>& spawns);
+
+	const std::vector<std::shared_ptr<BulletBase>>& GetBullets() const { return bullets; }
+
+	// ̒eۑ. ͊̒ejς݂̏ԂŌĂ (SnapshotSystem::Restore).
+	void SaveState(SnapshotWriter& out) const;
+	void LoadState(SnapshotReader& in);
 };
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "GameManager.h"
 #include "MusicController.h"
 #include "AudioResourceShortcut.hpp"
+#include "SnapshotStream.h"
 
 void BulletScript::Update(std::shared_ptr<Transform2D> tr, BulletBase* bullet) {
 
@@ -121,7 +122,7 @@ void BulletScript::Update(std::shared_ptr<Transform2D> tr, BulletBase* bullet) {
         }
 
         case BulletInstruction::Type::RandomizeAngle:
-            angle += (Random.Value() * 2.f - 1.f) * instr.value1;
+            angle += (Random.Stream(RandomStream::Pattern).Value() * 2.f - 1.f) * instr.value1;
             ++ip;
             break;
 
@@ -180,7 +181,7 @@ void BulletScript::Update(std::shared_ptr<Transform2D> tr, BulletBase* bullet) {
         case BulletInstruction::Type::PlaySE: {
             auto clip = Sounds[instr.soundName];
             auto scn = MusicController::GetInstance();
-            if (scn && clip) scn->OneShotAudio(clip->Clone(), instr.volume);
+            if (scn && clip) scn->OneShotAudio(clip, instr.volume);
             ip++;
             break;
         }
@@ -191,7 +192,7 @@ void BulletScript::Update(std::shared_ptr<Transform2D> tr, BulletBase* bullet) {
                 break;
             }
 
-            loopStack.push(LoopContext((int)ip, loopCount));
+            loopStack.push_back(LoopContext((int)ip, loopCount));
             ++ip;
             break;
         }
@@ -202,14 +203,14 @@ void BulletScript::Update(std::shared_ptr<Transform2D> tr, BulletBase* bullet) {
                 break;
             }
 
-            auto& ctx = loopStack.top();
+            auto& ctx = loopStack.back();
             ctx.remaining--;
 
             if (ctx.remaining > 0) {
                 ip = ctx.startIp + 1; // [v{̂ɖ߂
             }
             else {
-                loopStack.pop();
+                loopStack.pop_back();
                 ++ip;
             }
             break;
@@ -223,6 +224,34 @@ void BulletScript::Update(std::shared_ptr<Transform2D> tr, BulletBase* bullet) {
         }
     }
     // Ōɒe̕Ƒx𔽉f
-    tr->rotation = angle;
+    tr->SetRotation(angle);
     bullet->SetSpeed(speed);
 }
+
+void BulletScript::SaveState(SnapshotWriter& out) const {
+    out.Write(static_cast<uint32_t>(ip));
+    out.Write(frame);
+    out.Write(speed);
+    out.Write(angle);
+    out.WriteVector(loopStack);
+    out.Write(lerpStartSpeed);
+    out.Write(lerpStartAngle);
+    out.Write(targetAngle);
+    out.Write(lastWaveOffset);
+    out.Write(baseAngle);
+    out.Write(lerpInit);
+}
+
+void BulletScript::LoadState(SnapshotReader& in) {
+    ip = in.Read<uint32_t>();
+    in.Read(frame);
+    in.Read(speed);
+    in.Read(angle);
+    in.ReadVector(loopStack);
+    in.Read(lerpStartSpeed);
+    in.Read(lerpStartAngle);
+    in.Read(targetAngle);
+    in.Read(lastWaveOffset);
+    in.Read(baseAngle);
+    in.Read(lerpInit);
+}
@@ -1,11 +1,18 @@
 #pragma once
 #include "BulletControllerBase.h"
 #include "BulletInstruction.h"
-#include <stack>
+#include <vector>
+#include <cstdint>
+
+class SnapshotWriter;
+class SnapshotReader;
 
 class BulletScript : public BulletControllerBase
 {
+public:
+    static constexpr uint32_t NoProgram = 0xFFFFFFFF;
 private:
+    uint32_t programId = NoProgram;             ///< BulletScriptManager ̓o^ԍ (łێ)
     std::vector<BulletInstruction> instructions;  ///< ߗ
     size_t ip = 0;          ///< s̖߃CfbNX
     int    frame = 0;       ///< ߂Ƃ̃t[JE^
@@ -13,15 +20,16 @@ private:
     float  angle = 0.f;     ///< ݂̈ړpx (deg)
     
     struct LoopContext {
-        int startIp;
-        int remaining;
+        int startIp = 0;
+        int remaining = 0;
 
+        LoopContext() = default;
         LoopContext(int start, int count)
             : startIp(start), remaining(count) {
         }
     };
 
-    std::stack<LoopContext> loopStack;
+    std::vector<LoopContext> loopStack;
 
     float lerpStartSpeed = 0.0f;
     float lerpStartAngle = 0.0f;
@@ -39,6 +47,9 @@ public:
         instructions.push_back(instr);
     }
 
+    const std::vector<BulletInstruction>& GetInstructions() const { return instructions; }
+    void SetInstructions(std::vector<BulletInstruction> _instructions) { instructions = std::move(_instructions); }
+
     void Update(std::shared_ptr<Transform2D>, BulletBase*) override;
 
     void InitSpeed(float _spped) {
@@ -51,6 +62,7 @@ public:
 
     void Reset() {
         ip = 0;
+        loopStack.clear();
         frame = 0;
         speed = 0.f;
         angle = 0.f;
@@ -65,4 +77,11 @@ public:
         return bullet;
     }
 
+    uint32_t GetProgramId() const { return programId; }
+    void SetProgramId(uint32_t id) { programId = id; }
+
+    // sԂ̂ݕۑ (ߗ programId 畜ŗp).
+    void SaveState(SnapshotWriter& out) const;
+    void LoadState(SnapshotReader& in);
+
 };
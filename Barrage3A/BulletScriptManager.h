@@ -6,10 +6,12 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 class BulletScriptManager {
 private:
     std::unordered_map<std::string, std::shared_ptr<BulletScript>> scripts;
+    std::vector<std::shared_ptr<BulletScript>> programs;    // o^ (Y = programId)
 public:
     static BulletScriptManager& GetInstance() {
         static BulletScriptManager instance;
@@ -22,6 +24,21 @@ public:
         return it->second->Clone();
     }
 
+    // o^ԍ珉Ԃ̕ (XibvVbg̕p).
+    std::shared_ptr<BulletScript> CloneBulletScript(uint32_t programId) {
+        if (programId >= programs.size()) return nullptr;
+        return programs[programId]->Clone();
+    }
+
+    // o^ꂽ̂LŕԂ (Ȃ. eɎƂ Clone ).
+    std::shared_ptr<BulletScript> FindBulletScript(const std::string& id) const {
+        auto it = scripts.find(id);
+        return it != scripts.end() ? it->second : nullptr;
+    }
+    std::shared_ptr<BulletScript> GetBulletScript(uint32_t programId) const {
+        return programId < programs.size() ? programs[programId] : nullptr;
+    }
+
     void RegisterBulletScript(const std::string& id, std::shared_ptr<BulletScript> script) {
         if (id.empty() || !script) {
             return; // ID܂̓XNvgȏꍇ͉Ȃ
@@ -33,7 +50,21 @@ public:
         if (it != scripts.end()) {
             return;
         }
+        script->SetProgramId(static_cast<uint32_t>(programs.size()));
+        programs.push_back(script);
         scripts[id] = script;
     }
+
+    // o^Ȃo^, o^ς݂Ȃ疽ߗ񂾂ւ.
+    // ς݂̒e͕Ă̂Ō̓̂܂, Ȍ̔˂VߗɂȂ.
+    void ReplaceBulletScript(const std::string& id, std::shared_ptr<BulletScript> script) {
+        if (id.empty() || !script) return;
+        auto it = scripts.find(id);
+        if (it == scripts.end()) {
+            RegisterBulletScript(id, std::move(script));
+            return;
+        }
+        it->second->SetInstructions(script->GetInstructions());
+    }
 };
 
@@ -126,6 +126,7 @@ void BulletTypeManager::LoadJson(const std::string& path) {
             BulletParentID bulletID = static_cast<BulletParentID>(bulletType.id);
             bulletTypeMap[bulletID] = data;
         }
+        spriteCache.clear();
     }
     catch (const std::exception& e) {
         std::cerr << "Failed to load bullet types JSON: " << e.what() << std::endl;
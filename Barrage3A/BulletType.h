@@ -93,6 +93,11 @@ struct BulletTypeData
 class BulletTypeManager {
 private:
     std::unordered_map<BulletParentID, BulletTypeData> bulletTypeMap;
+    std::unordered_map<int, std::shared_ptr<Sprite>> spriteCache;   // (, F)  Sprite
+
+    static int SpriteKey(BulletParentID id, BulletColor color) {
+        return (static_cast<int>(id) << 8) | static_cast<int>(color);
+    }
 
     BulletTypeManager() {}
 
@@ -112,6 +117,7 @@ public:
 
     void SetBulletType(BulletParentID id, const BulletTypeData& data) {
         bulletTypeMap[id] = data;
+        spriteCache.clear();
     }
 
     void LoadJson(const std::string& ptch);
@@ -131,6 +137,23 @@ public:
         return it->second;
     }
 
+    // ނƐF Sprite 擾 (̂ Tex )
+    std::shared_ptr<Sprite> GetSprite(BulletParentID id, BulletColor color) {
+        const int key = SpriteKey(id, color);
+        auto it = spriteCache.find(key);
+        if (it != spriteCache.end()) return it->second;
+
+        int index = GetImageIndex(id, color);
+        if (index == -1) {
+            std::cerr << "[BulletTypeManager] Missing color mapping: BulletParentID="
+                << static_cast<int>(id) << ", Color=" << static_cast<int>(color) << std::endl;
+            return nullptr; // o^ĂȂF
+        }
+        auto texture = Tex[GetBulletType(id).imagePath + "_" + std::to_string(index)];
+        if (texture) spriteCache.emplace(key, texture);
+        return texture;
+    }
+
     float GetHitboxSize(BulletParentID id) const {
         auto it = bulletTypeMap.find(id);
         if (it == bulletTypeMap.end()) return 0.0f;
@@ -146,19 +169,20 @@ public:
         // f[^擾
         const BulletTypeData& data = GetBulletType(id);
 
-        // CfbNX擾
-        int index = GetImageIndex(id, color);
-        if (index == -1) {
-            std::cerr << "[BulletTypeManager] Missing color mapping: BulletParentID="
-                << static_cast<int>(id) << ", Color=" << static_cast<int>(color) << std::endl;
-
-            return nullptr; // o^ĂȂF
-        }
-
         // Sprite 擾
-        auto texture = Tex[data.imagePath+ "_" + std::to_string(index)];
+        auto texture = GetSprite(id, color);
         if (!texture) return nullptr;
 
+        return CreateBullet(texture, data.hitboxSize, std::move(tag), layer, drawLayer);
+    }
+
+    // Sprite Ɠ蔻̔aI̐ (ނ𑱂č鎞ɈȂ).
+    std::shared_ptr<GameObject> CreateBullet(
+        const std::shared_ptr<Sprite>& texture, float radius,
+        std::string tag = "EnemyBullet",
+        Layer layer = Layer::EnemyBullet,
+        int drawLayer = 5)
+    {
         // GameObject 쐬
         auto bullet = GameObject::Instantiate("Bullet");
         bullet->SetTag(tag);
@@ -170,7 +194,6 @@ public:
         renderer->SetRotation(-90);
 		renderer->SetLayer(drawLayer);
         // RC_[ǉiƂ肠 CircleColliderj
-        float radius = data.hitboxSize;
         if (radius > 0.0f) {
             auto collider = bullet->AddAppBase<CircleCollider>();
             collider->SetRadius(radius);
@@ -37,13 +37,12 @@ void Canvas::Draw() {
         switch (renderMode) {
         case RenderMode::ScreenSpaceOverlay:
         case RenderMode::ScreenSpaceCamera:
-            rt->width  = screenSize.x;
-            rt->height = screenSize.y;
-			rt->anchoredPosition = screenSize * 0.5f; // ɔzu
-            rt->scale = scale; // 킹
+            rt->SetSize(screenSize);
+			rt->SetAnchoredPosition(screenSize * 0.5f); // ɔzu
+            rt->SetScale(scale); // 킹
             break;
         case RenderMode::WorldSpace:
-            rt->scale = scale; // [hԂłwidth/heightRectTransform̂܂
+            rt->SetScale(scale); // [hԂłwidth/heightRectTransform̂܂
             break;
         }
     }
@@ -62,9 +61,22 @@ void Canvas::Draw() {
     }
 }
 
-std::vector<std::shared_ptr<UiBase>> Canvas::GetUiBases() const {
-    if (!transform) return {};
-    return transform->GetAppBasesInChildren<UiBase>();
+const std::vector<std::shared_ptr<UiBase>>& Canvas::GetUiBases() const {
+    uint32_t version = transform ? transform->GetHierarchyVersion() : 0;
+    if (uiBasesValid && uiBasesVersion == version) {
+        ++uiBasesCacheStats.hits;
+        return uiBases;
+    }
+    ++uiBasesCacheStats.misses;
+
+    // Kwωꍇ̂ݕR.
+    uiBases.clear();
+    if (transform) {
+        transform->CollectAppBasesInChildren<UiBase>(uiBases);
+    }
+    uiBasesVersion = version;
+    uiBasesValid   = true;
+    return uiBases;
 }
 
 
@@ -38,6 +38,10 @@ private:    // 
     CanvasScaler scaler;
     RenderMode renderMode = RenderMode::ScreenSpaceOverlay;
 	std::weak_ptr<RectTransform2D> rectTransform;; //  GameObject.
+    // `揇ɕR UiBase (Kwς̂ݍč\z).
+    mutable std::vector<std::shared_ptr<UiBase>> uiBases;
+    mutable uint32_t uiBasesVersion = 0;
+    mutable bool     uiBasesValid   = false;
 public:     // J.
 
     // RXgN^.
@@ -50,6 +54,11 @@ public:     // 
     void SetScaleMode(CanvasScaler::ScaleMode mode) { scaler.scaleMode = mode; }
     void SetReferenceResolution(const Vector2D& res) { scaler.referenceResolution = res; }
 
+    // `揇 UiBase ꗗ擾 (LbV. g̃[g̉̊Kwς̂ݍ蒼).
+    const std::vector<std::shared_ptr<UiBase>>& GetUiBases() const;
+    // GetUiBases ̃LbVp (S Canvas ̍v).
+    inline static UiCacheStats uiBasesCacheStats;
+
     void SetRenderMode(RenderMode mode) { renderMode = mode; }
     RenderMode GetRenderMode() const override { return renderMode; }
 
@@ -64,8 +73,6 @@ protected:
     }
 
 private:
-    std::vector<std::shared_ptr<UiBase>> GetUiBases() const;
-
     void DrawOverlayUI();
     void DrawCameraSpaceUI();
     void DrawWorldUI();
@@ -58,6 +58,20 @@ MyRectangle BoxCollider::GetBounds() const {
     return MyRectangle(position.x - size.x / 2, position.y - size.y / 2, size.x, size.y);
 }
 
+void BoxCollider::BuildShape(ColliderShape& out) const {
+    out.type    = ColliderShapeType::Box;
+    out.obb     = GetOBB();
+    out.center  = out.obb.center;
+    out.radius  = 0.f;
+
+    // 回転・スケール込みの AABB
+    const OBB& obb = out.obb;
+    Vector2D extent(
+        std::abs(obb.axes[0].x) * obb.halfSize.x + std::abs(obb.axes[1].x) * obb.halfSize.y,
+        std::abs(obb.axes[0].y) * obb.halfSize.x + std::abs(obb.axes[1].y) * obb.halfSize.y);
+    out.bounds = MyRectangle(obb.center.x - extent.x, obb.center.y - extent.y, extent.x * 2, extent.y * 2);
+}
+
 RectF BoxCollider::GetAABB() const {
     OBB obb = GetOBB();
 
@@ -84,14 +98,10 @@ RectF BoxCollider::GetAABB() const {
 }
 
 OBB BoxCollider::GetOBB() const {
-    auto transform = GetGameObject()->transform;
-
-    // ワールド Transform 取得
-    Transform2D worldTransform = transform->GetWorldTransform2D();
-
-    Vector2D center     = worldTransform.position;
-    Vector2D worldScale = worldTransform.scale;
-    float rotation      = worldTransform.rotation;
+    // ワールド Transform 取得 (キャッシュ参照. Transform2D のコピーは作らない)
+    Vector2D center     = transform->GetWorldPosition();
+    Vector2D worldScale = transform->GetWorldScale();
+    float rotation      = transform->GetWorldRotation();
 
     // スケールを反映
     Vector2D scaledSize = size * worldScale;
@@ -121,6 +131,17 @@ MyRectangle CircleCollider::GetBounds() const {
     return MyRectangle(position.x - radius, position.y - radius, radius * 2, radius * 2); // AABBを返す
 }
 
+void CircleCollider::BuildShape(ColliderShape& out) const {
+    Vector2D scale = transform->GetWorldScale();
+
+    out.type    = ColliderShapeType::Circle;
+    out.center  = transform->GetWorldPosition();
+    out.radius  = radius * Mathf::Min(scale.x, scale.y);
+
+    float r = std::abs(out.radius);
+    out.bounds = MyRectangle(out.center.x - r, out.center.y - r, r * 2, r * 2);
+}
+
 RectF CircleCollider::GetAABB() const {
     Vector2D position = transform->GetWorldPosition(); // ゲームオブジェクトの位置
     return RectF(position.x - radius, position.y - radius, radius * 2, radius * 2); // AABBを返す
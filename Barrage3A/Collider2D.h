@@ -11,6 +11,21 @@ struct OBB {
     Vector2D axes[2];
 };
 
+enum class ColliderShapeType : uint8_t {
+    Box,
+    Circle,
+};
+
+// 1 Xebṽ[hԌ`. CollisionManager t[ 1 x쐬,
+// L攻Eڍה͂ꂾQƂ (Transform2D HȂ).
+struct ColliderShape {
+    ColliderShapeType type = ColliderShapeType::Circle;
+    MyRectangle bounds{ 0, 0, 0, 0 };   // [h AABB
+    Vector2D center;                    // ~̒S / OBB ̒S
+    float radius = 0.f;                 // ~̔a (XP[fς)
+    OBB obb{};                          // Box ̂
+};
+
 // Collider2D class and AppBase class
 class Collider2D : public AppBase, public IRendererDraw ,public std::enable_shared_from_this<Collider2D> {
 private:    // J.
@@ -26,6 +41,8 @@ public:     // 
     int  GetSortingOrder() const override;
 
     virtual MyRectangle GetBounds() const = 0;
+    // ݂̃[h`o.
+    virtual void BuildShape(ColliderShape& out) const = 0;
 };
 
 class BoxCollider : public Collider2D{
@@ -50,6 +67,7 @@ public:
     void Draw()             override;
 
     MyRectangle GetBounds() const override;
+    void BuildShape(ColliderShape& out) const override;
 protected:
     std::shared_ptr<AppBase> Clone() const override {
         return std::make_shared<BoxCollider>(*this);
@@ -74,6 +92,7 @@ public:
     void Draw() override;
 
     MyRectangle GetBounds() const override;
+    void BuildShape(ColliderShape& out) const override;
 
 protected:
     std::shared_ptr<AppBase> Clone() const override {
@@ -3,7 +3,8 @@
 #include "QuadTree.h"
 #include "GameObjectMgr.h"
 #include "LayerManager.h"
-#include "Stopwatch.hpp"
+#include "Profiler.h"
+#include "Metrics.h"
 
 #include "CollisionDispatcher.h"
 
@@ -61,13 +62,20 @@
 #else
 
 void CollisionManager::CheckCollisions() {
-    if (colliders.size() < 2) return;
+    Metrics::GetInstance().Set(Metric::Colliders, colliders.size());
+    if (colliders.size() < 2) {
+        shapes.clear();
+        return;
+    }
 
-    // DebugStopwatch::Start("CollisionManager");
+    PROFILE_SCOPE(ProfileZone::CheckCollisions);
 
     // イベントを遅延処理するためのリスト
     std::vector<std::pair<CollisionPair, CollisionEventType>> collisionEvents;
 
+    // ワールド形状はここで 1 度だけ作成し, 以降は shapes のみ参照する.
+    BuildShapes();
+
     switch (mode)
     {
     case CollisionCheckMode::QuadTree:
@@ -81,6 +89,8 @@ void CollisionManager::CheckCollisions() {
     default:
         break;
     }
+    // 所有参照は次のステップまで持ち越さない.
+    shapeObjects.clear();
 
     
     // すべての衝突チェックが終了した後にイベントを発生させる
@@ -100,25 +110,53 @@ void CollisionManager::CheckCollisions() {
         }
     }
 
-
-    // DebugStopwatch::PrintStop("CollisionManager","CheckCollisionsメソッド 掛かった時間");
 }
 #endif
 
+bool CollisionManager::CollisionPairLess::operator()(const CollisionPair& a, const CollisionPair& b) const {
+    uint64_t a1 = a.first  ? a.first->GetInstanceID()  : 0;
+    uint64_t b1 = b.first  ? b.first->GetInstanceID()  : 0;
+    if (a1 != b1) return a1 < b1;
+    uint64_t a2 = a.second ? a.second->GetInstanceID() : 0;
+    uint64_t b2 = b.second ? b.second->GetInstanceID() : 0;
+    return a2 < b2;
+}
+
+CollisionManager::CollisionPair CollisionManager::MakeOrderedPair(const std::shared_ptr<GameObject>& a, const std::shared_ptr<GameObject>& b) {
+    return (a->GetInstanceID() < b->GetInstanceID()) ? std::make_pair(a, b) : std::make_pair(b, a);
+}
+
+void CollisionManager::BuildShapes() {
+    shapes.clear();
+    shapeObjects.clear();
+    shapes.reserve(colliders.size());
+    shapeObjects.reserve(colliders.size());
+
+    for (const auto& collider : colliders) {
+        if (!collider->IsEnabled()) continue;
+        auto go = collider->GetGameObject();
+        if (!go || !go->IsActive()) continue;
+
+        shapes.emplace_back();
+        collider->BuildShape(shapes.back());
+        shapeObjects.push_back(std::move(go));
+    }
+    shapeBuildCount += shapes.size();
+}
+
 MyRectangle CollisionManager::CalculateWorldBounds() {
     float minX =  std::numeric_limits<float>::infinity();
     float minY =  std::numeric_limits<float>::infinity();
     float maxX = -std::numeric_limits<float>::infinity();
     float maxY = -std::numeric_limits<float>::infinity();
 
-    for (const auto& collider : colliders) {
-        Vector2D position = collider->GetGameObject()->transform->GetWorldPosition();
-        MyRectangle bounds = collider->GetBounds();
+    for (const auto& shape : shapes) {
+        const MyRectangle& bounds = shape.bounds;
 
-        minX = Mathf::Min(minX, position.x - bounds.width / 2);
-        minY = Mathf::Min(minY, position.y - bounds.height / 2);
-        maxX = Mathf::Max(maxX, position.x + bounds.width / 2);
-        maxY = Mathf::Max(maxY, position.y + bounds.height / 2);
+        minX = Mathf::Min(minX, bounds.x);
+        minY = Mathf::Min(minY, bounds.y);
+        maxX = Mathf::Max(maxX, bounds.x + bounds.width);
+        maxY = Mathf::Max(maxY, bounds.y + bounds.height);
     }
 
     // コライダーが1つもない場合のエラーハンドリング
@@ -151,30 +189,23 @@ void CollisionManager::CheckCollisionsQuadTreeMode(std::vector<std::pair<Collisi
     MyRectangle bounds = isQuadTrueSizeAuto ? CalculateWorldBounds() : myRectangleSize;
     QuadTree quadTree(bounds, maxObjects, maxLevels);
 
-    std::vector<std::shared_ptr<Collider2D>> activeColliders;
-    activeColliders.reserve(colliders.size());
-
-    for (const auto& collider : colliders) {
-        if (!collider->IsEnabled()) continue;
-        auto go = collider->GetGameObject();
-        if (!go || !go->IsActive()) continue;
-        activeColliders.push_back(collider);
-        quadTree.Insert(collider);
+    const int count = static_cast<int>(shapes.size());
+    for (int i = 0; i < count; ++i) {
+        quadTree.Insert(i, shapes[i].bounds);
     }
 
-    std::set<CollisionPair> currentCollisions;
-    std::vector<std::shared_ptr<Collider2D>> foundColliders;
+    CollisionSet currentCollisions;
+    std::vector<int> found;
 
-    for (const auto& collider : activeColliders) {
-        foundColliders.clear();
-        quadTree.Retrieve(collider->GetBounds(), foundColliders);
+    for (int i = 0; i < count; ++i) {
+        found.clear();
+        quadTree.Retrieve(shapes[i].bounds, found);
 
-        for (const auto& otherCollider : foundColliders) {
-            if (collider == otherCollider) continue;
+        for (int j : found) {
+            if (i == j) continue;
 
-            auto goA = collider->GetGameObject();
-            auto goB = otherCollider->GetGameObject();
-            if (!goA || !goB) continue;
+            const auto& goA = shapeObjects[i];
+            const auto& goB = shapeObjects[j];
 
             Layer layer1 = goA->GetLayer();
             Layer layer2 = goB->GetLayer();
@@ -188,7 +219,7 @@ void CollisionManager::CheckCollisionsQuadTreeMode(std::vector<std::pair<Collisi
             auto pos2 = goB->transform->GetWorldPosition();
             DrawLine((int)pos1.x, (int)pos1.y, (int)pos2.x, (int)pos2.y, GetColor(0, 255, 0));
 #endif
-            if (CollisionDispatcher::CheckCollision(collider, otherCollider)) {
+            if (CollisionDispatcher::CheckCollision(shapes[i], shapes[j])) {
                 currentCollisions.insert(pair);
 
                 if (!previousCollisions.count(pair)) {
@@ -216,28 +247,24 @@ void CollisionManager::CheckCollisionsQuadTreeMode(std::vector<std::pair<Collisi
 
 #if(TRUE)
 void CollisionManager::CheckCollisionsLayerVsLayerMode(std::vector<std::pair<CollisionPair, CollisionEventType>>& collisionEvents) {
-    std::vector<std::vector<std::shared_ptr<Collider2D>>> collidersByLayer((size_t)Layer::Count);
-	// レイヤーごとにコライダーを分類.
-    for (auto& collider : colliders) {
-        if (!collider->IsEnabled()) continue;
-        auto go = collider->GetGameObject();
-        if (!go || !go->IsActive()) continue;
-        auto layerIdx = static_cast<size_t>(go->GetLayer());
+    std::vector<std::vector<int>> collidersByLayer((size_t)Layer::Count);
+	// レイヤーごとにコライダー (形状インデックス) を分類.
+    for (int i = 0; i < (int)shapes.size(); ++i) {
+        auto layerIdx = static_cast<size_t>(shapeObjects[i]->GetLayer());
         if (layerIdx >= collidersByLayer.size()) continue;
-        collidersByLayer[layerIdx].push_back(collider);
+        collidersByLayer[layerIdx].push_back(i);
     }
 
-    std::set<CollisionPair> currentCollisions;
+    CollisionSet currentCollisions;
 
-    auto tryCollision = [&](const std::shared_ptr<Collider2D>& a, const std::shared_ptr<Collider2D>& b) {
-        auto goA = a->GetGameObject();
-        auto goB = b->GetGameObject();
-        if (!goA || !goB) return;
+    auto tryCollision = [&](int a, int b) {
+        const auto& goA = shapeObjects[a];
+        const auto& goB = shapeObjects[b];
 
         auto pair = MakeOrderedPair(goA, goB);
         if (currentCollisions.count(pair)) return;
 
-        if (CollisionDispatcher::CheckCollision(a, b)) {
+        if (CollisionDispatcher::CheckCollision(shapes[a], shapes[b])) {
             currentCollisions.insert(pair);
 
             if (!previousCollisions.count(pair)) {
@@ -268,8 +295,8 @@ void CollisionManager::CheckCollisionsLayerVsLayerMode(std::vector<std::pair<Col
                 }
             }
             else {
-                for (auto& a : listA) {
-                    for (auto& b : listB) {
+                for (int a : listA) {
+                    for (int b : listB) {
                         tryCollision(a, b);
                     }
                 }
@@ -289,16 +316,14 @@ void CollisionManager::CheckCollisionsLayerVsLayerMode(std::vector<std::pair<Col
 #else
 #include <future>
 void CollisionManager::CheckCollisionsLayerVsLayerMode(std::vector<std::pair<CollisionPair, CollisionEventType>>& collisionEvents) {
-    std::vector<std::vector<std::shared_ptr<Collider2D>>> collidersByLayer((size_t)Layer::Count);
-
-    for (auto& collider : colliders) {
-        if (!collider->IsEnabled()) continue;
-        auto go = collider->GetGameObject();
-        if (!go || !go->IsActive()) continue;
-        collidersByLayer[(size_t)go->GetLayer()].push_back(collider);
+    std::vector<std::vector<int>> collidersByLayer((size_t)Layer::Count);
+    for (int i = 0; i < (int)shapes.size(); ++i) {
+        auto layerIdx = static_cast<size_t>(shapeObjects[i]->GetLayer());
+        if (layerIdx >= collidersByLayer.size()) continue;
+        collidersByLayer[layerIdx].push_back(i);
     }
 
-    std::unordered_set<std::pair<uintptr_t, uintptr_t>, pair_hash> currentCollisions;
+    CollisionSet currentCollisions;
     std::mutex mutex;  // currentCollisions 用
 
     std::vector<std::future<std::vector<std::pair<CollisionPair, CollisionEventType>>>> futures;
@@ -312,32 +337,25 @@ void CollisionManager::CheckCollisionsLayerVsLayerMode(std::vector<std::pair<Col
 
             if (listA.empty() || listB.empty()) continue;
 
-            futures.push_back(std::async(std::launch::async, [&, listA, listB, i, j]() {
+            futures.push_back(std::async(std::launch::async, [&, i, j]() {
                 std::vector<std::pair<CollisionPair, CollisionEventType>> localEvents;
 
                 for (size_t a = 0; a < listA.size(); ++a) {
                     size_t bStart = (i == j) ? a + 1 : 0;
                     for (size_t b = bStart; b < listB.size(); ++b) {
-                        auto aCol = listA[a];
-                        auto bCol = listB[b];
-                        if (!aCol || !bCol) continue;
-                        auto goA = aCol->GetGameObject();
-                        auto goB = bCol->GetGameObject();
-                        if (!goA || !goB) continue;
-
-                        uintptr_t addrA = reinterpret_cast<uintptr_t>(goA.get());
-                        uintptr_t addrB = reinterpret_cast<uintptr_t>(goB.get());
-                        auto pairKey = addrA < addrB ? std::make_pair(addrA, addrB) : std::make_pair(addrB, addrA);
-
-                        if (aCol->CheckCollision(bCol)) {
-                            std::lock_guard<std::mutex> lock(mutex);
-                            if (currentCollisions.insert(pairKey).second) {
-                                if (previousCollisions.count(pairKey)) {
-                                    localEvents.push_back({ {goA, goB}, CollisionEventType::Stay });
-                                }
-                                else {
-                                    localEvents.push_back({ {goA, goB}, CollisionEventType::Enter });
-                                }
+                        const int ia = listA[a];
+                        const int ib = listB[b];
+                        if (!CollisionDispatcher::CheckCollision(shapes[ia], shapes[ib])) continue;
+
+                        // 通し番号順の組をそのまま鍵にする (Exit でオブジェクトを探し直さない).
+                        auto pairKey = MakeOrderedPair(shapeObjects[ia], shapeObjects[ib]);
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (currentCollisions.insert(pairKey).second) {
+                            if (previousCollisions.count(pairKey)) {
+                                localEvents.push_back({ pairKey, CollisionEventType::Stay });
+                            }
+                            else {
+                                localEvents.push_back({ pairKey, CollisionEventType::Enter });
                             }
                         }
                     }
@@ -355,11 +373,7 @@ void CollisionManager::CheckCollisionsLayerVsLayerMode(std::vector<std::pair<Col
     // 衝突終了イベントの判定（Exit）
     for (const auto& pair : previousCollisions) {
         if (!currentCollisions.count(pair)) {
-            collisionEvents.push_back({
-                { GameObjectMgr::GetInstance().FindByRawPtr(pair.first),
-                  GameObjectMgr::GetInstance().FindByRawPtr(pair.second) },
-                CollisionEventType::Exit
-                });
+            collisionEvents.push_back({ pair, CollisionEventType::Exit });
         }
     }
 
@@ -6,6 +6,7 @@
 
 #define DEBUG_COLLIDER  (_DEBUG && true)
 #include <set>
+#include <unordered_set>
 
 #ifdef min
 #undef min
@@ -46,10 +47,27 @@ private:
 
     using CollisionPair = std::pair<std::shared_ptr<GameObject>, std::shared_ptr<GameObject>>;
 
+    //  (InstanceID) ŕׂ. AhXƃCxgsƂɕς胊vC.
+    struct CollisionPairLess {
+        bool operator()(const CollisionPair& a, const CollisionPair& b) const;
+    };
+    using CollisionSet = std::set<CollisionPair, CollisionPairLess>;
+
     // Փ˃yAiEnter/ExitǗpj
-    std::set<CollisionPair> previousCollisions;
+    CollisionSet previousCollisions;
     std::vector<std::shared_ptr<Collider2D>> colliders; // o^ꂽRC_[̃Xg
 
+    // Xebv̗LȃRC_[Ƃ̃[h` (CfbNXőΉ).
+    std::vector<ColliderShape> shapes;
+    std::vector<std::shared_ptr<GameObject>> shapeObjects;
+    size_t shapeBuildCount = 0;                         // ݌v̌`쐬 (Transform QƉ񐔂̖ڈ)
+
+    bool bulkRemoving = false;                          // ꊇ폜
+    std::unordered_set<std::shared_ptr<Collider2D>> bulkRemoved;   // ꊇ폜 Remove ꂽ (AhX̍ėpŎႦȂ悤QƂŎ)
+
+    int addBatchDepth = 0;                              // BeginBatch ̓q̐[
+    std::vector<std::shared_ptr<Collider2D>> pendingAdds;   // ob`ɒǉꂽ (EndBatch ł܂Ƃ߂ēo^)
+
     // QuadTrue Auto;
     bool useQuadTree = true;
     bool isQuadTrueSizeAuto;
@@ -71,16 +89,52 @@ public:
     }
 
     void AddCollider(const std::shared_ptr<Collider2D>& collider) {
+        if (addBatchDepth > 0) {
+            pendingAdds.push_back(collider);
+            return;
+        }
         colliders.push_back(collider);
     }
 
+    // ëꊇȂǂ̊Ԃ AddCollider 𗭂߂, EndBatch  1 xɓo^.
+    void BeginBatch() { ++addBatchDepth; }
+    void EndBatch() {
+        if (addBatchDepth == 0 || --addBatchDepth > 0) return;
+        colliders.insert(colliders.end(), pendingAdds.begin(), pendingAdds.end());
+        pendingAdds.clear();
+    }
+
     void RemoveCollider(const std::shared_ptr<Collider2D>& collider) {
+        if (bulkRemoving) {
+            bulkRemoved.insert(collider);
+            return;
+        }
+        // ob`ɒǉĂ܂o^ĂȂ.
+        if (addBatchDepth > 0) {
+            auto pending = std::find(pendingAdds.begin(), pendingAdds.end(), collider);
+            if (pending != pendingAdds.end()) {
+                pendingAdds.erase(pending);
+                return;
+            }
+        }
         colliders.erase(std::remove(colliders.begin(), colliders.end(), collider), colliders.end());
     }
 
+    // ʍ폜̊Ԃ RemoveCollider 𗭂߂, EndBulkRemove  1 xɋl߂.
+    void BeginBulkRemove() { bulkRemoving = true; }
+    void EndBulkRemove() {
+        bulkRemoving = false;
+        if (bulkRemoved.empty()) return;
+        colliders.erase(std::remove_if(colliders.begin(), colliders.end(),
+            [this](const std::shared_ptr<Collider2D>& c) { return bulkRemoved.count(c) != 0; }),
+            colliders.end());
+        bulkRemoved.clear();
+    }
+
     void Reset() {
         previousCollisions.clear();
         colliders.clear();
+        pendingAdds.clear();
     }
 
     void RemoveCollisionObject(std::shared_ptr<GameObject>);
@@ -95,6 +149,7 @@ public:
         if (newMode == mode) return;
         mode = newMode;
     }
+    CollisionCheckMode GetColliderCheckMode() const { return mode; }
 
     void SetMyRectangleSize(MyRectangle size) {
         myRectangleSize = size;
@@ -111,7 +166,14 @@ public:
     void SetQuadTreeSetting(bool is) {
         useQuadTree = is;
     }
+
+    // Xebvō쐬[h`.
+    const std::vector<ColliderShape>& GetShapes() const { return shapes; }
+    // Ň`쐬 (1 RC_[ 1 Xebvɂ 1).
+    size_t GetShapeBuildCount() const { return shapeBuildCount; }
 private:
+    // LȃRC_[̃[h`܂Ƃ߂č쐬 (1 Xebv 1 ).
+    void BuildShapes();
     MyRectangle CalculateWorldBounds();
     // QuadTreegp蔻.
     void CheckCollisionsQuadTreeMode(std::vector<std::pair<CollisionPair, CollisionEventType>>&);
@@ -122,7 +184,6 @@ private:
         return (static_cast<uint64_t>(std::min(a, b)) << 32) | static_cast<uint64_t>(std::max(a, b));
     }
 
-    CollisionPair MakeOrderedPair(const std::shared_ptr<GameObject>& a, const std::shared_ptr<GameObject>& b) {
-        return (a < b) ? std::make_pair(a, b) : std::make_pair(b, a);
-    }
+    // InstanceID ̏ɂyA.
+    CollisionPair MakeOrderedPair(const std::shared_ptr<GameObject>& a, const std::shared_ptr<GameObject>& b);
 };
\ No newline at end of file
@@ -1,42 +1,29 @@
 #include "CollisionDispatcher.h"
 #include "GameObject.h"
 #include "Transform2D.h"
-#include <emmintrin.h>
-
-#if defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__) || defined(__AVX__)
-#define USE_SIMD
-#endif
-
-bool CollisionDispatcher::CheckCollision(std::shared_ptr<Collider2D> a, std::shared_ptr<Collider2D> b) {
-    // BoxCollider - CircleCollider
-    if (auto boxA = std::dynamic_pointer_cast<BoxCollider>(a)) {
-        if (auto boxB = std::dynamic_pointer_cast<BoxCollider>(b)) {
-            // Boxm̔
-            return CheckBoxBox(boxA, boxB);
-        }
-        if (auto circleB = std::dynamic_pointer_cast<CircleCollider>(b)) {
-            // Box-Circle
-            return CheckBoxCircle(boxA, circleB);
-        }
-    }
-    // CircleCollider - BoxCollider
-    if (auto circleA = std::dynamic_pointer_cast<CircleCollider>(a)) {
-        if (auto boxB = std::dynamic_pointer_cast<BoxCollider>(b)) {
-            // Circle-Box Box-CircleƓȂ̂ŁAtŌĂ
-            return CheckBoxCircle(boxB, circleA);
-        }
-        if (auto circleB = std::dynamic_pointer_cast<CircleCollider>(b)) {
-            return CheckCircleCircle(circleA, circleB);
-        }
+#include "Simd.h"
+
+bool CollisionDispatcher::CheckCollision(const ColliderShape& a, const ColliderShape& b) {
+    if (a.type == ColliderShapeType::Box) {
+        // Boxm̔
+        if (b.type == ColliderShapeType::Box) return CheckBoxBox(a.obb, b.obb);
+        // Box-Circle
+        return CheckBoxCircle(a.obb, b.center, b.radius);
     }
-
-    return false;
+    // Circle-Box Box-CircleƓȂ̂ŁAtŌĂ
+    if (b.type == ColliderShapeType::Box) return CheckBoxCircle(b.obb, a.center, a.radius);
+    return CheckCircleCircle(a.center, a.radius, b.center, b.radius);
 }
 
-bool CollisionDispatcher::CheckBoxBox(std::shared_ptr<BoxCollider> a, std::shared_ptr<BoxCollider> b) {
-    OBB obbA = a->GetOBB();
-    OBB obbB = b->GetOBB();
+bool CollisionDispatcher::CheckCollision(std::shared_ptr<Collider2D> a, std::shared_ptr<Collider2D> b) {
+    if (!a || !b) return false;
+    ColliderShape shapeA, shapeB;
+    a->BuildShape(shapeA);
+    b->BuildShape(shapeB);
+    return CheckCollision(shapeA, shapeB);
+}
 
+bool CollisionDispatcher::CheckBoxBox(const OBB& obbA, const OBB& obbB) {
     // Փ˔Ɏg4i2Dj
     const Vector2D axes[] = {
         obbA.axes[0],
@@ -111,32 +98,14 @@ void CollisionDispatcher::ProjectOBB(const OBB& obb, const Vector2D& axis, float
 #endif
 }
 
-bool CollisionDispatcher::CheckCircleCircle(std::shared_ptr<CircleCollider> a, std::shared_ptr<CircleCollider> b) {
-    Vector2D centerA = a->GetGameObject()->transform->GetWorldPosition();
-    Vector2D centerB = b->GetGameObject()->transform->GetWorldPosition();
-
-    Vector2D scaleA = a->GetGameObject()->transform->GetWorldScale();
-    Vector2D scaleB = b->GetGameObject()->transform->GetWorldScale();
-
-    float uniformScaleA = Mathf::Min(scaleA.x, scaleA.y);
-    float uniformScaleB = Mathf::Min(scaleB.x, scaleB.y);
-
-    float radiusA = a->GetRadius() * uniformScaleA;
-    float radiusB = b->GetRadius() * uniformScaleB;
-
+bool CollisionDispatcher::CheckCircleCircle(const Vector2D& centerA, float radiusA, const Vector2D& centerB, float radiusB) {
     float distSq = (centerA - centerB).LengthSquared();
     float radiusSum = radiusA + radiusB;
 
     return distSq <= radiusSum * radiusSum;
 }
 
-bool CollisionDispatcher::CheckBoxCircle(std::shared_ptr<BoxCollider> box, std::shared_ptr<CircleCollider> circle) {
-    OBB obb                 = box->GetOBB();
-    Vector2D circleCenter   = circle->GetGameObject()->transform->GetWorldPosition();
-    Vector2D scale          = circle->GetGameObject()->transform->GetWorldScale();
-    float uniformScale      = Mathf::Min(scale.x, scale.y);
-    float circleRadius      = circle->GetRadius() * uniformScale;
-
+bool CollisionDispatcher::CheckBoxCircle(const OBB& obb, const Vector2D& circleCenter, float circleRadius) {
     // ~̒SOBB̋ǏWnɕϊ
     Vector2D dir = circleCenter - obb.center;
 
@@ -3,15 +3,17 @@
 
 class CollisionDispatcher {
 public:
+    // 쐬ς݂̃[h`󓯎mŔ (CollisionManager 疈t[gp).
+    static bool CheckCollision(const ColliderShape& a, const ColliderShape& b);
+    // ̏Ō`Ĕ.
     static bool CheckCollision(std::shared_ptr<Collider2D> a, std::shared_ptr<Collider2D> b);
 private:
 
-    static bool CheckBoxBox(std::shared_ptr<BoxCollider> a, std::shared_ptr<BoxCollider> b);
+    static bool CheckBoxBox(const OBB& a, const OBB& b);
     static void ProjectOBB(const OBB& obb, const Vector2D& axis, float& min, float& max);
-    static bool CheckBoxCircle(std::shared_ptr<BoxCollider> box, std::shared_ptr<CircleCollider> circle);
+    static bool CheckBoxCircle(const OBB& box, const Vector2D& circleCenter, float circleRadius);
 
 private:
-    static bool CheckCircleCircle(std::shared_ptr<CircleCollider> a, std::shared_ptr<CircleCollider> b);
+    static bool CheckCircleCircle(const Vector2D& centerA, float radiusA, const Vector2D& centerB, float radiusB);
 
 };
-
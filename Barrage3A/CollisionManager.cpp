@@ -298,7 +298,7 @@ void CollisionManager::CheckCollisionsLayerVsLayerMode(std::vector<std::pair<Col
         collidersByLayer[(size_t)go->GetLayer()].push_back(collider);
     }
 
-    std::unordered_set<std::pair<uintptr_t, uintptr_t>, pair_hash> currentCollisions;
+    CollisionSet currentCollisions;
     std::mutex mutex;  // currentCollisions 用
 
     std::vector<std::future<std::vector<std::pair<CollisionPair, CollisionEventType>>>> futures;
@@ -325,18 +325,17 @@ void CollisionManager::CheckCollisionsLayerVsLayerMode(std::vector<std::pair<Col
                         auto goB = bCol->GetGameObject();
                         if (!goA || !goB) continue;
 
-                        uintptr_t addrA = reinterpret_cast<uintptr_t>(goA.get());
-                        uintptr_t addrB = reinterpret_cast<uintptr_t>(goB.get());
-                        auto pairKey = addrA < addrB ? std::make_pair(addrA, addrB) : std::make_pair(addrB, addrA);
+                        // 通し番号順の組をそのまま鍵にする (Exit でオブジェクトを探し直さない).
+                        auto pairKey = MakeOrderedPair(goA, goB);
 
                         if (aCol->CheckCollision(bCol)) {
                             std::lock_guard<std::mutex> lock(mutex);
                             if (currentCollisions.insert(pairKey).second) {
                                 if (previousCollisions.count(pairKey)) {
-                                    localEvents.push_back({ {goA, goB}, CollisionEventType::Stay });
+                                    localEvents.push_back({ pairKey, CollisionEventType::Stay });
                                 }
                                 else {
-                                    localEvents.push_back({ {goA, goB}, CollisionEventType::Enter });
+                                    localEvents.push_back({ pairKey, CollisionEventType::Enter });
                                 }
                             }
                         }
@@ -355,11 +354,7 @@ void CollisionManager::CheckCollisionsLayerVsLayerMode(std::vector<std::pair<Col
     // 衝突終了イベントの判定（Exit）
     for (const auto& pair : previousCollisions) {
         if (!currentCollisions.count(pair)) {
-            collisionEvents.push_back({
-                { GameObjectMgr::GetInstance().FindByRawPtr(pair.first),
-                  GameObjectMgr::GetInstance().FindByRawPtr(pair.second) },
-                CollisionEventType::Exit
-                });
+            collisionEvents.push_back({ pair, CollisionEventType::Exit });
         }
     }
 
@@ -25,6 +25,8 @@
 #include <vector>
 #include <thread>
 #include <functional>
+
+#include "Metrics.h"
 // vO C# ɕύX}N.
 #define null     nullptr
 #define _yield   co_yield
@@ -402,6 +404,7 @@ namespace System {
                     [](auto& c) { return !c->Update(); }),
                 coroutines.end()
             );
+            Metrics::GetInstance().Set(Metric::Coroutines, coroutines.size());
         }
 
         bool IsAllCoroutinesFinished() const {
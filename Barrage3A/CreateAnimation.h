@@ -372,7 +372,7 @@ void CreateBulletAnimator()
                 s = Mathf::Lerp(peakScale, 0.0f, k);
             }
 
-            sp->GetGameObject()->transform->scale = { s, s };
+            sp->GetGameObject()->transform->SetScale({ s, s });
             };
 
         hitState.AddTween(scaleTween);
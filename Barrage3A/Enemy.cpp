@@ -21,6 +21,8 @@
 #include "MusicController.h"
 #include "AudioResourceShortcut.hpp"
 #include "GameManager.h"
+#include "EnemyScriptManager.h"
+#include "SnapshotStream.h"
 Enemy::Enemy() : AppBase("Enemy") {}
 Enemy::Enemy(std::shared_ptr<GameObject> o) : AppBase("Enemy", o) {}
 
@@ -31,6 +33,7 @@ void Enemy::Awake() {
 void Enemy::Start() {
 	previousPosition = transform->position;
 	animator = gameObject->GetAppBase<Animator>();
+	if (animator) isMovingParamId = animator->GetParameterId("isMoving");
 	spriteRenderer = gameObject->GetAppBase<SpriteRenderer>();
 }
 
@@ -38,8 +41,8 @@ void Enemy::Update() {
 
     if (GameManager::GetInstance().IsPause()) return;
 
-    if (script && !script->IsFinished()) 
-        script->Update(*this);
+    if (script.IsRunning())
+        script.Update(*this);
     else if (IsOutsideScreen(transform->position))
         Destroy();
 
@@ -58,7 +61,7 @@ void Enemy::Update() {
                 moving = true;
             }
             // パラメータは一度だけセット
-            animator->SetBool("isMoving", moving);
+            animator->SetBool(isMovingParamId, moving);
         }
     }
 
@@ -78,11 +81,11 @@ void Enemy::Update() {
 
     velocity += acceleration;
 
-    transform->position += velocity;
+    transform->Translate(velocity);
 
     // 弾発射スクリプトもあればUpdate
-    if (shotScript && !shotScript->IsFinished()) {
-        shotScript->Update(transform->position);
+    if (shotScript.IsRunning()) {
+        shotScript.Update(transform->position);
     }
 }
 
@@ -92,9 +95,9 @@ void Enemy::Damage(int _damage) {
     if (status.hp <= 0 && gameObject->IsActive()) {
         gameObject->SetActive(false);
         DropItem();
-		PrefabMgr.Instantiate("EnemyDestroyEffect")[0]->transform->position = transform->position;
+		PrefabMgr.Instantiate("EnemyDestroyEffect")[0]->transform->SetPosition(transform->position);
         if (auto sound = Sounds["enemy_destroy"]) {
-			MusicController::GetInstance()->OneShotAudio(sound->Clone(), 0.75f);
+			MusicController::GetInstance()->OneShotAudio(sound, 0.75f);
         }
         Destroy();
     }
@@ -106,8 +109,8 @@ void Enemy::DropItem() {
             auto pos = transform->position;
             // 1以外だったらランダム.
             if (data.quantity != 1) {
-                pos.x += Random.Range(-32.0f, 32.0f);
-                pos.y += Random.Range(-32.0f, 32.0f);
+                pos.x += Random.Stream(RandomStream::Item).Range(-32.0f, 32.0f);
+                pos.y += Random.Stream(RandomStream::Item).Range(-32.0f, 32.0f);
             }
             ItemManager::GetInstance().CreateItem(data.type, pos);
         }
@@ -119,7 +122,7 @@ void Enemy::OnDestroy() {
 }
 
 Vector2D Enemy::GetPosition() const { return transform->position; }
-void Enemy::SetPosition(const Vector2D& p) { transform->position = p; }
+void Enemy::SetPosition(const Vector2D& p) { transform->SetPosition(p); }
 Vector2D Enemy::GetVelocity() const { return velocity; }
 void Enemy::SetVelocity(const Vector2D& v) { velocity = v; }
 float Enemy::GetRotation() const { return rotation; }
@@ -181,10 +184,8 @@ void Enemy::Accelerate(const Vector2D& a) {
 void Enemy::Rotate(float deltaAngle) {
     rotation += deltaAngle;
 }
-void Enemy::FireShot(const std::string& shotScriptID) {
-    // 仮実装: ShotManagerなどと連携して実装する予定
-    printf("[Enemy] FireShot: %s\n", shotScriptID.c_str());
-    shotScript = ShotScriptManager::GetInstance().CloneShotScript(shotScriptID);
+void Enemy::FireShot(uint32_t shotNameId) {
+    shotScript.Start(ShotScriptManager::GetInstance().FindProgram(shotNameId));
 }
 void Enemy::SetType(int templateId, int colorId) {
     // 仮実装: 弾テンプレートと色を設定
@@ -198,3 +199,44 @@ void Enemy::SetOffset(int slot, const Vector2D& offset) {
     // 発射スロットのオフセット保存など
     printf("[Enemy] SetOffset: slot=%d, offset=(%.2f, %.2f)\n", slot, offset.x, offset.y);
 }
+
+void Enemy::SaveState(SnapshotWriter& out) const {
+    MotionState motion;
+    motion.position          = transform->position;
+    motion.transformRotation = transform->rotation;
+    motion.velocity          = velocity;
+    motion.acceleration      = acceleration;
+    motion.rotation          = rotation;
+    motion.previousPosition  = previousPosition;
+    motion.hp                = status.hp;
+    motion.damageFlashTimer  = damageFlashTimer;
+    out.Write(motion);
+    out.WriteVector(dropItems);
+
+    out.Write(script.GetProgramId());
+    if (script.GetProgramId() != EnemyScript::NoProgram) script.SaveState(out);
+    out.Write(shotScript.GetProgramId());
+    if (shotScript.GetProgramId() != ShotScript::NoProgram) shotScript.SaveState(out);
+}
+
+void Enemy::LoadState(SnapshotReader& in) {
+    const auto motion = in.Read<MotionState>();
+    transform->SetPosition(motion.position);
+    transform->SetRotation(motion.transformRotation);
+    velocity            = motion.velocity;
+    acceleration        = motion.acceleration;
+    rotation            = motion.rotation;
+    previousPosition    = motion.previousPosition;
+    status.hp           = motion.hp;
+    damageFlashTimer    = motion.damageFlashTimer;
+    in.ReadVector(dropItems);
+
+    // 登録が見つからない場合も状態は読み捨てて位置を合わせる.
+    const uint32_t scriptId = in.Read<uint32_t>();
+    script.Start(EnemyScriptManager::GetInstance().GetProgram(scriptId));
+    if (scriptId != EnemyScript::NoProgram) script.LoadState(in);
+
+    const uint32_t shotId = in.Read<uint32_t>();
+    shotScript.Start(ShotScriptManager::GetInstance().GetProgram(shotId));
+    if (shotId != ShotScript::NoProgram) shotScript.LoadState(in);
+}
@@ -17,6 +17,8 @@
 #include "Animator.h"
 #include "SpriteRenderer.h"
 class EnemyScript;  // 前方宣言
+class SnapshotWriter;
+class SnapshotReader;
 
 struct EnemyStatus {
     int hp = 100;
@@ -36,15 +38,30 @@ private:
     Vector2D acceleration               = Vector2D(0, 0);
     Vector2D velocity                   = Vector2D(0,0);
     float rotation                      = 0.f;
-    std::shared_ptr<EnemyScript> script     = nullptr;
-    std::shared_ptr<ShotScript> shotScript = nullptr;
-    std::string customUpdateFunctionID;
+    EnemyScript script;                 // 命令列は EnemyScriptManager のものを指すだけ
+    ShotScript shotScript;
+    uint32_t customUpdateFunctionID = ScriptNameTable::NoName;
 	std::shared_ptr<Animator> animator = nullptr; // アニメーション用
+	int isMovingParamId = AnimatorDef::InvalidId;  // Animator パラメータ ID (Start で解決)
 	std::shared_ptr<SpriteRenderer> spriteRenderer = nullptr; // スプライトレンダラー
     Vector2D previousPosition;
 
     int damageFlashTimer = 0;           // フレーム単位（例：5フレーム点滅）
     const int maxDamageFlashFrame = 10;  // 何フレーム暗くするか
+
+    std::string prefabKey;              // 生成元のプレハブ名 (スナップショットからの再生成用)
+
+    // スナップショットに memcpy で書く値.
+    struct MotionState {
+        Vector2D position;
+        float transformRotation = 0.f;
+        Vector2D velocity;
+        Vector2D acceleration;
+        float rotation = 0.f;
+        Vector2D previousPosition;
+        int hp = 0;
+        int damageFlashTimer = 0;
+    };
 public:
     Enemy();
     Enemy(std::shared_ptr<GameObject> owner);
@@ -72,12 +89,12 @@ public:
         acceleration = a;
     }
 
-    void SetCustomUpdateFunction(const std::string& funcId) {
+    void SetCustomUpdateFunction(uint32_t funcId) {
         customUpdateFunctionID = funcId;
     }
 
     const std::string& GetCustomUpdateFunction() const {
-        return customUpdateFunctionID;
+        return ScriptNameTable::GetInstance().Get(customUpdateFunctionID);
     }
 
     Vector2D GetPosition() const;
@@ -90,7 +107,7 @@ public:
     void Damage(int _damage);
 
     // スクリプト連携API
-    void SetScript(std::shared_ptr<EnemyScript> s) { script = s; }
+    void SetScript(const EnemyProgram* program) { script.Start(program); }
     void SetHp(int hp);
     void SetHitboxEnable(bool enabled);
     void SetAngle(float);
@@ -101,12 +118,19 @@ public:
 
     void Accelerate(const Vector2D& a);
     void Rotate(float deltaAngle);
-    void FireShot(const std::string& shotScriptID);
+    void FireShot(uint32_t shotNameId);
     void SetType(int templateId, int colorId);
     void EmitEffect(int effectId);
     void SetOffset(int slot, const Vector2D& offset);
     float GetAngle() const;
     void OnCollisionEnter(GameObject* other) override;
+
+    void SetPrefabKey(const std::string& key) { prefabKey = key; }
+    const std::string& GetPrefabKey() const { return prefabKey; }
+
+    // 移動・体力・ドロップと両スクリプトの実行状態.
+    void SaveState(SnapshotWriter& out) const;
+    void LoadState(SnapshotReader& in);
 private:
     bool IsOutsideScreen(const Vector2D& pos);
     void DropItem();
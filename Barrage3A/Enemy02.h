@@ -27,7 +27,7 @@ public:
 		// nWAYe + _΂T
 		Vector2D origin = transform->position;
 		BulletPatternFactory::FireNWay(origin, -90.0f, 15.0f, 5, 200.0f);
-		BulletPatternFactory::FireSpread(origin, (int)(Random.Value() * 10));
+		BulletPatternFactory::FireSpread(origin, (int)(Random.Stream(RandomStream::Pattern).Value() * 10));
 		isShot = false;
 		isStete = true;
 	}
@@ -27,7 +27,7 @@ public:
 		}
 		// {̉ړ{Eɗh
 		float offsetX = sinf(Time.time * 2.0f) * waveAmplitude;
-		transform->position = origin + Vector2D(offsetX, -count * speed * Time.deltaTime);
+		transform->SetPosition(origin + Vector2D(offsetX, -count * speed * Time.deltaTime));
 	}
 
 	void Shot() override {
@@ -37,7 +37,7 @@ public:
 		case State::ENTER:
 			vel = Vector2D(0, 1); // Ɉړ
 			if (transform->position.y >= targetPos.y) {
-				transform->position.y = targetPos.y;
+				transform->SetPosition(Vector2D(transform->position.x, targetPos.y));
 				vel = Vector2D(0, 0); // ~
 				state = State::ATTACK;
 			}
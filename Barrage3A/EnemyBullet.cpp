@@ -15,6 +15,7 @@
 #include "MusicController.h"
 #include "AudioResourceShortcut.hpp"
 #include "BulletManager.h"
+#include "SnapshotStream.h"
 // コンストラクタ 
 EnemyBullet::EnemyBullet(){
 
@@ -40,11 +41,11 @@ void EnemyBullet::OnCollisionEnter(GameObject* other) {
             auto music = MusicController::GetInstance();
             if (music)
             {
-                music->OneShotAudio(Sounds["graze"]->Clone());
+                music->OneShotAudio(Sounds["graze"]);
             }
             // 弾とGrazeの中間点にエフェクトを配置する（演出的に自然）
             auto obj = PrefabManager::GetInstance().Instantiate("GrazeEffect")[0];
-            obj->transform->position = transform->position;
+            obj->transform->SetPosition(transform->position);
             GameManager::GetInstance().GetGrazeManager().Add(1);
 
         }
@@ -52,4 +53,14 @@ void EnemyBullet::OnCollisionEnter(GameObject* other) {
     }
     gameObject->SetActive(false);
     Destroy();
-}
\ No newline at end of file
+}
+
+void EnemyBullet::SaveState(SnapshotWriter& out) const {
+    BulletBase::SaveState(out);
+    out.Write(isGraze);
+}
+
+void EnemyBullet::LoadState(SnapshotReader& in) {
+    BulletBase::LoadState(in);
+    in.Read(isGraze);
+}
@@ -30,6 +30,9 @@ public:     // 公開.
     void SetBulletControllerInstance(std::shared_ptr<BulletControllerBase> ctrl) {
         controller = std::move(ctrl);
     }
+
+    void SaveState(SnapshotWriter& out) const override;
+    void LoadState(SnapshotReader& in) override;
 protected:
     std::shared_ptr<AppBase> Clone() const override {
         return std::make_shared<EnemyBullet>(*this);
@@ -6,6 +6,7 @@
 #include "Enemy03.h"
 #include "Enemy04.h"
 #include "GameManager.h"
+#include "SnapshotStream.h"
 #define ENEMY_LIST_MAX (2)
 
 EnemyManager::EnemyManager() {}
@@ -61,6 +62,7 @@ void EnemyManager::LoadCSV(const std::string& path) {
 		meta.position.y = SafeStof(row[2]);
 		meta.type = row[3];
 		meta.scriptType = row[4];
+		meta.row = static_cast<int>(originalSpawnList.size());
 
 		// }X^[Rs[ɒǉ
 		originalSpawnList.push_back(meta);
@@ -120,6 +122,7 @@ void EnemyManager::Update() {
 
 // G̏o
 void EnemyManager::Spawn() {
+	spawnedRows.clear();
 	if (spawnList.empty()) return;
 
 	frameCnt++;
@@ -161,7 +164,7 @@ void EnemyManager::Spawn() {
 
 			// --- Prefab & Script ---
 			const std::string& scriptKey = it->scriptType;
-			auto script = EnemyScriptManager::GetInstance().CloneEnemyScript(scriptKey);
+			const EnemyProgram* script = EnemyScriptManager::GetInstance().FindProgram(scriptKey);
 			if (!script) {
 				Debug::WarningLog("Script܂: " + scriptKey);
 				it = spawnList.erase(it);
@@ -182,11 +185,13 @@ void EnemyManager::Spawn() {
 			}
 
 			auto enemyObj = list[0];
-			enemyObj->transform->position = it->position;
+			enemyObj->transform->SetPosition(it->position);
 
 			auto enemy = enemyObj->AddAppBase<Enemy>();
 			if (enemy) {
 				enemy->SetScript(script);
+				enemy->SetPrefabKey(prefabKey);
+				spawnedRows.push_back(it->row);
 				Debug::Log("Spawn: " + prefabKey);
 			}
 
@@ -235,4 +240,78 @@ void EnemyManager::AllEnemyDamage(int damage) {
 			enemy->Damage(damage);
 		}
 	}
-}
\ No newline at end of file
+}
+void EnemyManager::SeekSpawn(int row) {
+	if (row < 0 || row >= static_cast<int>(originalSpawnList.size())) return;
+
+	spawnList.assign(originalSpawnList.begin() + row, originalSpawnList.end());
+	//  Spawn  frameCnt ił傤ǏoɂȂ悤.
+	frameCnt = originalSpawnList[row].spawnTime - 1;
+	spawnedRows.clear();
+}
+
+void EnemyManager::SaveState(SnapshotWriter& out) const {
+	out.Write(currentCsvIndex);
+	out.Write(repeatCount);
+	out.Write(frameCnt);
+
+	// c̏o\͍sԍ (g CSV ).
+	out.Write(static_cast<uint32_t>(spawnList.size()));
+	for (const auto& s : spawnList) out.Write(s.row);
+
+	auto isAlive = [](const std::shared_ptr<Enemy>& enemy) {
+		const auto& go = enemy ? enemy->GetGameObject() : nullptr;
+		return go && go->IsActive() && !go->IsPendingDestroy();
+	};
+	uint32_t count = 0;
+	for (const auto& enemy : enemys) {
+		if (isAlive(enemy)) ++count;
+	}
+	out.Write(count);
+	for (const auto& enemy : enemys) {
+		if (!isAlive(enemy)) continue;
+		out.Write(enemy->GetGameObject()->GetInstanceID());
+		out.WriteString(enemy->GetPrefabKey());
+		const size_t block = out.BeginBlock();
+		enemy->SaveState(out);
+		out.EndBlock(block);
+	}
+}
+
+void EnemyManager::LoadState(SnapshotReader& in) {
+	const int csvIndex = in.Read<int>();
+	if (in.IsFailed()) return;
+	if (csvIndex != currentCsvIndex && csvIndex >= 0 && csvIndex < static_cast<int>(csvFiles.size())) {
+		currentCsvIndex = csvIndex;
+		LoadCurrentCSV();
+	}
+	in.Read(repeatCount);
+	in.Read(frameCnt);
+
+	spawnList.clear();
+	for (uint32_t i = in.Read<uint32_t>(); i > 0 && !in.IsFailed(); --i) {
+		const int row = in.Read<int>();
+		if (row >= 0 && row < static_cast<int>(originalSpawnList.size())) {
+			spawnList.push_back(originalSpawnList[row]);
+		}
+	}
+	spawnedRows.clear();
+
+	std::string prefabKey;
+	for (uint32_t i = in.Read<uint32_t>(); i > 0 && !in.IsFailed(); --i) {
+		const auto instanceId = in.Read<uint64_t>();
+		in.ReadString(prefabKey);
+		const size_t end = in.BeginBlock();
+
+		if (PrefabMgr.HasPrefab(prefabKey)) {
+			auto list = PrefabMgr.Instantiate(prefabKey);
+			if (!list.empty()) {
+				list[0]->RestoreInstanceID(instanceId);
+				auto enemy = list[0]->AddAppBase<Enemy>();
+				enemy->SetPrefabKey(prefabKey);
+				enemy->LoadState(in);
+			}
+		}
+		in.EndBlock(end);
+	}
+}
@@ -7,6 +7,9 @@
 #include <vector>
 #include <algorithm>
 
+class SnapshotWriter;
+class SnapshotReader;
+
 // --------------------------------------------------
 //  EnemyManageriG̈ꊇǗj
 // --------------------------------------------------
@@ -20,6 +23,7 @@ private:
 		std::string scriptType; // XNvg
 		int spawnTime = 0;
 		Vector2D position;
+		int row = 0;            // CSV ̍sԍ (originalSpawnList ̓Y)
 	};
 
 	std::vector<std::string> csvFiles;
@@ -34,6 +38,7 @@ private:
 	std::vector<SpawnData> originalSpawnList;
 
 	std::vector<std::shared_ptr<Enemy>> enemys;
+	std::vector<int> spawnedRows;                      // t[ɏos
 	std::unordered_map<std::string, std::function<std::shared_ptr<EnemyBase>(float, const Vector2D&)>> factories;
 
 	float SafeStof(const std::string& s);
@@ -54,4 +59,15 @@ public:
 	const std::vector<std::shared_ptr<Enemy>>& GetEnemys() const;
 	std::shared_ptr<GameObject> GetEnemyTarget(const Vector2D& pos);
 	void AllEnemyDamage(int damage);
+
+	// on_ (CSV ̍s) ̏. K[h̍ĊJʒuɎg.
+	int GetCurrentCsvIndex() const { return currentCsvIndex; }
+	int GetSpawnPointCount() const { return static_cast<int>(originalSpawnList.size()); }
+	const std::vector<int>& GetSpawnedRows() const { return spawnedRows; }
+	// ws̏oO֓o (̓GEe̕Еt͌Ăяo).
+	void SeekSpawn(int row);
+
+	// o̐is󋵂Ɛ̓G. ͊̓Gjς݂̏ԂŌĂ.
+	void SaveState(SnapshotWriter& out) const;
+	void LoadState(SnapshotReader& in);
 };
\ No newline at end of file
@@ -3,22 +3,45 @@
 #include "PathManager.h"
 #include "Enemy.h"
 #include "Mathf.h"
+#include "SnapshotStream.h"
+#include <algorithm>
+
+
+void EnemyProgram::Add(const EnemyInstruction& instr) {
+    EnemyOp op;
+    op.type      = instr.type;
+    op.position  = instr.position;
+    op.vector    = instr.vector;
+    op.angle     = instr.angle;
+    op.duration  = instr.duration;
+    op.extra     = instr.extra;
+    op.loopCount = instr.loopCount;
+    op.name      = ScriptNameTable::GetInstance().Intern(instr.shotScriptID);
+    ops.push_back(op);
+}
 
-
-void EnemyScript::Add(const EnemyInstruction& instr) {
-    instructions.push_back(instr);
+void EnemyScript::Start(const EnemyProgram* _program) {
+    program = _program;
+    ip = 0;
+    frame = 0;
+    startPos = Vector2D(0, 0);
+    finished = false;
+    ResetOpState(-1);
+    loopDepth = 0;
+    callDepth = 0;
 }
 
 void EnemyScript::Update(Enemy& enemy) {
-    if (finished) return;
+    if (finished || !program) return;
+    const std::vector<EnemyOp>& ops = program->GetOps();
 
     while (true) {
-        if (ip >= instructions.size()) {
+        if (ip >= static_cast<int>(ops.size())) {
             finished = true;
             return;
         }
 
-        const EnemyInstruction& instr = instructions[ip];
+        const EnemyOp& instr = ops[ip];
 
         switch (instr.type) {
         case EnemyInstruction::Type::SetHp:
@@ -76,7 +99,7 @@ void EnemyScript::Update(Enemy& enemy) {
             break;
 
         case EnemyInstruction::Type::Fire:
-            enemy.FireShot(instr.shotScriptID);
+            enemy.FireShot(instr.name);
             ip++;
             break;
 
@@ -158,7 +181,7 @@ void EnemyScript::Update(Enemy& enemy) {
         return;
         case EnemyInstruction::Type::FollowPath:
         {
-            auto path = PathManager::GetInstance().GetPath(static_cast<int>(instr.extra));
+            const Path2D* path = PathManager::GetInstance().FindPath(static_cast<int>(instr.extra));
             if (path) {
                 float t = float(frame) / float(instr.duration);
                 Vector2D pos = path->GetPositionAt(t);
@@ -174,37 +197,46 @@ void EnemyScript::Update(Enemy& enemy) {
         return;
         case EnemyInstruction::Type::SetUpdateFunction:
         {
-            enemy.SetCustomUpdateFunction(instr.shotScriptID);  // ֐⃉xœo^
+            enemy.SetCustomUpdateFunction(instr.name);  // ֐⃉xœo^
             ip++;
         }
         return;
 
         case EnemyInstruction::Type::LoopStart:
-            loopStack.push_back({ ip, instr.loopCount });
+            if (loopDepth >= MaxLoopDepth) {
+                // q[. Ή̂Ŏ~߂.
+                finished = true;
+                return;
+            }
+            loopStack[loopDepth++] = { ip, instr.loopCount };
             ip++;
             break;
 
         case EnemyInstruction::Type::LoopEnd:
-            if (loopStack.empty()) {
+            if (loopDepth == 0) {
                 // G[ or 
                 ip++;
                 break;
             }
             {
-                auto& top = loopStack.back();
-                if (--top.second > 0) {
-                    ip = top.first + 1; // [vJn̖̎߂
+                auto& top = loopStack[loopDepth - 1];
+                if (--top.remaining > 0) {
+                    ip = top.startIp + 1; // [vJn̖̎߂
                 }
                 else {
-                    loopStack.pop_back();
+                    --loopDepth;
                     ip++;
                 }
             }
             break;
 
         case EnemyInstruction::Type::CallSubroutine:
-            callStack.push(ip + 1);
-            ip = FindLabel(instr.shotScriptID); // x֐ix߈ʒuj
+            if (callDepth >= MaxCallDepth) {
+                finished = true;
+                return;
+            }
+            callStack[callDepth++] = ip + 1;
+            ip = program->FindLabel(instr.name); // x֐ix߈ʒuj
             if (ip == -1) {
                 // x炸G[I
                 finished = true;
@@ -229,17 +261,17 @@ void EnemyScript::Update(Enemy& enemy) {
         case EnemyInstruction::Type::RandomMove: {
             // instr.position = center, instr.vector.x/y = radiusX/Y, instr.extra = changeInterval, instr.duration = totalDuration (0=infinite)
             int changeInterval = std::max(1, instr.extra);
-            // 񓞒B instrCounters[ip] ݒȂ
-            if (instrCounters.find(ip) == instrCounters.end()) instrCounters[ip] = 0;
+            // 񓞒Bɕ⏕Xe[g
+            if (opStateIp != ip) ResetOpState(ip);
 
             // frame ̖͂ߓŁuԃt[v\i̊Kɍ킹j
             if (frame == 0) {
                 // V^[QbgI
                 float cx = instr.position.x, cy = instr.position.y;
                 float rx = instr.vector.x, ry = instr.vector.y;
-                float tx = Random.Range(cx - rx, cx + rx);
-                float ty = Random.Range(cy - ry, cy + ry);
-                instrPositions[ip] = Vector2D(tx, ty);
+                float tx = Random.Stream(RandomStream::Pattern).Range(cx - rx, cx + rx);
+                float ty = Random.Stream(RandomStream::Pattern).Range(cy - ry, cy + ry);
+                opTarget = Vector2D(tx, ty);
                 startPos = enemy.GetPosition();
             }
 
@@ -247,21 +279,20 @@ void EnemyScript::Update(Enemy& enemy) {
             int localInterval = changeInterval;
             float t = float(frame) / float(localInterval);
             if (t > 1.f) t = 1.f;
-            Vector2D target = instrPositions[ip];
+            Vector2D target = opTarget;
             Vector2D newPos = startPos * (1 - t) + target * t;
             enemy.SetPosition(newPos);
 
             frame++;
-            instrCounters[ip]++; // o߃t[ƂĎg
+            opCounter++; // o߃t[ƂĎg
 
             if (frame >= localInterval) {
                 frame = 0; // ̃^[QbgIԂ߂ɃZbgi Update őIj
             }
 
             // I
-            if (instr.duration > 0 && instrCounters[ip] >= instr.duration) {
-                instrCounters.erase(ip);
-                instrPositions.erase(ip);
+            if (instr.duration > 0 && opCounter >= instr.duration) {
+                ResetOpState(-1);
                 frame = 0;
                 ip++;
             }
@@ -271,35 +302,34 @@ void EnemyScript::Update(Enemy& enemy) {
         case EnemyInstruction::Type::RandomWander: {
             // instr.vector.x/y = amplitudeX/Y, instr.extra = changeInterval, instr.duration = totalDuration
             int changeInterval = std::max(1, instr.extra);
-            if (instrCounters.find(ip) == instrCounters.end()) instrCounters[ip] = 0;
+            if (opStateIp != ip) ResetOpState(ip);
 
             if (frame == 0) {
                 // ȃ^[Qbgi݈ʒu + _ItZbgj
                 Vector2D pos = enemy.GetPosition();
                 float ax = instr.vector.x, ay = instr.vector.y;
-                float tx = pos.x + Random.Range(-ax, ax);
-                float ty = pos.y + Random.Range(-ay, ay);
-                instrPositions[ip] = Vector2D(tx, ty);
+                float tx = pos.x + Random.Stream(RandomStream::Pattern).Range(-ax, ax);
+                float ty = pos.y + Random.Stream(RandomStream::Pattern).Range(-ay, ay);
+                opTarget = Vector2D(tx, ty);
                 startPos = enemy.GetPosition();
             }
 
             int localInterval = changeInterval;
             float t = float(frame) / float(localInterval);
             if (t > 1.f) t = 1.f;
-            Vector2D tgt = instrPositions[ip];
+            Vector2D tgt = opTarget;
             Vector2D newPos = startPos * (1 - t) + tgt * t;
             enemy.SetPosition(newPos);
 
             frame++;
-            instrCounters[ip]++;
+            opCounter++;
 
             if (frame >= localInterval) {
                 frame = 0; // ̏ڕW
             }
 
-            if (instr.duration > 0 && instrCounters[ip] >= instr.duration) {
-                instrCounters.erase(ip);
-                instrPositions.erase(ip);
+            if (instr.duration > 0 && opCounter >= instr.duration) {
+                ResetOpState(-1);
                 frame = 0;
                 ip++;
             }
@@ -317,12 +347,6 @@ void EnemyScript::Update(Enemy& enemy) {
     }
 }
 
-int EnemyScript::FindLabel(const std::string& labelName) const {
-    auto it = labelMap.find(labelName);
-    return (it != labelMap.end()) ? it->second : -1;
-}
-
-
 void EnemyScript::Advance() {
     ip++;
     frame = 0;
@@ -330,4 +354,36 @@ void EnemyScript::Advance() {
 
 bool EnemyScript::IsFinished() const {
     return finished;
-}
\ No newline at end of file
+}
+
+void EnemyScript::SaveState(SnapshotWriter& out) const {
+    out.Write(ip);
+    out.Write(frame);
+    out.Write(startPos);
+    out.Write(finished);
+
+    out.Write(opStateIp);
+    out.Write(opCounter);
+    out.Write(opTarget);
+
+    out.Write(loopDepth);
+    for (int i = 0; i < loopDepth; ++i) out.Write(loopStack[i]);
+    out.Write(callDepth);
+    for (int i = 0; i < callDepth; ++i) out.Write(callStack[i]);
+}
+
+void EnemyScript::LoadState(SnapshotReader& in) {
+    in.Read(ip);
+    in.Read(frame);
+    in.Read(startPos);
+    in.Read(finished);
+
+    in.Read(opStateIp);
+    in.Read(opCounter);
+    in.Read(opTarget);
+
+    loopDepth = std::clamp(in.Read<int>(), 0, MaxLoopDepth);
+    for (int i = 0; i < loopDepth; ++i) in.Read(loopStack[i]);
+    callDepth = std::clamp(in.Read<int>(), 0, MaxCallDepth);
+    for (int i = 0; i < callDepth; ++i) in.Read(callStack[i]);
+}
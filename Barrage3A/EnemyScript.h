@@ -2,9 +2,15 @@
 
 #include "EnemyInstruction.h"
 #include "Mathf.h"
-#include <stack>
+#include "ScriptNameTable.h"
+#include <vector>
+#include <array>
+#include <unordered_map>
+#include <cstdint>
 
 class Enemy;  // O錾
+class SnapshotWriter;
+class SnapshotReader;
 
 struct DropSettings {
     int powerPieceCount = 0;    // ʏP
@@ -16,41 +22,91 @@ struct DropSettings {
     bool guaranteedDrop = true; // ƂƂۏ؂邩
 };
 
+// EnemyInstruction 當𔲂sp̖.
+struct EnemyOp {
+    EnemyInstruction::Type type = EnemyInstruction::Type::End;
+    Vector2D position{};
+    Vector2D vector{};
+    float angle = 0.f;
+    int duration = 0;
+    int extra = 0;
+    int loopCount = 0;
+    uint32_t name = ScriptNameTable::NoName;   // Fire / CallSubroutine / SetUpdateFunction ̖O.
+};
+
+/// <summary>
+/// o^ɈxgݗĂGXNvg̖ߗ (gݗČ͋Lēǂނ).
+/// sԂ EnemyScript .
+/// </summary>
+class EnemyProgram {
+public:
+    static constexpr uint32_t NoProgram = 0xFFFFFFFF;
+private:
+    uint32_t programId = NoProgram;     // EnemyScriptManager ̓o^ԍ
+    std::vector<EnemyOp> ops;
+    std::unordered_map<uint32_t, int> labelMap;     // Oԍ  ߈ʒu
+public:
+    void Add(const EnemyInstruction& instr);
+
+    const std::vector<EnemyOp>& GetOps() const { return ops; }
+    // gݗčς݂̖ߗ̂܂܎ (p^[LbV̓ǂݍݗp).
+    void SetOps(std::vector<EnemyOp> _ops) { ops = std::move(_ops); }
+    int FindLabel(uint32_t name) const {
+        auto it = labelMap.find(name);
+        return (it != labelMap.end()) ? it->second : -1;
+    }
+
+    uint32_t GetProgramId() const { return programId; }
+    void SetProgramId(uint32_t id) { programId = id; }
+};
+
+/// <summary>
+/// G 1 ̂Ԃ̎s. ߗ EnemyProgram w, Œ蒷Ȃ̂œGĂmۂNȂ.
+/// </summary>
 class EnemyScript {
+public:
+    static constexpr uint32_t NoProgram = EnemyProgram::NoProgram;
+    static constexpr int MaxLoopDepth = 8;
+    static constexpr int MaxCallDepth = 8;
 private:
-    std::vector<EnemyInstruction> instructions;
+    struct LoopFrame {
+        int startIp = 0;        // [vJn߂ip
+        int remaining = 0;      // c胋[v
+    };
+
+    const EnemyProgram* program = nullptr;
     int ip = 0;
     int frame = 0;
     Vector2D startPos;
     bool finished = false;
 
-    std::unordered_map<std::string, int> labelMap;
-    // ߂Ƃ̕⏕Xe[giip L[j
-    std::unordered_map<int, int> instrCounters;        // ėpJE^io߃t[Ȃǁj
-    std::unordered_map<int, float> instrFloats;       // ėpt[giKvȂj
-    std::unordered_map<int, Vector2D> instrPositions; // ݂̃^[QbgWȂ
+    // RandomMove / RandomWander ̕⏕Xe[g (Ă閽߂͏ 1 Ȃ̂ 1 gő).
+    int opStateIp = -1;         // ̒lǂ̖߂̂̂
+    int opCounter = 0;          // o߃t[
+    Vector2D opTarget;          // ݂̃^[QbgW
 
     // [v
-    std::vector<std::pair<int, int>> loopStack; // <[vJn߂ip, c胋[v>
-    std::stack<int> callStack;
+    std::array<LoopFrame, MaxLoopDepth> loopStack{};
+    int loopDepth = 0;
+    std::array<int, MaxCallDepth> callStack{};
+    int callDepth = 0;
 
     void Advance();
-    int  FindLabel(const std::string& labelName) const;
-public:
-    std::shared_ptr<EnemyScript> Clone() const {
-        auto clone = std::make_shared<EnemyScript>();
-        clone->instructions = this->instructions;
-        // Ԃ͊Jn̏ԂɃZbg
-        clone->ip = 0;
-        clone->frame = 0;
-        clone->finished = false;
-        clone->startPos = this->startPos;
-        clone->labelMap = this->labelMap;
-        clone->loopStack.clear();
-        while (!clone->callStack.empty()) clone->callStack.pop();
-        return clone;
+    void ResetOpState(int targetIp) {
+        opStateIp = targetIp;
+        opCounter = 0;
+        opTarget = Vector2D(0, 0);
     }
-    void Add(const EnemyInstruction& instr);
+public:
+    // Ԃ program s. nullptr Ȃ~܂܂.
+    void Start(const EnemyProgram* _program);
     void Update(Enemy& enemy);
     bool IsFinished() const;
-};
\ No newline at end of file
+    bool IsRunning() const { return program && !finished; }
+
+    uint32_t GetProgramId() const { return program ? program->GetProgramId() : NoProgram; }
+
+    // sʒuƖ߂Ƃ̕⏕Xe[g.
+    void SaveState(SnapshotWriter& out) const;
+    void LoadState(SnapshotReader& in);
+};
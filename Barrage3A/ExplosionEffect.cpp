@@ -15,8 +15,8 @@ void ExplosionEffect::Start()
 void ExplosionEffect::CreateCircle(const Vector2D& dir, float initSpeed, float accel, int l )
 {
     auto sh = GameObject::Instantiate("ShapesRenderer")->AddAppBase<ShapesRenderer>();
-    sh->GetGameObject()->transform->rotation = 0;
-    sh->GetGameObject()->transform->position = centerPos - dir;
+    sh->GetGameObject()->transform->SetRotation(0);
+    sh->GetGameObject()->transform->SetPosition(centerPos - dir);
     sh->SetShapeType(ShapeType::Circle);
 
     auto filter = std::make_shared<Filter>();
@@ -5,6 +5,7 @@
 #include "GameObjectMgr.h"
 #include "ColliderManager.h"
 #include "RendererManager.h"
+#include "ParticleManager.h"
 #include "GameWorldManager.hpp"
 #include "Invoke.hpp"
 #if (_MSVC_LANG >= 202002L)
@@ -12,6 +13,9 @@
 #endif
 #include "Debug.hpp"
 #include "PlayerPrefs.h"
+#include "ReplaySystem.h"
+#include "SnapshotSystem.h"
+#include "AudioMixer.h"
 using namespace GameEngine;
 /////////// WindowSize class ////////////////
 
@@ -212,7 +216,10 @@ void Engine::Initialize() {
 }
 
 void Engine::FixedUpdate() {
+    PROFILE_SCOPE(ProfileZone::FixedUpdate);
     Object.AllGameObjectFixedUpdate();
+    GameWorldManager::GetInstance().ApplyWorldOffset();
+    Object.UpdateWorldTransforms();
     CollisionManager::GetInstance().CheckCollisions();
 #if (_MSVC_LANG >= 202002L)
     CoManager.FixedUpdate();
@@ -220,18 +227,24 @@ void Engine::FixedUpdate() {
 }
 
 void Engine::ProcessInput() {
-    Input.Update();
+    PROFILE_SCOPE(ProfileZone::ProcessInput);
+    // L^͓͂ۑ, Đ͋L^͂𗬂.
+    ReplaySystem::GetInstance().ProcessInput();
 }
 
 #if (_MSVC_LANG >= 202002L)
 void Engine::UpdateCoroutine() {
+    PROFILE_SCOPE(ProfileZone::Coroutine);
     CoManager.Update();
 }
 #endif
 
 void Engine::UpdateGameLogic() {
+    PROFILE_SCOPE(ProfileZone::UpdateGameLogic);
 	GameWorldManager::GetInstance().Update();
     Object.AllGameObjectUpdate();
+    // t[̃p[eBN[J[ł܂Ƃ߂čXV.
+    ParticleManager::GetInstance().Simulate();
     System::InvokeManager::GetInstance().Update();
     SceneManager::GetInstance().Update();
 }
@@ -252,34 +265,66 @@ void Engine::OnAnimationIK() {
 }
 
 void Engine::LateUpdate() {
+    PROFILE_SCOPE(ProfileZone::LateUpdate);
     Object.AllGameObjectLateUpdate();
+    // `OɃ[hϊ܂Ƃ߂Ċm.
+    GameWorldManager::GetInstance().ApplyWorldOffset();
+    Object.UpdateWorldTransforms();
+    // t[̏ԃnbV (vC̏ƍ).
+    ReplaySystem::GetInstance().EndFrame();
+    SnapshotSystem::GetInstance().EndFrame();
 }
 
 void Engine::DrawScreen() {
     SceneManager::GetInstance().UpdateTransitor();
+    if (headless) {                                 // Jڂ̍XVƃV[̐؂ւ̂.
+        SceneManager::GetInstance().ApplySceneChange();
+        return;
+    }
+    PROFILE_SCOPE(ProfileZone::Render);
 	ClearDrawScreen();                              // ʂNA.
     RendererManager::GetInstance().Render();
     SceneManager::GetInstance().Draw();
     SceneManager::GetInstance().DrawTransitor();
+    Profiler::GetInstance().DrawOverlay();
+    Metrics::GetInstance().DrawOverlay();
 }
 
 void Engine::ScreenFlip() {
     // svObject폜.
     Object.ProcessDestroyQueue();
 
-    DxLib::ScreenFlip();
+    if (!headless) DxLib::ScreenFlip();
+    // ~LT[̏o͂ DxLib ɓn (~LT[𓮂ĂȂΉȂ).
+    AudioMixer::GetInstance().Update();
 }
 
 void Engine::DebugLogic() {
     DisplayFPS();
 }
 
+void Engine::ProcessDebugKeys() {
+    // F9: vl̕\؂ւ. F10: ܂ł̏Wv metrics.json ɏo.
+    // F11: vt@C̕\؂ւ. F12: ȍ~ 300 t[荞 trace.json ɏo.
+    Profiler& profiler = Profiler::GetInstance();
+    if (Input.IsKeyDown(KeyCode::F11)) profiler.SetOverlayVisible(!profiler.IsOverlayVisible());
+    if (Input.IsKeyDown(KeyCode::F12) && !profiler.IsCapturing()) profiler.StartCapture(300, "trace.json");
+
+    Metrics& metrics = Metrics::GetInstance();
+    if (Input.IsKeyDown(KeyCode::F9)) metrics.SetOverlayVisible(!metrics.IsOverlayVisible());
+    if (Input.IsKeyDown(KeyCode::F10) && metrics.DumpJson("metrics.json")) {
+        GameEngine::Debug::Log("vlo܂: metrics.json ({:d} t[)", metrics.GetFrameCount());
+    }
+}
+
 void Engine::GameEngineExit() {
     Object.AllOnApplicationQuit();
     Object.AllDestroyGameObject();
     Object.ProcessDestroyQueue();
     CoManager.StopAllCoroutines();
     System::InvokeManager::GetInstance().Clear();
+    AudioMixer::GetInstance().Stop();
 
     PlayerPrefs::Save();
+    PlayerPrefs::Flush();
 }
\ No newline at end of file
@@ -3,6 +3,9 @@
 	GameEngine.h
 */
 #include "Application.hpp"
+#include "Profiler.h"
+#include "Metrics.h"
+#include "BenchmarkRunner.h"
 //ʃTCY.
 #define WIDTH			(960)		//  (x).
 #define HEIGHT			(720)		//(y).
@@ -160,6 +163,9 @@ private:
     bool isFps;
     float fps;               // ݂
     float fpsTime;           // ݂FPS
+
+    bool  useFixedStep = false;         // Ԃł͂ȂŒXebvŐi߂ (vCp).
+    float fixedStep    = 1.0f / 60.0f;
 public:
 	// TimeNX擾.
 	static Timer& Instance() {
@@ -199,8 +205,9 @@ public:
 
 		auto now = std::chrono::high_resolution_clock::now();
 		std::chrono::duration<float> deltaTimeDuration = now - lastFrameTime;
-		deltaTime = deltaTimeDuration.count() * timeScale;
-		unscaledDeltaTime = deltaTimeDuration.count();
+		float elapsed = useFixedStep ? fixedStep : deltaTimeDuration.count();
+		deltaTime = elapsed * timeScale;
+		unscaledDeltaTime = elapsed;
 		lastFrameTime = now;
 
 		time += deltaTime;
@@ -235,6 +242,13 @@ public:
         return isFixUpdate;
     }
 	void SetTimeScale(float scale) { timeScale = scale; }
+    // ŒXebv̗LE. LȊԂ 1 t[ step bƂĐi߂.
+    void SetFixedStep(bool enable, float step = 1.0f / 60.0f) {
+        useFixedStep = enable;
+        if (step > 0.0f) fixedStep = step;
+    }
+    bool  IsFixedStep() const { return useFixedStep; }
+    float GetFixedStep() const { return fixedStep; }
     int GetFpsCount() const { return fpsCount; }
     float GetSmoothDeltaTime() const { return smoothDeltaTime; }
     float GetRealtimeSinceStartup() const { return unscaledTime; }
@@ -279,6 +293,7 @@ private:// 
 
     int targetFrameRate;// Loop (ftHg 0 <Ȃ>)
     float targetFrameTime;
+    bool headless = false;  // `Eҋ@sȂ (vC̍Đp)
 
 private: // ֐.  
 
@@ -308,6 +323,8 @@ private: // 
     void ScreenFlip();
 
     void DebugLogic();
+    // vp̃L[ ([XrhłL).
+    void ProcessDebugKeys();
 
     // FPS\̂߂̊֐
     void DisplayFPS() {
@@ -330,6 +347,7 @@ public:
         do
         {
             clsDx();
+            Profiler::GetInstance().BeginFrame();
           
             Time.Update();
 
@@ -359,11 +377,15 @@ public:
             DrawScreen();
             // ؂ւ.
             ScreenFlip();
+            Profiler::GetInstance().EndFrame();
+            Metrics::GetInstance().EndFrame();
+            BenchmarkRunner::GetInstance().EndFrame();
+            ProcessDebugKeys();
 
 #if _DEBUG
             DebugLogic();
 #endif
-            Time.SleepAppFPS();
+            if (!headless) Time.SleepAppFPS();
         } 
         while (LoopProcess());
 
@@ -380,4 +402,8 @@ public:
         Time.SetFixed(_fps);
     }
 
+    // wbhXs (`Eʐ؂ւEt[ҋ@ȗ).
+    void SetHeadless(bool enable) { headless = enable; }
+    bool IsHeadless() const { return headless; }
+
 };
@@ -1,6 +1,7 @@
 #include "GameManager.h"
 #include "Mathf.h"
 #include "HUDManager.h"
+#include "SnapshotStream.h"
 
 GameManager& GameManager::GetInstance() {
     static GameManager instance;
@@ -80,4 +81,24 @@ void GameManager::Continue()
 void GameManager::OnGameOver() {
     Time.timeScale = 0;
     isPause = true;
-}
\ No newline at end of file
+    // nCXRAۑ (݂͕ʃXbh).
+    PlayerPrefs::Save();
+}
+
+void GameManager::SaveState(SnapshotWriter& out) const {
+    out.Write(isGameOver);
+    scoreManager.SaveState(out);
+    powerManager.SaveState(out);
+    lifeManager.SaveState(out);
+    bombManager.SaveState(out);
+    grazeManager.SaveState(out);
+}
+
+void GameManager::LoadState(SnapshotReader& in) {
+    in.Read(isGameOver);
+    scoreManager.LoadState(in);
+    powerManager.LoadState(in);
+    lifeManager.LoadState(in);
+    bombManager.LoadState(in);
+    grazeManager.LoadState(in);
+}
@@ -61,4 +61,8 @@ public:
     void Continue();
     void OnGameOver();
 
+    // Xe[^Xꎮ̕ۑE (|[YԂ͊܂߂Ȃ).
+    void SaveState(SnapshotWriter& out) const;
+    void LoadState(SnapshotReader& in);
+
 };
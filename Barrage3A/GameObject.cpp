@@ -6,12 +6,16 @@ void GameObject::Destroy() {
     Object.DestroyGameObject(shared_from_this());
 }
 
+bool GameObject::IsPendingDestroy() const {
+    return Object.IsPendingDestroy(*this);
+}
+
 // GameObject(W px) or GameObjectManagerɓo^.
 std::shared_ptr<GameObject> GameObject::Instantiate(const std::string& name, Vector2D pos, float rotation) {
     auto obj = std::make_shared<GameObject>(name);
     obj->transform = std::make_shared<Transform2D>(obj);
-    obj->transform->position = pos;
-    obj->transform->rotation = rotation;
+    obj->transform->SetPosition(pos);
+    obj->transform->SetRotation(rotation);
 
     GameObjectMgr::GetInstance().AddGameObject(obj);
 
@@ -20,6 +20,22 @@ class GameObject : public std::enable_shared_from_this<GameObject>
     friend class Prefab;
 private:
     bool dontDestroyOnLoad = false;
+    // GameObjectMgr Ǘo^. Rs[ (Prefab ) ł͈pV̔Ԃ.
+    struct WorldEntry {
+        uint64_t instanceId = NextInstanceId();         // ̒ʂԍ.
+        uint32_t destroyGeneration = 0;                 // 폜҂ɓo^ꂽ.
+        bool inWorld = false;                           // GameObjectMgr ɓo^ς.
+
+        WorldEntry() = default;
+        WorldEntry(const WorldEntry&) : WorldEntry() {}
+        WorldEntry& operator=(const WorldEntry&) { return *this; }
+    };
+    WorldEntry world;
+
+    static uint64_t NextInstanceId() {
+        static uint64_t counter = 0;
+        return ++counter;
+    }
     bool isActive;										// GameObject\ (𖳌).
     std::string tag;									// 擾ۂ⎯ʂɎgp.
     std::string name;									// GameObject.
@@ -35,6 +51,11 @@ public:
     GameObject(std::string _name = "GameObject") : name(_name), tag(""), isActive(true), newAppBase(false)
     {}
 
+    // ̒ʂԍ (ȂsƂɓ召֌WɂȂ).
+    uint64_t GetInstanceID() const { return world.instanceId; }
+    // XibvVbgŌ̒ʂԍɖ߂ (XVEՓˏ̍Čp).
+    void RestoreInstanceID(uint64_t id) { world.instanceId = id; }
+
     // UnityŌ AddComponent
     template <typename T, typename... Args, typename = std::enable_if_t<std::is_base_of_v<AppBase, T>>>
     std::shared_ptr<T> AddAppBase(Args&&... args) {
@@ -49,6 +70,7 @@ public:
             for (const auto app : newAppBaseList) {
                 app->SetTransform2D(transform);
             }
+            transform->NotifyHierarchyChanged();
             return std::static_pointer_cast<T>(transform);
         }
 
@@ -58,6 +80,7 @@ public:
         newAppBaseList.push_back(app);
 
         newAppBase = true;
+        if (transform) transform->NotifyHierarchyChanged();
         app->Awake();
 
         return app;
@@ -78,6 +101,7 @@ public:
             for (const auto app : newAppBaseList) {
                 app->SetTransform2D(transform);
             }
+            transform->NotifyHierarchyChanged();
             return std::static_pointer_cast<T>(transform);
         }
         // ʏ AppBase
@@ -86,6 +110,7 @@ public:
         newAppBaseList.push_back(app);
 
         newAppBase = true;
+        if (transform) transform->NotifyHierarchyChanged();
         app->Awake();
         return app;
     }
@@ -124,6 +149,7 @@ public:
                 for (const auto& app : newAppBaseList) {
                     app->SetTransform2D(transform);
                 }
+                transform->NotifyHierarchyChanged();
                 return;
             }
         }
@@ -147,6 +173,7 @@ public:
             (*i)->OnDestroy();
         }
         newAppBaseList.erase(it2, newAppBaseList.end());
+        if (transform) transform->NotifyHierarchyChanged();
     }
 
 
@@ -171,6 +198,7 @@ public:
             (*i)->OnDestroy();
         }
         newAppBaseList.erase(it2, newAppBaseList.end());
+        if (transform) transform->NotifyHierarchyChanged();
     }
 
     std::string GetName() const { return name; }
@@ -188,6 +216,7 @@ public:
         if (isActive == visible) return;
 
         isActive = visible; 
+        if (transform) transform->NotifyHierarchyChanged();
 
         if (isActive) OnEnable();
         else          OnDisable();
@@ -197,6 +226,8 @@ public:
     bool IsDontDestroyOnLoad() const { return dontDestroyOnLoad; }
 
     void Destroy();
+    // 폜҂Xgɓo^ς݂.
+    bool IsPendingDestroy() const;
 protected:
     // SĂ AppBase 擾 <Prefab̂ݎgp>.
     std::vector<std::shared_ptr<AppBase>> GetAppBases() {
@@ -273,6 +304,7 @@ protected:
         }
 
         appBases.clear();
+        if (transform) transform->NotifyHierarchyChanged();
         transform.reset();
     }
 
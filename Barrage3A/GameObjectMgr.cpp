@@ -1,5 +1,7 @@
 #include "GameObjectMgr.h"
 #include "GameObject.h"
+#include "RendererManager.h"
+#include "Profiler.h"
 
 /// <summary>
 /// VKɍ쐬ꍇ.
@@ -30,7 +32,7 @@ std::shared_ptr<GameObject> GameObjectMgr::Instantiate(const std::string _name,
     // IuWFNgǉ.
     AddGameObject(obj);
     // W炷.
-    if (obj->transform)obj->transform->position = _position;
+    if (obj->transform)obj->transform->SetPosition(_position);
     // 쐬IuWFNgԂ.
     return obj;
 }
@@ -55,4 +57,51 @@ std::shared_ptr<GameObject> GameObjectMgr::Instantiate(const std::vector<std::sh
     AddGameObject(_objs);
 
     return _objs[0];
-}
\ No newline at end of file
+}
+
+/// <summary>
+/// 폜҂Xg̃IuWFNg폜.
+/// ̏ꍇ̓RC_[E_[̓o^܂Ƃ߂ 1 pXōs.
+/// </summary>
+void GameObjectMgr::ProcessDestroyQueue() {
+    if (objectsToDestroy.empty()) return;
+    PROFILE_SCOPE(ProfileZone::DestroyQueue);
+    // OnDestroy ɒǉꂽ폜͎ɉ (i߂čēo^\ɂ).
+    std::vector<System::WeakAccessor<GameObject>> queue;
+    queue.swap(objectsToDestroy);
+    ++destroyGeneration;
+
+    const bool bulk = queue.size() >= BulkDestroyThreshold;
+    if (bulk) {
+        CollisionManager::GetInstance().BeginBulkRemove();
+        RendererManager::GetInstance().BeginBulkRemove();
+    }
+
+    bool removed = false;
+    for (auto& weakObj : queue) {
+        if (auto gameObject = weakObj.lock()) {
+            if (!gameObject->world.inWorld) continue;
+            gameObject->OnDestroy();
+            gameObject->world.inWorld = false;
+            removed = true;
+        }
+    }
+    // o^ۂ܂ 1 pXŋl߂.
+    if (removed) {
+        gameObjects.erase(std::remove_if(gameObjects.begin(), gameObjects.end(),
+            [](const std::shared_ptr<GameObject>& obj) { return !obj->world.inWorld; }),
+            gameObjects.end());
+        Metrics::GetInstance().Set(Metric::GameObjects, gameObjects.size());
+    }
+
+    if (bulk) {
+        CollisionManager::GetInstance().EndBulkRemove();
+        RendererManager::GetInstance().EndBulkRemove();
+    }
+
+    // gÏ͎t[̍폜҂ɍėp.
+    if (objectsToDestroy.empty()) {
+        queue.clear();
+        objectsToDestroy.swap(queue);
+    }
+}
@@ -3,25 +3,25 @@
 #include "GameObject.h"
 #include "WeakAccessor.hpp"
 #include "Stopwatch.hpp"
+#include "Metrics.h"
 /// <summary>
 /// oĂIuWFNgǗ.
 /// </summary>
 class GameObjectMgr {
 private:
     std::vector<std::shared_ptr<GameObject>> newGameObjects;
-    // Q[IuWFNg̔zf[^.
-    std::unordered_map<uintptr_t, std::shared_ptr<GameObject>> gameObjects;
+    // Q[IuWFNg̔zf[^ (o^. XVsƂɈɂ).
+    std::vector<std::shared_ptr<GameObject>> gameObjects;
     // 폜҂̃IuWFNg.
     std::vector<System::WeakAccessor<GameObject>> objectsToDestroy;
+    // 폜҂̐. ProcessDestroyQueue Ƃɐi, GameObject ̈ƈvΓo^ς.
+    uint32_t destroyGeneration = 1;
+    // ̐ȏ܂Ƃ߂č폜ꍇ̓RC_[E_[̓o^ꊇōs.
+    static constexpr size_t BulkDestroyThreshold = 32;
     // ̃IuWFNgɂ.
     GameObjectMgr(){}
 public:
 
-    std::shared_ptr<GameObject> FindByRawPtr(uintptr_t ptr) {
-        auto it = gameObjects.find(ptr);
-        return (it != gameObjects.end()) ? it->second : nullptr;
-    }
-
     // GameObjectMgr擾.
     static GameObjectMgr& GetInstance() {
         static GameObjectMgr instance;
@@ -40,22 +40,39 @@ public:
         }
     }
     // IuWFNg폜.
-    void DestroyGameObject(std::shared_ptr<GameObject> gameObject) {
-        if (gameObject) {
-            // łɍ폜҂Xgɑ݂Ȃꍇ̂ݒǉ.
-            if (std::find_if(objectsToDestroy.begin(), objectsToDestroy.end(),
-                [&gameObject](const System::WeakAccessor<GameObject>& wptr) {
-                    return wptr == gameObject; // operator== gƂŔr
-                }) == objectsToDestroy.end())
-            {
-                objectsToDestroy.push_back(gameObject);
-            }
+    void DestroyGameObject(const std::shared_ptr<GameObject>& gameObject) {
+        if (!gameObject) return;
+        // łɍ폜҂Xgɑ݂Ȃꍇ̂ݒǉ.
+        if (gameObject->world.destroyGeneration == destroyGeneration) return;
+        gameObject->world.destroyGeneration = destroyGeneration;
+        objectsToDestroy.push_back(gameObject);
+    }
+
+    // 폜҂Xgɓo^ς݂.
+    bool IsPendingDestroy(const GameObject& gameObject) const {
+        return gameObject.world.destroyGeneration == destroyGeneration;
+    }
+
+    // ɈvIuWFNg܂Ƃ߂č폜҂ɓo^. o^Ԃ.
+    template <typename Pred>
+    size_t DestroyWhere(Pred&& pred) {
+        size_t count = 0;
+        for (const auto& obj : gameObjects) {
+            if (obj->world.destroyGeneration == destroyGeneration || !pred(*obj)) continue;
+            obj->world.destroyGeneration = destroyGeneration;
+            objectsToDestroy.push_back(obj);
+            ++count;
         }
+        return count;
+    }
+
+    // w背C[̃IuWFNg܂Ƃ߂č폜҂ɓo^.
+    size_t DestroyByLayer(Layer layer) {
+        return DestroyWhere([layer](const GameObject& obj) { return obj.GetLayer() == layer; });
     }
 
     void DestroySceneObjects() {
-        for (const auto& pair : gameObjects) {
-            const auto& obj = pair.second;
+        for (const auto& obj : gameObjects) {
             if (!obj->IsDontDestroyOnLoad()) {
                 DestroyGameObject(obj); // SȌoH
             }
@@ -64,8 +81,7 @@ public:
 
     // Q[̓"O"GameObject擾.
     std::shared_ptr<GameObject> FindWithName(const std::string& _name) const {
-        for (const auto& pair : gameObjects) {
-            const auto& obj = pair.second;
+        for (const auto& obj : gameObjects) {
             if (obj->GetName() == _name) return obj;
         }
         return nullptr;
@@ -73,8 +89,7 @@ public:
 
     // Q[̓"^O"GameObject擾.
     std::shared_ptr<GameObject> FindWithTag(const std::string& _tag) const {
-        for (const auto& pair : gameObjects) {
-            const auto& obj = pair.second;
+        for (const auto& obj : gameObjects) {
             if (obj->GetTag() == _tag) return obj;
         }
         return nullptr;
@@ -82,8 +97,7 @@ public:
     // Q[̓ class IuWFNg擾.
     template <typename T>
     std::shared_ptr<T> FindObjectOfType() const {
-        for (auto& pair : gameObjects) {
-            const auto& obj = pair.second;
+        for (const auto& obj : gameObjects) {
             auto tmp = obj->GetAppBase<T>();
             if (tmp) return tmp;
         }
@@ -92,8 +106,7 @@ public:
     // Q[̓"O"GameObjectSĎ擾.
     std::vector<std::shared_ptr<GameObject>> FindGameObjectsWithName(const std::string& _name) const {
         std::vector<std::shared_ptr<GameObject>> result;
-        for (const auto& pair : gameObjects) {
-            const auto& obj = pair.second;
+        for (const auto& obj : gameObjects) {
             if (obj->GetName() == _name) {
                 result.push_back(obj);
             }
@@ -103,8 +116,7 @@ public:
     // Q[̓"^O"GameObjectSĎ擾.
     std::vector<std::shared_ptr<GameObject>> FindGameObjectsWithTag(const std::string& _tag) const {
         std::vector<std::shared_ptr<GameObject>> result;
-        for (const auto& pair : gameObjects) {
-            const auto& obj = pair.second;
+        for (const auto& obj : gameObjects) {
             if (obj->GetTag() == _tag) {
                 result.push_back(obj);
             }
@@ -115,8 +127,7 @@ public:
     template <typename T>
     std::vector<std::shared_ptr<T>> FindObjectsOfType() const {
         std::vector<std::shared_ptr<T>> tmps;
-        for (auto& pair : gameObjects) {
-            const auto& obj = pair.second;
+        for (const auto& obj : gameObjects) {
             auto tmp = obj->GetAppBase<T>();
             if (tmp) tmps.push_back(tmp);
         }
@@ -125,23 +136,20 @@ public:
 
     // SẴQ[̃IuWFNg"Awake"s.
     void AllGameObjectAwake() {
-        for (auto& pair : gameObjects) {
-            const auto& obj = pair.second;
+        for (const auto& obj : gameObjects) {
             if(obj->IsNewAppBase()) obj->Awake();
         }
     }
     // SẴQ[̃IuWFNg"Start"s.
     void AllGameObjectStart() {
-        for (auto& pair : gameObjects) {
-            const auto& obj = pair.second;
+        for (const auto& obj : gameObjects) {
             if (!obj->IsActive() || !obj->IsNewAppBase()) continue;
             obj->Start();
         }
     }
 
     void AllGameObjectFixedUpdate() {
-        for (auto& pair : gameObjects) {
-            const auto& obj = pair.second;
+        for (const auto& obj : gameObjects) {
             if (obj->IsActive()) {
                 obj->FixedUpdate();
             }
@@ -150,8 +158,7 @@ public:
 
     // SẴQ[̃IuWFNg"Update"s.
     void AllGameObjectUpdate() {
-        for (auto& pair : gameObjects) {
-            const auto& obj = pair.second;
+        for (const auto& obj : gameObjects) {
             if (obj->IsActive()) {
                 obj->Update();
             }
@@ -160,26 +167,30 @@ public:
 
     // SẴQ[̃IuWFNg"Update"s.
     void AllGameObjectLateUpdate() {
-        for (auto& pair : gameObjects) {
-            const auto& obj = pair.second;
+        for (const auto& obj : gameObjects) {
             if (obj->IsActive()) {
                 obj->LateUpdate();
             }
         }
     }
 
+    // SĂ Transform2D ̃[hϊ[gKwɍXV.
+    void UpdateWorldTransforms() {
+        for (const auto& obj : gameObjects) {
+            if (!obj->IsActive() || !obj->transform) continue;
+            if (obj->transform->HasParent()) continue;  // [ĝ (q͐eH).
+            obj->transform->UpdateWorldTransformHierarchy();
+        }
+    }
+
     void AllOnApplicationQuit() {
-        for (auto& pair : gameObjects) {
-            const auto& obj = pair.second;
+        for (const auto& obj : gameObjects) {
             obj->OnApplicationQuit();
         }
     }
 
     void AllDestroyGameObject() {
-        for (auto pair : gameObjects) {
-            const auto& obj = pair.second;
-            objectsToDestroy.push_back(obj);
-        }
+        DestroyWhere([](const GameObject&) { return true; });
     }
     // SẴQ[IuWFNgs.
     void AllGameObjectSystem() {
@@ -194,29 +205,23 @@ public:
 
     void ProcessNewObjects() {
         for (auto& obj : newGameObjects) {
-            uintptr_t rawPtr = reinterpret_cast<uintptr_t>(obj.get());
-            gameObjects[rawPtr] = obj;
+            if (obj->world.inWorld) continue;     // do^Ȃ
+            obj->world.inWorld = true;
+            gameObjects.push_back(obj);
         }
         newGameObjects.clear();
+        Metrics::GetInstance().Set(Metric::GameObjects, gameObjects.size());
     }
 
     // 폜҂Xg̃IuWFNg폜.
-    void ProcessDestroyQueue() {
-        if (objectsToDestroy.empty()) return;
-    //  DebugStopwatch::Start("DestroyQueue");
-        for (auto& weakObj : objectsToDestroy) {
-            if (auto sp = weakObj.lock()) {
-                auto key = reinterpret_cast<uintptr_t>(sp.get());
-                auto it = gameObjects.find(key);
-                if (it != gameObjects.end()) {
-                    auto gameObject = it->second;
-                    gameObject->OnDestroy();
-                    gameObjects.erase(it);
-                }
-            }
-        }
-        objectsToDestroy.clear();
-    //  DebugStopwatch::PrintStop("DestroyQueue", "폜 ");
+    void ProcessDestroyQueue();
+
+    // o^ InstanceID ɕג. ō蒼IuWFNg̈ʒuɖ߂.
+    void SortByInstanceID() {
+        std::stable_sort(gameObjects.begin(), gameObjects.end(),
+            [](const std::shared_ptr<GameObject>& a, const std::shared_ptr<GameObject>& b) {
+                return a->GetInstanceID() < b->GetInstanceID();
+            });
     }
 
 
@@ -227,12 +232,11 @@ public:
 
     // GameObject Mgr ɓo^Ă邷ׂẴIuWFNg.
     std::vector<std::shared_ptr<GameObject>> GetGameObjects() {
-        std::vector<std::shared_ptr<GameObject>> result;
-        result.reserve(gameObjects.size());
-        for (const auto& pair : gameObjects) {
-            result.push_back(pair.second);
-        }
-        return result;
+        return gameObjects;
+    }
+    // o^̈ꗗ (Rs[Ȃ).
+    const std::vector<std::shared_ptr<GameObject>>& GetGameObjectList() const {
+        return gameObjects;
     }
 
     void DontDestroyOnLoad(std::shared_ptr<GameObject> gameObject) {
@@ -23,6 +23,7 @@
 #include "MusicController.h"
 #include "HUDManager.h"
 #include "EnemyManager.h"
+#include "PatternLibrary.h"
 #include "ItemManager.h"
 
 #include "HpGauge.h"
@@ -74,10 +75,10 @@ void GameScene::Init() {
 
 	{
 		var player = GameObject::Instantiate("Player");
-		player->transform->scale = { 1.25f,1.25f };
+		player->transform->SetScale({ 1.25f,1.25f });
 		player->SetTag("Player");
 		player->AddAppBase<ReimuHakurei>();
-		player->transform->position = Vector2D(-150, -300);
+		player->transform->SetPosition(Vector2D(-150, -300));
 		auto sp = player->AddAppBase<SpriteRenderer>();
 		player->SetLayer(Layer::Player);
 
@@ -383,8 +384,8 @@ void GameScene::Init() {
 	{
 #if _DEBUG
 		auto boss = GameObject::Instantiate("boss");
-		boss->transform->position = Vector2D(-300, 300);
-		boss->transform->scale = Vector2D(1.25f, 1.25f);
+		boss->transform->SetPosition(Vector2D(-300, 300));
+		boss->transform->SetScale(Vector2D(1.25f, 1.25f));
 		boss->AddAppBase<BarrelDistort>();
 		auto sp = boss->AddAppBase<Sprite3DRenderer>();
 		sp->SetLayer(-6);
@@ -405,6 +406,7 @@ void GameScene::Init() {
 
 void GameScene::Update()
 {
+	PatternLibrary::GetInstance().PollHotReload();
 	EnemyManager::GetInstance().Update();
 	ItemManager::GetInstance().Update();
 
@@ -418,6 +420,8 @@ void GameScene::Draw() {
 }
 
 void GameScene::Release() {
+	// Xe[W𔲂ƂɃnCXRAۑ.
+	PlayerPrefs::Save();
 	Object.DestroySceneObjects();
 	ItemManager::GetInstance().Clear();
 	HUDManager::GetInstance().Reset();
@@ -53,6 +53,7 @@ namespace GameEngine {
         // [hʒu̐ݒ
         void SetWorldPosition(const Vector2D& newPosition) {
             worldPosition = newPosition;
+            ApplyWorldOffset();
         }
 
         // [hʒu̎擾
@@ -76,6 +77,13 @@ namespace GameEngine {
         // J̈ʒuݒ
         void SetCameraPosition(std::shared_ptr<Transform2D> newPosition) {
             cameraTransform2D = newPosition;
+            ApplyWorldOffset();
+        }
+
+        // ݂̃[hItZbg Transform2D ɔf (ω΃[gČvZ).
+        // J̈ړ̓[hϊ̓ (GameEngine) ɂŏE.
+        void ApplyWorldOffset() const {
+            Transform2D::SetWorldOffset(WorldOffSet());
         }
 
         Vector2D ScreenToViewport(const Vector2D& screenPos) const {
@@ -97,14 +105,15 @@ namespace GameEngine {
         void Update() {
             if (shakeDuration > 0.0f) {
                 shakeDuration -= Time.deltaTime;
-                float randX = (Random.Value()) * 2.0f - 1.0f;
-                float randY = (Random.Value()) * 2.0f - 1.0f;
+                float randX = (Random.Stream(RandomStream::Effect).Value()) * 2.0f - 1.0f;
+                float randY = (Random.Stream(RandomStream::Effect).Value()) * 2.0f - 1.0f;
                 shakeOffset.x = randX * shakeMagnitude;
                 shakeOffset.y = randY * shakeMagnitude;
                 if (shakeDuration <= 0.0f) {
                     shakeOffset = Vector2D(0, 0);  // I
                 }
             }
+            ApplyWorldOffset();
         }
 
     };
@@ -12,9 +12,89 @@ GraphicRaycaster::GraphicRaycaster(std::shared_ptr<GameObject> owner) : AppBase(
 
 }
 
+void GraphicRaycaster::RefreshUiBases() {
+    uint32_t version = transform->GetHierarchyVersion();
+    if (uiBasesValid && uiBasesVersion == version) {
+        ++uiBasesCacheStats.hits;
+        return;
+    }
+    ++uiBasesCacheStats.misses;
+
+    uiBases.clear();
+    transform->CollectAppBasesInChildren<UiBase>(uiBases);
+    uiBasesVersion = version;
+    uiBasesValid   = true;
+    indexValid     = false; // 蒼.
+
+    // Yς邽ߒǐՑΏۂ蒼.
+    tracked.clear();
+    for (size_t i = 0; i < uiBases.size(); ++i) {
+        if (IsTracked(uiBases[i])) tracked.push_back(static_cast<int>(i));
+    }
+}
+
+bool GraphicRaycaster::IsTracked(const std::shared_ptr<UiBase>& ui) const {
+    if (ui->isHoveredLastFrame) return true;
+    auto drag = uiDragState.find(ui);
+    return drag != uiDragState.end() && drag->second;
+}
+
+void GraphicRaycaster::RefreshIndex() {
+    // [gȉ̂ꂩ Transform2D ꍇ̂ݍč\z (vf͒HȂ).
+    uint32_t version = transform->GetHierarchyWorldVersion();
+    if (indexValid && indexVersion == version) {
+        ++indexCacheStats.hits;
+        return;
+    }
+    ++indexCacheStats.misses;
+
+    cells.clear();
+    indexVersion = version;
+    indexValid   = true;
+    for (size_t i = 0; i < uiBases.size(); ++i) {
+        auto rt = uiBases[i]->GetRectTransform();
+        if (!rt) continue;
+
+        Quad2D aabb = rt->GetWorldQuad().ToAABB();
+        int minX = static_cast<int>(std::floor(aabb.topLeft.x / CellSize));
+        int minY = static_cast<int>(std::floor(aabb.topLeft.y / CellSize));
+        int maxX = static_cast<int>(std::floor(aabb.bottomRight.x / CellSize));
+        int maxY = static_cast<int>(std::floor(aabb.bottomRight.y / CellSize));
+        for (int cy = minY; cy <= maxY; ++cy) {
+            for (int cx = minX; cx <= maxX; ++cx) {
+                cells[CellKey(cx, cy)].push_back(static_cast<int>(i));
+            }
+        }
+    }
+}
+
+void GraphicRaycaster::CollectCandidates(const Vector2D& point) {
+    candidates.clear();
+
+    // }EXʒũZɓĂ UI.
+    int cx = static_cast<int>(std::floor(point.x / CellSize));
+    int cy = static_cast<int>(std::floor(point.y / CellSize));
+    auto it = cells.find(CellKey(cx, cy));
+    if (it != cells.end()) {
+        candidates.insert(candidates.end(), it->second.begin(), it->second.end());
+    }
+
+    // Ot[Ńzo[ or hbO UI ͗ECxĝߕK܂߂.
+    candidates.insert(candidates.end(), tracked.begin(), tracked.end());
+
+    // Kw (`揇) ێ.
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+}
+
 void GraphicRaycaster::Update() {
     Vector2D mousePos = Input.GetMousePoint_F();
-    for (auto& ui : transform->GetAppBasesInChildren<UiBase>()) {
+    RefreshUiBases();
+    RefreshIndex();
+    CollectCandidates(mousePos);
+
+    for (int index : candidates) {
+        auto& ui = uiBases[index];
 		if (ui->GetGameObject()->IsActive() == false || !ui->raycastTarget) continue;
         if (ui->Raycast(mousePos)) {
             if (!ui->isHoveredLastFrame) {
@@ -89,4 +169,9 @@ void GraphicRaycaster::Update() {
             }
         }
     }
-}
\ No newline at end of file
+
+    tracked.clear();
+    for (int index : candidates) {
+        if (IsTracked(uiBases[index])) tracked.push_back(index);
+    }
+}
@@ -7,6 +7,19 @@ class GraphicRaycaster : public AppBase {
 private:    // J.
     std::unordered_map<std::shared_ptr<UiBase>, bool> uiDragState;
     std::unordered_map<std::shared_ptr<UiBase>, float> lastClickTimeMap;
+
+    // R UiBase (Kwς̂ݍč\z).
+    std::vector<std::shared_ptr<UiBase>> uiBases;
+    uint32_t uiBasesVersion = 0;
+    bool     uiBasesValid   = false;
+
+    // CLXgp̋ԃCfbNX (Z  uiBases ̓Y).
+    static constexpr float CellSize = 64.0f;
+    std::unordered_map<uint64_t, std::vector<int>> cells;
+    uint32_t indexVersion = 0;              // \z̃[gȉ̃[hϊo[W.
+    bool     indexValid   = false;
+    std::vector<int>      candidates;       // t[̔Ώ.
+    std::vector<int>      tracked;          // zo[ or hbO UI (ECxgp).
 public:     // J.
 
     // RXgN^.
@@ -15,8 +28,20 @@ public:     // 
 
     // Update.
     void Update() override;
+
+    // LbVp (S GraphicRaycaster ̍v).
+    inline static UiCacheStats uiBasesCacheStats;
+    inline static UiCacheStats indexCacheStats;
 protected:
     std::shared_ptr<AppBase> Clone() const override {
         return std::make_shared<GraphicRaycaster>(*this);
     }
+private:
+    void RefreshUiBases();
+    void RefreshIndex();
+    void CollectCandidates(const Vector2D& point);
+    bool IsTracked(const std::shared_ptr<UiBase>& ui) const;
+    static uint64_t CellKey(int cx, int cy) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32) | static_cast<uint32_t>(cy);
+    }
 };
\ No newline at end of file
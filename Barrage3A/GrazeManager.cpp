@@ -1,4 +1,5 @@
 #include "GrazeManager.h"
+#include "SnapshotStream.h"
 #include "GameManager.h"
 void GrazeManager::Add(int count) {
     grazeCount += count;
@@ -26,3 +27,13 @@ void GrazeManager::Reset() {
     grazeCount = 0;
     count = 0;
 }
+
+void GrazeManager::SaveState(SnapshotWriter& out) const {
+    out.Write(grazeCount);
+    out.Write(count);
+}
+
+void GrazeManager::LoadState(SnapshotReader& in) {
+    in.Read(grazeCount);
+    in.Read(count);
+}
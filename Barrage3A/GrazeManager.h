@@ -1,5 +1,8 @@
 #pragma once
 
+class SnapshotWriter;
+class SnapshotReader;
+
 class GrazeManager {
 private:
     int grazeCount = 0;
@@ -10,4 +13,8 @@ public:
     int GetTotalGraze() const;
     void NextStargReset();
     void Reset();
+
+    // Ԃ̕ۑE.
+    void SaveState(SnapshotWriter& out) const;
+    void LoadState(SnapshotReader& in);
 };
@@ -1,11 +1,45 @@
 #include "HUDManager.h"
 #include <algorithm>
+#include <charconv>
+#include <string_view>
 #include "Mathf.h"
 #include "Format.hpp"
 #include "TileTransitor.h"
 #include "MusicController.h"
 #include "AudioResourceShortcut.hpp"
 
+//----------------------------------
+// l̏ (std::to_chars ŌŒobt@ɏ)
+//----------------------------------
+namespace {
+    constexpr const char* kItemPath = "UI/Item:";
+    constexpr int kCountSpriteFrames = 4;  // LifeCount_0 ` LifeCount_3
+
+    // , ݌̈ʒuԂ.
+    template <class T>
+    char* WriteInt(char* first, char* last, T value) {
+        auto res = std::to_chars(first, last, value);
+        return res.ec == std::errc() ? res.ptr : first;
+    }
+
+    // 2 [.
+    char* WriteTwoDigits(char* first, int value) {
+        *first++ = static_cast<char>('0' + (value / 10) % 10);
+        *first++ = static_cast<char>('0' + value % 10);
+        return first;
+    }
+
+    char* WriteLiteral(char* first, char* last, std::string_view str) {
+        const size_t n = std::min(str.size(), static_cast<size_t>(last - first));
+        return std::copy_n(str.data(), n, first);
+    }
+
+    void SetTextFromBuffer(Text& text, std::string& buffer, const char* first, const char* last) {
+        buffer.assign(first, last);
+        text.SetText(buffer);
+    }
+}
+
 HUDManager& HUDManager::GetInstance() {
     static HUDManager instance;
     return instance;
@@ -42,6 +76,16 @@ void HUDManager::Initialize(
     if (auto fps = fpsText.lock()) {
         fps->SetSpriteFont(nullptr); // ftHgtHgݒiKvȂ璲j
     }
+
+    // c@E{̃XvCgɉĂ
+    lifeSprites.assign(kCountSpriteFrames, nullptr);
+    bombSprites.assign(kCountSpriteFrames, nullptr);
+    for (int i = 0; i < kCountSpriteFrames; ++i) {
+        lifeSprites[i] = Tex[std::string(kItemPath) + "LifeCount_" + std::to_string(i)];
+        bombSprites[i] = Tex[std::string(kItemPath) + "SpCount_" + std::to_string(i)];
+    }
+
+    ResetBindings();
 }
 
 //----------------------------------
@@ -89,6 +133,21 @@ void HUDManager::Update() {
     UpdatePause();
 }
 
+//----------------------------------
+// oCfBȌ
+//----------------------------------
+void HUDManager::ResetBindings() {
+    scoreBinding.Reset();
+    hiScoreBinding.Reset();
+    lifeBinding.Reset();
+    bombBinding.Reset();
+    powerBinding.Reset();
+    addScoreBinding.Reset();
+    grazeBinding.Reset();
+    totalGrazeBinding.Reset();
+    fpsBinding.Reset();
+}
+
 //----------------------------------
 // XRAXV
 //----------------------------------
@@ -101,7 +160,11 @@ void HUDManager::UpdateScore() {
             int64_t speed = std::max(diff / 15, kScoreAnimSpeed);
             displayedScore += std::min(diff, speed);
         }
-        score->SetText(std::to_string(displayedScore));
+        if (scoreBinding.Set(displayedScore)) {
+            char buf[32];
+            char* end = WriteInt(buf, buf + sizeof(buf), displayedScore);
+            SetTextFromBuffer(*score, textBuffer, buf, end);
+        }
     }
 }
 
@@ -122,41 +185,72 @@ void HUDManager::UpdateHiScore() {
             int64_t speed = std::max(diff / 15, kHiScoreAnimSpeed);
             displayedHiScore += std::min(diff, speed);
         }
-        hi->SetText(std::to_string(displayedHiScore));
+        if (hiScoreBinding.Set(displayedHiScore)) {
+            char buf[32];
+            char* end = WriteInt(buf, buf + sizeof(buf), displayedHiScore);
+            SetTextFromBuffer(*hi, textBuffer, buf, end);
+        }
     }
 }
 
 //----------------------------------
-// c@\XV
+// c@E{̃ACRXV
 //----------------------------------
-void HUDManager::UpdateLife() {
-    auto& lifeMgr = GameManager::GetInstance().GetLifeManager();
-    const int lifeCount = lifeMgr.GetLife();
-    const int fragments = lifeMgr.GetFragments();
-    const int maxFragments = lifeMgr.GetFragmentsToLife();
-
-    std::string path = "UI/Item:";
+void HUDManager::UpdateCountImages(const std::vector<std::weak_ptr<Image>>& images, std::vector<std::shared_ptr<Sprite>>& sprites,
+                                   const char* prefix, int count, int fragments, int maxFragments) {
+    // XvCg擾 (E͈͊O̎̂ Tex )
+    auto spriteAt = [&](int index) -> const std::shared_ptr<Sprite>& {
+        if (index >= static_cast<int>(sprites.size())) sprites.resize(index + 1);
+        auto& sprite = sprites[index];
+        if (!sprite) sprite = Tex[std::string(kItemPath) + prefix + std::to_string(index)];
+        return sprite;
+    };
 
-    for (size_t i = 0; i < lifes.size(); ++i) {
-        if (auto l = lifes[i].lock()) {
-            if (static_cast<int>(i) < lifeCount) {
-                l->SetSprite(Tex[path + "LifeCount_3"]);
+    for (size_t i = 0; i < images.size(); ++i) {
+        if (auto img = images[i].lock()) {
+            if (static_cast<int>(i) < count) {
+                img->SetSprite(spriteAt(kCountSpriteFrames - 1));
             }
-            else if (static_cast<int>(i) == lifeCount && fragments > 0) {
+            else if (static_cast<int>(i) == count && fragments > 0) {
                 int fragIndex = Mathf::Min(fragments, maxFragments);
-                l->SetSprite(Tex[path + "LifeCount_" + std::to_string(fragIndex)]);
+                img->SetSprite(spriteAt(fragIndex));
             }
             else {
-                l->SetSprite(Tex[path + "LifeCount_0"]);
+                img->SetSprite(spriteAt(0));
             }
         }
     }
+}
 
-    if (auto f = lifeFragmentsText.lock()) {
-        f->SetText(std::to_string(fragments) + "/" + std::to_string(maxFragments));
+//----------------------------------
+// АeLXg ("n/max")
+//----------------------------------
+void HUDManager::SetFragmentsText(const std::weak_ptr<Text>& text, int fragments, int maxFragments) {
+    if (auto f = text.lock()) {
+        char buf[32];
+        char* last = buf + sizeof(buf);
+        char* p = WriteInt(buf, last, fragments);
+        p = WriteLiteral(p, last, "/");
+        p = WriteInt(p, last, maxFragments);
+        SetTextFromBuffer(*f, textBuffer, buf, p);
     }
 }
 
+//----------------------------------
+// c@\XV
+//----------------------------------
+void HUDManager::UpdateLife() {
+    auto& lifeMgr = GameManager::GetInstance().GetLifeManager();
+    const int lifeCount = lifeMgr.GetLife();
+    const int fragments = lifeMgr.GetFragments();
+    const int maxFragments = lifeMgr.GetFragmentsToLife();
+
+    if (!lifeBinding.Set({ lifeCount, fragments, maxFragments })) return;
+
+    UpdateCountImages(lifes, lifeSprites, "LifeCount_", lifeCount, fragments, maxFragments);
+    SetFragmentsText(lifeFragmentsText, fragments, maxFragments);
+}
+
 //----------------------------------
 // {\XV
 //----------------------------------
@@ -166,26 +260,10 @@ void HUDManager::UpdateBomb() {
     const int fragments = bombMgr.GetFragments();
     const int maxFragments = bombMgr.GetMaxFragments();
 
-    std::string path = "UI/Item:";
-
-    for (size_t i = 0; i < bombs.size(); ++i) {
-        if (auto b = bombs[i].lock()) {
-            if (static_cast<int>(i) < bombCount) {
-                b->SetSprite(Tex[path + "SpCount_3"]);
-            }
-            else if (static_cast<int>(i) == bombCount && fragments > 0) {
-                int fragIndex = Mathf::Min(fragments, maxFragments);
-                b->SetSprite(Tex[path + "SpCount_" + std::to_string(fragIndex)]);
-            }
-            else {
-                b->SetSprite(Tex[path + "SpCount_0"]);
-            }
-        }
-    }
+    if (!bombBinding.Set({ bombCount, fragments, maxFragments })) return;
 
-    if (auto f = bombFragmentsText.lock()) {
-        f->SetText(std::to_string(fragments) + "/" + std::to_string(maxFragments));
-    }
+    UpdateCountImages(bombs, bombSprites, "SpCount_", bombCount, fragments, maxFragments);
+    SetFragmentsText(bombFragmentsText, fragments, maxFragments);
 }
 
 //----------------------------------
@@ -195,26 +273,22 @@ void HUDManager::UpdatePower() {
     auto& powerMgr = GameManager::GetInstance().GetPowerManager();
 
     if (auto reiryoku = reiryokuText.lock()) {
-        float currentPower = powerMgr.GetPower();
-        float maxPower = powerMgr.GetMaxPower();
-
-        int totalCurrent = Mathf::Round<int>(currentPower * 100);
-        int currentInt = totalCurrent / 100;
-        int currentFrac = totalCurrent % 100;
-
-        int totalMax = Mathf::Round<int>(maxPower * 100);
-        int maxInt = totalMax / 100;
-        int maxFrac = totalMax % 100;
-
-        std::ostringstream oss;
-        oss << currentInt << ".<size=60>";
-        if (currentFrac < 10) oss << "0";
-        oss << currentFrac << "</size>/";
-        oss << maxInt << ".<size=60>";
-        if (maxFrac < 10) oss << "0";
-        oss << maxFrac << "</size>";
-
-        reiryoku->SetText(oss.str());
+        int totalCurrent = Mathf::Round<int>(powerMgr.GetPower() * 100);
+        int totalMax = Mathf::Round<int>(powerMgr.GetMaxPower() * 100);
+        if (!powerBinding.Set({ totalCurrent, totalMax })) return;
+
+        // "{int}.<size=60>{frac:02}</size>/{maxInt}.<size=60>{maxFrac:02}</size>"
+        char buf[96];
+        char* last = buf + sizeof(buf);
+        char* p = WriteInt(buf, last, totalCurrent / 100);
+        p = WriteLiteral(p, last, ".<size=60>");
+        p = WriteTwoDigits(p, totalCurrent % 100);
+        p = WriteLiteral(p, last, "</size>/");
+        p = WriteInt(p, last, totalMax / 100);
+        p = WriteLiteral(p, last, ".<size=60>");
+        p = WriteTwoDigits(p, totalMax % 100);
+        p = WriteLiteral(p, last, "</size>");
+        SetTextFromBuffer(*reiryoku, textBuffer, buf, p);
     }
 }
 
@@ -224,7 +298,11 @@ void HUDManager::UpdatePower() {
 void HUDManager::UpdateAddScore() {
     auto& scoreMgr = GameManager::GetInstance().GetScoreManager();
     if (auto tokuten = addScoreText.lock()) {
-        tokuten->SetText(std::to_string(scoreMgr.GetScorePerItem()));
+        if (addScoreBinding.Set(scoreMgr.GetScorePerItem())) {
+            char buf[32];
+            char* end = WriteInt(buf, buf + sizeof(buf), addScoreBinding.value);
+            SetTextFromBuffer(*tokuten, textBuffer, buf, end);
+        }
     }
 }
 
@@ -235,10 +313,18 @@ void HUDManager::UpdateGraze() {
     auto& grazeMgr = GameManager::GetInstance().GetGrazeManager();
 
     if (auto graze = grazeCountText.lock()) {
-        graze->SetText(std::to_string(grazeMgr.GetGrazeCount()));
+        if (grazeBinding.Set(grazeMgr.GetGrazeCount())) {
+            char buf[16];
+            char* end = WriteInt(buf, buf + sizeof(buf), grazeBinding.value);
+            SetTextFromBuffer(*graze, textBuffer, buf, end);
+        }
     }
     if (auto total = totalGrazeCountText.lock()) {
-        total->SetText(std::to_string(grazeMgr.GetTotalGraze()));
+        if (totalGrazeBinding.Set(grazeMgr.GetTotalGraze())) {
+            char buf[16];
+            char* end = WriteInt(buf, buf + sizeof(buf), totalGrazeBinding.value);
+            SetTextFromBuffer(*total, textBuffer, buf, end);
+        }
     }
 }
 
@@ -248,7 +334,17 @@ void HUDManager::UpdateGraze() {
 void HUDManager::UpdateFPS() {
     if (auto fps = fpsText.lock()) {
         float fpsValue = Time.GetFPS();
-        fps->SetText(System::Utility::Format::FormatString("{0:.1f}fps", fpsValue));
+        //  1 ŕ\̂ 0.1 Pʂŕω𔻒
+        if (!fpsBinding.Set(Mathf::Round<int>(fpsValue * 10.0f))) return;
+
+        const int tenths = std::max(fpsBinding.value, 0);
+        char buf[32];
+        char* last = buf + sizeof(buf);
+        char* p = WriteInt(buf, last, tenths / 10);
+        p = WriteLiteral(p, last, ".");
+        *p++ = static_cast<char>('0' + tenths % 10);
+        p = WriteLiteral(p, last, "fps");
+        SetTextFromBuffer(*fps, textBuffer, buf, p);
 
         if (fpsValue >= 40) {
             fps->SetColor(Color(255, 255, 255));
@@ -342,7 +438,7 @@ void HUDManager::UpdatePauseMenu(std::shared_ptr<GameObject> p) {
     if (Input.IsKeyDown(KeyCode::Z) || Input.IsPadButtonDown<0>(PadCode::A)) {
         
         if (auto music = MusicController::GetInstance()) {
-            if (auto sound = Sounds["ui_ok"]->Clone()) {
+            if (auto sound = Sounds["ui_ok"]) {
                 music->OneShotAudio(sound);
             }
         }
@@ -419,7 +515,7 @@ void HUDManager::UpdatePauseMenu(std::shared_ptr<GameObject> p) {
                
                 if (auto music = MusicController::GetInstance()) {
                     if (auto sound = Sounds["ui_no"]) {
-                        music->OneShotAudio(sound->Clone());
+                        music->OneShotAudio(sound);
                     }
                 }
 
@@ -469,7 +565,7 @@ void HUDManager::UpdateGameOverMenu(std::shared_ptr<GameObject> p) {
             
             if (auto music = MusicController::GetInstance()) {
                 if (auto sound = Sounds["ui_ok"]) {
-                    music->OneShotAudio(sound->Clone());
+                    music->OneShotAudio(sound);
                 }
             }
 
@@ -590,7 +686,7 @@ bool HUDManager::HandleMenuInput(size_t& selectionIndex, size_t menuCount) {
     if (isEvent) {
         if (auto music = MusicController::GetInstance()) {
             if (auto sound = Sounds["ui_change"]) {
-                music->OneShotAudio(sound->Clone());
+                music->OneShotAudio(sound);
             }
         }
     }
@@ -731,13 +827,13 @@ System::Coroutine HUDManager::ShakeImage(std::shared_ptr<Image> img, float durat
         float offsetX = amplitudeX * std::sin(elapsed * frequency * 2.0f * 3.14159f) + Random.Range(-1.0f, 1.0f);
         float offsetY = 0.0f; // Y͌Œ
 
-        rectTransform->anchoredPosition = basePos + Vector2D(offsetX, offsetY);
+        rectTransform->SetAnchoredPosition(basePos + Vector2D(offsetX, offsetY));
 
         _yield null;
         elapsed += Time.unscaledDeltaTime;
     }
 
-    rectTransform->anchoredPosition = basePos; // ̈ʒuɖ߂
+    rectTransform->SetAnchoredPosition(basePos); // ̈ʒuɖ߂
 }
 
 // 0. Title
@@ -835,6 +931,9 @@ void HUDManager::Reset() {
 
     displayedHiScore = 0;
     displayedScore = 0;
+    lifeSprites.clear();
+    bombSprites.clear();
+    ResetBindings();
 
     // L[s[g֌W̏
     currentKey = KeyCode::None;
@@ -3,7 +3,9 @@
 #include <vector>
 #include <memory>
 #include <cstdint>
-#include <sstream>
+#include <array>
+#include <string>
+#include <utility>
 #include "GameManager.h"
 #include "Text.h"
 #include "Image.h"
@@ -11,6 +13,22 @@
 #include "GameObject.h"
 #include "FilterUI.h"
 
+// HUD ̕\loCfBO. lςĕ`悳.
+template <class T>
+struct HUDBinding {
+    T    value{};
+    bool bound = false;
+
+    // lOƈقȂ (܂͖ݒ) ̂ true.
+    bool Set(const T& v) {
+        if (bound && value == v) return false;
+        value = v;
+        bound = true;
+        return true;
+    }
+    void Reset() { bound = false; }
+};
+
 class HUDManager {
 private:
     // UI references (weak so HUDManager doesn't own them)
@@ -33,6 +51,24 @@ private:
     static constexpr int64_t kHiScoreAnimSpeed = 1000LL;
     static constexpr int64_t kScoreAnimSpeed = 1000LL;
 
+    // \l̃oCfBO (ω̂ SetText / SetSprite)
+    HUDBinding<int64_t> scoreBinding;
+    HUDBinding<int64_t> hiScoreBinding;
+    HUDBinding<std::array<int, 3>> lifeBinding;     // c@, , KvА
+    HUDBinding<std::array<int, 3>> bombBinding;     // {, , ő匇А
+    HUDBinding<std::pair<int, int>> powerBinding;   // ݒl, ől (x100)
+    HUDBinding<int64_t> addScoreBinding;
+    HUDBinding<int> grazeBinding;
+    HUDBinding<int> totalGrazeBinding;
+    HUDBinding<int> fpsBinding;                     // FPS (x10)
+
+    // SetText p̎g񂵃obt@
+    std::string textBuffer;
+
+    // c@E{̃XvCg (Initialize ɉ)
+    std::vector<std::shared_ptr<Sprite>> lifeSprites;
+    std::vector<std::shared_ptr<Sprite>> bombSprites;
+
     // j[z
     std::vector<std::weak_ptr<Image>> pauseMenuItems;
     std::vector<std::weak_ptr<Image>> confirmMenuItems;
@@ -70,6 +106,10 @@ private:
     void UpdateAddScore();
     void UpdateGraze();
     void UpdateFPS();
+    void ResetBindings();
+    void UpdateCountImages(const std::vector<std::weak_ptr<Image>>& images, std::vector<std::shared_ptr<Sprite>>& sprites,
+                           const char* prefix, int count, int fragments, int maxFragments);
+    void SetFragmentsText(const std::weak_ptr<Text>& text, int fragments, int maxFragments);
 
     void UpdatePause();
     void UpdatePauseMenu(std::shared_ptr<GameObject> p);
@@ -42,7 +42,7 @@ public:
 		Vector2D direction = Vector2D(std::cos(angleRad), std::sin(angleRad));
 
 		// ړ
-		transform->position += direction * speed * Time.deltaTime;
+		transform->Translate(direction * speed * Time.deltaTime);
 
 		// ʊO`FbN
 		Vector2D pos = transform->position;
@@ -117,7 +117,7 @@ public:
 	StraightMove(const Vector2D& vec): speed(vec) {}
 
 	void Move(std::shared_ptr<Transform2D> _tr) override {
-		_tr->position += speed * Time.deltaTime;
+		_tr->Translate(speed * Time.deltaTime);
 	}
 };
 
@@ -139,7 +139,7 @@ public:
 	}
 
 	void Move(std::shared_ptr<Transform2D> _tr) override {
-		_tr->position += direction * speed * Time.deltaTime;
+		_tr->Translate(direction * speed * Time.deltaTime);
 	}
 };
 
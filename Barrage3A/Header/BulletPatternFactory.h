@@ -16,7 +16,7 @@ public:
 	void Move(std::shared_ptr<Transform2D> tr) override {
 		if (!player) return;
 		Vector2D dir = (player->transform->position - tr->position).GetNormalize();
-		tr->position += dir * speed * Time.deltaTime;
+		tr->Translate(dir * speed * Time.deltaTime);
 	}
 };
 
@@ -33,7 +33,7 @@ public:
 		for (int i = 0; i < count; ++i) {
 			float angle = centerAngle + interval * (i - (count - 1) / 2.0f);
 			auto bullet = PrefabMgr.Instantiate("Bullet_Base")[0];
-			bullet->transform->position = origin;
+			bullet->transform->SetPosition(origin);
 			bullet->GetAppBase<BulletControl>()->SetMove(std::make_shared<FrontSpreadMove>(angle, speed));
 			objs.push_back(bullet);
 		}
@@ -48,7 +48,7 @@ public:
 		float angle = atan2f(dir.y, dir.x) * 180.0f / Mathf::PI;
 
 		auto bullet = PrefabMgr.Instantiate("Bullet_Base")[0];
-		bullet->transform->position = origin;
+		bullet->transform->SetPosition(origin);
 		bullet->GetAppBase<BulletControl>()->SetMove(std::make_shared<FrontSpreadMove>(angle, speed));
 	}
 	
@@ -60,7 +60,7 @@ public:
 		float angle = atan2f(dir.y, dir.x) * 180.0f / Mathf::PI + offsetAngleDeg;
 
 		auto bullet = PrefabMgr.Instantiate("Bullet_Base")[0];
-		bullet->transform->position = origin;
+		bullet->transform->SetPosition(origin);
 		bullet->GetAppBase<BulletControl>()->SetMove(std::make_shared<FrontSpreadMove>(angle, speed));
 	}
 
@@ -70,21 +70,21 @@ public:
 		if (!player) return;
 		float angle = (player->transform->position.x > origin.x) ? 45.0f : 135.0f;
 		auto bullet = PrefabMgr.Instantiate("Bullet_Base")[0];
-		bullet->transform->position = origin;
+		bullet->transform->SetPosition(origin);
 		bullet->GetAppBase<BulletControl>()->SetMove(std::make_shared<FrontSpreadMove>(angle, speed));
 	}
 
 	// 5. Œe
 	static void FireFixed(Vector2D origin, float angleDeg, float speed) {
 		auto bullet = PrefabMgr.Instantiate("Bullet_Base")[0];
-		bullet->transform->position = origin;
+		bullet->transform->SetPosition(origin);
 		bullet->GetAppBase<BulletControl>()->SetMove(std::make_shared<FrontSpreadMove>(angleDeg, speed));
 	}
 
 	// 6. _e
 	static void FireRandom(Vector2D origin) {
-		float angle = Random.Range(0.0f, 360.0f);
-		float speed = Random.Range(100.0f, 400.0f);
+		float angle = Random.Stream(RandomStream::Pattern).Range(0.0f, 360.0f);
+		float speed = Random.Stream(RandomStream::Pattern).Range(100.0f, 400.0f);
 		FireFixed(origin, angle, speed);
 	}
 
@@ -98,7 +98,7 @@ public:
 	// 8. ݒueȉɎ~܂A莞Ԍɍ폜j
 	static void FireStationary(Vector2D origin) {
 		auto bullet = PrefabMgr.Instantiate("Bullet_Base")[0];
-		bullet->transform->position = origin;
+		bullet->transform->SetPosition(origin);
 		bullet->GetAppBase<BulletControl>()->SetMove(std::make_shared<DelayMove>(2.0f, std::make_shared<StraightMove>(Vector2D(0, 0))));
 	}
 
@@ -107,7 +107,7 @@ public:
 		auto player = GetPlayer();
 		if (!player) return;
 		auto bullet = PrefabMgr.Instantiate("Bullet_Base")[0];
-		bullet->transform->position = origin;
+		bullet->transform->SetPosition(origin);
 		bullet->GetAppBase<BulletControl>()->SetMove(std::make_shared<HomingMove>(player, speed));
 	}
 
@@ -129,7 +129,7 @@ public:
 			// ̂Ƃ͒SE̒ԂɂȂ邽ߔ
 			if (count % 2 == 0) offsetX += spacing / 2.0f;
 
-			bullet->transform->position = origin + Vector2D(offsetX, 0);
+			bullet->transform->SetPosition(origin + Vector2D(offsetX, 0));
 			bullet->GetAppBase<BulletControl>()->SetMove(std::make_shared<StraightMove>(speed));
 
 			objs.push_back(bullet);
@@ -80,7 +80,7 @@ public:
 protected:
 	virtual void Init() = 0;
 	virtual void Pattern() = 0;
-	virtual void Move() { transform->position += vel * speed * Time.deltaTime; };
+	virtual void Move() { transform->Translate(vel * speed * Time.deltaTime); };
 	virtual void Shot() = 0;
 };
 
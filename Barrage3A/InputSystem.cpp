@@ -94,6 +94,106 @@ void InputSystem::Update() {
         }
     }
 }
+namespace {
+    void WriteU16(uint8_t*& p, uint16_t v) { *p++ = (uint8_t)(v & 0xFF); *p++ = (uint8_t)(v >> 8); }
+    uint16_t ReadU16(const uint8_t*& p) { uint16_t v = (uint16_t)(p[0] | (p[1] << 8)); p += 2; return v; }
+}
+
+void InputFrame::ToBytes(uint8_t* out) const {
+    uint8_t* p = out;
+    for (uint8_t k : keys) *p++ = k;
+    *p++ = mouseButtons;
+    WriteU16(p, (uint16_t)mouseX);
+    WriteU16(p, (uint16_t)mouseY);
+    WriteU16(p, (uint16_t)mouseScroll);
+    for (const auto& pad : pads) {
+        WriteU16(p, pad.buttons);
+        *p++ = pad.leftTrigger;
+        *p++ = pad.rightTrigger;
+        WriteU16(p, (uint16_t)pad.thumbLX);
+        WriteU16(p, (uint16_t)pad.thumbLY);
+        WriteU16(p, (uint16_t)pad.thumbRX);
+        WriteU16(p, (uint16_t)pad.thumbRY);
+        *p++ = pad.connected;
+    }
+}
+
+void InputFrame::FromBytes(const uint8_t* in) {
+    const uint8_t* p = in;
+    for (uint8_t& k : keys) k = *p++;
+    mouseButtons = *p++;
+    mouseX      = (int16_t)ReadU16(p);
+    mouseY      = (int16_t)ReadU16(p);
+    mouseScroll = (int16_t)ReadU16(p);
+    for (auto& pad : pads) {
+        pad.buttons      = ReadU16(p);
+        pad.leftTrigger  = *p++;
+        pad.rightTrigger = *p++;
+        pad.thumbLX      = (int16_t)ReadU16(p);
+        pad.thumbLY      = (int16_t)ReadU16(p);
+        pad.thumbRX      = (int16_t)ReadU16(p);
+        pad.thumbRY      = (int16_t)ReadU16(p);
+        pad.connected    = *p++;
+    }
+}
+
+InputFrame InputSystem::CaptureFrame() const {
+    InputFrame frame;
+    for (int i = 0; i < 256; ++i) {
+        if (keyStateCurrent[i] != 0) frame.keys[i >> 3] |= (uint8_t)(1 << (i & 7));
+    }
+    frame.mouseButtons = (uint8_t)(mouseInputCurrent & 0xFF);
+    frame.mouseX       = (int16_t)mousePos.x;
+    frame.mouseY       = (int16_t)mousePos.y;
+    frame.mouseScroll  = (int16_t)scrollAmount;
+    for (size_t n = 0; n < pads.size(); ++n) {
+        const auto& pad = pads[n];
+        auto& out = frame.pads[n];
+        for (int i = 0; i < 16; ++i) {
+            if (pad.current[i] != 0) out.buttons |= (uint16_t)(1 << i);
+        }
+        out.leftTrigger  = pad.leftTrigger;
+        out.rightTrigger = pad.rightTrigger;
+        out.thumbLX      = pad.thumbLX;
+        out.thumbLY      = pad.thumbLY;
+        out.thumbRX      = pad.thumbRX;
+        out.thumbRY      = pad.thumbRY;
+        out.connected    = pad.isConnected ? 1 : 0;
+    }
+    return frame;
+}
+
+void InputSystem::ApplyFrame(const InputFrame& frame) {
+    // Update ƓOt[ۑĂ獷ւ.
+    keyStatePrevious = keyStateCurrent;
+    for (int i = 0; i < 256; ++i) {
+        keyStateCurrent[i] = (frame.keys[i >> 3] >> (i & 7)) & 1;
+    }
+
+    mouseInputPrevious = mouseInputCurrent;
+    mouseInputCurrent  = frame.mouseButtons;
+    mousePos.x         = frame.mouseX;
+    mousePos.y         = frame.mouseY;
+    UpdateMouseCounter();
+    scrollAmount       = frame.mouseScroll;
+
+    for (size_t n = 0; n < pads.size(); ++n) {
+        auto& pad = pads[n];
+        const auto& in = frame.pads[n];
+        pad.previous = pad.current;
+        for (int i = 0; i < 16; ++i) {
+            pad.current[i] = (in.buttons >> i) & 1;
+        }
+        pad.leftTrigger  = in.leftTrigger;
+        pad.rightTrigger = in.rightTrigger;
+        pad.thumbLX      = in.thumbLX;
+        pad.thumbLY      = in.thumbLY;
+        pad.thumbRX      = in.thumbRX;
+        pad.thumbRY      = in.thumbRY;
+        pad.isConnected  = in.connected != 0;
+    }
+}
+
 // L[Ă邩`FbN.
 bool InputSystem::IsKey(int key) {
 	return keyStateCurrent[key] != 0;
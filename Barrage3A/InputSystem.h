@@ -7,6 +7,8 @@
 #include "Vector.h"
 #include "LibrarySettings.h"
 #include <functional>
+#include <array>
+#include <cstdint>
 
 namespace GameEngine::Utilities {
     template<size_t N>
@@ -23,6 +25,30 @@ struct PadState {
     bool isConnected = false;
 };
 
+// 1 フレーム分の入力 (リプレイ記録用). ToBytes / FromBytes で固定長のバイト列と相互変換する.
+struct InputFrame {
+    struct Pad {
+        uint16_t buttons = 0;           // 16 ボタンのビット列
+        uint8_t  leftTrigger = 0;
+        uint8_t  rightTrigger = 0;
+        int16_t  thumbLX = 0, thumbLY = 0;
+        int16_t  thumbRX = 0, thumbRY = 0;
+        uint8_t  connected = 0;
+    };
+
+    std::array<uint8_t, 32> keys{};     // 256 キーのビット列
+    uint8_t  mouseButtons = 0;
+    int16_t  mouseX = 0, mouseY = 0;
+    int16_t  mouseScroll = 0;
+    std::array<Pad, LibrarySettings::MaxPadCount> pads{};
+
+    static constexpr size_t PadBytes  = 2 + 1 + 1 + 8 + 1;
+    static constexpr size_t ByteSize  = 32 + 1 + 2 + 2 + 2 + PadBytes * LibrarySettings::MaxPadCount;
+
+    void ToBytes(uint8_t* out) const;
+    void FromBytes(const uint8_t* in);
+};
+
 class InputSystem {
 private:
 	// キーボードの状態を管理する配列.
@@ -57,6 +83,11 @@ public:
 	// 入力の状態を更新する.
 	void Update();
 
+	// 現在の入力を InputFrame として取得 (リプレイ記録).
+	InputFrame CaptureFrame() const;
+	// デバイスを読まずに InputFrame を現在の入力として適用 (リプレイ再生).
+	void ApplyFrame(const InputFrame& frame);
+
 	// キーが押されているかをチェック.
 	bool IsKey(int key);
 	// キーが押された瞬間をチェック.
@@ -11,6 +11,7 @@
 #pragma once
 
 #include "GameEngine.h"
+#include "Metrics.h"
 #include <functional>
 
 namespace System {
@@ -65,6 +66,7 @@ namespace System {
 
             tasks.insert(tasks.end(), newTasks.begin(), newTasks.end());
             newTasks.clear();
+            Metrics::GetInstance().Set(Metric::Timers, tasks.size());
         }
 
         void Invoke(std::function<void()> callback, float delay, bool repeat = false) {
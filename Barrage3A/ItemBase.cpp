@@ -16,6 +16,7 @@
 #include "AudioResourceShortcut.hpp"
 #include "Texture2DManager.hpp"
 #include "ScoreEffect.h"
+#include "SnapshotStream.h"
 using namespace GameEngine;
 
 // コンストラクタ 
@@ -57,11 +58,11 @@ void ItemBase::Update() {
     // 回転アニメーション（減速付き）
     // ----------------------------
     if (spinTimer > 0.0f) {
-        transform->rotation += initialSpinSpeed;
+        transform->Rotate(initialSpinSpeed);
         spinTimer -= 1.0f / 60.0f;  // 1フレームごとに減少（60FPS基準）
         if (spinTimer < 0.0f) {
             spinTimer = 0.0f;
-			transform->rotation = 0.0f;  // 回転をリセット
+			transform->SetRotation(0.0f);  // 回転をリセット
         }
     }
     // ----------------------------
@@ -86,13 +87,13 @@ void ItemBase::Update() {
     if (isAutoCollect && hasRisen) {
         if (distSqr > 0.001f) {
             toPlayer.Normalize();
-            transform->position += toPlayer * collectSpeed;
+            transform->Translate(toPlayer * collectSpeed);
         }
     }
     else {
         // ▼ 重力落下
         velocity.y = Mathf::Max(velocity.y + gravity, maxFallSpeed);
-        transform->position += velocity;
+        transform->Translate(velocity);
 
         // ▼ 近距離吸引（吸引範囲内ならじわじわ引っ張られる）
         if (distSqr < attractRange * attractRange) {
@@ -144,7 +145,7 @@ void ItemBase::OnItemEvent() {
 
         auto effect = GameObject::Instantiate("ScoreEffect")->AddAppBase<ScoreEffect>();
         effect->SetScore(pts);
-        effect->GetGameObject()->transform->position = transform->position;
+        effect->GetGameObject()->transform->SetPosition(transform->position);
         effect->SetFont(Texture2DManager::GetInstance().GetSpriteFont("scoreNumber"));
         if (player && player->transform->position.y >= fullPointLine)
             effect->SetColor(fullScoreColor);
@@ -157,7 +158,7 @@ void ItemBase::OnItemEvent() {
 
         auto effect = GameObject::Instantiate("ScoreEffect")->AddAppBase<ScoreEffect>();
         effect->SetScore(pts);
-        effect->GetGameObject()->transform->position = transform->position;
+        effect->GetGameObject()->transform->SetPosition(transform->position);
         effect->SetFont(Texture2DManager::GetInstance().GetSpriteFont("scoreNumber"));
         if (player && player->transform->position.y >= fullPointLine)
             effect->SetColor(fullScoreColor);
@@ -206,7 +207,7 @@ void ItemBase::OnItemEvent() {
     }
 
     if (auto audio = Sounds["item_get"]) {
-        MusicController::GetInstance()->OneShotAudio(audio->Clone(),0.5f);
+        MusicController::GetInstance()->OneShotAudio(audio,0.5f);
     }
 }
 
@@ -221,3 +222,22 @@ void ItemBase::SetType(ItemType type) {
 void ItemBase::SetSpinDuration(float time) {
     spinTimer = time;
 }
+
+
+void ItemBase::SaveState(SnapshotWriter& out) const {
+    out.Write(transform->position);
+    out.Write(transform->rotation);
+    out.Write(velocity);
+    out.Write(spinTimer);
+    out.Write(isAutoCollect);
+    out.Write(hasRisen);
+}
+
+void ItemBase::LoadState(SnapshotReader& in) {
+    transform->SetPosition(in.Read<Vector2D>());
+    transform->SetRotation(in.Read<float>());
+    in.Read(velocity);
+    in.Read(spinTimer);
+    in.Read(isAutoCollect);
+    in.Read(hasRisen);
+}
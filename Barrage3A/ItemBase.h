@@ -13,6 +13,9 @@
 #include "AppBase.h"
 #include "SpriteRenderer.h"
 
+class SnapshotWriter;
+class SnapshotReader;
+
 enum class ItemType {
     Score,              // 得点アイテム.
 	ScoreBig,           // 大得点アイテム.
@@ -56,6 +59,11 @@ public: // 公開.
     void AutoCollect();    
     void SetType(ItemType type);
     void SetSpinDuration(float time); // 回転する秒数を設定
+    ItemType GetType() const { return itemType; }
+
+    // 落下・吸収の進行状態 (スナップショット用).
+    void SaveState(SnapshotWriter& out) const;
+    void LoadState(SnapshotReader& in);
 protected:
     virtual std::shared_ptr<AppBase> Clone() const override {
         return std::make_shared<ItemBase>(*this);
@@ -3,6 +3,7 @@
 #include "SpriteRenderer.h"
 #include "Texture2DShortcut.hpp"
 #include "ArrowPointer.h"
+#include "SnapshotStream.h"
 using namespace GameEngine;
 
 void ItemManager::AddItem(const std::shared_ptr<ItemBase>& item) {
@@ -38,9 +39,9 @@ void ItemManager::Clear() {
     items.clear();
 }
 
-void ItemManager::CreateItem(ItemType itemType, Vector2D pos) {
+std::shared_ptr<ItemBase> ItemManager::CreateItem(ItemType itemType, Vector2D pos) {
     auto itemObj = GameObject::Instantiate("Item");
-    itemObj->transform->position = pos;
+    itemObj->transform->SetPosition(pos);
     auto item = itemObj->AddAppBase<ItemBase>();
     item->SetType(itemType);
     std::string key = "Items/Item:";
@@ -93,4 +94,38 @@ void ItemManager::CreateItem(ItemType itemType, Vector2D pos) {
 			arrow->SetArrowSprite(arraw);
 		}
     }  
-}
\ No newline at end of file
+    return item;
+}
+
+void ItemManager::SaveState(SnapshotWriter& out) const {
+    uint32_t count = 0;
+    for (const auto& wp : items) {
+        auto item = wp.lock();
+        if (item && item->GetGameObject() && !item->GetGameObject()->IsPendingDestroy()) ++count;
+    }
+    out.Write(count);
+
+    for (const auto& wp : items) {
+        auto item = wp.lock();
+        if (!item || !item->GetGameObject() || item->GetGameObject()->IsPendingDestroy()) continue;
+        out.Write(item->GetGameObject()->GetInstanceID());
+        out.Write(item->GetType());
+        const size_t block = out.BeginBlock();
+        item->SaveState(out);
+        out.EndBlock(block);
+    }
+}
+
+void ItemManager::LoadState(SnapshotReader& in) {
+    for (uint32_t i = in.Read<uint32_t>(); i > 0 && !in.IsFailed(); --i) {
+        const auto instanceId = in.Read<uint64_t>();
+        const auto type = in.Read<ItemType>();
+        const size_t end = in.BeginBlock();
+
+        // ʒu LoadState ŏ㏑.
+        auto item = CreateItem(type, Vector2D());
+        item->GetGameObject()->RestoreInstanceID(instanceId);
+        item->LoadState(in);
+        in.EndBlock(end);
+    }
+}
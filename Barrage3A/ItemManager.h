@@ -2,6 +2,9 @@
 
 #include "ItemBase.h"
 
+class SnapshotWriter;
+class SnapshotReader;
+
 class ItemManager {
 private:
 	std::vector<std::weak_ptr<ItemBase>> items;
@@ -22,5 +25,9 @@ public:
 
 	void Clear();
 
-	void CreateItem(ItemType itemType,Vector2D pos);
+	std::shared_ptr<ItemBase> CreateItem(ItemType itemType,Vector2D pos);
+
+	// ̃ACeۑ. ͊̃ACejς݂̏ԂŌĂ.
+	void SaveState(SnapshotWriter& out) const;
+	void LoadState(SnapshotReader& in);
 };
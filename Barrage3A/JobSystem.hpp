@@ -0,0 +1,140 @@
+﻿/*
+    JobSystem.hpp
+
+    class-
+    - JobSystem
+
+    作成日         : 2026/10/19
+    最終変更日     : 2026/10/19
+*/
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <algorithm>
+#include <cstdint>
+
+namespace System {
+
+    // 常駐ワーカースレッドでインデックス単位のジョブを並列実行する.
+    // ParallelFor は呼び出しスレッドも処理に参加し, 全ジョブ完了まで戻らない.
+    class JobSystem {
+    private:
+        std::vector<std::thread> workers;
+        std::mutex mutex;
+        std::condition_variable wakeCv;
+        std::condition_variable doneCv;
+
+        const std::function<void(size_t)>* job = nullptr; // 実行中のジョブ (ParallelFor の間のみ有効)
+        size_t jobCount = 0;
+        std::atomic<size_t> nextIndex{ 0 };
+        std::atomic<size_t> finished{ 0 };
+        size_t activeWorkers = 0;   // ジョブを参照中のワーカー数
+        uint64_t generation = 0;    // ジョブ投入ごとに加算
+        bool quit = false;
+
+        JobSystem() {
+            unsigned hc = std::thread::hardware_concurrency();
+            Start(hc > 1 ? hc - 1 : 0);
+        }
+        ~JobSystem() { Stop(); }
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        void Start(size_t count) {
+            quit = false;
+            for (size_t i = 0; i < count; ++i) {
+                workers.emplace_back([this]() { WorkerLoop(); });
+            }
+        }
+
+        void Stop() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                quit = true;
+            }
+            wakeCv.notify_all();
+            for (auto& t : workers) t.join();
+            workers.clear();
+        }
+
+        // 残っているインデックスを取り出して実行.
+        void RunIndices(const std::function<void(size_t)>& func, size_t count) {
+            size_t i;
+            while ((i = nextIndex.fetch_add(1)) < count) {
+                func(i);
+                if (finished.fetch_add(1) + 1 == count) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    doneCv.notify_all();
+                }
+            }
+        }
+
+        void WorkerLoop() {
+            uint64_t seen = 0;
+            for (;;) {
+                const std::function<void(size_t)>* func;
+                size_t count;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    wakeCv.wait(lock, [&]() { return quit || (job && generation != seen); });
+                    if (quit) return;
+                    seen = generation;
+                    func = job;
+                    count = jobCount;
+                    ++activeWorkers;
+                }
+                RunIndices(*func, count);
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    --activeWorkers;
+                }
+                doneCv.notify_all();
+            }
+        }
+
+    public:
+        static JobSystem& GetInstance() {
+            static JobSystem instance;
+            return instance;
+        }
+
+        // ワーカー数 (呼び出しスレッドを含まない)
+        size_t GetWorkerCount() const { return workers.size(); }
+
+        // ワーカー数を変更 (0 なら呼び出しスレッドのみで実行)
+        void SetWorkerCount(size_t count) {
+            if (count == workers.size()) return;
+            Stop();
+            Start(count);
+        }
+
+        // [0, count) の各インデックスで func を呼ぶ. 全て終わるまで待機.
+        void ParallelFor(size_t count, const std::function<void(size_t)>& func) {
+            if (count == 0) return;
+            if (workers.empty() || count == 1) {
+                for (size_t i = 0; i < count; ++i) func(i);
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                job = &func;
+                jobCount = count;
+                nextIndex = 0;
+                finished = 0;
+                ++generation;
+            }
+            wakeCv.notify_all();
+
+            RunIndices(func, count);
+
+            std::unique_lock<std::mutex> lock(mutex);
+            doneCv.wait(lock, [&]() { return finished.load() >= count && activeWorkers == 0; });
+            job = nullptr;
+        }
+    };
+}
@@ -0,0 +1,432 @@
+#include "Project.h"
+#include "JsonDocument.h"
+#include "JsonValue.hpp"
+#include "File.hpp"
+#include <algorithm>
+#include <charconv>
+#include <memory>
+#include <stdexcept>
+#include <cstdlib>
+
+namespace {
+    inline bool IsDigit(char c) noexcept { return c >= '0' && c <= '9'; }
+
+    // vfȂIuWFNg͑}\[g (, Ɨ̈mۂȂ).
+    constexpr size_t InsertionSortLimit = 16;
+
+    void SortMembers(JsonMember* members, size_t count) {
+        const auto less = [](const JsonMember& a, const JsonMember& b) { return a.key < b.key; };
+        if (count <= InsertionSortLimit) {
+            for (size_t i = 1; i < count; ++i) {
+                const JsonMember m = members[i];
+                size_t j = i;
+                for (; j > 0 && less(m, members[j - 1]); --j) members[j] = members[j - 1];
+                members[j] = m;
+            }
+            return;
+        }
+        if (!std::is_sorted(members, members + count, less)) {
+            std::stable_sort(members, members + count, less);
+        }
+    }
+
+    int HexValue(char c) {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        throw std::runtime_error("Invalid \\u escape");
+    }
+
+    uint32_t ReadHex4(const char* p, const char* end) {
+        if (end - p < 4) throw std::runtime_error("Invalid \\u escape");
+        return static_cast<uint32_t>((HexValue(p[0]) << 12) | (HexValue(p[1]) << 8) | (HexValue(p[2]) << 4) | HexValue(p[3]));
+    }
+
+    void AppendUtf8(std::string& out, uint32_t cp) {
+        if (cp < 0x80) {
+            out.push_back(static_cast<char>(cp));
+        }
+        else if (cp < 0x800) {
+            out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+        else if (cp < 0x10000) {
+            out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+        else {
+            out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+    }
+}
+
+// ---- A[i --------------------------------------------------------------
+
+std::byte* JsonArena::AllocateSlow(size_t bytes, size_t align) {
+    const size_t need = bytes + align;
+    // Reset ͊mۍς݂̃ubNɎg.
+    size_t next = blocks.empty() ? 0 : current + 1;
+    while (next < blocks.size() && blocks[next].size < need) ++next;
+    if (next >= blocks.size()) {
+        Block block;
+        block.size = std::max(blockSize, need);
+        block.data.reset(new std::byte[block.size]);
+        blocks.push_back(std::move(block));
+        next = blocks.size() - 1;
+    }
+    current = next;
+    offset = 0;
+    return Allocate(bytes, align);
+}
+
+size_t JsonArena::GetCapacity() const {
+    size_t total = 0;
+    for (const auto& block : blocks) total += block.size;
+    return total;
+}
+
+// ---- vf ------------------------------------------------------------------
+
+bool JsonNode::GetBool() const {
+    if (type != JsonType::Bool) throw std::runtime_error("Expected bool");
+    return boolean;
+}
+
+double JsonNode::GetNumber() const {
+    if (type != JsonType::Number) throw std::runtime_error("Expected number");
+    return number;
+}
+
+std::string_view JsonNode::GetRawString() const {
+    if (type != JsonType::String) throw std::runtime_error("Expected string");
+    return { string, size };
+}
+
+std::string JsonNode::GetString() const {
+    std::string result;
+    AppendString(result);
+    return result;
+}
+
+void JsonNode::AppendString(std::string& out) const {
+    const std::string_view raw = GetRawString();
+    if (escaped) JsonDocument::Unescape(raw, out);
+    else out.append(raw);
+}
+
+std::span<const JsonNode> JsonNode::Items() const {
+    if (type != JsonType::Array) throw std::runtime_error("Expected array");
+    return { items, size };
+}
+
+std::span<const JsonMember> JsonNode::Members() const {
+    if (type != JsonType::Object) throw std::runtime_error("Expected object");
+    return { members, size };
+}
+
+const JsonNode* JsonNode::Find(std::string_view key) const {
+    if (type != JsonType::Object) return nullptr;
+    const JsonMember* last = members + size;
+    const JsonMember* it = std::lower_bound(members, last, key,
+        [](const JsonMember& m, std::string_view k) { return m.key < k; });
+    return (it != last && it->key == key) ? &it->value : nullptr;
+}
+
+JsonValue JsonNode::ToJsonValue() const {
+    switch (type) {
+    case JsonType::Bool:   return JsonValue{ JsonPrimitive(boolean) };
+    case JsonType::Number: return JsonValue{ JsonPrimitive(number) };
+    case JsonType::String: return JsonValue{ JsonPrimitive(GetString()) };
+    case JsonType::Array: {
+        JsonArray arr;
+        arr.reserve(size);
+        for (const JsonNode& item : Items()) arr.push_back(item.ToJsonValue());
+        return JsonValue{ std::move(arr) };
+    }
+    case JsonType::Object: {
+        // L[͐ɏôc (] JsonParser Ɠ).
+        JsonObject obj;
+        obj.reserve(size);
+        for (const JsonMember& m : Members()) obj.emplace(std::string(m.key), m.value.ToJsonValue());
+        return JsonValue{ std::move(obj) };
+    }
+    default:
+        return JsonValue{ JsonPrimitive(nullptr) };
+    }
+}
+
+// ----  ------------------------------------------------------------------
+
+const JsonNode& JsonDocument::Parse(std::string&& text) {
+    owned = std::make_unique<std::string>(std::move(text));
+    return Parse(std::string_view(*owned));
+}
+
+const JsonNode& JsonDocument::ParseFile(const std::string& path) {
+    return Parse(System::IO::File::ReadAllText(path));
+}
+
+const JsonNode& JsonDocument::Parse(std::string_view text) {
+    arena.Reset();
+    valueStack.clear();
+    memberStack.clear();
+    depth = 0;
+    root = JsonNode{};
+
+    begin = cursor = text.data();
+    end = begin + text.size();
+    // UTF-8  BOM ͓ǂݔ΂.
+    if (text.size() >= 3 && static_cast<unsigned char>(text[0]) == 0xEF
+        && static_cast<unsigned char>(text[1]) == 0xBB && static_cast<unsigned char>(text[2]) == 0xBF) {
+        cursor += 3;
+    }
+
+    root = ParseValue();
+    SkipWhitespace();
+    if (cursor != end) Fail("Unexpected trailing characters");
+    return root;
+}
+
+void JsonDocument::Fail(const char* message) const {
+    throw std::runtime_error("JSON parse error at offset " + std::to_string(cursor - begin) + ": " + message);
+}
+
+void JsonDocument::SkipWhitespace() noexcept {
+    while (cursor < end && (*cursor == ' ' || *cursor == '\n' || *cursor == '\r' || *cursor == '\t')) ++cursor;
+}
+
+JsonNode JsonDocument::ParseValue() {
+    SkipWhitespace();
+    if (cursor >= end) Fail("Unexpected end of JSON");
+
+    JsonNode node;
+    switch (*cursor) {
+    case '{': return ParseObject();
+    case '[': return ParseArray();
+    case '"': {
+        bool hasEscapes = false;
+        const std::string_view raw = ScanString(hasEscapes);
+        node.type = JsonType::String;
+        node.escaped = hasEscapes;
+        node.string = raw.data();
+        node.size = static_cast<uint32_t>(raw.size());
+        return node;
+    }
+    case 't':
+        ExpectLiteral("true", 4);
+        node.type = JsonType::Bool;
+        node.boolean = true;
+        return node;
+    case 'f':
+        ExpectLiteral("false", 5);
+        node.type = JsonType::Bool;
+        node.boolean = false;
+        return node;
+    case 'n':
+        ExpectLiteral("null", 4);
+        return node;
+    default:
+        if (*cursor == '-' || IsDigit(*cursor)) return ParseNumber();
+        Fail("Unexpected JSON value");
+    }
+}
+
+JsonNode JsonDocument::ParseObject() {
+    ++cursor;   // '{'
+    if (++depth > MaxDepth) Fail("Nesting too deep");
+
+    // q̉͂Őς܂ꂽ͎qƂɖ߂̂, base オ̗vf.
+    const size_t base = memberStack.size();
+    SkipWhitespace();
+    if (cursor < end && *cursor == '}') {
+        ++cursor;
+    }
+    else {
+        while (true) {
+            const std::string_view key = ParseKey();
+            SkipWhitespace();
+            if (cursor >= end || *cursor != ':') Fail("Expected ':' after key");
+            ++cursor;
+            const JsonNode value = ParseValue();
+            memberStack.push_back({ key, value });
+
+            SkipWhitespace();
+            if (cursor < end && *cursor == ',') { ++cursor; continue; }
+            if (cursor < end && *cursor == '}') { ++cursor; break; }
+            Fail("Expected ',' or '}'");
+        }
+    }
+    --depth;
+
+    const size_t count = memberStack.size() - base;
+    JsonMember* members = nullptr;
+    if (count > 0) {
+        members = arena.Allocate<JsonMember>(count);
+        std::uninitialized_copy(memberStack.begin() + base, memberStack.end(), members);
+        SortMembers(members, count);
+        memberStack.resize(base);
+    }
+
+    JsonNode node;
+    node.type = JsonType::Object;
+    node.size = static_cast<uint32_t>(count);
+    node.members = members;
+    return node;
+}
+
+JsonNode JsonDocument::ParseArray() {
+    ++cursor;   // '['
+    if (++depth > MaxDepth) Fail("Nesting too deep");
+
+    const size_t base = valueStack.size();
+    SkipWhitespace();
+    if (cursor < end && *cursor == ']') {
+        ++cursor;
+    }
+    else {
+        while (true) {
+            const JsonNode value = ParseValue();
+            valueStack.push_back(value);
+
+            SkipWhitespace();
+            if (cursor < end && *cursor == ',') { ++cursor; continue; }
+            if (cursor < end && *cursor == ']') { ++cursor; break; }
+            Fail("Expected ',' or ']'");
+        }
+    }
+    --depth;
+
+    const size_t count = valueStack.size() - base;
+    JsonNode* items = nullptr;
+    if (count > 0) {
+        items = arena.Allocate<JsonNode>(count);
+        std::uninitialized_copy(valueStack.begin() + base, valueStack.end(), items);
+        valueStack.resize(base);
+    }
+
+    JsonNode node;
+    node.type = JsonType::Array;
+    node.size = static_cast<uint32_t>(count);
+    node.items = items;
+    return node;
+}
+
+JsonNode JsonDocument::ParseNumber() {
+    // JSON ̐l̏󂯕t, ϊ from_chars ɔC.
+    const char* start = cursor;
+    if (*cursor == '-') ++cursor;
+    if (cursor >= end || !IsDigit(*cursor)) Fail("Invalid number");
+    if (*cursor == '0') ++cursor;
+    else while (cursor < end && IsDigit(*cursor)) ++cursor;
+    if (cursor < end && *cursor == '.') {
+        ++cursor;
+        if (cursor >= end || !IsDigit(*cursor)) Fail("Invalid number");
+        while (cursor < end && IsDigit(*cursor)) ++cursor;
+    }
+    if (cursor < end && (*cursor == 'e' || *cursor == 'E')) {
+        ++cursor;
+        if (cursor < end && (*cursor == '+' || *cursor == '-')) ++cursor;
+        if (cursor >= end || !IsDigit(*cursor)) Fail("Invalid number");
+        while (cursor < end && IsDigit(*cursor)) ++cursor;
+    }
+
+    JsonNode node;
+    node.type = JsonType::Number;
+    const auto [ptr, ec] = std::from_chars(start, cursor, node.number);
+    if (ec == std::errc::result_out_of_range) {
+        // ӂ strtod Ɠ }HUGE_VAL / 0 ɂ.
+        node.number = std::strtod(std::string(start, cursor).c_str(), nullptr);
+    }
+    else if (ec != std::errc() || ptr != cursor) {
+        Fail("Invalid number");
+    }
+    return node;
+}
+
+std::string_view JsonDocument::ScanString(bool& hasEscapes) {
+    ++cursor;   // '"'
+    const char* start = cursor;
+    hasEscapes = false;
+    // GXP[v̒g͂ł͊m߂, ƂɌ؂.
+    while (cursor < end) {
+        const char c = *cursor;
+        if (c == '"') break;
+        if (c == '\\') {
+            hasEscapes = true;
+            cursor += 2;
+            continue;
+        }
+        ++cursor;
+    }
+    if (cursor >= end) Fail("Unterminated string");
+    const std::string_view raw(start, static_cast<size_t>(cursor - start));
+    ++cursor;   // '"'
+    return raw;
+}
+
+std::string_view JsonDocument::ParseKey() {
+    SkipWhitespace();
+    if (cursor >= end || *cursor != '"') Fail("Expected '\"'");
+    bool hasEscapes = false;
+    const std::string_view raw = ScanString(hasEscapes);
+    if (!hasEscapes) return raw;
+
+    // Ŕׂ悤, L[͂̏ŕăA[iɒu.
+    keyScratch.clear();
+    Unescape(raw, keyScratch);
+    char* copy = arena.Allocate<char>(keyScratch.size());
+    std::copy(keyScratch.begin(), keyScratch.end(), copy);
+    return { copy, keyScratch.size() };
+}
+
+void JsonDocument::ExpectLiteral(const char* literal, size_t length) {
+    if (static_cast<size_t>(end - cursor) < length || std::char_traits<char>::compare(cursor, literal, length) != 0) {
+        Fail("Invalid literal");
+    }
+    cursor += length;
+}
+
+void JsonDocument::Unescape(std::string_view raw, std::string& out) {
+    out.reserve(out.size() + raw.size());
+    const char* p = raw.data();
+    const char* last = p + raw.size();
+    while (p < last) {
+        // GXP[v̖Ԃ͂܂Ƃ߂đ.
+        const char* run = p;
+        while (p < last && *p != '\\') ++p;
+        out.append(run, p);
+        if (p >= last) break;
+
+        if (++p >= last) throw std::runtime_error("Unterminated escape");
+        const char esc = *p++;
+        switch (esc) {
+        case '"' : out.push_back('"');  break;
+        case '\\': out.push_back('\\'); break;
+        case '/' : out.push_back('/');  break;
+        case 'b' : out.push_back('\b'); break;
+        case 'f' : out.push_back('\f'); break;
+        case 'n' : out.push_back('\n'); break;
+        case 'r' : out.push_back('\r'); break;
+        case 't' : out.push_back('\t'); break;
+        case 'u': {
+            uint32_t cp = ReadHex4(p, last);
+            p += 4;
+            // TQ[gyA.
+            if (cp >= 0xD800 && cp <= 0xDBFF && last - p >= 6 && p[0] == '\\' && p[1] == 'u') {
+                const uint32_t low = ReadHex4(p + 2, last);
+                if (low >= 0xDC00 && low <= 0xDFFF) {
+                    cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                    p += 6;
+                }
+            }
+            AppendUtf8(out, cp);
+            break;
+        }
+        default: throw std::runtime_error("Invalid escape char");
+        }
+    }
+}
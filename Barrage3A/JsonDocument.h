@@ -0,0 +1,184 @@
+/*
+    JsonDocument.h
+
+    :class
+        - JsonArena
+        - JsonNode
+        - JsonMember
+        - JsonDocument
+
+    쐬         : 2026/10/19
+    ŏIύX     : 2026/10/19
+*/
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <span>
+#include <cstddef>
+#include <cstdint>
+
+struct JsonValue;
+
+// ubNPʂł܂Ƃ߂Ċmۂ,  Reset / jɈꊇōs.
+// ɒu^̓fXgN^Ȃ.
+class JsonArena {
+private:
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        size_t size = 0;
+    };
+    std::vector<Block> blocks;
+    size_t current = 0;         // gp̃ubN.
+    size_t offset = 0;          // gp̃ubN̈ʒu.
+    size_t blockSize;
+
+    std::byte* AllocateSlow(size_t bytes, size_t align);
+public:
+    explicit JsonArena(size_t _blockSize = 16 * 1024) : blockSize(_blockSize) {}
+    JsonArena(const JsonArena&) = delete;
+    JsonArena& operator=(const JsonArena&) = delete;
+    JsonArena(JsonArena&&) noexcept = default;
+    JsonArena& operator=(JsonArena&&) noexcept = default;
+
+    std::byte* Allocate(size_t bytes, size_t align) {
+        if (!blocks.empty()) {
+            const size_t aligned = (offset + align - 1) & ~(align - 1);
+            if (aligned + bytes <= blocks[current].size) {
+                offset = aligned + bytes;
+                return blocks[current].data.get() + aligned;
+            }
+        }
+        return AllocateSlow(bytes, align);
+    }
+    template <typename T>
+    T* Allocate(size_t count) {
+        return reinterpret_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+    }
+    // mۍς݂̃ubN͎c܂ܐ擪g.
+    void Reset() { current = 0; offset = 0; }
+    size_t GetCapacity() const;
+};
+
+enum class JsonType : uint8_t {
+    Null,
+    Bool,
+    Number,
+    String,
+    Array,
+    Object,
+};
+
+struct JsonMember;
+
+/// <summary>
+/// JsonDocument  1 vf. g̓A[i̕w, ł͉LȂ.
+/// ̓GXP[v܂ޏꍇ GetString ŕ (ȊO͌̂̕܂ܕԂ).
+/// </summary>
+class JsonNode {
+    friend class JsonDocument;
+private:
+    JsonType type = JsonType::Null;
+    bool escaped = false;       // ɃGXP[v܂܂Ă邩.
+    uint32_t size = 0;          // ̃oCg / zEIuWFNg̗vf.
+    union {
+        bool boolean;
+        double number;
+        const char* string;
+        const JsonNode* items;
+        const JsonMember* members;
+    };
+public:
+    JsonNode() : number(0.0) {}
+
+    JsonType GetType() const noexcept { return type; }
+    bool IsNull() const noexcept { return type == JsonType::Null; }
+    bool IsBool() const noexcept { return type == JsonType::Bool; }
+    bool IsNumber() const noexcept { return type == JsonType::Number; }
+    bool IsString() const noexcept { return type == JsonType::String; }
+    bool IsArray() const noexcept { return type == JsonType::Array; }
+    bool IsObject() const noexcept { return type == JsonType::Object; }
+
+    bool GetBool() const;
+    double GetNumber() const;
+    float GetFloat() const { return static_cast<float>(GetNumber()); }
+    int GetInt() const { return static_cast<int>(GetNumber()); }
+
+    // p̓̂܂ܕԂ (GXP[v͖).
+    std::string_view GetRawString() const;
+    bool HasEscapes() const noexcept { return escaped; }
+    // GXP[v𕜍.
+    std::string GetString() const;
+    void AppendString(std::string& out) const;
+
+    // zEIuWFNg̗vf (ȊO 0).
+    size_t Size() const noexcept { return (IsArray() || IsObject()) ? size : 0; }
+    std::span<const JsonNode> Items() const;
+    // L[̏ (L[͏o).
+    std::span<const JsonMember> Members() const;
+    // L[̓񕪒T. Ȃ nullptr.
+    const JsonNode* Find(std::string_view key) const;
+    const JsonNode& operator[](size_t index) const { return Items()[index]; }
+
+    // ] JsonValue ɕϊ (JsonParser p).
+    JsonValue ToJsonValue() const;
+};
+
+// L[̓GXP[vς (GXP[vΌ̕w).
+struct JsonMember {
+    std::string_view key;
+    JsonNode value;
+};
+
+/// <summary>
+/// JSON  1 ̑ŃA[i̖؂ɓǂݍ.
+/// ͌̃obt@ŵ, Parse(std::string_view) ̏ꍇ͕蒷Ă
+/// (Parse(std::string&&) Ȃ當a). ͂Ɏs std::runtime_error 𓊂.
+///  Parse , O̖؂̂ĂăA[iƍƗ̈g.
+/// </summary>
+class JsonDocument {
+private:
+    JsonArena arena;
+    std::unique_ptr<std::string> owned;     // [uĂ̈ʒuςȂ悤q[vɒu.
+    JsonNode root;
+
+    // ͒̍Ɨ̈. zEIuWFNg̕A[iֈڂ.
+    std::vector<JsonNode> valueStack;
+    std::vector<JsonMember> memberStack;
+    std::string keyScratch;
+
+    const char* begin = nullptr;
+    const char* cursor = nullptr;
+    const char* end = nullptr;
+    uint32_t depth = 0;
+
+    static constexpr uint32_t MaxDepth = 512;
+
+    [[noreturn]] void Fail(const char* message) const;
+    void SkipWhitespace() noexcept;
+    JsonNode ParseValue();
+    JsonNode ParseObject();
+    JsonNode ParseArray();
+    JsonNode ParseNumber();
+    std::string_view ScanString(bool& hasEscapes);
+    std::string_view ParseKey();
+    void ExpectLiteral(const char* literal, size_t length);
+public:
+    JsonDocument() = default;
+    JsonDocument(const JsonDocument&) = delete;
+    JsonDocument& operator=(const JsonDocument&) = delete;
+    JsonDocument(JsonDocument&&) noexcept = default;
+    JsonDocument& operator=(JsonDocument&&) noexcept = default;
+
+    const JsonNode& Parse(std::string_view text);
+    const JsonNode& Parse(std::string&& text);
+    const JsonNode& ParseFile(const std::string& path);
+
+    const JsonNode& Root() const noexcept { return root; }
+    size_t GetArenaCapacity() const { return arena.GetCapacity(); }
+
+    // GXP[v܂ޕ (p̓) 𕜍 out ɑ.
+    static void Unescape(std::string_view raw, std::string& out);
+};
@@ -9,51 +9,38 @@
 #include "Reflection.h"
 class JsonUtility {
 public:
+    // tB[h錾ɏo (`Ȃ).
     template <typename T>
     static std::string ToJson(const T& obj) {
-        try {
-            std::ostringstream stream;
-            stream << "{";
-            bool first = true;
-            std::map<std::string, std::string> fields;
-            Reflector<T>::Reflect(obj, fields);
-
-            for (const auto& [name, value] : fields) {
-                if (!first) stream << ", ";
-                // ͊ȗFlXgΉReflectorŕ񉻍ς݂Ɖ
-                if (!value.empty() && (value[0] == '{' || value[0] == '[')) {
-                    stream << "\"" << name << "\": " << value;
-                }
-                else {
-                    stream << "\"" << name << "\": \"" << value << "\"";
-                }
-                first = false;
-            }
-
-            stream << "}";
-            return stream.str();
-        }
-        catch (const std::exception& e) {
-            std::cerr << "ToJson Error: " << e.what() << std::endl;
-            return "{}";
-        }
+        std::string out;
+        out.reserve(256);
+        WriteJson(out, obj);
+        return out;
+    }
+    // out ̖ɑ. obt@g񂷏ꍇ.
+    template <typename T>
+    static void ToJson(const T& obj, std::string& out) {
+        WriteJson(out, obj);
     }
 
     template <typename T>
     static T FromJson(const std::string& jsonString) {
         try {
-            JsonParser parser(jsonString);
-            JsonValue root = parser.Parse();
-            if (!root.IsObject()) throw std::runtime_error("Root JSON is not an object");
-
-            T obj;
-            Reflector<T>::From(obj, root.AsObject());
-
-            return obj;
+            JsonDocument document;
+            return FromJson<T>(document.Parse(std::string_view(jsonString)));
         }
         catch (const std::exception& e) {
             std::cerr << "FromJson Error: " << e.what() << std::endl;
             return T();
         }
     }
-};
\ No newline at end of file
+
+    // ͍ς݂̕ǂ. ^ȂΗO𓊂.
+    template <typename T>
+    static T FromJson(const JsonNode& root) {
+        if (!root.IsObject()) throw std::runtime_error("Root JSON is not an object");
+        T obj;
+        ReadJson(root, obj);
+        return obj;
+    }
+};
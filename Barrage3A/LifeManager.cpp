@@ -1,4 +1,5 @@
 #include "LifeManager.h"
+#include "SnapshotStream.h"
 
 void LifeManager::AddLives(int value) {
     life += value;
@@ -49,4 +50,16 @@ void LifeManager::Continue()
 
 bool LifeManager::IsContinueCheck() {
     return continueLife > 0;
-}
\ No newline at end of file
+}
+
+void LifeManager::SaveState(SnapshotWriter& out) const {
+    out.Write(life);
+    out.Write(lifeFragments);
+    out.Write(continueLife);
+}
+
+void LifeManager::LoadState(SnapshotReader& in) {
+    in.Read(life);
+    in.Read(lifeFragments);
+    in.Read(continueLife);
+}
@@ -1,5 +1,8 @@
 #pragma once
 
+class SnapshotWriter;
+class SnapshotReader;
+
 class LifeManager {
 private:
     const int maxLives = 7;
@@ -20,4 +23,8 @@ public:
     void Reset();
     void Continue();
     bool IsContinueCheck();
+
+    // Ԃ̕ۑE.
+    void SaveState(SnapshotWriter& out) const;
+    void LoadState(SnapshotReader& in);
 };
\ No newline at end of file
@@ -27,7 +27,7 @@ void Magatama::Start() {
 void Magatama::LateUpdate() {
 
     // 回転（視覚効果用）
-    transform->rotation = fmodf(Time.time * -180.0f, 360.f);
+    transform->SetRotation(fmodf(Time.time * -180.0f, 360.f));
 
     auto sp = player.lock();
     if (!sp) return;
@@ -50,5 +50,5 @@ void Magatama::LateUpdate() {
     Vector2D move = delta.GetNormalize() * speed * Time.deltaTime;
     if (move.Length() > dist) move = delta;
 
-    transform->position += move;
+    transform->Translate(move);
 }
@@ -49,7 +49,7 @@ void MagatamaController::SetMagatamaCount(int index) {
             magatamas[i]->focusedOffset = focusedOffsets[index - 1][i];
             magatamas[i]->currentOffset = magatamas[i]->normalOffset;
 
-            magatamas[i]->GetGameObject()->transform->position = transform->position;
+            magatamas[i]->GetGameObject()->transform->SetPosition(transform->position);
         }
     }
 }
@@ -20,10 +20,12 @@
 #include "ParticleSystem.h"
 #include "PathManager.h"
 #include "BulletType.h"
-#include "Script.h"
+#include "PatternLibrary.h"
 #include "EnemyFarm.h"
 #include "Dx3DCamera.h"
 #include "CreateAnimation.h"
+#include "ReplaySystem.h"
+#include "AudioMixer.h"
 using namespace GameEngine;
 using namespace GameEditor;
 using namespace System;
@@ -102,6 +104,7 @@ int WINAPI WinMain(HINSTANCE hinstance, HINSTANCE hPrevinstance, LPSTR lpCmdLine
             Texture2DManager::GetInstance().AddSpriteFont("scoreNumber", spriteFont);
         }
         
+        System::AudioInfoCache::GetInstance().Open(AudioInfoCacheFile.string());
         AudioResource::GetInstance().LoadFromCSV(LoadAudioSE_CSV.string());
         AudioResource::GetInstance().LoadSetFromCSV(LoadAudioBGM_CSV.string());
     }
@@ -189,38 +192,49 @@ int WINAPI WinMain(HINSTANCE hinstance, HINSTANCE hPrevinstance, LPSTR lpCmdLine
             seting.useRandomStartColor = true;
             seting.startColorMin = { 0,  0,  0,100 };
             seting.startColorMax = { 255,255,255,200 };
-            seting.customUpdate = PARTICLE_FUNC {
-                // -------------------------
-                // cɉisx u
-                // -------------------------
-                float total = (p.totalLife > 1e-6f) ? p.totalLife : 1e-6f;
-                float elapsed = p.totalLife - p.life;
-                float u = elapsed / total;
-                u = std::clamp(u, 0.0f, 1.0f);
+            seting.customBatchUpdate = PARTICLE_BATCH_FUNC {
+                using F = ParticleField;
+                const int n = ps.Count();
+                const float dt = ctx.deltaTime;
+                float* posX = ps[F::PosX];          float* posY = ps[F::PosY];
+                const float* vcX = ps[F::VcX];      const float* vcY = ps[F::VcY];
+                float* rotX = ps[F::RotX];          float* rotY = ps[F::RotY];          float* rotZ = ps[F::RotZ];
+                const float* rsX = ps[F::RotSpeedX]; const float* rsY = ps[F::RotSpeedY]; const float* rsZ = ps[F::RotSpeedZ];
+                const float* life = ps[F::Life];    const float* totalLife = ps[F::TotalLife];
+                const float* size = ps[F::Size];    float* sizeCurrent = ps[F::SizeCurrent];
 
-                // -------------------------
-                // ʒuXV
-                // -------------------------
-                float maxU = 0.9f;
-                float t = std::clamp(u / maxU, 0.0f, 1.0f); // 0~1 ɐK
-                float moveFactor = 1.0f - t;                 // 01 Ō
-                Vector2D move = p.vc * moveFactor * Time.deltaTime;
-                p.pos += move;
+                for (int i = 0; i < n; ++i) {
+                    // -------------------------
+                    // cɉisx u
+                    // -------------------------
+                    float total = (totalLife[i] > 1e-6f) ? totalLife[i] : 1e-6f;
+                    float elapsed = totalLife[i] - life[i];
+                    float u = std::clamp(elapsed / total, 0.0f, 1.0f);
 
-                p.rot.x += p.rotSpeed.x * Time.deltaTime;
-                p.rot.y += p.rotSpeed.y * Time.deltaTime;
-                p.rot.z += p.rotSpeed.z * Time.deltaTime;
+                    // -------------------------
+                    // ʒuXV
+                    // -------------------------
+                    float maxU = 0.9f;
+                    float t = std::clamp(u / maxU, 0.0f, 1.0f); // 0~1 ɐK
+                    float moveFactor = (1.0f - t) * dt;          // 01 Ō
+                    posX[i] += vcX[i] * moveFactor;
+                    posY[i] += vcY[i] * moveFactor;
 
-                // -------------------------
-                // TCYω: 60% -> 100% ɂ 0 
-                // -------------------------
-                float sizeStartU = 0.6f;
-                if (u <= sizeStartU) {
-                    p.sizeCurrent = 0.8f * p.size;
-                }
-                else {
-                    float t = (u - sizeStartU) / (1.0f - sizeStartU);
-                    p.sizeCurrent = 0.8f * p.size * (1.0f - t);
+                    rotX[i] += rsX[i] * dt;
+                    rotY[i] += rsY[i] * dt;
+                    rotZ[i] += rsZ[i] * dt;
+
+                    // -------------------------
+                    // TCYω: 60% -> 100% ɂ 0 
+                    // -------------------------
+                    float sizeStartU = 0.6f;
+                    if (u <= sizeStartU) {
+                        sizeCurrent[i] = 0.8f * size[i];
+                    }
+                    else {
+                        float st = (u - sizeStartU) / (1.0f - sizeStartU);
+                        sizeCurrent[i] = 0.8f * size[i] * (1.0f - st);
+                    }
                 }
             };
         }
@@ -245,36 +259,44 @@ int WINAPI WinMain(HINSTANCE hinstance, HINSTANCE hPrevinstance, LPSTR lpCmdLine
             seting.useRandomStartColor = true;
             seting.startColorMin = { 0  ,0  ,0  ,175 };
             seting.startColorMax = { 255,255,255,175 };
-            seting.customUpdate = PARTICLE_FUNC{
-                float total = (p.totalLife > 1e-6f) ? p.totalLife : 1e-6f;
-                float elapsed = p.totalLife - p.life;
-                float u = elapsed / total;
-                u = Mathf::Clamp(u, 0.0f, 1.0f);
+            seting.customBatchUpdate = PARTICLE_BATCH_FUNC {
+                using F = ParticleField;
+                const int n = ps.Count();
+                const float* life = ps[F::Life];        const float* totalLife = ps[F::TotalLife];
+                const float* size = ps[F::Size];        const float* targetSize = ps[F::TargetSize];
+                const float* startA = ps[F::StartA];
+                float* sizeCurrent = ps[F::SizeCurrent];
+                float* alpha = ps[F::ColorA];
 
                 // C[WO
                 auto EaseOutQuad = [](float t) -> float {
                     return 1.0f - (1.0f - t) * (1.0f - t);
                 };
-                float eased = EaseOutQuad(u);
+                const float fadeStart = 0.75f;
 
-                // ԂČ݃TCY
-                p.sizeCurrent = p.size + (p.targetSize - p.size) * eased;
+                for (int i = 0; i < n; ++i) {
+                    float total = (totalLife[i] > 1e-6f) ? totalLife[i] : 1e-6f;
+                    float elapsed = totalLife[i] - life[i];
+                    float u = Mathf::Clamp(elapsed / total, 0.0f, 1.0f);
 
-                float alphaMul = 1.0f;
-                const float fadeStart = 0.75f;
-                if (u > fadeStart) {
-                    float fadeT = (u - fadeStart) / (1.0f - fadeStart); // 0 -> 1
-                    fadeT = Mathf::Clamp(fadeT, 0.0f, 1.0f);
-                    alphaMul = 1.0f - fadeT;
+                    // ԂČ݃TCY
+                    sizeCurrent[i] = size[i] + (targetSize[i] - size[i]) * EaseOutQuad(u);
+
+                    float alphaMul = 1.0f;
+                    if (u > fadeStart) {
+                        float fadeT = (u - fadeStart) / (1.0f - fadeStart); // 0 -> 1
+                        fadeT = Mathf::Clamp(fadeT, 0.0f, 1.0f);
+                        alphaMul = 1.0f - fadeT;
+                    }
+                    alpha[i] = startA[i] * alphaMul;
                 }
-                p.color.a = p.startColor.a * alphaMul;
             };
         }
     }
     /*
     {
 		var effectObj = GameObject::Instantiate("Effect");
-        effectObj->transform->position = Vector2D(-200, 0);
+        effectObj->transform->SetPosition(Vector2D(-200, 0));
         var effect = effectObj->AddAppBase<ParticleSystem>();
         effect->GetSortingLayer().layer = 1;
         effect->SetSprite(Tex["Effects/Leaf:Leaf01"]);
@@ -343,16 +365,34 @@ int WINAPI WinMain(HINSTANCE hinstance, HINSTANCE hPrevinstance, LPSTR lpCmdLine
     }
 
     {
-        RegisterBulletScripts();
-        RegisterShotScripts();
-		RegisterEnemyScripts();
-        RegisterEliteEnemyScripts();
+        // eEVbgEG̓ (|ς݃LbV΂ǂ).
+        PatternLibrary::GetInstance().Load(LoadPatternScript.string());
+#if _DEBUG
+        PatternLibrary::GetInstance().SetHotReload(true);
+#endif
         CreatePlayerAnimator();
         CreateBulletAnimator();
     }
 
+    // N -bench [o.json] [x[XC.json] Ő\vďI.
+    // -record <o.rpl> [t[] [V[h] / -replay <.rpl> ŃXe[W̋L^EĐ.
+    // -trace [o.json] [t[] ͏ƕpł, Ñt[ Chrome g[Xɏo.
+    const std::string commandLine = lpCmdLine ? lpCmdLine : "";
+    Profiler::GetInstance().StartFromCommandLine(commandLine);
+    // -audiotest <o.wav> [r.wav] ͌܂菇̍Đ WAV ɏoĔׂ邾ŏI.
+    // -mixer ̓GW̃~LT[ DxLib ɏo͂ē.
+    bool audioTestFailed = false;
+    if (AudioMixer::GetInstance().RunRegressionFromCommandLine(commandLine, audioTestFailed)) {
+        DxLib::DxLib_End();
+        return audioTestFailed ? 1 : 0;
+    }
+    AudioMixer::GetInstance().StartFromCommandLine(commandLine);
+    if (!BenchmarkRunner::GetInstance().StartFromCommandLine(commandLine)) {
+        ReplaySystem::GetInstance().StartFromCommandLine(commandLine);
+    }
+
     Engine::Instance().Run();
 
 	DxLib::DxLib_End();	//DXCȕI.
-	return 0;		//I.
+	return ReplaySystem::GetInstance().HasVerifyFailed() ? 1 : 0;		//I (Đ؂vȂ 1).
 }
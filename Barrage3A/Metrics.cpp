@@ -0,0 +1,200 @@
+#include "Project.h"
+#include "Metrics.h"
+#include "File.hpp"
+#include "Debug.hpp"
+#include <atomic>
+#include <algorithm>
+#include <new>
+#include <cstdlib>
+#include <cstdio>
+
+// ---- mۂ̌v ------------------------------------------------------------
+// L^łȂ 1  relaxed ǂݍ݂ malloc / free ɓn.
+
+namespace {
+    std::atomic<bool> trackAllocations{ false };
+    std::atomic<uint64_t> totalCount{ 0 };
+    std::atomic<uint64_t> totalBytes{ 0 };
+    thread_local uint64_t threadCount = 0;
+    thread_local uint64_t threadBytes = 0;
+
+#if METRICS_ALLOCATION_HOOK
+    void CountAllocation(size_t size) {
+        if (!trackAllocations.load(std::memory_order_relaxed)) return;
+        totalCount.fetch_add(1, std::memory_order_relaxed);
+        totalBytes.fetch_add(size, std::memory_order_relaxed);
+        ++threadCount;
+        threadBytes += size;
+    }
+
+    void* Allocate(size_t size) {
+        CountAllocation(size);
+        if (size == 0) size = 1;
+        for (;;) {
+            if (void* p = std::malloc(size)) return p;
+            std::new_handler handler = std::get_new_handler();
+            if (!handler) throw std::bad_alloc();
+            handler();
+        }
+    }
+#endif
+}
+
+#if METRICS_ALLOCATION_HOOK
+void* operator new(std::size_t size) { return Allocate(size); }
+void* operator new[](std::size_t size) { return Allocate(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try { return Allocate(size); }
+    catch (...) { return nullptr; }
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    try { return Allocate(size); }
+    catch (...) { return nullptr; }
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+#endif
+
+void Metrics::SetAllocationTracking(bool enable) {
+    if (!IsAllocationHookAvailable()) return;
+    // Lɂt[̍݌vɂȂȂ悤蒼.
+    GetInstance().frameStart = GetAllocationTotal();
+    trackAllocations.store(enable, std::memory_order_relaxed);
+}
+
+bool Metrics::IsAllocationTracking() {
+    return trackAllocations.load(std::memory_order_relaxed);
+}
+
+AllocationCount Metrics::GetAllocationTotal() {
+    return { totalCount.load(std::memory_order_relaxed), totalBytes.load(std::memory_order_relaxed) };
+}
+
+AllocationCount Metrics::GetThreadAllocationTotal() {
+    return { threadCount, threadBytes };
+}
+
+// ---- t[ --------------------------------------------------------------
+
+void Metrics::EndFrame() {
+    if (IsAllocationTracking()) {
+        const AllocationCount now = GetAllocationTotal();
+        Set(Metric::Allocations, static_cast<int64_t>(now.count - frameStart.count));
+        Set(Metric::AllocatedBytes, static_cast<int64_t>(now.bytes - frameStart.bytes));
+        frameStart = now;
+    }
+
+    for (size_t i = 0; i < MetricCount; ++i) {
+        const int64_t v = values[i];
+        Series& s = series[i];
+        if (frames == 0) {
+            s.min = s.max = v;
+        }
+        else {
+            if (v < s.min) s.min = v;
+            if (v > s.max) s.max = v;
+        }
+        s.last = v;
+        s.sum += static_cast<double>(v);
+    }
+    ++frames;
+}
+
+void Metrics::ResetSeries() {
+    series.fill(Series{});
+    frames = 0;
+    frameStart = GetAllocationTotal();
+    std::lock_guard<std::mutex> lock(scopeMutex);
+    scopes.clear();
+}
+
+void Metrics::RecordScope(const char* name, const AllocationCount& delta) {
+    std::lock_guard<std::mutex> lock(scopeMutex);
+    auto it = std::find_if(scopes.begin(), scopes.end(), [name](const ScopeStats& s) { return s.name == name; });
+    if (it == scopes.end()) {
+        scopes.push_back({ name });
+        it = scopes.end() - 1;
+    }
+    ++it->calls;
+    it->allocations += delta.count;
+    it->bytes += delta.bytes;
+    if (delta.count > it->maxAllocations) it->maxAllocations = delta.count;
+}
+
+std::vector<Metrics::ScopeStats> Metrics::GetScopes() const {
+    std::lock_guard<std::mutex> lock(scopeMutex);
+    return scopes;
+}
+
+// ---- o --------------------------------------------------------------
+// {"frames":N,"allocationTracking":bool,
+//  "metrics":{"<O>":{"last","min","max","avg"}, ...},
+//  "scopes":{"<O>":{"calls","allocations","bytes","maxAllocations","avgAllocations"}, ...}}
+
+std::string Metrics::ToJson() const {
+    std::string out;
+    out.reserve(1024);
+    char line[256];
+
+    std::snprintf(line, sizeof(line), "{\n  \"frames\": %llu,\n  \"allocationTracking\": %s,\n  \"metrics\": {\n",
+        static_cast<unsigned long long>(frames), IsAllocationTracking() ? "true" : "false");
+    out += line;
+    for (size_t i = 0; i < MetricCount; ++i) {
+        const Series& s = series[i];
+        const double avg = frames > 0 ? s.sum / static_cast<double>(frames) : 0.0;
+        std::snprintf(line, sizeof(line), "    \"%s\": {\"last\": %lld, \"min\": %lld, \"max\": %lld, \"avg\": %.3f}%s\n",
+            MetricNames[i], static_cast<long long>(s.last), static_cast<long long>(s.min),
+            static_cast<long long>(s.max), avg, i + 1 < MetricCount ? "," : "");
+        out += line;
+    }
+    out += "  },\n  \"scopes\": {\n";
+
+    const std::vector<ScopeStats> scopeList = GetScopes();
+    for (size_t i = 0; i < scopeList.size(); ++i) {
+        const ScopeStats& s = scopeList[i];
+        const double avg = s.calls > 0 ? static_cast<double>(s.allocations) / static_cast<double>(s.calls) : 0.0;
+        std::snprintf(line, sizeof(line),
+            "    \"%s\": {\"calls\": %llu, \"allocations\": %llu, \"bytes\": %llu, \"maxAllocations\": %llu, \"avgAllocations\": %.3f}%s\n",
+            s.name, static_cast<unsigned long long>(s.calls), static_cast<unsigned long long>(s.allocations),
+            static_cast<unsigned long long>(s.bytes), static_cast<unsigned long long>(s.maxAllocations), avg,
+            i + 1 < scopeList.size() ? "," : "");
+        out += line;
+    }
+    out += "  }\n}\n";
+    return out;
+}
+
+bool Metrics::DumpJson(const std::string& path) const {
+    try {
+        System::IO::File::WriteAllText(path, ToJson());
+    }
+    catch (const std::exception& e) {
+        GameEngine::Debug::ErrorLog("Metrics dump failed: {}", e.what());
+        return false;
+    }
+    return true;
+}
+
+// ---- I[o[C ----------------------------------------------------------
+
+void Metrics::DrawOverlay(int x, int y) const {
+    if (!overlayVisible) return;
+
+    constexpr int LineHeight = 16;
+    constexpr int Width = 240;
+    const int height = static_cast<int>(MetricCount) * LineHeight + 8;
+    const unsigned int white = GetColor(255, 255, 255);
+
+    SetDrawBlendMode(DX_BLENDMODE_ALPHA, 160);
+    DrawBox(x, y, x + Width, y + height, GetColor(0, 0, 0), TRUE);
+    SetDrawBlendMode(DX_BLENDMODE_NOBLEND, 0);
+
+    for (size_t i = 0; i < MetricCount; ++i) {
+        DrawFormatString(x + 4, y + 4 + static_cast<int>(i) * LineHeight, white, "%-16s %10lld",
+            MetricNames[i], static_cast<long long>(series[i].last));
+    }
+}
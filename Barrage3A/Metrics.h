@@ -0,0 +1,159 @@
+/*
+    Metrics.h
+
+    :class
+        - Metrics
+        - AllocationScope
+
+    쐬         : 2026/10/19
+    ŏIύX     : 2026/10/19
+*/
+#pragma once
+
+#include <vector>
+#include <array>
+#include <string>
+#include <mutex>
+#include <cstdint>
+#include <iterator>
+
+// 1 ɂ Metrics.cpp  operator new / delete u, mۉ񐔂ƃoCg𐔂.
+// ̂ SetAllocationTracking(true) ̊Ԃ̂. SĂ̊mۂɎ肪̂Ŋł͖ɂ,
+// vp̃rhłvvZbT` (METRICS_ALLOCATION_HOOK=1) ŗLɂ.
+#ifndef METRICS_ALLOCATION_HOOK
+#define METRICS_ALLOCATION_HOOK 0
+#endif
+
+// L^l. O MetricNames Ɠɕׂ邱.
+enum class Metric : uint16_t {
+    GameObjects,
+    Colliders,
+    Renderers,
+    Coroutines,
+    Timers,
+    Bullets,
+    Particles,
+    Allocations,        // t[̊mۉ (tbNL).
+    AllocatedBytes,     // t[̊mۃoCg (tbNL).
+    Count
+};
+
+inline constexpr const char* MetricNames[] = {
+    "GameObjects",
+    "Colliders",
+    "Renderers",
+    "Coroutines",
+    "Timers",
+    "Bullets",
+    "Particles",
+    "Allocations",
+    "AllocatedBytes",
+};
+static_assert(std::size(MetricNames) == static_cast<size_t>(Metric::Count), "MetricNames ̐Ȃ.");
+
+// mۂ̗݌v (SXbh / ĂяoXbh).
+struct AllocationCount {
+    uint64_t count = 0;
+    uint64_t bytes = 0;
+};
+
+/// <summary>
+/// GW̌vl (IuWFNgȂ) , t[Ƃ̃mې̋L^.
+/// e}l[W[͎̍XV Set Ōݒl񍐂, Engine::Run ̖ EndFrame 
+/// t[̒lƂĊm肷. Wv (ŏEőE)  DumpJson  CI ɏo.
+/// </summary>
+class Metrics {
+public:
+    static constexpr size_t MetricCount = static_cast<size_t>(Metric::Count);
+
+    struct Series {
+        int64_t last = 0;
+        int64_t min = 0;
+        int64_t max = 0;
+        double sum = 0.0;
+    };
+    // AllocationScope Ƃ̗݌v.
+    struct ScopeStats {
+        const char* name = nullptr;
+        uint64_t calls = 0;
+        uint64_t allocations = 0;
+        uint64_t bytes = 0;
+        uint64_t maxAllocations = 0;    // 1 ̍ő.
+    };
+private:
+    std::array<int64_t, MetricCount> values{};
+    std::array<Series, MetricCount> series{};
+    uint64_t frames = 0;
+    AllocationCount frameStart;         // t[Jn_̊mۗ݌v.
+
+    // XR[v̓[J[L^ꂤ̂ŃbN (͏Ȃ).
+    mutable std::mutex scopeMutex;
+    std::vector<ScopeStats> scopes;
+
+    bool overlayVisible = false;
+
+    Metrics() = default;
+    ~Metrics() = default;
+    Metrics(const Metrics&) = delete;
+    Metrics& operator=(const Metrics&) = delete;
+public:
+    static Metrics& GetInstance() {
+        static Metrics instance;
+        return instance;
+    }
+
+    // ݒl̕ (t[ɕĂׂ΍Ō̒l).
+    void Set(Metric metric, int64_t value) { values[static_cast<size_t>(metric)] = value; }
+    int64_t Get(Metric metric) const { return values[static_cast<size_t>(metric)]; }
+    const Series& GetSeries(Metric metric) const { return series[static_cast<size_t>(metric)]; }
+    uint64_t GetFrameCount() const { return frames; }
+
+    // t[̒lm肵ďWvɉ. Engine::Run ̃t[ŌĂ.
+    void EndFrame();
+    // Wv (Series ƃXR[v) ̂Ă. vԂ̎n܂ɌĂ.
+    void ResetSeries();
+
+    // ---- mۂ̌v ----
+    static bool IsAllocationHookAvailable() { return METRICS_ALLOCATION_HOOK != 0; }
+    static void SetAllocationTracking(bool enable);
+    static bool IsAllocationTracking();
+    static AllocationCount GetAllocationTotal();
+    static AllocationCount GetThreadAllocationTotal();
+
+    void RecordScope(const char* name, const AllocationCount& delta);
+    std::vector<ScopeStats> GetScopes() const;
+
+    // Wv JSON ŏo (CI ̐ڋL^p).
+    std::string ToJson() const;
+    bool DumpJson(const std::string& path) const;
+
+    void SetOverlayVisible(bool visible) { overlayVisible = visible; }
+    bool IsOverlayVisible() const { return overlayVisible; }
+    // ݒl\. Engine::DrawScreen ̍ŌɌĂ.
+    void DrawOverlay(int x = 440, int y = 8) const;
+};
+
+// XR[vŌĂяoXbhsmۂ name ƂɏWv.
+// name ͕񃊃e (|C^ŋʂ).
+class AllocationScope {
+private:
+    const char* name;
+    AllocationCount start;
+    bool active;
+public:
+    explicit AllocationScope(const char* _name)
+        : name(_name), active(Metrics::IsAllocationTracking()) {
+        if (active) start = Metrics::GetThreadAllocationTotal();
+    }
+    ~AllocationScope() {
+        if (!active) return;
+        const AllocationCount now = Metrics::GetThreadAllocationTotal();
+        Metrics::GetInstance().RecordScope(name, { now.count - start.count, now.bytes - start.bytes });
+    }
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+};
+
+#define METRICS_CONCAT_INNER(a, b) a##b
+#define METRICS_CONCAT(a, b) METRICS_CONCAT_INNER(a, b)
+#define ALLOCATION_SCOPE(name) AllocationScope METRICS_CONCAT(allocationScope_, __LINE__)(name)
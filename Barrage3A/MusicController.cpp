@@ -5,6 +5,8 @@
 #include "GameObject.h"
 #include "GameObjectMgr.h"
 #include "AudioResourceShortcut.hpp"
+#include "SEVoicePool.h"
+#include "AudioMixer.h"
 using namespace GameEngine;
 using namespace System;
 
@@ -39,8 +41,8 @@ void MusicController::Start() {
         if (!audioSource) audioSource = gameObject->AddAppBase<AudioSource>();
         PlayNewClip(musicClip);
         audioSource->SetPlayOnStart(false);
-        audioSource->SetLoop(true);
-        audioSource->SetVolume(musicVolume);
+        SetLoopSong(true);
+        BgmSetVolume(musicVolume);
         gameObject->SetDontDestroyOnLoad(true);
     }
     else {
@@ -53,8 +55,8 @@ void MusicController::Start() {
                 inst->FadePlayUnfade(musicClip);
             else
             {
-                inst->audioSource->PlayFromStart();
-                inst->audioSource->SetVolume(0.0f);
+                inst->BgmPlayFromStart();
+                inst->BgmSetVolume(0.0f);
                 inst->UnFadeMusic();
             }
                 
@@ -76,10 +78,10 @@ void MusicController::PlayNewClip(std::shared_ptr<AudioClip> newAudioClip)
     if (!audioSource->GetClip() ||
         audioSource->GetClip()->GetTitle() != newAudioClip->GetTitle())
     {
-        audioSource->Stop();
+        BgmStop();
         musicClip = newAudioClip;
         audioSource->SetAudioClip(newAudioClip);
-        audioSource->Play();
+        BgmPlay();
     }
 }
 
@@ -87,20 +89,24 @@ void MusicController::PlayNewClip(std::shared_ptr<AudioClip> newAudioClip)
 void MusicController::SkipToPoint(float value)
 {
     if (audioSource)
-        audioSource->SetPlaybackTime(value);
+        BgmSeek(value);
 }
 
 void MusicController::SetLoopSong(bool isLoop)
 {
-    if (audioSource)
-        audioSource->SetLoop(isLoop);
+    if (!audioSource) return;
+    audioSource->SetLoop(isLoop);
+    if (AudioMixer::GetInstance().IsStarted()) {
+        const uint32_t voice = CurrentBgmVoice();
+        if (voice != AudioMixer::InvalidVoice) AudioMixer::GetInstance().SetVoiceLoop(voice, isLoop);
+    }
 }
 
 void MusicController::SetMusicVolume(float vol) {
     musicVolume = std::clamp(vol, 0.0f, 1.0f);
     maxVolume = musicVolume; // フェード用の最大音量も更新
     if (audioSource) {
-        audioSource->SetVolume(musicVolume);
+        BgmSetVolume(musicVolume);
     }
 }
 
@@ -116,7 +122,7 @@ void MusicController::SetSEVolume(float vol) {
 System::Coroutine MusicController::IE_PauseFadeOut(float duration) {
     if (!audioSource) co_return;
 
-    float startVolume = audioSource->GetVolume();
+    float startVolume = BgmGetVolume();
     float t = 0.0f;
 
     // duration 秒で線形フェードアウト
@@ -124,12 +130,12 @@ System::Coroutine MusicController::IE_PauseFadeOut(float duration) {
         t += Time.unscaledDeltaTime;
         float r = Mathf::Clamp01(t / duration);
         float newVolume = Mathf::Lerp(startVolume, 0.0f, r);
-        audioSource->SetVolume(newVolume);
+        BgmSetVolume(newVolume);
         _yield nullptr;
     }
 
-    audioSource->SetVolume(0.0f);
-    audioSource->Pause();    // StopではなくPause
+    BgmSetVolume(0.0f);
+    BgmPause();    // StopではなくPause
     co_return;
 }
 
@@ -137,9 +143,9 @@ System::Coroutine MusicController::IE_PauseFadeOut(float duration) {
 System::Coroutine MusicController::IE_ResumeFadeIn(float duration) {
     if (!audioSource || !musicClip) co_return;
 
-    audioSource->Play(); // Pause → 再生
+    BgmPlay(); // Pause → 再生
 
-    float startVolume = audioSource->GetVolume();   // 多くの場合 0
+    float startVolume = BgmGetVolume();   // 多くの場合 0
     float t = 0.0f;
 
     // duration 秒で線形フェードイン
@@ -147,11 +153,11 @@ System::Coroutine MusicController::IE_ResumeFadeIn(float duration) {
         t += Time.unscaledDeltaTime;
         float r = Mathf::Clamp01(t / duration);
         float newVolume = Mathf::Lerp(startVolume, maxVolume, r);
-        audioSource->SetVolume(newVolume);
+        BgmSetVolume(newVolume);
         _yield nullptr;
     }
 
-    audioSource->SetVolume(maxVolume);
+    BgmSetVolume(maxVolume);
     co_return;
 }
 
@@ -223,36 +229,14 @@ void MusicController::ContinueFromGameOverAndResume() {
 // ---------------------------
 // OneShotAudio / helpers
 // ---------------------------
-std::shared_ptr<AudioSource> MusicController::OneShotAudio(std::shared_ptr<AudioClip> newAudioClip, float v)
+bool MusicController::OneShotAudio(std::shared_ptr<AudioClip> newAudioClip, float v, float pan)
 {
-    if (!newAudioClip) return nullptr;
-    auto tmpObj = GameObject::Instantiate("ShotAudio_" + newAudioClip->GetTitle());
-    tmpObj->transform->position = gameObject->transform->position;
-
-    auto tmpAudio = tmpObj->AddAppBase<AudioSource>();
-    tmpAudio->SetAudioClip(newAudioClip);
-    tmpAudio->SetVolume(v);
-    tmpAudio->Play();
-    // Destroy 設定で クリップの最大時間をセット.
-    Destroy(tmpObj, (float)newAudioClip->GetDuration());
-
-    return tmpAudio;
+    // GameObject もハンドルも作らず, プールのボイスで鳴らす.
+    return SEVoicePool::GetInstance().Play(newAudioClip, v, pan);
 }
-std::shared_ptr<AudioSource> MusicController::OneShotAudio(std::string key, float v)
+bool MusicController::OneShotAudio(std::string key, float v, float pan)
 {
-    auto newAudioClip = Sounds[key];
-    if (!newAudioClip) return nullptr;
-    auto tmpObj = GameObject::Instantiate("ShotAudio_" + newAudioClip->GetTitle());
-    tmpObj->transform->position = gameObject->transform->position;
-
-    auto tmpAudio = tmpObj->AddAppBase<AudioSource>();
-    tmpAudio->SetAudioClip(newAudioClip);
-    tmpAudio->SetVolume(v);
-    tmpAudio->Play();
-    // Destroy 設定で クリップの最大時間をセット.
-    Destroy(tmpObj, (float)newAudioClip->GetDuration());
-
-    return tmpAudio;
+    return OneShotAudio(Sounds[key], v, pan);
 }
 void MusicController::FadeMusic()
 {
@@ -281,19 +265,19 @@ void MusicController::FadePlayUnfade(std::shared_ptr<AudioClip> newAudioClip)
 System::Coroutine MusicController::IE_FadeMusic(float duration) {
     if (!audioSource) co_return;
 
-    float startVolume = audioSource->GetVolume();
+    float startVolume = BgmGetVolume();
     float t = 0.0f;
 
     while (t < duration) {
         t += Time.unscaledDeltaTime;
         float r = Mathf::Clamp01(t / duration);
         float newVolume = Mathf::Lerp(startVolume, 0.0f, r);
-        audioSource->SetVolume(newVolume);
+        BgmSetVolume(newVolume);
         _yield nullptr;
     }
 
-    audioSource->SetVolume(0.0f);
-    audioSource->Stop();
+    BgmSetVolume(0.0f);
+    BgmStop();
     co_return;
 }
 
@@ -301,18 +285,18 @@ System::Coroutine MusicController::IE_FadeMusic(float duration) {
 System::Coroutine MusicController::IE_UnFadeMusic(float duration) {
     if (!audioSource) co_return;
 
-    float startVolume = audioSource->GetVolume();  // おそらく 0
+    float startVolume = BgmGetVolume();  // おそらく 0
     float t = 0.0f;
 
     while (t < duration) {
         t += Time.unscaledDeltaTime;
         float r = Mathf::Clamp01(t / duration);
         float newVolume = Mathf::Lerp(startVolume, maxVolume, r);
-        audioSource->SetVolume(newVolume);
+        BgmSetVolume(newVolume);
         _yield nullptr;
     }
 
-    audioSource->SetVolume(maxVolume);
+    BgmSetVolume(maxVolume);
     co_return;
 }
 
@@ -320,7 +304,7 @@ System::Coroutine MusicController::IE_UnFadeMusic(float duration) {
 System::Coroutine MusicController::IE_FadePlayUnfade(float duration,bool reStart) {
     if (!audioSource) co_return;
 
-    float startVolume = audioSource->GetVolume();
+    float startVolume = BgmGetVolume();
     float t = 0.0f;
 
     // ---------- フェードアウト ----------
@@ -328,15 +312,15 @@ System::Coroutine MusicController::IE_FadePlayUnfade(float duration,bool reStart
         t += Time.unscaledDeltaTime;
         float r = Mathf::Clamp01(t / duration);
         float newVolume = Mathf::Lerp(startVolume, 0.0f, r);
-        audioSource->SetVolume(newVolume);
+        BgmSetVolume(newVolume);
         _yield nullptr;
     }
 
     // 停止してクリップ切替
-    audioSource->SetVolume(0.0f);
-    audioSource->Stop();
+    BgmSetVolume(0.0f);
+    BgmStop();
     audioSource->SetAudioClip(musicClip);
-    audioSource->Play(reStart);
+    BgmPlay(reStart);
 
     // ---------- フェードイン ----------
     t = 0.0f;
@@ -344,16 +328,105 @@ System::Coroutine MusicController::IE_FadePlayUnfade(float duration,bool reStart
         t += Time.unscaledDeltaTime;
         float r = Mathf::Clamp01(t / duration);
         float newVolume = Mathf::Lerp(0.0f, maxVolume, r);
-        audioSource->SetVolume(newVolume);
+        BgmSetVolume(newVolume);
         _yield nullptr;
     }
 
-    audioSource->SetVolume(maxVolume);
+    BgmSetVolume(maxVolume);
     co_return;
 }
 
 
 
+// ---------------------------
+// BGM の出力
+// - AudioMixer が動いていれば BGM カテゴリのボイスで鳴らす (audioSource はクリップの管理だけに使う)。
+// - Stop は DxLib と同じく位置を保つので, ミキサーでもボイスを一時停止して残す。
+// ---------------------------
+uint32_t MusicController::CurrentBgmVoice() const {
+    if (!audioSource || !audioSource->GetClip()) return AudioMixer::InvalidVoice;
+    auto it = bgmVoices.find(audioSource->GetClip().get());
+    return it != bgmVoices.end() ? it->second : AudioMixer::InvalidVoice;
+}
+
+void MusicController::BgmPlay(bool resume) {
+    AudioMixer& mixer = AudioMixer::GetInstance();
+    if (!mixer.IsStarted()) {
+        audioSource->Play(resume);
+        return;
+    }
+    auto clip = audioSource->GetClip();
+    if (!clip) return;
+
+    auto it = bgmVoices.find(clip.get());
+    if (it != bgmVoices.end()) {
+        if (resume || bgmPaused) {
+            mixer.SetVoicePaused(it->second, false);
+            bgmPaused = false;
+            return;
+        }
+        mixer.StopVoice(it->second);
+        bgmVoices.erase(it);
+    }
+    bgmPaused = false;
+    const uint32_t voice = mixer.Play(mixer.LoadPcm(*clip), AudioCategory::BGM, bgmVolume, 0.0f, 1.0f, audioSource->IsLoop());
+    if (voice != AudioMixer::InvalidVoice) bgmVoices[clip.get()] = voice;
+}
+
+void MusicController::BgmPlayFromStart() {
+    if (!AudioMixer::GetInstance().IsStarted()) {
+        audioSource->PlayFromStart();
+        return;
+    }
+    bgmPaused = false;
+    BgmPlay();
+}
+
+void MusicController::BgmStop() {
+    AudioMixer& mixer = AudioMixer::GetInstance();
+    if (!mixer.IsStarted()) {
+        audioSource->Stop();
+        return;
+    }
+    const uint32_t voice = CurrentBgmVoice();
+    if (voice != AudioMixer::InvalidVoice) mixer.SetVoicePaused(voice, true);
+}
+
+void MusicController::BgmPause() {
+    if (!AudioMixer::GetInstance().IsStarted()) {
+        audioSource->Pause();
+        return;
+    }
+    BgmStop();
+    bgmPaused = true;
+}
+
+void MusicController::BgmSetVolume(float vol) {
+    AudioMixer& mixer = AudioMixer::GetInstance();
+    if (!mixer.IsStarted()) {
+        audioSource->SetVolume(vol);
+        return;
+    }
+    if (audioSource->GetClip()) vol = Mathf::Min(vol, audioSource->GetClip()->GetMaxVolume());
+    bgmVolume = vol;
+    const uint32_t voice = CurrentBgmVoice();
+    if (voice != AudioMixer::InvalidVoice) mixer.SetVoiceVolume(voice, vol);
+}
+
+float MusicController::BgmGetVolume() const {
+    return AudioMixer::GetInstance().IsStarted() ? bgmVolume : audioSource->GetVolume();
+}
+
+void MusicController::BgmSeek(float time) {
+    AudioMixer& mixer = AudioMixer::GetInstance();
+    if (!mixer.IsStarted()) {
+        audioSource->SetPlaybackTime(time);
+        return;
+    }
+    const uint32_t voice = CurrentBgmVoice();
+    if (voice != AudioMixer::InvalidVoice) mixer.SeekVoice(voice, time);
+}
+
 std::shared_ptr<AudioSource> MusicController::GetAudioSource() {
     if (!audioSource) {
         audioSource = gameObject->GetAppBase<AudioSource>();
@@ -12,6 +12,8 @@
 #include "AppBase.h"
 #include "AudioSource.h"
 #include "AudioClip.h"
+#include <unordered_map>
+#include <cstdint>
 
 // MusicController class and AppBase class
 class MusicController : public AppBase, public std::enable_shared_from_this<MusicController> {
@@ -34,6 +36,11 @@ private:    // 非公開.
     bool isPaused = false;                                  // ポーズ中フラグ
     bool inGameOver = false;                                // ゲームオーバー中フラグ
 
+    // AudioMixer で鳴らしているときの BGM. 止めたボイスも位置を保ったまま残し, 続きから鳴らせるようにする.
+    std::unordered_map<const GameEngine::AudioClip*, uint32_t> bgmVoices;
+    float bgmVolume = 1.0f;
+    bool bgmPaused = false;
+
 public:     // 公開.
 
     // コンストラクタ.
@@ -59,6 +66,7 @@ public:     // 公開.
 
     void SetMusicVolume(float vol);
     void SetSEVolume(float vol);
+    float GetSEVolume() const { return seVolume; }
 
     // ポーズ処理
     void PauseBGM();    // フェードアウトして停止（位置保存）
@@ -68,8 +76,9 @@ public:     // 公開.
     void TriggerGameOver();                      // 現在を停止して gameOverClip をフェードインで再生
     void ContinueFromGameOverAndResume();        // ゲームオーバー解除 → 元曲を pausedTime からフェードインで再開
 
-    std::shared_ptr<AudioSource> OneShotAudio(std::shared_ptr<GameEngine::AudioClip> clip, float = MusicController::GetInstance()->seVolume);
-    std::shared_ptr<AudioSource> OneShotAudio(std::string key, float = MusicController::GetInstance()->seVolume);
+    // 単発 SE. SEVoicePool で鳴らす (clip は Clone しないで渡す). 鳴らさなかった場合は false.
+    bool OneShotAudio(std::shared_ptr<GameEngine::AudioClip> clip, float = MusicController::GetInstance()->seVolume, float pan = 0.0f);
+    bool OneShotAudio(std::string key, float = MusicController::GetInstance()->seVolume, float pan = 0.0f);
 
     // AppBase 関数.
     void Awake()    override;
@@ -77,6 +86,16 @@ public:     // 公開.
 
     std::shared_ptr<AudioSource> GetAudioSource();
 private:
+    // BGM の出力. AudioMixer が動いていればミキサーのボイスで, そうでなければ audioSource で鳴らす.
+    void BgmPlay(bool resume = false);
+    void BgmPlayFromStart();
+    void BgmStop();
+    void BgmPause();
+    void BgmSetVolume(float vol);
+    float BgmGetVolume() const;
+    void BgmSeek(float time);
+    uint32_t CurrentBgmVoice() const;
+
     System::Coroutine IE_FadeMusic(float duration = 0.5f);            // フェードアウト（停止を含める）
     System::Coroutine IE_UnFadeMusic(float duration = 0.5f);          // フェードイン（現在再生中のclipを maxVolume まで）
     System::Coroutine IE_FadePlayUnfade(float duration = 0.5f, bool reStart = false);       // 既存: フェードアウト→切替→フェードイン
@@ -41,7 +41,7 @@ void MyBullet::Update() {
     if (GameManager::GetInstance().IsPause()) return;
 
     // 角度を加算
-    transform->rotation += rotationRate;
+    transform->Rotate(rotationRate);
 
     // 速度を加速
     speed += acceleration;
@@ -51,7 +51,7 @@ void MyBullet::Update() {
 
     // 向きに基づいて移動
     Vector2D direction = Vector2D::FromAngle(transform->rotation);
-    transform->position += direction * speed;
+    transform->Translate(direction * speed);
 
     // 画面外チェック
     Vector2D pos = transform->position;
@@ -67,7 +67,7 @@ void MyBullet::OnDestroy() {
 
     if (gameObject->GetLayer() == Layer::EnemyBullet) {
        auto obj = PrefabManager::GetInstance().Instantiate("EnemyBulletEffect")[0];
-       obj->transform->position = transform->position;
+       obj->transform->SetPosition(transform->position);
     }
 
     if (gameObject->GetLayer() != Layer::PlayerBullet) {
@@ -84,11 +84,11 @@ void MyBullet::OnCollisionEnter(GameObject* other) {
             auto music = MusicController::GetInstance();
             if (music)
             {
-                music->OneShotAudio(Sounds["graze"]->Clone());
+                music->OneShotAudio(Sounds["graze"]);
             }
             // 弾とGrazeの中間点にエフェクトを配置する（演出的に自然）
             auto obj = PrefabManager::GetInstance().Instantiate("GrazeEffect")[0];
-            obj->transform->position = transform->position;
+            obj->transform->SetPosition(transform->position);
             GameManager::GetInstance().GetGrazeManager().Add(1);
             
         }
@@ -101,7 +101,7 @@ void MyBullet::OnCollisionEnter(GameObject* other) {
         auto music      = MusicController::GetInstance();
         if (music)
         {
-            music->OneShotAudio(Sounds["enemy_damage"]->Clone());
+            music->OneShotAudio(Sounds["enemy_damage"]);
         }
     }
     // Graze以外の対象には通常通り消える
@@ -0,0 +1,161 @@
+﻿/*
+    ◆ ParticleBuffer.h
+
+    クラス名        : ParticleBuffer クラス
+    概要            : パーティクルの SoA (構造体配列) ストア.
+                      生存中のパーティクルは常に [0, Count()) に詰めて保持する.
+*/
+#pragma once
+#include "IDraw.h"
+#include "Vector.h"
+#include <array>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+// パーティクルデータ(1 個分のビュー). カスタム描画・旧形式のカスタム更新用.
+struct Particle {
+    Vector2D pos;           // 2Dスクリーン座標
+    Vector2D vc;            // 2D速度ベクトル
+    float size;             // 基本スケール
+    float sizeCurrent;      // 現在のスケール（Updateで変化）
+	float targetSize;	    // 目標スケール
+    Color color;            // RGBAカラー (0～255)
+    Color startColor;       // 初回のカラー;
+    Vector3D rot;           // 回転角度 (度): x,y は疑似3Dチルト, z はスピン.
+    Vector3D rotSpeed;      // 各軸の回転速度 (度/秒)
+    float life;             // 残り寿命 (秒)
+    float totalLife;        // 初期寿命 (秒)
+    bool active;            // アクティブ状態フラグ
+    float angleDirection;
+};
+
+// SoA の列.
+enum class ParticleField : int {
+    PosX, PosY,
+    VcX, VcY,
+    Size, SizeCurrent, TargetSize,
+    ColorR, ColorG, ColorB, ColorA,
+    StartR, StartG, StartB, StartA,
+    RotX, RotY, RotZ,
+    RotSpeedX, RotSpeedY, RotSpeedZ,
+    Life, TotalLife,
+    AngleDirection,
+    Count
+};
+
+class ParticleBuffer {
+public:
+    static constexpr int FieldCount = static_cast<int>(ParticleField::Count);
+    static constexpr int MaxCapacity = 100000;  // 1 システムあたりの上限.
+private:
+    std::array<std::vector<float>, FieldCount> fields;
+    int count    = 0;   // 生存数.
+    int capacity = 0;   // 確保済み数.
+    int limit    = 0;   // 最大数 (maxParticles).
+
+    // 必要数まで倍々に確保 (limit まで).
+    bool Grow(int need) {
+        if (need <= capacity) return true;
+        if (need > limit) return false;
+        int next = std::min(limit, std::max(need, std::max(64, capacity * 2)));
+        for (auto& f : fields) f.resize(next);
+        capacity = next;
+        return true;
+    }
+public:
+    // 最大数を設定. 既存のパーティクルは破棄.
+    void SetLimit(int maxParticles) {
+        limit = std::clamp(maxParticles, 0, MaxCapacity);
+        count = 0;
+        if (capacity > limit) {
+            for (auto& f : fields) { f.resize(limit); f.shrink_to_fit(); }
+            capacity = limit;
+        }
+    }
+
+    int  Count()    const { return count; }
+    int  Limit()    const { return limit; }
+    bool Empty()    const { return count == 0; }
+    void Clear()          { count = 0; }
+
+    float*       operator[](ParticleField f)       { return fields[static_cast<int>(f)].data(); }
+    const float* operator[](ParticleField f) const { return fields[static_cast<int>(f)].data(); }
+
+    // 末尾に 1 つ確保してインデックスを返す (満杯なら -1).
+    int Emit() {
+        if (!Grow(count + 1)) return -1;
+        return count++;
+    }
+
+    // i 番目を削除 (末尾と入れ替え). 呼び出し側は i を再評価すること.
+    void Kill(int i) {
+        const int last = --count;
+        if (i != last) {
+            for (auto& f : fields) f[i] = f[last];
+        }
+    }
+
+    // 寿命切れ (Life <= 0) を取り除いて詰める.
+    void RemoveDead() {
+        const float* life = (*this)[ParticleField::Life];
+        for (int i = 0; i < count; ) {
+            if (life[i] <= 0.0f) Kill(i);
+            else ++i;
+        }
+    }
+
+    // 1 個分を取り出す / 書き戻す.
+    Particle Get(int i) const {
+        auto v = [&](ParticleField f) { return fields[static_cast<int>(f)][i]; };
+        Particle p;
+        p.pos            = { v(ParticleField::PosX), v(ParticleField::PosY) };
+        p.vc             = { v(ParticleField::VcX),  v(ParticleField::VcY) };
+        p.size           = v(ParticleField::Size);
+        p.sizeCurrent    = v(ParticleField::SizeCurrent);
+        p.targetSize     = v(ParticleField::TargetSize);
+        p.color.r        = v(ParticleField::ColorR);
+        p.color.g        = v(ParticleField::ColorG);
+        p.color.b        = v(ParticleField::ColorB);
+        p.color.a        = v(ParticleField::ColorA);
+        p.startColor.r   = v(ParticleField::StartR);
+        p.startColor.g   = v(ParticleField::StartG);
+        p.startColor.b   = v(ParticleField::StartB);
+        p.startColor.a   = v(ParticleField::StartA);
+        p.rot            = { v(ParticleField::RotX), v(ParticleField::RotY), v(ParticleField::RotZ) };
+        p.rotSpeed       = { v(ParticleField::RotSpeedX), v(ParticleField::RotSpeedY), v(ParticleField::RotSpeedZ) };
+        p.life           = v(ParticleField::Life);
+        p.totalLife      = v(ParticleField::TotalLife);
+        p.active         = i < count;
+        p.angleDirection = v(ParticleField::AngleDirection);
+        return p;
+    }
+
+    void Set(int i, const Particle& p) {
+        auto v = [&](ParticleField f) -> float& { return fields[static_cast<int>(f)][i]; };
+        v(ParticleField::PosX)           = p.pos.x;
+        v(ParticleField::PosY)           = p.pos.y;
+        v(ParticleField::VcX)            = p.vc.x;
+        v(ParticleField::VcY)            = p.vc.y;
+        v(ParticleField::Size)           = p.size;
+        v(ParticleField::SizeCurrent)    = p.sizeCurrent;
+        v(ParticleField::TargetSize)     = p.targetSize;
+        v(ParticleField::ColorR)         = p.color.r;
+        v(ParticleField::ColorG)         = p.color.g;
+        v(ParticleField::ColorB)         = p.color.b;
+        v(ParticleField::ColorA)         = p.color.a;
+        v(ParticleField::StartR)         = p.startColor.r;
+        v(ParticleField::StartG)         = p.startColor.g;
+        v(ParticleField::StartB)         = p.startColor.b;
+        v(ParticleField::StartA)         = p.startColor.a;
+        v(ParticleField::RotX)           = p.rot.x;
+        v(ParticleField::RotY)           = p.rot.y;
+        v(ParticleField::RotZ)           = p.rot.z;
+        v(ParticleField::RotSpeedX)      = p.rotSpeed.x;
+        v(ParticleField::RotSpeedY)      = p.rotSpeed.y;
+        v(ParticleField::RotSpeedZ)      = p.rotSpeed.z;
+        v(ParticleField::Life)           = p.life;
+        v(ParticleField::TotalLife)      = p.totalLife;
+        v(ParticleField::AngleDirection) = p.angleDirection;
+    }
+};
@@ -0,0 +1,82 @@
+﻿/*
+    ParticleManager.h
+
+    :class
+        - ParticleManager
+
+    作成日         : 2026/10/19
+    最終変更日     : 2026/10/19
+*/
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include "ParticleSystem.h"
+#include "JobSystem.hpp"
+#include "Profiler.h"
+#include "Metrics.h"
+
+/// <summary>
+/// そのフレームに更新するパーティクルシステムを集め, ワーカーでまとめてシミュレーションする.
+/// ParticleSystem::Update (メインスレッド) は生成のみ行い, 移動・寿命の更新はここで並列に行う.
+/// </summary>
+class ParticleManager {
+private:
+    std::vector<std::shared_ptr<ParticleSystem>> pending;   // 今フレームの更新対象.
+    bool parallel = true;
+
+    ParticleManager() = default;
+    ~ParticleManager() = default;
+public:
+    static ParticleManager& GetInstance() {
+        static ParticleManager instance;
+        return instance;
+    }
+
+    // 並列実行の有無 (false ならメインスレッドで順に実行)
+    void SetParallel(bool enable) { parallel = enable; }
+    bool IsParallel() const { return parallel; }
+
+    // ParticleSystem::Update から登録.
+    void Enqueue(const std::shared_ptr<ParticleSystem>& system) {
+        pending.push_back(system);
+    }
+
+    // 登録されたシステムをシミュレーションし, 完了後に描画用データを確定する.
+    void Simulate() {
+        if (pending.empty()) {
+            Metrics::GetInstance().Set(Metric::Particles, 0);
+            return;
+        }
+
+        if (parallel) {
+            System::JobSystem::GetInstance().ParallelFor(pending.size(), [this](size_t i) {
+                if (!pending[i]->IsParallelSafe()) return;
+                PROFILE_SCOPE(ProfileZone::Particles);
+                pending[i]->RunSimulation();
+            });
+            // 並列不可 (旧形式のカスタム更新など) はメインスレッドで実行
+            for (auto& ps : pending) {
+                if (ps->IsParallelSafe()) continue;
+                PROFILE_SCOPE(ProfileZone::Particles);
+                ps->RunSimulation();
+            }
+        }
+        else {
+            for (auto& ps : pending) {
+                PROFILE_SCOPE(ProfileZone::Particles);
+                ps->RunSimulation();
+            }
+        }
+
+        // ジョブ完了後にメインスレッドで確定 (描画数の更新, 終了時の破棄)
+        int64_t particles = 0;
+        for (auto& ps : pending) {
+            ps->Publish();
+            particles += ps->GetParticleCount();
+        }
+        Metrics::GetInstance().Set(Metric::Particles, particles);
+        pending.clear();
+    }
+};
@@ -11,6 +11,67 @@
 #include "RendererManager.h"
 #include "GameObject.h"
 #include "GameObjectMgr.h"
+#include "ParticleManager.h"
+#include "Simd.h"
+
+// --- SoA 用の更新カーネル ---
+namespace {
+    // Random::Range と同じ規則の乱数 (システムごとの乱数列を使う)
+    float RandomRange(std::mt19937& rng, float min, float max) {
+        if (min > max) std::swap(min, max);
+        if (min == max) return max;
+        return std::uniform_real_distribution<float>(min, max)(rng);
+    }
+    int RandomRange(std::mt19937& rng, int min, int max) {
+        if (min > max) std::swap(min, max);
+        if (min == max) return max;
+        return std::uniform_int_distribution<int>(min, max)(rng);
+    }
+
+    // dst[i] += src[i] * dt
+    void AddScaled(float* dst, const float* src, float dt, int n) {
+        int i = 0;
+#ifdef USE_SIMD
+        const __m128 vdt = _mm_set1_ps(dt);
+        for (; i + 4 <= n; i += 4) {
+            __m128 d = _mm_loadu_ps(dst + i);
+            __m128 v = _mm_loadu_ps(src + i);
+            _mm_storeu_ps(dst + i, _mm_add_ps(d, _mm_mul_ps(v, vdt)));
+        }
+#endif
+        for (; i < n; ++i) dst[i] += src[i] * dt;
+    }
+
+    // dst[i] -= v
+    void SubScalar(float* dst, float v, int n) {
+        int i = 0;
+#ifdef USE_SIMD
+        const __m128 vv = _mm_set1_ps(v);
+        for (; i + 4 <= n; i += 4) {
+            _mm_storeu_ps(dst + i, _mm_sub_ps(_mm_loadu_ps(dst + i), vv));
+        }
+#endif
+        for (; i < n; ++i) dst[i] -= v;
+    }
+
+    // 寿命比率 t = life / totalLife (1→0) でサイズとアルファを線形に減らす.
+    void FadeByLife(const float* life, const float* totalLife, const float* size, const float* startA,
+                    float* sizeCurrent, float* alpha, int n) {
+        int i = 0;
+#ifdef USE_SIMD
+        for (; i + 4 <= n; i += 4) {
+            __m128 t = _mm_div_ps(_mm_loadu_ps(life + i), _mm_loadu_ps(totalLife + i));
+            _mm_storeu_ps(sizeCurrent + i, _mm_mul_ps(_mm_loadu_ps(size + i), t));
+            _mm_storeu_ps(alpha + i, _mm_mul_ps(_mm_loadu_ps(startA + i), t));
+        }
+#endif
+        for (; i < n; ++i) {
+            float t = life[i] / totalLife[i];
+            sizeCurrent[i] = size[i] * t;
+            alpha[i] = startA[i] * t;
+        }
+    }
+}
 
 // コンストラクタ 
 ParticleSystem::ParticleSystem() : AppBase("ParticleSystem"){
@@ -26,21 +87,18 @@ void ParticleSystem::Awake() {
 }
 
 void ParticleSystem::Restart() {
-    for (auto& p : particles) {
-        p.active = false; // 初期状態は非アクティブ
-    }
+    particles.Clear(); // 全て非アクティブに
+    publishedCount = 0;
     elapsedTime = 0.0f;
     emitCounter = 0.0f;
     burstDone = false;
 }
 
 void ParticleSystem::Start() {
-    if (settings.maxParticles <= 0) return;
-    particles.resize(settings.maxParticles);
-    for (auto& p : particles) {
-        p.active = false;       // 初期状態は非アクティブ
-        p.sizeCurrent = 0.0f;   // 初期サイズ
-    }
+    particles.SetLimit(settings.maxParticles);
+    publishedCount = 0;
+    // システムごとの乱数列 (グローバル乱数から種を取るので再現可能)
+    rng.seed(static_cast<std::mt19937::result_type>(Random.Stream(RandomStream::Effect).GetEngine()()));
     elapsedTime = 0.0f;
     emitCounter = 0.0f;
     burstDone = false;
@@ -79,47 +137,76 @@ void ParticleSystem::Update() {
         }
     }
 
-    if (dt != 0) {
-        for (auto& p : particles) {
-            if (!p.active) continue;
+    // 移動・寿命の更新は ParticleManager がまとめて行う
+    simulateContext.worldPosition = transform->GetWorldPosition();
+    simulateContext.worldScale    = transform->GetWorldScale();
+    simulateContext.deltaTime     = dt;
+    simulateContext.rng           = &rng;
+    if (!simulateQueued) {
+        simulateQueued = true;
+        ParticleManager::GetInstance().Enqueue(shared_from_this());
+    }
+}
+
+bool ParticleSystem::IsParallelSafe() const {
+    // 旧形式の customUpdate は 1 個ずつ呼ぶ任意関数なのでメインスレッドで実行
+    return settings.parallelSimulation && (settings.customBatchUpdate || !settings.customUpdate);
+}
+
+void ParticleSystem::RunSimulation() {
+    if (simulateContext.deltaTime != 0) {
+        SimulateParticles(simulateContext);
+    }
+}
+
+void ParticleSystem::Publish() {
+    simulateQueued = false;
+    publishedCount = particles.Count();
+    if (isEndDestroy && particles.Empty()) {
+        Destroy();
+    }
+}
 
+void ParticleSystem::SimulateParticles(const ParticleUpdateContext& ctx) {
+    using F = ParticleField;
+    const float dt = ctx.deltaTime;
 
+    // 寿命を減らして切れたものを詰める
+    SubScalar(particles[F::Life], dt, particles.Count());
+    particles.RemoveDead();
 
-            p.life -= dt;
-            if (p.life <= 0) { p.active = false; continue; }
+    const int n = particles.Count();
+    if (n == 0) return;
 
-            if (settings.customUpdate) {
-                // カスタム関数で更新
-                settings.customUpdate(p, transform->GetWorldPosition(), transform->GetWorldScale());
-            }
-            else {
-                // デフォルト更新処理
-                p.pos.x += p.vc.x * dt;
-                p.pos.y += p.vc.y * dt;
-                p.rot.x += p.rotSpeed.x * dt;
-                p.rot.y += p.rotSpeed.y * dt;
-                p.rot.z += p.rotSpeed.z * dt;
-
-                // サイズやアルファを寿命に応じて更新
-                float t = p.life / p.totalLife; // 寿命比率(1→0)
-                p.sizeCurrent = p.size * t;     // 線形で小さくする例
-                // カラー（寿命によってアルファと明度をフェードアウト）
-                p.color.a = p.startColor.a * t;
-            }
+    if (settings.customBatchUpdate || settings.customUpdate) {
+        if (settings.customBatchUpdate) {
+            settings.customBatchUpdate(particles, ctx);
         }
-    }
-    if (isEndDestroy) {
-        bool allInactive = true;
-        for (auto& p : particles) {
-            if (p.active) {
-                allInactive = false;
-                break;
+        else {
+            // 旧形式: 1 個ずつ取り出して書き戻す
+            float* life = particles[F::Life];
+            for (int i = 0; i < n; ++i) {
+                Particle p = particles.Get(i);
+                settings.customUpdate(p, ctx.worldPosition, ctx.worldScale);
+                particles.Set(i, p);
+                if (!p.active) life[i] = 0.0f;
             }
         }
-        if (allInactive) {
-            Destroy();
-        }
+        // カスタム側で寿命を切ったものを取り除く
+        particles.RemoveDead();
+        return;
     }
+
+    // デフォルト更新処理
+    AddScaled(particles[F::PosX], particles[F::VcX], dt, n);
+    AddScaled(particles[F::PosY], particles[F::VcY], dt, n);
+    AddScaled(particles[F::RotX], particles[F::RotSpeedX], dt, n);
+    AddScaled(particles[F::RotY], particles[F::RotSpeedY], dt, n);
+    AddScaled(particles[F::RotZ], particles[F::RotSpeedZ], dt, n);
+
+    // サイズやアルファを寿命に応じて更新 (線形で小さく・フェードアウト)
+    FadeByLife(particles[F::Life], particles[F::TotalLife], particles[F::Size], particles[F::StartA],
+               particles[F::SizeCurrent], particles[F::ColorA], n);
 }
 
 void ParticleSystem::OnDestroy() {
@@ -127,16 +214,17 @@ void ParticleSystem::OnDestroy() {
 }
 
 void ParticleSystem::Draw() {
+    using F = ParticleField;
 
     if (isStop) return;
-    if (particles.empty()) return;
+    // 描画はシミュレーション完了後に確定した数だけ
+    const int n = std::min(publishedCount, particles.Count());
+    if (n == 0) return;
 
     // カスタム描画が設定されていればそれを優先
     if (customDraw) {
-        for (auto& p : particles) {
-            if (p.active) {
-                customDraw(p, *sprite);
-            }
+        for (int i = 0; i < n; ++i) {
+            customDraw(particles.Get(i), *sprite);
         }
         return;
     }
@@ -145,31 +233,44 @@ void ParticleSystem::Draw() {
     auto sp = sprite;
     auto scale = transform->GetWorldScale();
 
-    for (auto& p : particles) {
-        if (!p.active) continue;
+    const float* posX = particles[F::PosX];
+    const float* posY = particles[F::PosY];
+    const float* sizeCurrent = particles[F::SizeCurrent];
+    const float* rotX = particles[F::RotX];
+    const float* rotY = particles[F::RotY];
+    const float* rotZ = particles[F::RotZ];
+    const float* colR = particles[F::ColorR];
+    const float* colG = particles[F::ColorG];
+    const float* colB = particles[F::ColorB];
+    const float* colA = particles[F::ColorA];
+
+    const float baseHalfX = sp->width * 0.5f * scale.x;
+    const float baseHalfY = sp->height * 0.5f * scale.y;
+
+    for (int i = 0; i < n; ++i) {
         // --- デフォルト描画 ---
-        SetDrawBlendMode(DX_BLENDMODE_ALPHA, p.color.A255());
-        SetDrawBright(p.color.R255(), p.color.G255(), p.color.B255());
-
-        float halfX = (sp->width * 0.5f) * p.sizeCurrent * scale.x;
-        float halfY = (sp->height * 0.5f) * p.sizeCurrent * scale.y;
+        Color color(colR[i], colG[i], colB[i], colA[i]);
+        SetDrawBlendMode(DX_BLENDMODE_ALPHA, color.A255());
+        SetDrawBright(color.R255(), color.G255(), color.B255());
 
-        float radZ = Mathf::DegToRad(p.rot.z);
-        float radX = Mathf::DegToRad(p.rot.x);
-        float radY = Mathf::DegToRad(p.rot.y);
+        float halfX = baseHalfX * sizeCurrent[i];
+        float halfY = baseHalfY * sizeCurrent[i];
 
-        float sx = Mathf::Cos(radY);
-        float sy = Mathf::Cos(radX);
+        float radZ = Mathf::DegToRad(rotZ[i]);
+        float sx = Mathf::Cos(Mathf::DegToRad(rotY[i]));
+        float sy = Mathf::Cos(Mathf::DegToRad(rotX[i]));
+        float cz = Mathf::Cos(radZ);
+        float sz = Mathf::Sin(radZ);
 
         float dx[4] = { -halfX,  halfX, halfX, -halfX };
         float dy[4] = { -halfY, -halfY, halfY,  halfY };
 
         float px[4], py[4];
-        for (int i = 0; i < 4; ++i) {
-            float x = dx[i] * sx;
-            float y = dy[i] * sy;
-            px[i] = p.pos.x + x * Mathf::Cos(radZ) - y * Mathf::Sin(radZ);
-            py[i] = p.pos.y + x * Mathf::Sin(radZ) + y * Mathf::Cos(radZ);
+        for (int k = 0; k < 4; ++k) {
+            float x = dx[k] * sx;
+            float y = dy[k] * sy;
+            px[k] = posX[i] + x * cz - y * sz;
+            py[k] = posY[i] + x * sz + y * cz;
         }
 
         DrawModiGraph(
@@ -207,131 +308,135 @@ void ParticleSystem::EmitParticle() {
     float cosRot = cosf(rotationRad);
     float sinRot = sinf(rotationRad);
 
-    for (auto& p : particles) {
-        if (!p.active) {
-            p.active = true;
-
-            // -------------------------
-            // 生成位置（回転適用あり）
-            // -------------------------
-            float localX = 0.0f;
-            float localY = 0.0f;
-
-            switch (settings.spawnShape) {
-            case SpawnParticleShape::Circle: {
-                float angle = Random.Range(0.0f, 2.0f * Mathf::PI);
-                float dist = Random.Range(settings.spawnRadiusMin, settings.spawnRadiusMax);
-                localX = cosf(angle) * dist;
-                localY = sinf(angle) * dist;
-                break;
-            }
-            case SpawnParticleShape::Square: {
-                localX = Random.Range(-settings.spawnRadiusMax, settings.spawnRadiusMax);
-                localY = Random.Range(-settings.spawnRadiusMax, settings.spawnRadiusMax);
-                break;
-            }
-            case SpawnParticleShape::Box: {
-                localX = Random.Range(settings.spawnBoxMin.x, settings.spawnBoxMax.x);
-                localY = Random.Range(settings.spawnBoxMin.y, settings.spawnBoxMax.y);
-                break;
-            }
-            case SpawnParticleShape::Line: {
-                localX = Random.Range(-settings.spawnRadiusMax, settings.spawnRadiusMax);
-                localY = 0.0f;
-                break;
-            }
-            }
+    // 空きは末尾に 1 つ (満杯なら生成しない)
+    const int index = particles.Emit();
+    if (index < 0) return;
+
+    Particle p{};
+    p.active = true;
+
+    // -------------------------
+    // 生成位置（回転適用あり）
+    // -------------------------
+    float localX = 0.0f;
+    float localY = 0.0f;
+
+    switch (settings.spawnShape) {
+    case SpawnParticleShape::Circle: {
+        float angle = RandomRange(rng, 0.0f, 2.0f * Mathf::PI);
+        float dist = RandomRange(rng, settings.spawnRadiusMin, settings.spawnRadiusMax);
+        localX = cosf(angle) * dist;
+        localY = sinf(angle) * dist;
+        break;
+    }
+    case SpawnParticleShape::Square: {
+        localX = RandomRange(rng, -settings.spawnRadiusMax, settings.spawnRadiusMax);
+        localY = RandomRange(rng, -settings.spawnRadiusMax, settings.spawnRadiusMax);
+        break;
+    }
+    case SpawnParticleShape::Box: {
+        localX = RandomRange(rng, settings.spawnBoxMin.x, settings.spawnBoxMax.x);
+        localY = RandomRange(rng, settings.spawnBoxMin.y, settings.spawnBoxMax.y);
+        break;
+    }
+    case SpawnParticleShape::Line: {
+        localX = RandomRange(rng, -settings.spawnRadiusMax, settings.spawnRadiusMax);
+        localY = 0.0f;
+        break;
+    }
+    }
 
-            // 回転適用
-            float worldX = localX * cosRot - localY * sinRot;
-            float worldY = localX * sinRot + localY * cosRot;
-            p.pos.x = origin.x + worldX;
-            p.pos.y = origin.y + worldY;
-
-            // -------------------------
-            // 寿命・初期サイズ
-            // -------------------------
-            float life = Random.Range(settings.lifetimeMin, settings.lifetimeMax);
-            p.life = p.totalLife = life;
-
-            p.size = Random.Range(settings.sizeMin, settings.sizeMax);
-            p.sizeCurrent = p.size;
-
-            // 終端サイズ（寿命末に向かって成長するサイズ）
-            p.targetSize = Random.Range(settings.endSizeMin, settings.endSizeMax);
-
-
-            // -------------------------
-            // 発射方向と速度（回転対応）
-            // -------------------------
-            float speed = Random.Range(settings.speedMin, settings.speedMax);
-            float angle = 0.0f;
-            bool velocitySet = false;
-
-            float velocityDirectionRad = Mathf::DegToRad(settings.velocityDirectionDeg);
-            float velocitySpreadRad = Mathf::DegToRad(settings.velocitySpreadDeg);
-
-            switch (settings.velocityMode) {
-            case VelocityDirectionMode::Random360:
-                angle = Random.Range(0.0f, 2.0f * Mathf::PI);
-                break;
-            case VelocityDirectionMode::Cone:
-                angle = velocityDirectionRad + Random.Range(-velocitySpreadRad / 2.0f, velocitySpreadRad / 2.0f);
-                break;
-            case VelocityDirectionMode::Fixed:
-                angle = velocityDirectionRad;
-                break;
-            case VelocityDirectionMode::Line:
-                angle = (Random.Range(0, 1) > 0.5f) ? velocityDirectionRad : velocityDirectionRad + Mathf::PI;
-                break;
-            case VelocityDirectionMode::CustomFunction:
-                if (settings.customVelocityFunc) {
-                    Vector2D dir = settings.customVelocityFunc().GetNormalize();
-                    p.vc.x = dir.x * speed;
-                    p.vc.y = dir.y * speed;
-                    velocitySet = true;
-                }
-                else {
-                    angle = Random.Range(0.0f, 2.0f * Mathf::PI);
-                }
-                break;
-            }
+    // 回転適用
+    float worldX = localX * cosRot - localY * sinRot;
+    float worldY = localX * sinRot + localY * cosRot;
+    p.pos.x = origin.x + worldX;
+    p.pos.y = origin.y + worldY;
+
+    // -------------------------
+    // 寿命・初期サイズ
+    // -------------------------
+    float life = RandomRange(rng, settings.lifetimeMin, settings.lifetimeMax);
+    p.life = p.totalLife = life;
+
+    p.size = RandomRange(rng, settings.sizeMin, settings.sizeMax);
+    p.sizeCurrent = p.size;
+
+    // 終端サイズ（寿命末に向かって成長するサイズ）
+    p.targetSize = RandomRange(rng, settings.endSizeMin, settings.endSizeMax);
+
+
+    // -------------------------
+    // 発射方向と速度（回転対応）
+    // -------------------------
+    float speed = RandomRange(rng, settings.speedMin, settings.speedMax);
+    float angle = 0.0f;
+    bool velocitySet = false;
+
+    float velocityDirectionRad = Mathf::DegToRad(settings.velocityDirectionDeg);
+    float velocitySpreadRad = Mathf::DegToRad(settings.velocitySpreadDeg);
+
+    switch (settings.velocityMode) {
+    case VelocityDirectionMode::Random360:
+        angle = RandomRange(rng, 0.0f, 2.0f * Mathf::PI);
+        break;
+    case VelocityDirectionMode::Cone:
+        angle = velocityDirectionRad + RandomRange(rng, -velocitySpreadRad / 2.0f, velocitySpreadRad / 2.0f);
+        break;
+    case VelocityDirectionMode::Fixed:
+        angle = velocityDirectionRad;
+        break;
+    case VelocityDirectionMode::Line:
+        angle = (RandomRange(rng, 0, 1) > 0.5f) ? velocityDirectionRad : velocityDirectionRad + Mathf::PI;
+        break;
+    case VelocityDirectionMode::CustomFunction:
+        if (settings.customVelocityFunc) {
+            Vector2D dir = settings.customVelocityFunc().GetNormalize();
+            p.vc.x = dir.x * speed;
+            p.vc.y = dir.y * speed;
+            velocitySet = true;
+        }
+        else {
+            angle = RandomRange(rng, 0.0f, 2.0f * Mathf::PI);
+        }
+        break;
+    }
 
-            if (!velocitySet) {
-                float vx = cosf(angle) * speed;
-                float vy = sinf(angle) * speed;
+    if (!velocitySet) {
+        float vx = cosf(angle) * speed;
+        float vy = sinf(angle) * speed;
 
-                // ワールド回転適用
-                p.vc.x = vx * cosRot - vy * sinRot;
-                p.vc.y = vx * sinRot + vy * cosRot;
-            }
+        // ワールド回転適用
+        p.vc.x = vx * cosRot - vy * sinRot;
+        p.vc.y = vx * sinRot + vy * cosRot;
+    }
 
-            // -------------------------
-            // 回転と色
-            // -------------------------
-            p.rot.x     = Random.Range(settings.startRotationMin.x, settings.startRotationMax.x);
-            p.rot.y     = Random.Range(settings.startRotationMin.y, settings.startRotationMax.y);
-            p.rot.z     = Random.Range(settings.startRotationMin.z, settings.startRotationMax.z);
-
-            p.rotSpeed.x = Random.Range(settings.rotationSpeedMin.x, settings.rotationSpeedMax.x);
-            p.rotSpeed.y = Random.Range(settings.rotationSpeedMin.y, settings.rotationSpeedMax.y);
-            p.rotSpeed.z = Random.Range(settings.rotationSpeedMin.z, settings.rotationSpeedMax.z);
-
-            // ランダムカラー設定
-            if (settings.useRandomStartColor) {
-                // 各チャンネルを最小～最大の範囲で乱数生成
-                int r = Random.Range(settings.startColorMin.R255(), settings.startColorMax.R255());
-                int g = Random.Range(settings.startColorMin.G255(), settings.startColorMax.G255());
-                int b = Random.Range(settings.startColorMin.B255(), settings.startColorMax.B255());
-                int a = Random.Range(settings.startColorMin.A255(), settings.startColorMax.A255());
-                Color randCol = { r, g, b, a };
-                p.startColor = p.color = randCol;
-            }
-            else {
-                // 固定色
-                p.startColor = p.color = settings.startColor;
-            }
-            break; // 1つだけ発生
-        }
+    // -------------------------
+    // 回転と色
+    // -------------------------
+    p.rot.x     = RandomRange(rng, settings.startRotationMin.x, settings.startRotationMax.x);
+    p.rot.y     = RandomRange(rng, settings.startRotationMin.y, settings.startRotationMax.y);
+    p.rot.z     = RandomRange(rng, settings.startRotationMin.z, settings.startRotationMax.z);
+
+    p.rotSpeed.x = RandomRange(rng, settings.rotationSpeedMin.x, settings.rotationSpeedMax.x);
+    p.rotSpeed.y = RandomRange(rng, settings.rotationSpeedMin.y, settings.rotationSpeedMax.y);
+    p.rotSpeed.z = RandomRange(rng, settings.rotationSpeedMin.z, settings.rotationSpeedMax.z);
+
+    // ランダムカラー設定
+    if (settings.useRandomStartColor) {
+        // 各チャンネルを最小～最大の範囲で乱数生成
+        int r = RandomRange(rng, settings.startColorMin.R255(), settings.startColorMax.R255());
+        int g = RandomRange(rng, settings.startColorMin.G255(), settings.startColorMax.G255());
+        int b = RandomRange(rng, settings.startColorMin.B255(), settings.startColorMax.B255());
+        int a = RandomRange(rng, settings.startColorMin.A255(), settings.startColorMax.A255());
+        Color randCol = { r, g, b, a };
+        p.startColor = p.color = randCol;
+    }
+    else {
+        // 固定色
+        p.startColor = p.color = settings.startColor;
     }
+    // 揺れ等の位相用
+    p.angleDirection = RandomRange(rng, 0.0f, 2.0f * Mathf::PI);
+
+    particles.Set(index, p);
 }
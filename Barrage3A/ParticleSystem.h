@@ -14,10 +14,12 @@
 #include "Text.h"
 #include "Filter.hpp"
 #include "Texture2D.h"
+#include "ParticleBuffer.h"
 #include <vector>
 #include <memory>
 #include <cstdlib>
 #include <cmath>
+#include <random>
 
 using namespace GameEngine;
 
@@ -36,23 +38,6 @@ enum class VelocityDirectionMode {
     CustomFunction  // ユーザー定義関数で決定
 };
 
-// パーティクルデータ(実体)
-struct Particle {
-    Vector2D pos;           // 2Dスクリーン座標
-    Vector2D vc;            // 2D速度ベクトル
-    float size;             // 基本スケール
-    float sizeCurrent;      // 現在のスケール（Updateで変化）
-	float targetSize;	    // 目標スケール
-    Color color;            // RGBAカラー (0～255)
-    Color startColor;       // 初回のカラー;
-    Vector3D rot;           // 回転角度 (度): x,y は疑似3Dチルト, z はスピン.
-    Vector3D rotSpeed;      // 各軸の回転速度 (度/秒)
-    float life;             // 残り寿命 (秒)
-    float totalLife;        // 初期寿命 (秒)
-    bool active;            // アクティブ状態フラグ
-    float angleDirection;
-};
-
 using ParticleFunc = std::function<void(Particle&, Vector2D,Vector2D)>;
 using ParticleDrawFunc = std::function<void(const Particle&, const Sprite&)>;
 
@@ -63,6 +48,20 @@ ParticleFunc MakeParticleFunc(F&& f) {
     return std::forward<F>(f);
 }
 
+// まとめて更新する時の共通情報 (1 システム 1 フレームに 1 回だけ計算).
+struct ParticleUpdateContext {
+    Vector2D worldPosition;     // ParticleSystem のワールド座標
+    Vector2D worldScale;        // ParticleSystem のワールドスケール
+    float    deltaTime = 0.0f;
+    std::mt19937* rng = nullptr;    // システムごとの乱数列 (ワーカーからも決定的に使える)
+};
+
+// 生存中の全パーティクル [0, Count()) をまとめて更新する関数.
+// Life を 0 以下にしたパーティクルは呼び出し後に取り除かれる.
+using ParticleBatchFunc = std::function<void(ParticleBuffer&, const ParticleUpdateContext&)>;
+
+#define PARTICLE_BATCH_FUNC [](ParticleBuffer& ps, const ParticleUpdateContext& ctx)
+
 struct ParticleSettings {
     int maxParticles = 1000;                    // 最大パーティクル数
     float spawnRadiusMin = 0.0f;                // 生成範囲の最小半径（内側の空洞半径）
@@ -97,14 +96,20 @@ struct ParticleSettings {
     float velocityDirectionDeg  = 90.0f;       // 度で指定（例：下方向）
     float velocitySpreadDeg     = 45.0f;       // 広がり（度）
     std::function<Vector2D()> customVelocityFunc = nullptr; // CustomFunction用
-    ParticleFunc customUpdate = nullptr;        // nullptrならデフォルト更新処理
+    ParticleBatchFunc customBatchUpdate = nullptr; // 設定時はシステム単位でまとめて更新 (customUpdate より優先)
+    ParticleFunc customUpdate = nullptr;        // nullptrならデフォルト更新処理 (1 個ずつ, 旧形式)
+    bool parallelSimulation = true;             // ワーカースレッドで更新してよいか
 };
 
 // ParticleSystem class and AppBase class
 class ParticleSystem : public AppBase, public IRendererDraw, public std::enable_shared_from_this<ParticleSystem>{
 private:    // 非公開.
 	ParticleSettings settings;
-    std::vector<Particle> particles;
+    ParticleBuffer particles;               // SoA. 生存中は [0, Count()) に詰めて保持.
+    int publishedCount = 0;                 // 描画に使う数 (シミュレーション完了後に確定)
+    std::mt19937 rng;                       // システムごとの乱数列.
+    ParticleUpdateContext simulateContext;  // 今フレームの更新情報 (Update で設定)
+    bool simulateQueued = false;            // ParticleManager に登録済みか.
     std::shared_ptr<Sprite> sprite;
     SortingLayer sortingLayer;
 	RenderMode   renderMode = RenderMode::WorldSpace; // 描画モード.
@@ -133,6 +138,12 @@ public:     // 公開.
 	void Restart();                     // 再起動 (停止状態解除 + エミッション再開).
 
     void SetCustomDraw(ParticleDrawFunc func) { customDraw = std::move(func); }
+    int  GetParticleCount() const { return particles.Count(); }
+
+    // ParticleManager から呼ばれる.
+    bool IsParallelSafe() const;    // ワーカーで更新してよいか.
+    void RunSimulation();           // 移動・寿命の更新 (ワーカースレッド可).
+    void Publish();                 // 更新結果の確定 (メインスレッド).
 
     // AppBase 関数.
     void Awake()        override;
@@ -149,8 +160,12 @@ public:     // 公開.
 private:
     // 作成.
     void EmitParticle();
+    // 更新 (寿命・移動・フェード).
+    void SimulateParticles(const ParticleUpdateContext& ctx);
 protected:
     std::shared_ptr<AppBase> Clone() const override {
-        return std::make_shared<ParticleSystem>(*this);
+        auto clone = std::make_shared<ParticleSystem>(*this);
+        clone->simulateQueued = false;  // 登録状態は複製元のもの (複製は未登録から始める).
+        return clone;
     }
 };
\ No newline at end of file
@@ -1,55 +1,83 @@
 #pragma once
 #include <vector>
+#include <span>
+#include <cmath>
+#include <algorithm>
+#include <cstdint>
 #include "Vector.h"
+#include "SnapshotStream.h"
 
+// G̈ړoH.
+// SetPath ̎_ŌoHʒɂēԊuȓ_ɏĂ, GetPositionAt 
+// ׂ荇 2 _̕Ԃŋ߂ (t ɑ΂đɂȂ).
 class Path2D {
+public:
+    // Ă݂̎菇E萔ςグ (ÂLbVǂ܂Ȃ悤).
+    static constexpr uint32_t BakeVersion = 1;
 private:
-    struct Segment {
-        enum class Type { Linear, CubicBezier };
-        Type type;
-        Vector2D p0, p1, p2, p3; // 4_ŃL[rbN
-        float length;
-    };
-    std::vector<Segment> segments;
+    static constexpr int BezierSubdivisions = 64;       // ʒ𑪂Ƃ 1 Ԃ̕.
+    static constexpr float SampleSpacing = 2.0f;        // Ăޓ_̊Ԋu (px).
+    static constexpr size_t MinSamples = 32;
+    static constexpr size_t MaxSamples = 4096;
+
+    // samples[i]  t = i / sampleScale ̈ʒu.
+    std::vector<Vector2D> samples;
+    float sampleScale = 0.f;
     float totalLength = 0.f;
 
-    static float EstimateBezierLength(const Vector2D& p0, const Vector2D& p1, const Vector2D& p2, const Vector2D& p3, int samples = 10) {
-        float len = 0.f;
-        Vector2D prev = p0;
-        for (int i = 1; i <= samples; ++i) {
-            float t = i / (float)samples;
-            float u = 1 - t;
-            Vector2D point =
-                u * u * u * p0 +
-                3 * u * u * t * p1 +
-                3 * u * t * t * p2 +
-                t * t * t * p3;
-            len += (point - prev).Length();
-            prev = point;
+    static Vector2D EvaluateBezier(const Vector2D& p0, const Vector2D& p1, const Vector2D& p2, const Vector2D& p3, float t) {
+        float u = 1 - t;
+        return p0 * (u * u * u) + p1 * (3 * u * u * t) + p2 * (3 * u * t * t) + p3 * (t * t * t);
+    }
+
+    // ׂ܂, ʒœԊuȓ_.
+    void Bake(const std::vector<Vector2D>& dense) {
+        samples.clear();
+        sampleScale = 0.f;
+        totalLength = 0.f;
+        if (dense.empty()) return;
+
+        std::vector<float> cumulative(dense.size(), 0.f);
+        for (size_t i = 1; i < dense.size(); ++i) {
+            cumulative[i] = cumulative[i - 1] + (dense[i] - dense[i - 1]).Length();
         }
-        return len;
+        totalLength = cumulative.back();
+        if (dense.size() < 2 || totalLength <= 0.f) {
+            samples.assign(2, dense.front());
+            sampleScale = 1.f;
+            return;
+        }
+
+        const size_t count = std::clamp(static_cast<size_t>(std::ceil(totalLength / SampleSpacing)), MinSamples, MaxSamples);
+        samples.resize(count + 1);
+        size_t j = 0;
+        for (size_t k = 0; k < count; ++k) {
+            const float d = totalLength * static_cast<float>(k) / static_cast<float>(count);
+            while (j + 2 < dense.size() && cumulative[j + 1] < d) ++j;
+            const float span = cumulative[j + 1] - cumulative[j];
+            const float a = span > 0.f ? (d - cumulative[j]) / span : 0.f;
+            samples[k] = dense[j] + (dense[j + 1] - dense[j]) * a;
+        }
+        samples[count] = dense.back();
+        sampleScale = static_cast<float>(count);
     }
 
 public:
+    // segmentInterpolations[i]  points[i]  points[i + 1] ̕ (0: , ȊO: 3 xWF).
     void SetPath(const std::vector<Vector2D>& points, const std::vector<int>& segmentInterpolations) {
-        segments.clear();
-        totalLength = 0.f;
+        std::vector<Vector2D> dense;
+        dense.reserve(segmentInterpolations.size() * BezierSubdivisions + 1);
 
         for (size_t i = 0; i < segmentInterpolations.size(); ++i) {
+            if (i + 1 >= points.size()) break;
+            if (dense.empty()) dense.push_back(points[i]);
+
             if (segmentInterpolations[i] == 0) {
                 // Linear
-                if (i + 1 >= points.size()) break;
-                Segment seg;
-                seg.type = Segment::Type::Linear;
-                seg.p0 = points[i];
-                seg.p1 = points[i + 1];
-                seg.length = (seg.p1 - seg.p0).Length();
-                segments.push_back(seg);
-                totalLength += seg.length;
+                dense.push_back(points[i + 1]);
             }
             else {
                 // Cubic BezieriRXvC_vZj
-                if (i + 1 >= points.size()) break;
                 Vector2D P0 = points[i];
                 Vector2D P3 = points[i + 1];
                 Vector2D P_minus1 = (i == 0) ? P0 : points[i - 1];
@@ -58,48 +86,48 @@ public:
                 Vector2D P1 = P0 + (P3 - P_minus1) / 6.0;
                 Vector2D P2 = P3 - (P_plus2 - P0) / 6.0;
 
-                Segment seg;
-                seg.type = Segment::Type::CubicBezier;
-                seg.p0 = P0;
-                seg.p1 = P1;
-                seg.p2 = P2;
-                seg.p3 = P3;
-                seg.length = EstimateBezierLength(P0, P1, P2, P3);
-                segments.push_back(seg);
-                totalLength += seg.length;
+                for (int s = 1; s <= BezierSubdivisions; ++s) {
+                    dense.push_back(EvaluateBezier(P0, P1, P2, P3, s / static_cast<float>(BezierSubdivisions)));
+                }
             }
         }
+        Bake(dense);
     }
 
+    bool IsEmpty() const { return samples.empty(); }
+    float GetLength() const { return totalLength; }
+    const std::vector<Vector2D>& GetSamples() const { return samples; }
+
     Vector2D GetPositionAt(float t) const {
-        if (segments.empty()) return Vector2D(0, 0);
-        if (t <= 0.f) return segments.front().p0;
-        if (t >= 1.f) {
-            const auto& seg = segments.back();
-            if (seg.type == Segment::Type::Linear) return seg.p1;
-            else return seg.p3;
-        }
+        if (samples.empty()) return Vector2D(0, 0);
+        if (t <= 0.f) return samples.front();
+        if (t >= 1.f) return samples.back();
 
-        float target = t * totalLength;
-        float accumulated = 0.f;
+        const float f = t * sampleScale;
+        const size_t i = std::min(static_cast<size_t>(f), samples.size() - 2);
+        const float a = f - static_cast<float>(i);
+        return samples[i] + (samples[i + 1] - samples[i]) * a;
+    }
 
-        for (const auto& seg : segments) {
-            if (accumulated + seg.length >= target) {
-                float localT = (target - accumulated) / seg.length;
-                if (seg.type == Segment::Type::Linear) {
-                    return seg.p0 * (1 - localT) + seg.p1 * localT;
-                }
-                else {
-                    float u = 1 - localT;
-                    return seg.p0 * (u * u * u) + seg.p1 * (3 * u * u * localT) + seg.p2 * (3 * u * localT * localT) + seg.p3 * (localT * localT * localT);
-                }
-            }
-            accumulated += seg.length;
-        }
+    // oHH镡̈ʒu (t ̗) ܂Ƃ߂ċ߂. out  ts Ɠ.
+    void GetPositionsAt(std::span<const float> ts, std::span<Vector2D> out) const {
+        const size_t n = std::min(ts.size(), out.size());
+        for (size_t k = 0; k < n; ++k) out[k] = GetPositionAt(ts[k]);
+    }
 
-        // fallback
-        const auto& seg = segments.back();
-        if (seg.type == Segment::Type::Linear) return seg.p1;
-        else return seg.p3;
+    // Ă񂾓_̕ۑƕ (PathManager ̃LbVp).
+    void Write(SnapshotWriter& out) const {
+        out.Write(totalLength);
+        out.WriteVector(samples);
+    }
+    bool Read(SnapshotReader& in) {
+        in.Read(totalLength);
+        in.ReadVector(samples);
+        if (in.IsFailed() || samples.size() == 1) {
+            samples.clear();
+            return false;
+        }
+        sampleScale = samples.empty() ? 0.f : static_cast<float>(samples.size() - 1);
+        return true;
     }
 };
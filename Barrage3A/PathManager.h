@@ -1,9 +1,12 @@
 #pragma once
 #include <unordered_map>
 #include <memory>
+#include <filesystem>
 #include "File.hpp"
 #include "JsonUtility.h"
+#include "JsonDocument.h"
 #include "Path2D.h"
+#include "SnapshotStream.h"
 
 
 struct PathData {
@@ -15,9 +18,66 @@ struct PathData {
 class PathManager {
 private:
     std::unordered_map<int, std::shared_ptr<Path2D>> paths;
+    bool cacheEnabled = true;
+
+    static constexpr uint32_t CacheMagic = 0x42443250;     // "P2DB"
 
     PathManager() {}
 
+    // t@C̑傫ƍXV (LbVÂȂ̔Ɏg).
+    static bool GetSourceStamp(const std::string& filepath, uint64_t& size, int64_t& time) {
+        std::error_code ec;
+        size = static_cast<uint64_t>(std::filesystem::file_size(filepath, ec));
+        if (ec) return false;
+        const auto writeTime = std::filesystem::last_write_time(filepath, ec);
+        if (ec) return false;
+        time = static_cast<int64_t>(writeTime.time_since_epoch().count());
+        return true;
+    }
+
+    static std::shared_ptr<Path2D> LoadCache(const std::string& cachePath, const std::string& sourcePath) {
+        if (!System::IO::File::Exists(cachePath)) return nullptr;
+        std::string bytes;
+        try {
+            bytes = System::IO::File::ReadAllBytes(cachePath);
+        }
+        catch (...) {
+            return nullptr;
+        }
+        SnapshotReader in(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size());
+        if (in.Read<uint32_t>() != CacheMagic || in.Read<uint32_t>() != Path2D::BakeVersion) return nullptr;
+        const uint64_t size = in.Read<uint64_t>();
+        const int64_t time = in.Read<int64_t>();
+        //  JSON ꍇ̓LbVœǂ.
+        uint64_t sourceSize = 0;
+        int64_t sourceTime = 0;
+        if (GetSourceStamp(sourcePath, sourceSize, sourceTime) && (sourceSize != size || sourceTime != time)) return nullptr;
+
+        auto path = std::make_shared<Path2D>();
+        if (!path->Read(in)) return nullptr;
+        return path;
+    }
+
+    static void SaveCache(const std::string& cachePath, const std::string& sourcePath, const Path2D& path) {
+        uint64_t size = 0;
+        int64_t time = 0;
+        if (!GetSourceStamp(sourcePath, size, time)) return;
+
+        std::vector<uint8_t> buffer;
+        SnapshotWriter out(buffer);
+        out.Write(CacheMagic);
+        out.Write(Path2D::BakeVersion);
+        out.Write(size);
+        out.Write(time);
+        path.Write(out);
+        try {
+            System::IO::File::WriteAllBytes(cachePath, std::string(buffer.begin(), buffer.end()));
+        }
+        catch (...) {
+            // ȂꏊȂ疈 JSON Ă.
+        }
+    }
+
 public:
     PathManager(const PathManager&) = delete;
     PathManager& operator=(const PathManager&) = delete;
@@ -32,21 +92,37 @@ public:
         paths[id] = path;
     }
 
+    // Ăݍς݂ "<json>.bin"  JSON ƈvĂ΂ǂ,
+    // EÂꍇ JSON ĂăLbV.
     void AddJsonPath(int id, const std::string& filepath) {
+        const std::string cachePath = filepath + ".bin";
+        if (cacheEnabled) {
+            if (auto cached = LoadCache(cachePath, filepath)) {
+                AddPath(id, cached);
+                return;
+            }
+        }
         try {
-            auto jsonText = System::IO::File::ReadAllText(filepath);
-            auto data = JsonUtility::FromJson<PathData>(jsonText);
+            // JsonValue gݗĂ, ǂݍ񂾕璼ڎo.
+            JsonDocument document;
+            const JsonNode& root = document.ParseFile(filepath);
+
+            PathData data;
+            ReadJson(root, data);
 
             auto path = std::make_shared<Path2D>();
             path->SetPath(data.points, data.segmentInterpolations);
 
             AddPath(id, path);
+            if (cacheEnabled) SaveCache(cachePath, filepath, *path);
         }
         catch (...) {
 
         }
     }
 
+    void SetCacheEnabled(bool enable) { cacheEnabled = enable; }
+
     // pX擾B݂Ȃ nullptr
     std::shared_ptr<Path2D> GetPath(int id) const {
         auto it = paths.find(id);
@@ -55,4 +131,9 @@ public:
         }
         return nullptr;
     }
-};
+    // t[p (QƃJEgGȂ).
+    const Path2D* FindPath(int id) const {
+        auto it = paths.find(id);
+        return it != paths.end() ? it->second.get() : nullptr;
+    }
+};
\ No newline at end of file
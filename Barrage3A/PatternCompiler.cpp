@@ -0,0 +1,841 @@
+#include "PatternCompiler.h"
+#include <unordered_map>
+#include <charconv>
+#include <cmath>
+#include <algorithm>
+
+namespace {
+    // ----  ----------------------------------------------------------------
+
+    enum class TokenType { Identifier, Number, String, Symbol, End };
+
+    struct Token {
+        TokenType type = TokenType::End;
+        std::string text;       // ʎqELE̒g.
+        double number = 0.0;
+        int line = 1;
+        int column = 1;
+    };
+
+    class Lexer {
+    private:
+        std::string_view src;
+        size_t pos = 0;
+        int line = 1;
+        size_t lineStart = 0;
+
+        int Column() const { return static_cast<int>(pos - lineStart) + 1; }
+        char Peek(size_t ahead = 0) const { return pos + ahead < src.size() ? src[pos + ahead] : '\0'; }
+        static bool IsIdentStart(char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_'; }
+        static bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+        void SkipSpace() {
+            while (pos < src.size()) {
+                const char c = src[pos];
+                if (c == '\n') { ++pos; ++line; lineStart = pos; }
+                else if (c == ' ' || c == '\t' || c == '\r' || c == ';') ++pos;
+                else if (c == '/' && Peek(1) == '/') { while (pos < src.size() && src[pos] != '\n') ++pos; }
+                else if (c == '#') { while (pos < src.size() && src[pos] != '\n') ++pos; }
+                else if (c == '/' && Peek(1) == '*') {
+                    pos += 2;
+                    while (pos < src.size() && !(src[pos] == '*' && Peek(1) == '/')) {
+                        if (src[pos] == '\n') { ++line; lineStart = pos + 1; }
+                        ++pos;
+                    }
+                    pos = std::min(pos + 2, src.size());
+                }
+                else break;
+            }
+        }
+    public:
+        explicit Lexer(std::string_view _src) : src(_src) {
+            if (src.size() >= 3 && src.substr(0, 3) == "\xEF\xBB\xBF") pos = lineStart = 3;
+        }
+
+        Token Next() {
+            SkipSpace();
+            Token t;
+            t.line = line;
+            t.column = Column();
+            if (pos >= src.size()) return t;
+
+            const char c = src[pos];
+            if (IsIdentStart(c)) {
+                const size_t start = pos;
+                // r '.' ͗񋓂̏C (BulletColor.Red) . ".." ͔͈͂̋L.
+                while (pos < src.size() && (IsIdentStart(src[pos]) || IsDigit(src[pos]) || (src[pos] == '.' && IsIdentStart(Peek(1))))) ++pos;
+                t.type = TokenType::Identifier;
+                t.text.assign(src.substr(start, pos - start));
+                return t;
+            }
+            if (IsDigit(c) || (c == '.' && IsDigit(Peek(1)))) {
+                const size_t start = pos;
+                while (IsDigit(Peek())) ++pos;
+                if (Peek() == '.' && IsDigit(Peek(1))) {
+                    ++pos;
+                    while (IsDigit(Peek())) ++pos;
+                }
+                if (Peek() == 'e' || Peek() == 'E') {
+                    size_t p = pos + 1;
+                    if (p < src.size() && (src[p] == '+' || src[p] == '-')) ++p;
+                    if (p < src.size() && IsDigit(src[p])) {
+                        pos = p;
+                        while (IsDigit(Peek())) ++pos;
+                    }
+                }
+                const std::string_view digits = src.substr(start, pos - start);
+                std::from_chars(digits.data(), digits.data() + digits.size(), t.number);
+                if (Peek() == 'f' || Peek() == 'F') ++pos;     // C++ ʂƂ 1.5f .
+                if (IsIdentStart(Peek())) throw PatternError(t.line, t.column, "O͐Ŏn߂Ȃ (\"...\" ň͂)");
+                t.type = TokenType::Number;
+                return t;
+            }
+            if (c == '"') {
+                ++pos;
+                t.type = TokenType::String;
+                while (true) {
+                    if (pos >= src.size() || src[pos] == '\n') throw PatternError(t.line, t.column, "񂪕ĂȂ");
+                    const char ch = src[pos++];
+                    if (ch == '"') break;
+                    if (ch == '\\' && pos < src.size()) {
+                        const char e = src[pos++];
+                        t.text.push_back(e == 'n' ? '\n' : e == 't' ? '\t' : e);
+                    }
+                    else t.text.push_back(ch);
+                }
+                return t;
+            }
+
+            static constexpr std::string_view twoChar[] = { "..", "<=", ">=", "==", "!=", "&&", "||", "+=", "-=", "*=", "/=" };
+            for (std::string_view sym : twoChar) {
+                if (src.substr(pos, 2) == sym) {
+                    pos += 2;
+                    t.type = TokenType::Symbol;
+                    t.text.assign(sym);
+                    return t;
+                }
+            }
+            if (std::string_view("{}()[],=+-*/%<>!").find(c) != std::string_view::npos) {
+                ++pos;
+                t.type = TokenType::Symbol;
+                t.text.assign(1, c);
+                return t;
+            }
+            throw PatternError(t.line, t.column, std::string("gȂ '") + c + "'");
+        }
+    };
+
+    // ---- \ --------------------------------------------------------------
+
+    struct Expr {
+        enum class Kind { Number, String, List, Variable, Unary, Binary, Call };
+        Kind kind = Kind::Number;
+        double number = 0.0;
+        std::string text;           // EϐE֐EZq.
+        std::vector<int> args;      // q̎.
+        int line = 0;
+        int column = 0;
+    };
+
+    struct Stmt {
+        enum class Kind { Instruction, Let, Assign, Loop, Repeat, For, If };
+        Kind kind = Kind::Instruction;
+        std::string name;           // ߖEϐEZq.
+        std::string op;
+        std::vector<int> args;
+        int expr[3] = { -1, -1, -1 };
+        std::vector<int> body;
+        std::vector<int> elseBody;
+        int line = 0;
+        int column = 0;
+    };
+
+    struct Item {
+        bool isPattern = false;
+        int stmt = -1;              // 萔 (Let).
+        PatternKind kind = PatternKind::Bullet;
+        std::string name;
+        std::vector<int> body;
+        int line = 0;
+        int column = 0;
+    };
+
+    struct Ast {
+        std::vector<Expr> exprs;
+        std::vector<Stmt> stmts;
+        std::vector<Item> items;
+    };
+
+    class Parser {
+    private:
+        Lexer lexer;
+        Token current;
+        Ast& ast;
+
+        void Advance() { current = lexer.Next(); }
+        bool IsSymbol(std::string_view s) const { return current.type == TokenType::Symbol && current.text == s; }
+        bool IsKeyword(std::string_view s) const { return current.type == TokenType::Identifier && current.text == s; }
+        [[noreturn]] void Fail(const std::string& message) const { throw PatternError(current.line, current.column, message); }
+        void Expect(std::string_view s) {
+            if (!IsSymbol(s)) Fail("'" + std::string(s) + "' Kv");
+            Advance();
+        }
+        std::string ExpectIdentifier() {
+            if (current.type != TokenType::Identifier) Fail("OKv");
+            std::string name = std::move(current.text);
+            Advance();
+            return name;
+        }
+
+        int NewExpr(Expr::Kind kind, const Token& at) {
+            Expr e;
+            e.kind = kind;
+            e.line = at.line;
+            e.column = at.column;
+            ast.exprs.push_back(std::move(e));
+            return static_cast<int>(ast.exprs.size()) - 1;
+        }
+        int NewStmt(Stmt::Kind kind, const Token& at) {
+            Stmt s;
+            s.kind = kind;
+            s.line = at.line;
+            s.column = at.column;
+            ast.stmts.push_back(std::move(s));
+            return static_cast<int>(ast.stmts.size()) - 1;
+        }
+
+        // ----  (D揇ʂ̒Ⴂ) ----
+        int ParseExpr() { return ParseBinary(0); }
+
+        static int Precedence(const Token& t) {
+            if (t.type != TokenType::Symbol) return -1;
+            static const std::unordered_map<std::string_view, int> table = {
+                { "||", 0 }, { "&&", 1 },
+                { "==", 2 }, { "!=", 2 },
+                { "<", 3 }, { "<=", 3 }, { ">", 3 }, { ">=", 3 },
+                { "+", 4 }, { "-", 4 },
+                { "*", 5 }, { "/", 5 }, { "%", 5 },
+            };
+            auto it = table.find(t.text);
+            return it != table.end() ? it->second : -1;
+        }
+
+        int ParseBinary(int minPrecedence) {
+            int left = ParseUnary();
+            while (true) {
+                const int prec = Precedence(current);
+                if (prec < minPrecedence) return left;
+                const Token opToken = current;
+                Advance();
+                const int right = ParseBinary(prec + 1);
+                const int e = NewExpr(Expr::Kind::Binary, opToken);
+                ast.exprs[e].text = opToken.text;
+                ast.exprs[e].args = { left, right };
+                left = e;
+            }
+        }
+
+        int ParseUnary() {
+            if (IsSymbol("-") || IsSymbol("!") || IsSymbol("+")) {
+                const Token opToken = current;
+                Advance();
+                const int operand = ParseUnary();
+                const int e = NewExpr(Expr::Kind::Unary, opToken);
+                ast.exprs[e].text = opToken.text;
+                ast.exprs[e].args = { operand };
+                return e;
+            }
+            return ParsePrimary();
+        }
+
+        std::vector<int> ParseArgs(std::string_view close) {
+            std::vector<int> args;
+            if (IsSymbol(close)) { Advance(); return args; }
+            while (true) {
+                args.push_back(ParseExpr());
+                if (IsSymbol(",")) { Advance(); if (IsSymbol(close)) { Advance(); return args; } continue; }
+                Expect(close);
+                return args;
+            }
+        }
+
+        int ParsePrimary() {
+            const Token at = current;
+            switch (current.type) {
+            case TokenType::Number: {
+                const int e = NewExpr(Expr::Kind::Number, at);
+                ast.exprs[e].number = current.number;
+                Advance();
+                return e;
+            }
+            case TokenType::String: {
+                const int e = NewExpr(Expr::Kind::String, at);
+                ast.exprs[e].text = std::move(current.text);
+                Advance();
+                return e;
+            }
+            case TokenType::Identifier: {
+                std::string name = std::move(current.text);
+                Advance();
+                if (IsSymbol("(")) {
+                    Advance();
+                    std::vector<int> args = ParseArgs(")");
+                    const int e = NewExpr(Expr::Kind::Call, at);
+                    ast.exprs[e].text = std::move(name);
+                    ast.exprs[e].args = std::move(args);
+                    return e;
+                }
+                const int e = NewExpr(Expr::Kind::Variable, at);
+                ast.exprs[e].text = std::move(name);
+                return e;
+            }
+            case TokenType::Symbol:
+                if (IsSymbol("(")) {
+                    Advance();
+                    const int e = ParseExpr();
+                    Expect(")");
+                    return e;
+                }
+                if (IsSymbol("[")) {
+                    Advance();
+                    std::vector<int> args = ParseArgs("]");
+                    const int e = NewExpr(Expr::Kind::List, at);
+                    ast.exprs[e].args = std::move(args);
+                    return e;
+                }
+                break;
+            default:
+                break;
+            }
+            Fail("Kv");
+        }
+
+        // ----  ----
+        std::vector<int> ParseBlock() {
+            Expect("{");
+            std::vector<int> body;
+            while (!IsSymbol("}")) {
+                if (current.type == TokenType::End) Fail("'}' Kv");
+                body.push_back(ParseStatement());
+            }
+            Advance();
+            return body;
+        }
+
+        int ParseLet(const Token& at) {
+            const int s = NewStmt(Stmt::Kind::Let, at);
+            std::string name = ExpectIdentifier();
+            Expect("=");
+            const int value = ParseExpr();
+            ast.stmts[s].name = std::move(name);
+            ast.stmts[s].expr[0] = value;
+            return s;
+        }
+
+        int ParseStatement() {
+            const Token at = current;
+            if (current.type != TokenType::Identifier) Fail("߂Kv");
+
+            if (IsKeyword("let") || IsKeyword("const")) {
+                Advance();
+                return ParseLet(at);
+            }
+            if (IsKeyword("loop") || IsKeyword("repeat")) {
+                const bool runtime = IsKeyword("loop");
+                Advance();
+                const int count = ParseExpr();
+                std::vector<int> body = ParseBlock();
+                const int s = NewStmt(runtime ? Stmt::Kind::Loop : Stmt::Kind::Repeat, at);
+                ast.stmts[s].expr[0] = count;
+                ast.stmts[s].body = std::move(body);
+                return s;
+            }
+            if (IsKeyword("for")) {
+                Advance();
+                std::string counter = ExpectIdentifier();
+                if (!IsKeyword("in")) Fail("'in' Kv");
+                Advance();
+                const int from = ParseExpr();
+                Expect("..");
+                const int to = ParseExpr();
+                int step = -1;
+                if (IsKeyword("step")) { Advance(); step = ParseExpr(); }
+                std::vector<int> body = ParseBlock();
+                const int s = NewStmt(Stmt::Kind::For, at);
+                ast.stmts[s].name = std::move(counter);
+                ast.stmts[s].expr[0] = from;
+                ast.stmts[s].expr[1] = to;
+                ast.stmts[s].expr[2] = step;
+                ast.stmts[s].body = std::move(body);
+                return s;
+            }
+            if (IsKeyword("if")) {
+                Advance();
+                const int cond = ParseExpr();
+                std::vector<int> body = ParseBlock();
+                std::vector<int> elseBody;
+                if (IsKeyword("else")) {
+                    Advance();
+                    if (IsKeyword("if")) elseBody.push_back(ParseStatement());
+                    else elseBody = ParseBlock();
+                }
+                const int s = NewStmt(Stmt::Kind::If, at);
+                ast.stmts[s].expr[0] = cond;
+                ast.stmts[s].body = std::move(body);
+                ast.stmts[s].elseBody = std::move(elseBody);
+                return s;
+            }
+
+            std::string name = ExpectIdentifier();
+            if (IsSymbol("=") || IsSymbol("+=") || IsSymbol("-=") || IsSymbol("*=") || IsSymbol("/=")) {
+                std::string op = current.text;
+                Advance();
+                const int value = ParseExpr();
+                const int s = NewStmt(Stmt::Kind::Assign, at);
+                ast.stmts[s].name = std::move(name);
+                ast.stmts[s].op = std::move(op);
+                ast.stmts[s].expr[0] = value;
+                return s;
+            }
+            Expect("(");
+            std::vector<int> args = ParseArgs(")");
+            const int s = NewStmt(Stmt::Kind::Instruction, at);
+            ast.stmts[s].name = std::move(name);
+            ast.stmts[s].args = std::move(args);
+            return s;
+        }
+    public:
+        Parser(std::string_view source, Ast& _ast) : lexer(source), ast(_ast) { Advance(); }
+
+        void ParseFile() {
+            while (current.type != TokenType::End) {
+                const Token at = current;
+                Item item;
+                item.line = at.line;
+                item.column = at.column;
+                if (IsKeyword("const") || IsKeyword("let")) {
+                    Advance();
+                    item.stmt = ParseLet(at);
+                }
+                else if (IsKeyword("bullet") || IsKeyword("shot") || IsKeyword("enemy")) {
+                    item.isPattern = true;
+                    item.kind = IsKeyword("bullet") ? PatternKind::Bullet : IsKeyword("shot") ? PatternKind::Shot : PatternKind::Enemy;
+                    Advance();
+                    if (current.type == TokenType::Identifier || current.type == TokenType::String) {
+                        item.name = std::move(current.text);
+                        Advance();
+                    }
+                    else Fail("p^[Kv");
+                    item.body = ParseBlock();
+                }
+                else Fail("'bullet', 'shot', 'enemy'  'const' Kv");
+                ast.items.push_back(std::move(item));
+            }
+        }
+    };
+
+    // ---- ] ----------------------------------------------------------------
+
+    struct Value {
+        enum class Kind { Number, String, List };
+        Kind kind = Kind::Number;
+        double number = 0.0;
+        std::string text;
+        std::vector<double> list;
+
+        static Value Number(double v) { Value r; r.number = v; return r; }
+    };
+
+    // ߂̈. ^ȂΌĂяoʒu PatternError.
+    class PatternArgs {
+    private:
+        const std::vector<Value>& values;
+        const Stmt& at;
+
+        const Value& Get(size_t i, Value::Kind kind, const char* what) const {
+            if (i >= values.size()) Fail(std::to_string(i + 1) + " Ԗڂ̈Ȃ");
+            if (values[i].kind != kind) Fail(std::to_string(i + 1) + " Ԗڂ̈" + what);
+            return values[i];
+        }
+    public:
+        PatternArgs(const std::vector<Value>& _values, const Stmt& _at) : values(_values), at(_at) {}
+
+        [[noreturn]] void Fail(const std::string& message) const {
+            throw PatternError(at.line, at.column, at.name + ": " + message);
+        }
+        void Count(size_t min, size_t max) const {
+            if (values.size() < min || values.size() > max) {
+                Fail("̐ " + (min == max ? std::to_string(min) : std::to_string(min) + "`" + std::to_string(max)) +
+                     " (" + std::to_string(values.size()) + " )");
+            }
+        }
+        size_t Size() const { return values.size(); }
+
+        float Float(size_t i) const { return static_cast<float>(Get(i, Value::Kind::Number, "l").number); }
+        int Int(size_t i) const { return static_cast<int>(std::lround(Get(i, Value::Kind::Number, "l").number)); }
+        bool Bool(size_t i) const { return Get(i, Value::Kind::Number, "l").number != 0.0; }
+        float FloatOr(size_t i, float def) const { return i < values.size() ? Float(i) : def; }
+        int IntOr(size_t i, int def) const { return i < values.size() ? Int(i) : def; }
+        const std::string& String(size_t i) const { return Get(i, Value::Kind::String, "").text; }
+        template<typename E>
+        E Enum(size_t i) const { return static_cast<E>(Int(i)); }
+
+        std::vector<float> Floats(size_t i) const {
+            const Value& v = Get(i, Value::Kind::List, "Xg [a, b, ...]");
+            return std::vector<float>(v.list.begin(), v.list.end());
+        }
+        Vector2D Vector(size_t i) const {
+            const Value& v = Get(i, Value::Kind::List, "W [x, y]");
+            if (v.list.size() != 2) Fail(std::to_string(i + 1) + " Ԗڂ̈ [x, y]  2 vf");
+            return Vector2D(static_cast<float>(v.list[0]), static_cast<float>(v.list[1]));
+        }
+    };
+
+    template<typename T>
+    using Builder = T(*)(const PatternArgs&);
+
+    template<typename T>
+    using BuilderTable = std::unordered_map<std::string_view, Builder<T>>;
+
+    const BuilderTable<BulletInstruction>& BulletBuilders() {
+        using I = BulletInstruction;
+        static const BuilderTable<I> table = {
+            { "SetBulletType", +[](const PatternArgs& a) { a.Count(2, 2); return I::SetBulletType(a.Enum<BulletParentID>(0), a.Enum<BulletColor>(1)); } },
+            { "SetVelocity",   +[](const PatternArgs& a) { a.Count(2, 2); return I::SetVelocity(a.Float(0), a.Float(1)); } },
+            { "Accelerate",    +[](const PatternArgs& a) { a.Count(2, 2); return I::Accelerate(a.Float(0), a.Int(1)); } },
+            { "Rotate",        +[](const PatternArgs& a) { a.Count(2, 2); return I::Rotate(a.Float(0), a.Int(1)); } },
+            { "Wait",          +[](const PatternArgs& a) { a.Count(1, 1); return I::Wait(a.Int(0)); } },
+            { "LerpVelocity",  +[](const PatternArgs& a) { a.Count(2, 2); return I::LerpVelocity(a.Float(0), a.Int(1)); } },
+            { "RotateTo",      +[](const PatternArgs& a) { a.Count(2, 2); return I::RotateTo(a.Float(0), a.Int(1)); } },
+            { "AddRotateTo",   +[](const PatternArgs& a) { a.Count(2, 2); return I::AddRotateTo(a.Float(0), a.Int(1)); } },
+            { "AimAtPlayer",   +[](const PatternArgs& a) { a.Count(0, 0); return I::AimAtPlayer(); } },
+            { "Seek",          +[](const PatternArgs& a) { a.Count(2, 2); return I::Seek(a.Float(0), a.Int(1)); } },
+            { "RandomizeAngle",+[](const PatternArgs& a) { a.Count(1, 1); return I::RandomizeAngle(a.Float(0)); } },
+            { "Branch",        +[](const PatternArgs& a) { a.Count(2, 2); return I::Branch(a.Int(0), a.Float(1)); } },
+            { "DelayedFire",   +[](const PatternArgs& a) { a.Count(1, 1); return I::DelayedFire(a.Int(0)); } },
+            { "Wave",          +[](const PatternArgs& a) { a.Count(3, 3); return I::Wave(a.Float(0), a.Float(1), a.Int(2)); } },
+            { "Zigzag",        +[](const PatternArgs& a) { a.Count(2, 2); return I::Zigzag(a.Float(0), a.Int(1)); } },
+            { "End",           +[](const PatternArgs& a) { a.Count(0, 0); return I::End(); } },
+            { "SetPlayerSE",   +[](const PatternArgs& a) { a.Count(1, 2); return I::SetPlayerSE(a.String(0), a.FloatOr(1, 1.0f)); } },
+            { "LoopStart",     +[](const PatternArgs& a) { a.Count(1, 1); return I::LoopStart(a.Int(0)); } },
+            { "LoopEnd",       +[](const PatternArgs& a) { a.Count(0, 0); return I::LoopEnd(); } },
+        };
+        return table;
+    }
+
+    const BuilderTable<ShotInstruction>& ShotBuilders() {
+        using I = ShotInstruction;
+        static const BuilderTable<I> table = {
+            { "SetEnemyBulletType",  +[](const PatternArgs& a) { a.Count(3, 3); return I::SetEnemyBulletType(a.Int(0), a.Enum<BulletParentID>(1), a.Enum<BulletColor>(2)); } },
+            { "SetBulletDefault",    +[](const PatternArgs& a) { a.Count(2, 2); return I::SetBulletDefault(a.Enum<BulletParentID>(0), a.Enum<BulletColor>(1)); } },
+            { "Fire",                +[](const PatternArgs& a) { a.Count(2, 2); return I::Fire(a.Float(0), a.Float(1)); } },
+            { "FireSpread",          +[](const PatternArgs& a) { a.Count(4, 4); return I::FireSpread(a.Int(0), a.Float(1), a.Float(2), a.Float(3)); } },
+            { "FireMultiSpeed",      +[](const PatternArgs& a) { a.Count(2, 2); return I::FireMultiSpeed(a.Float(0), a.Floats(1)); } },
+            { "FireSpreadCentered",  +[](const PatternArgs& a) { a.Count(4, 4); return I::FireSpreadCentered(a.Int(0), a.Float(1), a.Float(2), a.Float(3)); } },
+            { "FireSpreadShuffled",  +[](const PatternArgs& a) { a.Count(2, 5); return I::FireSpreadShuffled(a.Int(0), a.Float(1), a.FloatOr(2, 360.0f), a.FloatOr(3, 0.0f), a.IntOr(4, -1)); } },
+            { "FireSpreadRandomized",+[](const PatternArgs& a) { a.Count(4, 4); return I::FireSpreadRandomized(a.Int(0), a.Float(1), a.Float(2), a.Float(3)); } },
+            { "RegisterBullet",      +[](const PatternArgs& a) { a.Count(3, 3); return I::RegisterBullet(a.Int(0), a.Float(1), a.Float(2)); } },
+            { "OnFire",              +[](const PatternArgs& a) { a.Count(1, 1); return I::OnFire(a.Int(0)); } },
+            { "FireSnake",           +[](const PatternArgs& a) { a.Count(3, 3); return I::FireSnake(a.Int(0), a.Float(1), a.Float(2)); } },
+            { "FireFan",             +[](const PatternArgs& a) { a.Count(4, 4); return I::FireFan(a.Int(0), a.Int(1), a.Float(2), a.Float(3)); } },
+            { "FireCircle",          +[](const PatternArgs& a) { a.Count(3, 3); return I::FireCircle(a.Int(0), a.Int(1), a.Float(2)); } },
+            { "FireSpiral",          +[](const PatternArgs& a) { a.Count(4, 4); return I::FireSpiral(a.Int(0), a.Int(1), a.Float(2), a.Float(3)); } },
+            { "FireWave",            +[](const PatternArgs& a) { a.Count(4, 4); return I::FireWave(a.Int(0), a.Int(1), a.Float(2), a.Float(3)); } },
+            { "RandomizeAngle",      +[](const PatternArgs& a) { a.Count(1, 1); return I::RandomizeAngle(a.Float(0)); } },
+            { "LoopStart",           +[](const PatternArgs& a) { a.Count(1, 1); return I::LoopStart(a.Int(0)); } },
+            { "LoopEnd",             +[](const PatternArgs& a) { a.Count(0, 0); return I::LoopEnd(); } },
+            { "Wait",                +[](const PatternArgs& a) { a.Count(1, 1); return I::Wait(a.Int(0)); } },
+            { "End",                 +[](const PatternArgs& a) { a.Count(0, 0); return I::End(); } },
+            { "SetBulletScript",     +[](const PatternArgs& a) { a.Count(1, 1); return I::SetBulletScript(a.String(0)); } },
+            { "SetEnemyType",        +[](const PatternArgs& a) { a.Count(3, 3); return I::SetEnemyType(a.Int(0), a.Int(1), a.Int(2)); } },
+            { "EmitEffect",          +[](const PatternArgs& a) { a.Count(1, 1); return I::EmitEffect(a.Int(0)); } },
+            { "EmitSpeedUp",         +[](const PatternArgs& a) { a.Count(5, 5); return I::EmitSpeedUp(a.Int(0), a.Int(1), a.Int(2), a.Float(3), a.Bool(4)); } },
+            { "EmitDelay",           +[](const PatternArgs& a) { a.Count(2, 2); return I::EmitDelay(a.Int(0), a.Int(1)); } },
+            { "Offset",              +[](const PatternArgs& a) { a.Count(3, 3); return I::Offset(a.Int(0), a.Float(1), a.Float(2)); } },
+            { "Rotate",              +[](const PatternArgs& a) { a.Count(1, 1); return I::Rotate(a.Float(0)); } },
+            { "Accelerate",          +[](const PatternArgs& a) { a.Count(1, 1); return I::Accelerate(a.Float(0)); } },
+            { "AddBaseAngle",        +[](const PatternArgs& a) { a.Count(1, 1); return I::AddBaseAngle(a.Float(0)); } },
+            { "SetAngle",            +[](const PatternArgs& a) { a.Count(1, 1); return I::SetAngle(a.Float(0)); } },
+            { "SetPlayerAngle",      +[](const PatternArgs& a) { a.Count(0, 0); return I::SetPlayerAngle(); } },
+            { "SetPlayerSE",         +[](const PatternArgs& a) { a.Count(1, 2); return I::SetPlayerSE(a.String(0), a.FloatOr(1, 1.0f)); } },
+        };
+        return table;
+    }
+
+    const BuilderTable<EnemyInstruction>& EnemyBuilders() {
+        using I = EnemyInstruction;
+        static const BuilderTable<I> table = {
+            { "SetHp",                  +[](const PatternArgs& a) { a.Count(1, 1); return I::SetHp(a.Int(0)); } },
+            { "SetHitboxEnable",        +[](const PatternArgs& a) { a.Count(1, 1); return I::SetHitboxEnable(a.Bool(0)); } },
+            { "AddDropItem",            +[](const PatternArgs& a) { a.Count(2, 2); return I::AddDropItem(a.Enum<ItemType>(0), a.Int(1)); } },
+            { "SetAngle",               +[](const PatternArgs& a) { a.Count(1, 1); return I::SetAngle(a.Float(0)); } },
+            { "Die",                    +[](const PatternArgs& a) { a.Count(0, 0); return I::Die(); } },
+            { "MoveTo",                 +[](const PatternArgs& a) { a.Count(2, 2); return I::MoveTo(a.Vector(0), a.Int(1)); } },
+            { "Wait",                   +[](const PatternArgs& a) { a.Count(1, 1); return I::Wait(a.Int(0)); } },
+            { "Teleport",               +[](const PatternArgs& a) { a.Count(1, 1); return I::Teleport(a.Vector(0)); } },
+            { "Fire",                   +[](const PatternArgs& a) { a.Count(1, 1); return I::Fire(a.String(0)); } },
+            { "SetVelocity",            +[](const PatternArgs& a) { a.Count(1, 1); return I::SetVelocity(a.Vector(0)); } },
+            { "Accelerate",             +[](const PatternArgs& a) { a.Count(1, 1); return I::Accelerate(a.Vector(0)); } },
+            { "Rotate",                 +[](const PatternArgs& a) { a.Count(1, 2); return I::Rotate(a.Float(0), a.IntOr(1, 1)); } },
+            { "LoopStart",              +[](const PatternArgs& a) { a.Count(1, 1); return I::LoopStart(a.Int(0)); } },
+            { "LoopEnd",                +[](const PatternArgs& a) { a.Count(0, 0); return I::LoopEnd(); } },
+            { "CallSubroutine",         +[](const PatternArgs& a) { a.Count(1, 1); return I::CallSubroutine(a.String(0)); } },
+            { "SetEnemyType",           +[](const PatternArgs& a) { a.Count(2, 2); return I::SetEnemyType(a.Int(0), a.Int(1)); } },
+            { "EmitEffect",             +[](const PatternArgs& a) { a.Count(1, 1); return I::EmitEffect(a.Int(0)); } },
+            { "Offset",                 +[](const PatternArgs& a) { a.Count(3, 3); return I::Offset(a.Int(0), a.Float(1), a.Float(2)); } },
+            { "SetAccelerationPattern", +[](const PatternArgs& a) { a.Count(2, 2); return I::SetAccelerationPattern(a.Vector(0), a.Int(1)); } },
+            { "OscillateX",             +[](const PatternArgs& a) { a.Count(3, 3); return I::OscillateX(a.Float(0), a.Float(1), a.Int(2)); } },
+            { "OscillateY",             +[](const PatternArgs& a) { a.Count(3, 3); return I::OscillateY(a.Float(0), a.Float(1), a.Int(2)); } },
+            { "HomingPlayer",           +[](const PatternArgs& a) { a.Count(2, 2); return I::HomingPlayer(a.Float(0), a.Int(1)); } },
+            { "FollowPath",             +[](const PatternArgs& a) { a.Count(2, 2); return I::FollowPath(a.Int(0), a.Int(1)); } },
+            { "SetUpdateFunction",      +[](const PatternArgs& a) { a.Count(1, 1); return I::SetUpdateFunction(a.String(0)); } },
+            { "RandomMove",             +[](const PatternArgs& a) { a.Count(4, 5); return I::RandomMove(a.Vector(0), a.Float(1), a.Float(2), a.Int(3), a.IntOr(4, 60)); } },
+            { "RandomWander",           +[](const PatternArgs& a) { a.Count(2, 4); return I::RandomWander(a.Float(0), a.Float(1), a.IntOr(2, 30), a.IntOr(3, 0)); } },
+            { "End",                    +[](const PatternArgs& a) { a.Count(0, 0); return I::End(); } },
+        };
+        return table;
+    }
+
+    // 񋓒l̖O. т͊e enum ̒`.
+    void DefineEnumConstants(std::unordered_map<std::string, Value>& scope) {
+        auto define = [&scope](std::string_view prefix, std::initializer_list<std::string_view> names) {
+            double value = 0.0;
+            for (std::string_view name : names) {
+                scope[std::string(name)] = Value::Number(value);
+                scope[std::string(prefix) + "." + std::string(name)] = Value::Number(value);
+                value += 1.0;
+            }
+        };
+        define("BulletParentID", { "B1", "B4", "BigB4", "B5", "B6", "B7", "Crystal", "Kunai", "MiniB0", "MiniB1", "MiniB2",
+                                   "Star", "BigSter", "B13", "B14", "B15", "Bullet", "Knife", "Arraw", "BigBullet" });
+        define("BulletColor", { "Gray", "Red", "VividRed", "Purple", "Pink", "Blue", "LightBlue", "Cyan", "SkyBlue", "MintGreen",
+                                "NeonGreen", "LimeGreen", "LemonYellow", "PastelYellow", "Orange", "White", "Black" });
+        define("ItemType", { "Score", "ScoreBig", "Power", "PowerBig", "LifePiece", "LifeFull", "BombPiece", "BombFull",
+                             "PointExtend", "Custom" });
+        scope["true"] = Value::Number(1.0);
+        scope["false"] = Value::Number(0.0);
+    }
+
+    class Evaluator {
+    private:
+        const Ast& ast;
+        std::vector<std::unordered_map<std::string, Value>> scopes;
+
+        [[noreturn]] static void Fail(int line, int column, const std::string& message) { throw PatternError(line, column, message); }
+
+        Value* FindVariable(const std::string& name) {
+            for (auto it = scopes.rbegin(); it != scopes.rend(); ++it) {
+                if (auto found = it->find(name); found != it->end()) return &found->second;
+            }
+            return nullptr;
+        }
+
+        double EvalNumber(int index) {
+            const Value v = Eval(index);
+            if (v.kind != Value::Kind::Number) Fail(ast.exprs[index].line, ast.exprs[index].column, "lKv");
+            return v.number;
+        }
+
+        Value Call(const Expr& e) {
+            std::vector<double> args;
+            args.reserve(e.args.size());
+            for (int a : e.args) {
+                if (e.text == "len") {
+                    const Value v = Eval(a);
+                    if (v.kind != Value::Kind::List) Fail(e.line, e.column, "len ̈̓Xg");
+                    return Value::Number(static_cast<double>(v.list.size()));
+                }
+                args.push_back(EvalNumber(a));
+            }
+            auto need = [&](size_t n) {
+                if (args.size() != n) Fail(e.line, e.column, e.text + " ̈ " + std::to_string(n) + " ");
+            };
+            constexpr double DegToRad = 3.14159265358979323846 / 180.0;
+            if (e.text == "sin")   { need(1); return Value::Number(std::sin(args[0] * DegToRad)); }
+            if (e.text == "cos")   { need(1); return Value::Number(std::cos(args[0] * DegToRad)); }
+            if (e.text == "sqrt")  { need(1); return Value::Number(std::sqrt(args[0])); }
+            if (e.text == "abs")   { need(1); return Value::Number(std::fabs(args[0])); }
+            if (e.text == "floor") { need(1); return Value::Number(std::floor(args[0])); }
+            if (e.text == "ceil")  { need(1); return Value::Number(std::ceil(args[0])); }
+            if (e.text == "round") { need(1); return Value::Number(std::round(args[0])); }
+            if (e.text == "min" || e.text == "max") {
+                if (args.empty()) Fail(e.line, e.column, e.text + " ̈");
+                return Value::Number(e.text == "min" ? *std::min_element(args.begin(), args.end()) : *std::max_element(args.begin(), args.end()));
+            }
+            Fail(e.line, e.column, "mȂ֐ '" + e.text + "'");
+        }
+
+        Value Eval(int index) {
+            const Expr& e = ast.exprs[index];
+            switch (e.kind) {
+            case Expr::Kind::Number:
+                return Value::Number(e.number);
+            case Expr::Kind::String: {
+                Value v;
+                v.kind = Value::Kind::String;
+                v.text = e.text;
+                return v;
+            }
+            case Expr::Kind::List: {
+                Value v;
+                v.kind = Value::Kind::List;
+                v.list.reserve(e.args.size());
+                for (int a : e.args) v.list.push_back(EvalNumber(a));
+                return v;
+            }
+            case Expr::Kind::Variable:
+                if (const Value* v = FindVariable(e.text)) return *v;
+                Fail(e.line, e.column, "mȂO '" + e.text + "'");
+            case Expr::Kind::Unary: {
+                const double v = EvalNumber(e.args[0]);
+                if (e.text == "-") return Value::Number(-v);
+                if (e.text == "!") return Value::Number(v == 0.0 ? 1.0 : 0.0);
+                return Value::Number(v);
+            }
+            case Expr::Kind::Binary: {
+                // &&  || ͍Ō܂ΉE]Ȃ.
+                if (e.text == "&&" || e.text == "||") {
+                    const bool left = EvalNumber(e.args[0]) != 0.0;
+                    if (e.text == "&&" ? !left : left) return Value::Number(left ? 1.0 : 0.0);
+                    return Value::Number(EvalNumber(e.args[1]) != 0.0 ? 1.0 : 0.0);
+                }
+                const double a = EvalNumber(e.args[0]);
+                const double b = EvalNumber(e.args[1]);
+                const std::string& op = e.text;
+                if (op == "+") return Value::Number(a + b);
+                if (op == "-") return Value::Number(a - b);
+                if (op == "*") return Value::Number(a * b);
+                if (op == "/" || op == "%") {
+                    if (b == 0.0) Fail(e.line, e.column, "0 ŊĂ");
+                    return Value::Number(op == "/" ? a / b : std::fmod(a, b));
+                }
+                if (op == "<")  return Value::Number(a < b);
+                if (op == "<=") return Value::Number(a <= b);
+                if (op == ">")  return Value::Number(a > b);
+                if (op == ">=") return Value::Number(a >= b);
+                if (op == "==") return Value::Number(a == b);
+                if (op == "!=") return Value::Number(a != b);
+                Fail(e.line, e.column, "mȂZq '" + op + "'");
+            }
+            case Expr::Kind::Call:
+                return Call(e);
+            }
+            Fail(e.line, e.column, "]łȂ");
+        }
+
+        template<typename T>
+        void Emit(std::vector<T>& out, T&& instr, const Stmt& at) {
+            if (out.size() >= PatternCompiler::MaxInstructionsPerPattern) Fail(at.line, at.column, "߂ (WĴ߂)");
+            out.push_back(std::move(instr));
+        }
+
+        template<typename T>
+        void ExecBlock(const std::vector<int>& body, std::vector<T>& out, const BuilderTable<T>& builders) {
+            scopes.emplace_back();
+            for (int s : body) Exec(ast.stmts[s], out, builders);
+            scopes.pop_back();
+        }
+
+        template<typename T>
+        void Exec(const Stmt& s, std::vector<T>& out, const BuilderTable<T>& builders) {
+            switch (s.kind) {
+            case Stmt::Kind::Instruction: {
+                auto it = builders.find(s.name);
+                if (it == builders.end()) Fail(s.line, s.column, "̎ނ̃XNvgɖ '" + s.name + "'");
+                std::vector<Value> values;
+                values.reserve(s.args.size());
+                for (int a : s.args) values.push_back(Eval(a));
+                Emit(out, it->second(PatternArgs(values, s)), s);
+                break;
+            }
+            case Stmt::Kind::Let:
+                scopes.back()[s.name] = Eval(s.expr[0]);
+                break;
+            case Stmt::Kind::Assign: {
+                Value* target = FindVariable(s.name);
+                if (!target) Fail(s.line, s.column, "let ĂȂO '" + s.name + "'");
+                Value v = Eval(s.expr[0]);
+                if (s.op != "=") {
+                    if (target->kind != Value::Kind::Number || v.kind != Value::Kind::Number) Fail(s.line, s.column, s.op + " ͐l̂");
+                    if (s.op == "+=") v.number = target->number + v.number;
+                    else if (s.op == "-=") v.number = target->number - v.number;
+                    else if (s.op == "*=") v.number = target->number * v.number;
+                    else {
+                        if (v.number == 0.0) Fail(s.line, s.column, "0 ŊĂ");
+                        v.number = target->number / v.number;
+                    }
+                }
+                *target = std::move(v);
+                break;
+            }
+            case Stmt::Kind::Loop: {
+                const int count = static_cast<int>(std::lround(EvalNumber(s.expr[0])));
+                Emit(out, T::LoopStart(count), s);
+                ExecBlock(s.body, out, builders);
+                Emit(out, T::LoopEnd(), s);
+                break;
+            }
+            case Stmt::Kind::Repeat: {
+                const long long count = std::llround(EvalNumber(s.expr[0]));
+                for (long long i = 0; i < count; ++i) ExecBlock(s.body, out, builders);
+                break;
+            }
+            case Stmt::Kind::For: {
+                const double from = EvalNumber(s.expr[0]);
+                const double to = EvalNumber(s.expr[1]);
+                const double step = s.expr[2] >= 0 ? EvalNumber(s.expr[2]) : (from <= to ? 1.0 : -1.0);
+                if (step == 0.0 || (step > 0.0) != (from <= to)) Fail(s.line, s.column, "step ͈̌͂ƍȂ");
+                for (double v = from; step > 0.0 ? v < to : v > to; v += step) {
+                    scopes.emplace_back();
+                    scopes.back()[s.name] = Value::Number(v);
+                    for (int b : s.body) Exec(ast.stmts[b], out, builders);
+                    scopes.pop_back();
+                }
+                break;
+            }
+            case Stmt::Kind::If:
+                ExecBlock(EvalNumber(s.expr[0]) != 0.0 ? s.body : s.elseBody, out, builders);
+                break;
+            }
+        }
+    public:
+        explicit Evaluator(const Ast& _ast) : ast(_ast) {
+            scopes.emplace_back();
+            DefineEnumConstants(scopes.back());
+            scopes.emplace_back();     // t@C̒萔.
+        }
+
+        void Define(const Stmt& s) { scopes.back()[s.name] = Eval(s.expr[0]); }
+
+        PatternEntry Build(const Item& item) {
+            PatternEntry entry;
+            entry.kind = item.kind;
+            entry.name = item.name;
+            switch (item.kind) {
+            case PatternKind::Bullet: ExecBlock(item.body, entry.bullet, BulletBuilders()); break;
+            case PatternKind::Shot:   ExecBlock(item.body, entry.shot, ShotBuilders()); break;
+            case PatternKind::Enemy:  ExecBlock(item.body, entry.enemy, EnemyBuilders()); break;
+            }
+            return entry;
+        }
+    };
+}
+
+std::vector<PatternEntry> PatternCompiler::Compile(std::string_view source) {
+    Ast ast;
+    Parser(source, ast).ParseFile();
+
+    Evaluator evaluator(ast);
+    std::vector<PatternEntry> entries;
+    std::unordered_map<std::string, int> defined[3];    // ނƂ̖O  s
+    for (const Item& item : ast.items) {
+        if (!item.isPattern) {
+            evaluator.Define(ast.stmts[item.stmt]);
+            continue;
+        }
+        auto [it, inserted] = defined[static_cast<int>(item.kind)].emplace(item.name, item.line);
+        if (!inserted) throw PatternError(item.line, item.column, "'" + item.name + "'  " + std::to_string(it->second) + " sڂŒ`ς");
+        entries.push_back(evaluator.Build(item));
+    }
+    return entries;
+}
@@ -0,0 +1,76 @@
+/*
+    PatternCompiler.h
+
+    :class
+        - PatternError
+        - PatternCompiler
+
+    쐬         : 2026/10/19
+    ŏIύX     : 2026/10/19
+*/
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <stdexcept>
+#include <cstdint>
+
+#include "BulletInstruction.h"
+#include "ShotInstruction.h"
+#include "EnemyInstruction.h"
+
+enum class PatternKind : uint8_t {
+    Bullet,
+    Shot,
+    Enemy,
+};
+
+// 1 {Ԃ̃XNvg (kind ɑΉ閽ߗ񂾂܂).
+struct PatternEntry {
+    PatternKind kind = PatternKind::Bullet;
+    std::string name;
+    std::vector<BulletInstruction> bullet;
+    std::vector<ShotInstruction> shot;
+    std::vector<EnemyInstruction> enemy;
+};
+
+// @EӖ̃G[. what() ɂ "s:: e" .
+class PatternError : public std::runtime_error {
+private:
+    int line;
+    int column;
+public:
+    PatternError(int _line, int _column, const std::string& message)
+        : std::runtime_error(std::to_string(_line) + ":" + std::to_string(_column) + ": " + message),
+          line(_line), column(_column) {}
+
+    int GetLine() const { return line; }
+    int GetColumn() const { return column; }
+};
+
+/// <summary>
+/// ep^[Lq (.pat)  BulletInstruction / ShotInstruction / EnemyInstruction ̗ɖ|󂷂.
+///
+///   const N = 5                       // t@CŜ̒萔
+///   bullet slowBullet { Wait(60) LerpVelocity(1, 60) End() }
+///   shot "30LoopShot" {
+///       SetBulletDefault(Crystal, Cyan)
+///       loop 30 { SetPlayerAngle() Fire(0, 5) Wait(15) }     // s̃[v (LoopStart/LoopEnd)
+///       for i in 0 .. N { Fire(i * 72, 3) }                 // |󎞂ɓWJ郋[v
+///       End()
+///   }
+///   enemy Enemy01 { SetHp(40) MoveTo([-150, 250], 120) Fire("shot_aim") End() }
+///
+/// ߖƈ͊e Instruction  static ֐Ɠ. Vector2D  [x, y], x̗ [a, b, ...].
+/// ͎lE]ErE_, let / , repeat n { } / if  { } else { } 
+/// sin, cos (x), sqrt, abs, min, max, floor, ceil, round, len g.
+/// 񋓒l (BulletParentID / BulletColor / ItemType) ͖Oł BulletColor.Red ̌`ł.
+/// </summary>
+class PatternCompiler {
+public:
+    static constexpr size_t MaxInstructionsPerPattern = 65536;     // WJ߂̎~.
+
+    // s PatternError 𓊂.
+    static std::vector<PatternEntry> Compile(std::string_view source);
+};
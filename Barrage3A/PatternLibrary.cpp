@@ -0,0 +1,304 @@
+#include "PatternLibrary.h"
+#include "PatternCompiler.h"
+#include "ShotScriptManager.h"
+#include "BulletScriptManager.h"
+#include "EnemyScriptManager.h"
+#include "SnapshotStream.h"
+#include "File.hpp"
+#include "Debug.hpp"
+
+#include <filesystem>
+#include <unordered_map>
+#include <algorithm>
+
+namespace {
+    constexpr uint32_t CacheMagic = 0x42544150;     // "PATB"
+    constexpr uint32_t CacheVersion = 1;
+
+    // LbV̒e. soundName ̓LbV̕\̈ʒuŎ.
+    struct BulletRecord {
+        BulletInstruction::Type type = BulletInstruction::Type::End;
+        float value1 = 0.f;
+        float value2 = 0.f;
+        int duration = 0;
+        float volume = 1.0f;
+        BulletParentID parentID = BulletParentID::Count;
+        BulletColor color = BulletColor::Red;
+        uint32_t sound = ScriptNameTable::NoName;
+    };
+
+    // gݗčς݂ 1 {. kind ɑΉ̂.
+    struct BuiltPattern {
+        PatternKind kind = PatternKind::Bullet;
+        std::string name;
+        std::shared_ptr<BulletScript> bullet;
+        std::shared_ptr<ShotProgram> shot;
+        std::shared_ptr<EnemyProgram> enemy;
+    };
+
+    // LbVŎg\. ߂̖Oԍ͂̕\̈ʒuɒuď.
+    class StringTable {
+    private:
+        std::vector<std::string> strings;
+        std::unordered_map<std::string, uint32_t> indices;
+    public:
+        uint32_t Add(const std::string& text) {
+            if (text.empty()) return ScriptNameTable::NoName;
+            auto [it, inserted] = indices.emplace(text, static_cast<uint32_t>(strings.size()));
+            if (inserted) strings.push_back(text);
+            return it->second;
+        }
+        uint32_t AddName(uint32_t nameId) {
+            return nameId == ScriptNameTable::NoName ? nameId : Add(ScriptNameTable::GetInstance().Get(nameId));
+        }
+        const std::vector<std::string>& GetStrings() const { return strings; }
+    };
+
+    bool GetSourceStamp(const std::string& filepath, uint64_t& size, int64_t& time) {
+        std::error_code ec;
+        size = static_cast<uint64_t>(std::filesystem::file_size(filepath, ec));
+        if (ec) return false;
+        const auto writeTime = std::filesystem::last_write_time(filepath, ec);
+        if (ec) return false;
+        time = static_cast<int64_t>(writeTime.time_since_epoch().count());
+        return true;
+    }
+
+    std::vector<BuiltPattern> Build(const std::vector<PatternEntry>& entries) {
+        std::vector<BuiltPattern> built;
+        built.reserve(entries.size());
+        for (const PatternEntry& entry : entries) {
+            BuiltPattern& b = built.emplace_back();
+            b.kind = entry.kind;
+            b.name = entry.name;
+            switch (entry.kind) {
+            case PatternKind::Bullet:
+                b.bullet = std::make_shared<BulletScript>();
+                b.bullet->SetInstructions(entry.bullet);
+                break;
+            case PatternKind::Shot:
+                b.shot = std::make_shared<ShotProgram>();
+                for (const ShotInstruction& instr : entry.shot) b.shot->AddInstruction(instr);
+                break;
+            case PatternKind::Enemy:
+                b.enemy = std::make_shared<EnemyProgram>();
+                for (const EnemyInstruction& instr : entry.enemy) b.enemy->Add(instr);
+                break;
+            }
+        }
+        return built;
+    }
+
+    // eVbgG̏ɓ (VbgeXNvg𖼑Oň).
+    void Install(std::vector<BuiltPattern>& built) {
+        for (PatternKind kind : { PatternKind::Bullet, PatternKind::Shot, PatternKind::Enemy }) {
+            for (BuiltPattern& b : built) {
+                if (b.kind != kind) continue;
+                switch (kind) {
+                case PatternKind::Bullet: BulletScriptManager::GetInstance().ReplaceBulletScript(b.name, std::move(b.bullet)); break;
+                case PatternKind::Shot:   ShotScriptManager::GetInstance().ReplaceShotScript(b.name, std::move(b.shot)); break;
+                case PatternKind::Enemy:  EnemyScriptManager::GetInstance().ReplaceEnemyScript(b.name, std::move(b.enemy)); break;
+                }
+            }
+        }
+    }
+
+    // ---- LbV ----
+    //   magic, version, ߂̑傫 3 , t@C̑傫ƍXV,
+    //   \, p^[, [, O, ߗ (Vbg + x\)] ...
+    // ߗ͎š`̂܂ܕׂĂ̂, ǂݍ݂ 1 {ɂ memcpy 1 ƖOԍ̕tւ.
+
+    void WriteHeader(SnapshotWriter& out, uint64_t size, int64_t time) {
+        out.Write(CacheMagic);
+        out.Write(CacheVersion);
+        out.Write(static_cast<uint32_t>(sizeof(BulletRecord)));
+        out.Write(static_cast<uint32_t>(sizeof(ShotOp)));
+        out.Write(static_cast<uint32_t>(sizeof(EnemyOp)));
+        out.Write(size);
+        out.Write(time);
+    }
+
+    void SaveCache(const std::string& cachePath, uint64_t size, int64_t time, const std::vector<BuiltPattern>& built) {
+        StringTable strings;
+        std::vector<uint8_t> body;
+        SnapshotWriter out(body);
+        out.Write(static_cast<uint32_t>(built.size()));
+        for (const BuiltPattern& b : built) {
+            out.Write(static_cast<uint8_t>(b.kind));
+            out.Write(strings.Add(b.name));
+            switch (b.kind) {
+            case PatternKind::Bullet: {
+                std::vector<BulletRecord> records;
+                records.reserve(b.bullet->GetInstructions().size());
+                for (const BulletInstruction& instr : b.bullet->GetInstructions()) {
+                    records.push_back({ instr.type, instr.value1, instr.value2, instr.duration, instr.volume,
+                                        instr.parentID, instr.color, strings.Add(instr.soundName) });
+                }
+                out.WriteVector(records);
+                break;
+            }
+            case PatternKind::Shot: {
+                std::vector<ShotOp> ops = b.shot->GetOps();
+                for (ShotOp& op : ops) op.name = strings.AddName(op.name);
+                out.WriteVector(ops);
+                out.WriteVector(b.shot->GetSpeedTable());
+                break;
+            }
+            case PatternKind::Enemy: {
+                std::vector<EnemyOp> ops = b.enemy->GetOps();
+                for (EnemyOp& op : ops) op.name = strings.AddName(op.name);
+                out.WriteVector(ops);
+                break;
+            }
+            }
+        }
+
+        std::vector<uint8_t> buffer;
+        SnapshotWriter file(buffer);
+        WriteHeader(file, size, time);
+        file.Write(static_cast<uint32_t>(strings.GetStrings().size()));
+        for (const std::string& s : strings.GetStrings()) file.WriteString(s);
+        buffer.insert(buffer.end(), body.begin(), body.end());
+        try {
+            System::IO::File::WriteAllBytes(cachePath, std::string(buffer.begin(), buffer.end()));
+        }
+        catch (...) {
+            // ȂΖ|󂷂邾.
+        }
+    }
+
+    // t@C (zz) , 傫ƍXVvƂǂ.
+    bool LoadCache(const std::string& cachePath, bool hasSource, uint64_t size, int64_t time, std::vector<BuiltPattern>& built) {
+        if (!System::IO::File::Exists(cachePath)) return false;
+        std::string bytes;
+        try {
+            bytes = System::IO::File::ReadAllBytes(cachePath);
+        }
+        catch (...) {
+            return false;
+        }
+        SnapshotReader in(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size());
+        if (in.Read<uint32_t>() != CacheMagic || in.Read<uint32_t>() != CacheVersion) return false;
+        if (in.Read<uint32_t>() != sizeof(BulletRecord) || in.Read<uint32_t>() != sizeof(ShotOp) || in.Read<uint32_t>() != sizeof(EnemyOp)) return false;
+        const uint64_t cachedSize = in.Read<uint64_t>();
+        const int64_t cachedTime = in.Read<int64_t>();
+        if (hasSource && (cachedSize != size || cachedTime != time)) return false;
+
+        // \͓ǂ񂾎_ ScriptNameTable ɒʂĂ.
+        const uint32_t stringCount = in.Read<uint32_t>();
+        if (stringCount > bytes.size()) return false;
+        std::vector<std::string> strings(stringCount);
+        std::vector<uint32_t> nameIds(strings.size());
+        for (size_t i = 0; i < strings.size() && !in.IsFailed(); ++i) {
+            in.ReadString(strings[i]);
+            nameIds[i] = ScriptNameTable::GetInstance().Intern(strings[i]);
+        }
+        auto toName = [&](uint32_t index) { return index < nameIds.size() ? nameIds[index] : ScriptNameTable::NoName; };
+        auto toString = [&](uint32_t index) -> const std::string& {
+            static const std::string empty;
+            return index < strings.size() ? strings[index] : empty;
+        };
+
+        const uint32_t count = in.Read<uint32_t>();
+        for (uint32_t i = 0; i < count && !in.IsFailed(); ++i) {
+            BuiltPattern& b = built.emplace_back();
+            b.kind = static_cast<PatternKind>(in.Read<uint8_t>());
+            b.name = toString(in.Read<uint32_t>());
+            switch (b.kind) {
+            case PatternKind::Bullet: {
+                std::vector<BulletRecord> records;
+                in.ReadVector(records);
+                std::vector<BulletInstruction> instructions(records.size());
+                for (size_t r = 0; r < records.size(); ++r) {
+                    const BulletRecord& rec = records[r];
+                    BulletInstruction& instr = instructions[r];
+                    instr.type = rec.type;
+                    instr.value1 = rec.value1;
+                    instr.value2 = rec.value2;
+                    instr.duration = rec.duration;
+                    instr.soundName = toString(rec.sound);
+                    instr.volume = rec.volume;
+                    instr.parentID = rec.parentID;
+                    instr.color = rec.color;
+                }
+                b.bullet = std::make_shared<BulletScript>();
+                b.bullet->SetInstructions(std::move(instructions));
+                break;
+            }
+            case PatternKind::Shot: {
+                std::vector<ShotOp> ops;
+                std::vector<float> speeds;
+                in.ReadVector(ops);
+                in.ReadVector(speeds);
+                for (ShotOp& op : ops) {
+                    op.name = toName(op.name);
+                    if (op.type == ShotInstruction::Type::FireMultiSpeed &&
+                        static_cast<size_t>(op.firstSpeed) + static_cast<size_t>(std::max(op.count, 0)) > speeds.size()) return false;
+                }
+                b.shot = std::make_shared<ShotProgram>();
+                b.shot->SetOps(std::move(ops), std::move(speeds));
+                break;
+            }
+            case PatternKind::Enemy: {
+                std::vector<EnemyOp> ops;
+                in.ReadVector(ops);
+                for (EnemyOp& op : ops) op.name = toName(op.name);
+                b.enemy = std::make_shared<EnemyProgram>();
+                b.enemy->SetOps(std::move(ops));
+                break;
+            }
+            default:
+                return false;
+            }
+        }
+        return !in.IsFailed();
+    }
+}
+
+bool PatternLibrary::Load(const std::string& filepath) {
+    uint64_t size = 0;
+    int64_t time = 0;
+    const bool hasSource = GetSourceStamp(filepath, size, time);
+
+    auto source = std::find_if(sources.begin(), sources.end(), [&](const SourceFile& s) { return s.path == filepath; });
+    if (source == sources.end()) source = sources.insert(sources.end(), SourceFile{ filepath });
+    source->size = size;
+    source->time = time;
+
+    const std::string cachePath = filepath + ".bin";
+    std::vector<BuiltPattern> built;
+    if (cacheEnabled && LoadCache(cachePath, hasSource, size, time, built)) {
+        Install(built);
+        return true;
+    }
+    if (!hasSource) {
+        GameEngine::Debug::ErrorLog("p^[t@C܂: {}", filepath);
+        return false;
+    }
+
+    try {
+        built = Build(PatternCompiler::Compile(System::IO::File::ReadAllText(filepath)));
+    }
+    catch (const std::exception& e) {
+        // so^ς݂̂̂c (zbg[h̏ŃQ[~߂Ȃ).
+        GameEngine::Debug::ErrorLog("{}:{}", filepath, e.what());
+        return false;
+    }
+    if (cacheEnabled) SaveCache(cachePath, size, time, built);
+    Install(built);
+    return true;
+}
+
+void PatternLibrary::PollHotReload() {
+    if (!hotReload || ++pollCounter < HotReloadInterval) return;
+    pollCounter = 0;
+
+    for (size_t i = 0; i < sources.size(); ++i) {
+        uint64_t size = 0;
+        int64_t time = 0;
+        if (!GetSourceStamp(sources[i].path, size, time)) continue;
+        if (size == sources[i].size && time == sources[i].time) continue;
+        const std::string path = sources[i].path;    // Load  sources ̂ŎʂĂ.
+        if (Load(path)) GameEngine::Debug::Log("p^[ǂݒ܂: {}", path);
+    }
+}
@@ -0,0 +1,54 @@
+/*
+    PatternLibrary.h
+
+    :class
+        - PatternLibrary
+
+    쐬         : 2026/10/19
+    ŏIύX     : 2026/10/19
+*/
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+/// <summary>
+/// p^[Lq (.pat) |󂵂 BulletScriptManager / ShotScriptManager / EnemyScriptManager ɓo^.
+/// |󌋉ʂ "<pat>.bin" Ɏsp̖ߗ̂܂ܕۑ, 񂩂͌t@CςĂȂ΂ǂ.
+/// zbg[hLɂƍXVēǂݒ, o^ԍۂ܂ܒgւ.
+/// </summary>
+class PatternLibrary {
+private:
+    static constexpr int HotReloadInterval = 30;            //  Poll  1 t@C邩.
+
+    struct SourceFile {
+        std::string path;
+        uint64_t size = 0;
+        int64_t time = 0;
+    };
+
+    std::vector<SourceFile> sources;
+    bool cacheEnabled = true;
+    bool hotReload = false;
+    int pollCounter = 0;
+
+    PatternLibrary() = default;
+public:
+    PatternLibrary(const PatternLibrary&) = delete;
+    PatternLibrary& operator=(const PatternLibrary&) = delete;
+
+    static PatternLibrary& GetInstance() {
+        static PatternLibrary instance;
+        return instance;
+    }
+
+    // ǂ߂Ȃꍇ̓G[o false (o^ς݂̂̂͂̂܂܎c).
+    bool Load(const std::string& filepath);
+
+    void SetCacheEnabled(bool enable) { cacheEnabled = enable; }
+    void SetHotReload(bool enable) { hotReload = enable; }
+
+    // t[Ă. zbg[hLȂ玞XXVmFēǂݒ.
+    void PollHotReload();
+};
@@ -0,0 +1,158 @@
+#include <DxLib.h>
+#include <cstring>
+#include <algorithm>
+#include <filesystem>
+
+#include "PcmDecoder.h"
+#include "File.hpp"
+#include "Debug.hpp"
+
+namespace GameEngine {
+
+    namespace {
+        constexpr uint16_t FormatPcm        = 1;
+        constexpr uint16_t FormatFloat      = 3;
+        constexpr uint16_t FormatExtensible = 0xFFFE;
+
+        uint16_t ReadU16(const uint8_t* p) { return static_cast<uint16_t>(p[0] | (p[1] << 8)); }
+        uint32_t ReadU32(const uint8_t* p) { return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24); }
+
+        // 1 Tv -1 ~ 1 .
+        float ToFloat(const uint8_t* p, int bits, bool isFloat) {
+            switch (bits) {
+            case 8:  return (static_cast<int>(p[0]) - 128) * (1.0f / 128.0f);
+            case 16: return static_cast<int16_t>(ReadU16(p)) * (1.0f / 32768.0f);
+            case 24: {
+                int32_t v = (p[0] << 8) | (p[1] << 16) | (static_cast<uint32_t>(p[2]) << 24);
+                return (v >> 8) * (1.0f / 8388608.0f);
+            }
+            case 32:
+                if (isFloat) {
+                    float f;
+                    std::memcpy(&f, p, sizeof(f));
+                    return f;
+                }
+                return static_cast<int32_t>(ReadU32(p)) * (1.0f / 2147483648.0f);
+            }
+            return 0.0f;
+        }
+    }
+
+    std::shared_ptr<PcmBuffer> PcmDecoder::DecodeFile(const std::string& filepath) {
+        std::string ext = std::filesystem::path(filepath).extension().string();
+        std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+        if (ext != ".wav") return DecodeWithDxLib(filepath);
+
+        std::string bytes;
+        try {
+            bytes = System::IO::File::ReadAllBytes(filepath);
+        }
+        catch (const std::exception& e) {
+            Debug::ErrorLog("PcmDecoder: {}", e.what());
+            return nullptr;
+        }
+
+        auto pcm = std::make_shared<PcmBuffer>();
+        std::string error;
+        if (!DecodeWav(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size(), *pcm, error)) {
+            Debug::ErrorLog("PcmDecoder: {} [{}]", error, filepath);
+            return nullptr;
+        }
+        pcm->path = filepath;
+        return pcm;
+    }
+
+    bool PcmDecoder::DecodeWav(const uint8_t* data, size_t size, PcmBuffer& out, std::string& error) {
+        if (size < 12 || std::memcmp(data, "RIFF", 4) != 0 || std::memcmp(data + 8, "WAVE", 4) != 0) {
+            error = "RIFF/WAVE ł͂܂";
+            return false;
+        }
+
+        uint16_t format = 0, channels = 0, bits = 0, blockAlign = 0;
+        uint32_t sampleRate = 0;
+        const uint8_t* body = nullptr;
+        size_t bodySize = 0;
+
+        // `NɌ (fmt ̑O LIST ȂǂĂt@C).
+        size_t pos = 12;
+        while (pos + 8 <= size) {
+            const uint8_t* chunk = data + pos;
+            const size_t chunkSize = ReadU32(chunk + 4);
+            const size_t available = (std::min)(chunkSize, size - pos - 8);
+            if (std::memcmp(chunk, "fmt ", 4) == 0 && available >= 16) {
+                format     = ReadU16(chunk + 8);
+                channels   = ReadU16(chunk + 10);
+                sampleRate = ReadU32(chunk + 12);
+                blockAlign = ReadU16(chunk + 20);
+                bits       = ReadU16(chunk + 22);
+                // WAVE_FORMAT_EXTENSIBLE ̓TutH[}bg GUID ̐擪 2 oCgۂ̌`.
+                if (format == FormatExtensible && available >= 26) format = ReadU16(chunk + 32);
+            }
+            else if (std::memcmp(chunk, "data", 4) == 0) {
+                body = chunk + 8;
+                bodySize = available;       // rŐ؂ꂽt@C͓ǂ߂.
+            }
+            pos += 8 + chunkSize + (chunkSize & 1);
+        }
+
+        if (!body || format == 0) {
+            error = "fmt / data `N܂";
+            return false;
+        }
+        const bool isFloat = format == FormatFloat;
+        if ((format != FormatPcm && !isFloat) || (isFloat && bits != 32) ||
+            (bits != 8 && bits != 16 && bits != 24 && bits != 32)) {
+            error = "ΉĂȂ`ł (format " + std::to_string(format) + ", " + std::to_string(bits) + "bit)";
+            return false;
+        }
+        if (channels < 1 || channels > 2 || sampleRate == 0) {
+            error = "`l / Tv[gsł";
+            return false;
+        }
+
+        const int bytesPerSample = bits / 8;
+        if (blockAlign < channels * bytesPerSample) blockAlign = static_cast<uint16_t>(channels * bytesPerSample);
+        const size_t frames = bodySize / blockAlign;
+
+        out.sampleRate = static_cast<int>(sampleRate);
+        out.channels = channels;
+        out.samples.resize(frames * channels);
+        float* dst = out.samples.data();
+        for (size_t f = 0; f < frames; ++f) {
+            const uint8_t* src = body + f * blockAlign;
+            for (int c = 0; c < channels; ++c) *dst++ = ToFloat(src + c * bytesPerSample, bits, isFloat);
+        }
+        return true;
+    }
+
+    std::shared_ptr<PcmBuffer> PcmDecoder::DecodeWithDxLib(const std::string& filepath) {
+        const int soft = LoadSoftSound(filepath.c_str());
+        if (soft == -1) {
+            Debug::ErrorLog("PcmDecoder: WJɎs܂ [{}]", filepath);
+            return nullptr;
+        }
+
+        int channels = 0, bits = 0, sampleRate = 0, isFloat = FALSE;
+        GetSoftSoundFormat(soft, &channels, &bits, &sampleRate, &isFloat);
+        const int frames = GetSoftSoundSampleNum(soft);
+        const auto* image = static_cast<const uint8_t*>(GetSoftSoundDataImage(soft));
+
+        std::shared_ptr<PcmBuffer> pcm;
+        if (image && frames > 0 && channels >= 1 && channels <= 2 && (bits == 8 || bits == 16 || bits == 32)) {
+            pcm = std::make_shared<PcmBuffer>();
+            pcm->path = filepath;
+            pcm->sampleRate = sampleRate;
+            pcm->channels = channels;
+            pcm->samples.resize(static_cast<size_t>(frames) * channels);
+            const int bytesPerSample = bits / 8;
+            for (size_t i = 0; i < pcm->samples.size(); ++i) {
+                pcm->samples[i] = ToFloat(image + i * bytesPerSample, bits, isFloat != FALSE);
+            }
+        }
+        else {
+            Debug::ErrorLog("PcmDecoder: ΉĂȂ`ł ({}ch, {}bit) [{}]", channels, bits, filepath);
+        }
+        DeleteSoftSound(soft);
+        return pcm;
+    }
+}
@@ -0,0 +1,44 @@
+/*
+    PcmDecoder.h
+
+    :class
+        - PcmBuffer
+        - PcmDecoder
+
+    쐬         : 2026/10/19
+    ŏIύX     : 2026/10/19
+*/
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+namespace GameEngine {
+
+    // fR[hς݂̉. -1 ~ 1  float `lɕׂ (1ch / 2ch).
+    struct PcmBuffer {
+        std::string path;
+        int sampleRate = 0;
+        int channels = 0;
+        std::vector<float> samples;
+
+        size_t GetFrameCount() const { return channels > 0 ? samples.size() / channels : 0; }
+        double GetDuration() const { return sampleRate > 0 ? static_cast<double>(GetFrameCount()) / sampleRate : 0.0; }
+    };
+
+    // t@C PcmBuffer ɓWJ.
+    // WAV ( 8/16/24/32bit, float 32bit) ͎Oœǂނ̂ŃwbhXłg.
+    // OGG / MP3 Ȃǂ DxLib ̃\tgTEhœWJ (DxLib ̃CXbĥ).
+    class PcmDecoder {
+    public:
+        // s̓G[o nullptr.
+        static std::shared_ptr<PcmBuffer> DecodeFile(const std::string& filepath);
+
+        //  WAV WJ. s false ƗR.
+        static bool DecodeWav(const uint8_t* data, size_t size, PcmBuffer& out, std::string& error);
+    private:
+        static std::shared_ptr<PcmBuffer> DecodeWithDxLib(const std::string& filepath);
+    };
+}
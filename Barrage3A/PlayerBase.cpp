@@ -16,6 +16,7 @@
 #include "EnemyManager.h"
 #include "MusicController.h"
 #include "AudioResourceShortcut.hpp"
+#include "SnapshotStream.h"
 
 // コンストラクタ 
 PlayerBase::PlayerBase() {}
@@ -31,11 +32,11 @@ void PlayerBase::Move() {
     if (Input.IsAnyKey(KeyCode::W, KeyCode::UpArrow)    || Input.IsPadButton<0>(PadCode::Up))   move.y =  1;
     if (Input.IsAnyKey(KeyCode::S, KeyCode::DownArrow)  || Input.IsPadButton<0>(PadCode::Down)) move.y = -1;
 
-    transform->position += move.GetNormalize() * s * Time.deltaTime;
+    transform->Translate(move.GetNormalize() * s * Time.deltaTime);
 
     if (animator) {
-        animator->SetBool("isLeft"  , move.x < 0);
-        animator->SetBool("isRight" , move.x > 0);
+        animator->SetBool(isLeftParamId , move.x < 0);
+        animator->SetBool(isRightParamId, move.x > 0);
     }
 
     // 画面外に収める.
@@ -118,7 +119,7 @@ void PlayerBase::UpdateInvincible() {
 
         float t = Mathf::Min(invincibleTimer / invincibleTime, 1.0f);
         auto& mg = GameManager::GetInstance();
-        transform->position = Vector2D::Lerp(mg.GetPlayerRespawnPos(), mg.GetPlayerStartPos(), t);
+        transform->SetPosition(Vector2D::Lerp(mg.GetPlayerRespawnPos(), mg.GetPlayerStartPos(), t));
         if (t >= 0.3) {
             BulletManager::Instance().AllDestroyLayer(Layer::EnemyBullet);
             if (t <= 0.4) {
@@ -155,7 +156,7 @@ void PlayerBase::HandleDeath() {
             ->AddAppBase<ExplosionEffect>()
             ->SetCenterPosition(transform->position);
         // プレイヤーの位置をリスポーン位置にセット
-        transform->position = GameManager::GetInstance().GetPlayerRespawnPos();
+        transform->SetPosition(GameManager::GetInstance().GetPlayerRespawnPos());
         // 無敵状態開始準備
         invincibleTimer = 0.0f;
         isRespawning = true;
@@ -170,8 +171,8 @@ void PlayerBase::HandleDeath() {
 
         // アニメーションの左右フラグリセット
         if (auto a = animator.lock()) {
-            a->SetBool("isLeft", false);
-            a->SetBool("isRight", false);
+            a->SetBool(isLeftParamId, false);
+            a->SetBool(isRightParamId, false);
         }
         GameManager::GetInstance().OnPlayerDead();
     }
@@ -187,6 +188,10 @@ void PlayerBase::Start() {
     sprite = gameObject->GetAppBase<SpriteRenderer>();
     size = sprite.lock()->GetSize();
     animator = gameObject->GetAppBase<Animator>();
+    if (auto a = animator.lock()) {
+        isLeftParamId  = a->GetParameterId("isLeft");
+        isRightParamId = a->GetParameterId("isRight");
+    }
     Initialize();
     magatama->SetMagatamaCount(prevCount);
 }
@@ -226,4 +231,26 @@ void PlayerBase::OnCollisionEnter(GameObject* other) {
         }
         OnHit();
     }
-}
\ No newline at end of file
+}
+
+void PlayerBase::SaveState(SnapshotWriter& out) const {
+    out.Write(transform->position);
+    out.Write(state);
+    out.Write(invincibleTimer);
+    out.Write(isRespawning);
+    out.Write(prevCount);
+    out.Write(mgtmCount);
+    out.Write(shotCount);
+    out.Write(lifeCount);
+}
+
+void PlayerBase::LoadState(SnapshotReader& in) {
+    transform->SetPosition(in.Read<Vector2D>());
+    in.Read(state);
+    in.Read(invincibleTimer);
+    in.Read(isRespawning);
+    in.Read(prevCount);
+    in.Read(mgtmCount);
+    in.Read(shotCount);
+    in.Read(lifeCount);
+}
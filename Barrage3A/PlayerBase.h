@@ -15,6 +15,9 @@
 #include "SpriteRenderer.h"
 #include "MagatamaController.h"
 
+class SnapshotWriter;
+class SnapshotReader;
+
 // PlayerBase class and AppBase class
 class PlayerBase : public TouhouBase {
 protected:
@@ -36,11 +39,17 @@ protected:
     int lifeCount           = 6;
 
 	System::WeakAccessor<Animator> animator;
+	int isLeftParamId  = AnimatorDef::InvalidId;   // Animator パラメータ ID (Start で解決)
+	int isRightParamId = AnimatorDef::InvalidId;
 	System::WeakAccessor<SpriteRenderer> sprite;
     std::shared_ptr<MagatamaController> magatama;
 public:
     void Awake() override;
     void Start() override;
+
+    // 位置と被弾・無敵の進行状態 (スナップショット用).
+    void SaveState(SnapshotWriter& out) const;
+    void LoadState(SnapshotReader& in);
 protected: 
     // コンストラクタ.
     PlayerBase();
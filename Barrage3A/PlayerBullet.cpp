@@ -56,7 +56,7 @@ void PlayerBullet::OnCollisionEnter(GameObject* other) {
         // スコアやサウンド
         GameManager::GetInstance().GetScoreManager().OnEnemyHit();
         if (auto music = MusicController::GetInstance()) {
-            music->OneShotAudio(Sounds["enemy_damage"]->Clone());
+            music->OneShotAudio(Sounds["enemy_damage"]);
         }
         
         if (collider) collider->SetEnabled(false);
@@ -2,32 +2,34 @@
 #include "PlayerPrefs.h"
 #include "File.hpp"
 #include "EditorUtility.hpp"
+#include "SnapshotStream.h"
 #include <windows.h>
 #include <wincrypt.h>    // SHA256p
 #include <sstream>
 #include <iomanip>
 #include <stdexcept>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
 #pragma comment(lib, "Crypt32.lib")  // ǉ
 
 using namespace System::IO;
 
 // staticϐ̏
-std::unordered_map<std::string, std::string> PlayerPrefs::prefs;
+std::unordered_map<std::string, PlayerPrefs::Value> PlayerPrefs::prefs;
+std::unordered_set<std::string> PlayerPrefs::dirtyKeys;
 #if _DEBUG
 std::string PlayerPrefs::filename = "_prefs_debug.dat";
 #else
 std::string PlayerPrefs::filename = "_prefs.dat";
 #endif
 bool PlayerPrefs::initialized   = false;
-bool PlayerPrefs::needsSave     = false; // ÍtO
-
-void PlayerPrefs::Init()
-{
-    if (!initialized) {
-        Load();
-        initialized = true;
-    }
-}
+bool PlayerPrefs::needsSave     = false;
+bool PlayerPrefs::pendingClear  = false;
+bool PlayerPrefs::needsCompact  = false;
+size_t PlayerPrefs::journalBytes = 0;
 
 // XORÍ^ij
 std::string SimpleXOREncrypt(const std::string& input, char key = 0x5A) {
@@ -177,184 +179,579 @@ std::string CalcSHA256Bin(const std::string& data) {
     return std::string(reinterpret_cast<const char*>(hash), hashSize);
 }
 
-// t@CBɐݒ肷֐isfalseԂj
-bool SetFileHiddenAttribute(const std::string& filepath) {
-    DWORD attrs = GetFileAttributesA(filepath.c_str());
-    if (attrs == INVALID_FILE_ATTRIBUTES) {
-        return false; // t@C݂Ȃ
-    }
-
-    // ̑ɉB
-    attrs |= FILE_ATTRIBUTE_HIDDEN;
-
-    return SetFileAttributesA(filepath.c_str(), attrs) != 0;
-}
+// --- ۑ` ---
+// {    : XOR( magic, version, , , R[h... ) + SHA256( 32oCg)
+// W[i: magic, version, , ȍ~ [ u32][FNV-1a u64][XOR(, ...)] ̌JԂ
+// R[h : L[, ^ԍ u8, l. W[ił͍폜ƑS폜̈g.
+namespace {
+    constexpr uint32_t SnapshotMagic = 0x32465250;     // "PRF2"
+    constexpr uint32_t JournalMagic  = 0x324A5250;     // "PRJ2"
+    constexpr uint32_t FormatVersion = 1;
+    constexpr size_t HashSize = 32;
+    constexpr size_t JournalEntryOverhead = sizeof(uint32_t) + sizeof(uint64_t);
+    constexpr size_t CompactJournalBytes = 16 * 1024;  // W[i𒴂Ŝ.
 
-// --- PlayerPrefs \bh ---
-void PlayerPrefs::Save()
-{
-    if (!needsSave) return;
-    needsSave = false;
+#ifdef _DEBUG
+    constexpr DWORD SaveFileAttributes = FILE_ATTRIBUTE_NORMAL;
+#else
+    constexpr DWORD SaveFileAttributes = FILE_ATTRIBUTE_HIDDEN;
+#endif
 
-    try {
-        std::ostringstream oss;
-        for (const auto& pair : prefs) {
-            std::string encodedValue = EscapeString(pair.second); //  GXP[vĈs
-            oss << pair.first << "=" << encodedValue << "\n";
+    enum class RecordKind : uint8_t {
+        Int = 0, Float = 1, Int64 = 2, String = 3,
+        Delete = 0x10, Clear = 0x11,
+    };
+    static_assert(std::variant_size_v<PlayerPrefs::Value> == 4 &&
+        std::is_same_v<std::variant_alternative_t<static_cast<size_t>(RecordKind::String), PlayerPrefs::Value>, std::string>,
+        "RecordKind  PlayerPrefs::Value ̕т𑵂邱.");
+
+    constexpr uint64_t FnvOffset = 1469598103934665603ull;
+    constexpr uint64_t FnvPrime = 1099511628211ull;
+
+    uint64_t Fnv1a(const uint8_t* data, size_t size) {
+        uint64_t hash = FnvOffset;
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= data[i];
+            hash *= FnvPrime;
         }
-        std::string plainData = oss.str();
+        return hash;
+    }
 
-#ifdef _DEBUG
-        // fobO͕eLXgۑ
-        File::WriteAllText(filename, plainData);
-#else
-        // Í
-        std::string encrypted = SimpleXOREncrypt(plainData);
+    struct Op {
+        RecordKind kind = RecordKind::Clear;
+        std::string key;
+        PlayerPrefs::Value value;
+    };
+
+    void WriteRecord(SnapshotWriter& out, const std::string& key, const PlayerPrefs::Value& value) {
+        out.WriteString(key);
+        out.Write(static_cast<uint8_t>(value.index()));
+        std::visit([&](const auto& v) {
+            if constexpr (std::is_same_v<std::decay_t<decltype(v)>, std::string>) out.WriteString(v);
+            else out.Write(v);
+        }, value);
+    }
 
-        // nbVvZif[^j
-        std::string hashBin = CalcSHA256Bin(plainData);
+    void WriteMarker(SnapshotWriter& out, const std::string& key, RecordKind kind) {
+        out.WriteString(key);
+        out.Write(static_cast<uint8_t>(kind));
+    }
 
-        // t@C = Íf[^ + nbV32oCg
-        std::string saveData = encrypted + hashBin;
+    bool ReadOp(SnapshotReader& in, Op& op) {
+        in.ReadString(op.key);
+        op.kind = static_cast<RecordKind>(in.Read<uint8_t>());
+        switch (op.kind) {
+        case RecordKind::Int:    op.value = in.Read<int32_t>(); break;
+        case RecordKind::Float:  op.value = in.Read<float>(); break;
+        case RecordKind::Int64:  op.value = in.Read<int64_t>(); break;
+        case RecordKind::String: {
+            std::string text;
+            in.ReadString(text);
+            op.value = std::move(text);
+            break;
+        }
+        case RecordKind::Delete:
+        case RecordKind::Clear:
+            break;
+        default:
+            return false;
+        }
+        return !in.IsFailed();
+    }
 
-        File::WriteAllBytes(filename, saveData);
+    void ApplyOp(Op& op, std::unordered_map<std::string, PlayerPrefs::Value>& prefs) {
+        switch (op.kind) {
+        case RecordKind::Delete: prefs.erase(op.key); break;
+        case RecordKind::Clear:  prefs.clear(); break;
+        default:                 prefs[op.key] = std::move(op.value); break;
+        }
+    }
 
-        SetFileHiddenAttribute(filename);
-#endif
+    std::string JournalPath(const std::string& path) {
+        return path + ".journal";
     }
-    catch (const std::exception& e) {
-        std::cerr << "PlayerPrefs::Save failed: " << e.what() << std::endl;
+
+    std::string ToString(const std::vector<uint8_t>& bytes) {
+        return std::string(bytes.begin(), bytes.end());
     }
-}
 
-void PlayerPrefs::Load()
-{
-    try {
-        if (!File::Exists(filename)) return;
+    enum class SnapshotResult { Ok, Corrupted, UnknownFormat };
 
+    SnapshotResult ParseSnapshot(const std::string& fileData,
+        std::unordered_map<std::string, PlayerPrefs::Value>& out, uint64_t& generation)
+    {
+        if (fileData.size() < HashSize + sizeof(uint32_t)) return SnapshotResult::UnknownFormat;
+
+        const std::string plainData = SimpleXOREncrypt(fileData.substr(0, fileData.size() - HashSize));
+        SnapshotReader in(reinterpret_cast<const uint8_t*>(plainData.data()), plainData.size());
+        if (in.Read<uint32_t>() != SnapshotMagic) return SnapshotResult::UnknownFormat;
+        if (fileData.compare(fileData.size() - HashSize, HashSize, CalcSHA256Bin(plainData)) != 0) return SnapshotResult::Corrupted;
+        if (in.Read<uint32_t>() != FormatVersion) return SnapshotResult::Corrupted;
+
+        generation = in.Read<uint64_t>();
+        const uint32_t count = in.Read<uint32_t>();
+        Op op;
+        for (uint32_t i = 0; i < count; ++i) {
+            if (!ReadOp(in, op) || op.kind >= RecordKind::Delete) return SnapshotResult::Corrupted;
+            ApplyOp(op, out);
+        }
+        return in.IsFailed() ? SnapshotResult::Corrupted : SnapshotResult::Ok;
+    }
+
+    // ` (key=value ̍s. [Xł XOR + SHA256, fobOł͕) 𕶎̒lƂēǂ.
+    bool ParseLegacy(const std::string& fileData, std::unordered_map<std::string, PlayerPrefs::Value>& out) {
 #ifdef _DEBUG
-        std::string content = File::ReadAllText(filename);
-        prefs.clear();
-        std::istringstream iss(content);
+        const std::string& plainData = fileData;
+#else
+        if (fileData.size() < HashSize) return false;
+        const std::string plainData = SimpleXOREncrypt(fileData.substr(0, fileData.size() - HashSize));
+        if (fileData.compare(fileData.size() - HashSize, HashSize, CalcSHA256Bin(plainData)) != 0) return false;
+#endif
+        std::istringstream iss(plainData);
         std::string line;
         while (std::getline(iss, line)) {
             size_t pos = line.find('=');
             if (pos != std::string::npos) {
-                std::string key = line.substr(0, pos);
-                std::string escapedValue = line.substr(pos + 1);
-                std::string decodedValue = UnescapeString(escapedValue);  //  GXP[v
-                prefs[key] = decodedValue;
+                out[line.substr(0, pos)] = UnescapeString(line.substr(pos + 1));
             }
         }
-#else
-        std::string fileData = File::ReadAllBytes(filename);
-        if (fileData.size() < 32) throw std::runtime_error("Prefs file size too small");
+        return true;
+    }
 
-        std::string encrypted = fileData.substr(0, fileData.size() - 32);
-        std::string savedHash = fileData.substr(fileData.size() - 32, 32);
+    // 擪珇ɓKp, ꂽ () ڂɓ炻Ŏ~߂.
+    // Ō܂œǂ߂, {̂Ɠ̂Ƃ true (̂܂ܒǋLĂ悢).
+    bool ReplayJournal(const std::string& fileData, uint64_t generation,
+        std::unordered_map<std::string, PlayerPrefs::Value>& out, size_t& journalBytes)
+    {
+        SnapshotReader in(reinterpret_cast<const uint8_t*>(fileData.data()), fileData.size());
+        const uint32_t magic = in.Read<uint32_t>();
+        const uint32_t version = in.Read<uint32_t>();
+        const uint64_t journalGeneration = in.Read<uint64_t>();
+        if (in.IsFailed() || magic != JournalMagic || version != FormatVersion || journalGeneration != generation) return false;
+
+        std::vector<Op> ops;
+        while (!in.IsEnd()) {
+            const uint32_t length = in.Read<uint32_t>();
+            const uint64_t hash = in.Read<uint64_t>();
+            if (in.IsFailed() || length > fileData.size() - in.Position()) return false;
+
+            const std::string batch = SimpleXOREncrypt(fileData.substr(in.Position(), length));
+            in.EndBlock(in.Position() + length);
+            if (Fnv1a(reinterpret_cast<const uint8_t*>(batch.data()), batch.size()) != hash) return false;
+
+            // 1  Save ͂܂Ƃ߂ēKp (r܂ł͔fȂ).
+            SnapshotReader entry(reinterpret_cast<const uint8_t*>(batch.data()), batch.size());
+            const uint32_t count = entry.Read<uint32_t>();
+            if (entry.IsFailed() || count > batch.size()) return false;
+            ops.resize(count);
+            for (Op& op : ops) {
+                if (!ReadOp(entry, op)) return false;
+            }
+            if (!entry.IsEnd()) return false;
+            for (Op& op : ops) ApplyOp(op, out);
+            journalBytes += JournalEntryOverhead + length;
+        }
+        return true;
+    }
+
+    // ݂ςނ܂ŕԂȂ (rŎ~܂Ăt@C͑O̓eVêǂ炩).
+    bool WriteAll(HANDLE file, const std::string& data) {
+        size_t written = 0;
+        while (written < data.size()) {
+            const DWORD request = static_cast<DWORD>((std::min<size_t>)(data.size() - written, 1u << 30));
+            DWORD chunk = 0;
+            if (!WriteFile(file, data.data() + written, request, &chunk, nullptr) || chunk == 0) return false;
+            written += chunk;
+        }
+        return FlushFileBuffers(file) != 0;
+    }
 
-        std::string plainData = SimpleXOREncrypt(encrypted);
-        std::string calcHash = CalcSHA256Bin(plainData);
+    std::string FrameJournalEntry(const std::vector<uint8_t>& batch) {
+        std::vector<uint8_t> header;
+        SnapshotWriter out(header);
+        out.Write(static_cast<uint32_t>(batch.size()));
+        out.Write(Fnv1a(batch.data(), batch.size()));
+        return ToString(header) + SimpleXOREncrypt(ToString(batch));
+    }
 
-        if (savedHash != calcHash) {
-            GameEditor::EditorUtility::DisplayErrorMessage("Error", "PlayerPrefs file hash mismatch! File corrupted or modified.");
-            throw std::runtime_error("Prefs file hash mismatch! File corrupted or modified.");
+    // t@Cւ݂̏󂯎Xbh. CXbh͈˗ςނő҂Ȃ.
+    class PrefsWriter {
+    public:
+        struct Job {
+            bool compact = false;
+            uint32_t recordCount = 0;
+            std::vector<uint8_t> records;   // compact ̂Ƃ̑SR[h.
+            std::vector<uint8_t> batch;     // W[i 1 . Ŝ̏ɎsƂǋL.
+        };
+    private:
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable wakeCv;
+        std::condition_variable idleCv;
+        std::deque<Job> jobs;
+        bool quit = false;
+        bool busy = false;
+
+        // ---- ݃Xbh.
+        std::string path;
+        uint64_t generation = 0;
+        bool resetJournal = false;      // ̒ǋLŊ̃W[îĂ.
+
+        void Run();
+        bool WriteSnapshot(const Job& job);
+        bool AppendJournal(const std::string& entries);
+    public:
+        ~PrefsWriter() { Stop(); }
+
+        // ĂΏݐƐゾւ (ĂԑO WaitIdle Ă).
+        void Start(const std::string& file, uint64_t fileGeneration, bool discardJournal) {
+            {
+                std::lock_guard lock(mutex);
+                path = file;
+                generation = fileGeneration;
+                resetJournal = discardJournal;
+                quit = false;
+            }
+            if (!thread.joinable()) thread = std::thread(&PrefsWriter::Run, this);
         }
 
-        prefs.clear();
-        std::istringstream iss(plainData);
-        std::string line;
-        while (std::getline(iss, line)) {
-            size_t pos = line.find('=');
-            if (pos != std::string::npos) {
-                std::string key = line.substr(0, pos);
-                std::string escapedValue = line.substr(pos + 1);
-                std::string decodedValue = UnescapeString(escapedValue);  //  GXP[v
-                prefs[key] = decodedValue;
+        void Push(Job job) {
+            {
+                std::lock_guard lock(mutex);
+                jobs.push_back(std::move(job));
             }
+            wakeCv.notify_one();
+        }
+
+        void WaitIdle() {
+            std::unique_lock lock(mutex);
+            idleCv.wait(lock, [this] { return jobs.empty() && !busy; });
+        }
+
+        // ς܂Ă镪IĂ~܂.
+        void Stop() {
+            {
+                std::lock_guard lock(mutex);
+                quit = true;
+            }
+            wakeCv.notify_all();
+            if (thread.joinable()) thread.join();
+        }
+    };
+
+    void PrefsWriter::Run() {
+        std::deque<Job> pending;
+        for (;;) {
+            {
+                std::unique_lock lock(mutex);
+                busy = false;
+                idleCv.notify_all();
+                wakeCv.wait(lock, [this] { return quit || !jobs.empty(); });
+                if (jobs.empty()) return;
+                pending.swap(jobs);
+                busy = true;
+            }
+
+            // ėǋL͂܂Ƃ߂ 1 ŏ.
+            std::string entries;
+            for (const Job& job : pending) {
+                if (!job.compact) {
+                    entries += FrameJournalEntry(job.batch);
+                    continue;
+                }
+                if (!entries.empty()) {
+                    AppendJournal(entries);
+                    entries.clear();
+                }
+                if (!WriteSnapshot(job)) AppendJournal(FrameJournalEntry(job.batch));
+            }
+            if (!entries.empty()) AppendJournal(entries);
+            pending.clear();
+        }
+    }
+
+    bool PrefsWriter::WriteSnapshot(const Job& job) {
+        std::vector<uint8_t> plain;
+        SnapshotWriter out(plain);
+        out.Write(SnapshotMagic);
+        out.Write(FormatVersion);
+        out.Write(generation + 1);
+        out.Write(job.recordCount);
+        out.WriteBytes(job.records.data(), job.records.size());
+
+        std::string saveData;
+        try {
+            const std::string plainData = ToString(plain);
+            saveData = SimpleXOREncrypt(plainData) + CalcSHA256Bin(plainData);
+        }
+        catch (const std::exception& e) {
+            std::cerr << "PlayerPrefs::Save failed: " << e.what() << std::endl;
+            return false;
+        }
+
+        // ꎞt@Cɏ؂Ăû, rŗẴt@Cc.
+        const std::string temp = path + ".tmp";
+        HANDLE file = CreateFileA(temp.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, SaveFileAttributes, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            std::cerr << "PlayerPrefs::Save failed: cannot create " << temp << std::endl;
+            return false;
+        }
+        const bool written = WriteAll(file, saveData);
+        CloseHandle(file);
+        if (!written || !MoveFileExA(temp.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+            std::cerr << "PlayerPrefs::Save failed: cannot replace " << path << " (" << GetLastError() << ")" << std::endl;
+            DeleteFileA(temp.c_str());
+            return false;
+        }
+
+        // ẪW[i͓ǂݍݎɂ邪, ȂƂ̂ߎ̒ǋLō蒼.
+        ++generation;
+        resetJournal = true;
+        DeleteFileA(JournalPath(path).c_str());
+        return true;
+    }
+
+    bool PrefsWriter::AppendJournal(const std::string& entries) {
+        const std::string journal = JournalPath(path);
+        HANDLE file = CreateFileA(journal.c_str(), GENERIC_WRITE, 0, nullptr,
+            resetJournal ? CREATE_ALWAYS : OPEN_ALWAYS, SaveFileAttributes, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            std::cerr << "PlayerPrefs::Save failed: cannot open " << journal << std::endl;
+            return false;
+        }
+
+        std::string data;
+        LARGE_INTEGER end{};
+        if (!SetFilePointerEx(file, LARGE_INTEGER{}, &end, FILE_END)) end.QuadPart = -1;
+        if (end.QuadPart == 0) {
+            // VW[i͖{̂Ɠ擪ɏ.
+            std::vector<uint8_t> header;
+            SnapshotWriter out(header);
+            out.Write(JournalMagic);
+            out.Write(FormatVersion);
+            out.Write(generation);
+            data = ToString(header);
+        }
+        data += entries;
+
+        const bool ok = end.QuadPart >= 0 && WriteAll(file, data);
+        CloseHandle(file);
+        if (!ok) {
+            std::cerr << "PlayerPrefs::Save failed: cannot append " << journal << std::endl;
+            return false;
+        }
+        resetJournal = false;
+        return true;
+    }
+
+    PrefsWriter& Writer() {
+        static PrefsWriter writer;
+        return writer;
+    }
+}
+
+// --- PlayerPrefs \bh ---
+void PlayerPrefs::Init()
+{
+    if (!initialized) {
+        Load();
+        initialized = true;
+    }
+}
+
+void PlayerPrefs::Save()
+{
+    if (!needsSave) return;
+    needsSave = false;
+
+    // ςL[ 1 ̃W[iɂ. S폜͐擪ɒu.
+    PrefsWriter::Job job;
+    SnapshotWriter batch(job.batch);
+    batch.Write(static_cast<uint32_t>(dirtyKeys.size() + (pendingClear ? 1 : 0)));
+    if (pendingClear) WriteMarker(batch, "", RecordKind::Clear);
+    for (const auto& key : dirtyKeys) {
+        auto it = prefs.find(key);
+        if (it != prefs.end()) WriteRecord(batch, it->first, it->second);
+        else WriteMarker(batch, key, RecordKind::Delete);
+    }
+    dirtyKeys.clear();
+    pendingClear = false;
+
+    journalBytes += JournalEntryOverhead + job.batch.size();
+    if (needsCompact || journalBytes > CompactJournalBytes) {
+        job.compact = true;
+        job.recordCount = static_cast<uint32_t>(prefs.size());
+        SnapshotWriter records(job.records);
+        for (const auto& [key, value] : prefs) WriteRecord(records, key, value);
+        needsCompact = false;
+        journalBytes = 0;
+    }
+
+    Writer().Push(std::move(job));
+}
+
+void PlayerPrefs::Flush()
+{
+    Writer().WaitIdle();
+}
+
+void PlayerPrefs::Load()
+{
+    // ΏIĂǂ.
+    Writer().WaitIdle();
+
+    prefs.clear();
+    dirtyKeys.clear();
+    needsSave = false;
+    pendingClear = false;
+    needsCompact = false;
+    journalBytes = 0;
+
+    uint64_t generation = 0;
+    bool journalUsable = true;
+    try {
+        if (File::Exists(filename)) {
+            const std::string fileData = File::ReadAllBytes(filename);
+            SnapshotResult result = ParseSnapshot(fileData, prefs, generation);
+            if (result == SnapshotResult::UnknownFormat) {
+                // `Ȃǂݍ,  Save ŐV`ɏ.
+                result = ParseLegacy(fileData, prefs) ? SnapshotResult::Ok : SnapshotResult::Corrupted;
+                journalUsable = false;
+            }
+            if (result == SnapshotResult::Corrupted) {
+                GameEditor::EditorUtility::DisplayErrorMessage("Error", "PlayerPrefs file hash mismatch! File corrupted or modified.");
+                throw std::runtime_error("Prefs file hash mismatch! File corrupted or modified.");
+            }
+        }
+
+        const std::string journal = JournalPath(filename);
+        if (File::Exists(journal) && !ReplayJournal(File::ReadAllBytes(journal), generation, prefs, journalBytes)) {
+            std::cerr << "PlayerPrefs::Load: journal was truncated or stale, it will be rewritten" << std::endl;
+            journalUsable = false;
         }
-#endif
     }
     catch (const std::exception& e) {
         std::cerr << "PlayerPrefs::Load failed: " << e.what() << std::endl;
         prefs.clear();
+        generation = 0;
+        journalUsable = false;
+    }
+
+    if (!journalUsable) {
+        // ̃W[iɂ͒ǋLłȂ̂,  Save őŜ.
+        // ɎsĒǋLɉƂSc悤, S폜 + SL[ɂĂ.
+        needsCompact = true;
+        pendingClear = true;
+        for (const auto& pair : prefs) dirtyKeys.insert(pair.first);
     }
+    Writer().Start(filename, generation, !journalUsable);
 }
 
-void PlayerPrefs::SetInt(const std::string& key, int value)
+void PlayerPrefs::SetValue(const std::string& key, Value value)
 {
     Init();
-    prefs[key] = std::to_string(value);
+    auto it = prefs.find(key);
+    if (it != prefs.end() && it->second == value) return;
+    prefs[key] = std::move(value);
+    dirtyKeys.insert(key);
     needsSave = true;
 }
 
-void PlayerPrefs::SetFloat(const std::string& key, float value)
+const PlayerPrefs::Value* PlayerPrefs::FindValue(const std::string& key)
 {
     Init();
-    prefs[key] = std::to_string(value);
-    needsSave = true;
+    auto it = prefs.find(key);
+    return it != prefs.end() ? &it->second : nullptr;
+}
+
+void PlayerPrefs::SetInt(const std::string& key, int value)
+{
+    SetValue(key, static_cast<int32_t>(value));
+}
+
+void PlayerPrefs::SetInt64(const std::string& key, int64_t value)
+{
+    SetValue(key, value);
+}
+
+void PlayerPrefs::SetFloat(const std::string& key, float value)
+{
+    SetValue(key, value);
 }
 
 void PlayerPrefs::SetString(const std::string& key, const std::string& value)
 {
-    Init();
-    prefs[key] = value;
-    needsSave = true;
+    SetValue(key, value);
 }
 
+// `ڂl͕œĂ̂, l̎擾͕񂩂ϊ.
 int PlayerPrefs::GetInt(const std::string& key, int defaultValue)
 {
-    Init();
-    if (prefs.find(key) != prefs.end()) {
-        try {
-            return std::stoi(prefs[key]);
-        }
-        catch (...) {
-            return defaultValue;
-        }
+    const Value* value = FindValue(key);
+    if (!value) return defaultValue;
+    if (auto v = std::get_if<int32_t>(value)) return *v;
+    if (auto v = std::get_if<int64_t>(value)) return static_cast<int>(*v);
+    if (auto v = std::get_if<float>(value)) return static_cast<int>(*v);
+    try {
+        return std::stoi(std::get<std::string>(*value));
+    }
+    catch (...) {
+        return defaultValue;
+    }
+}
+
+int64_t PlayerPrefs::GetInt64(const std::string& key, int64_t defaultValue)
+{
+    const Value* value = FindValue(key);
+    if (!value) return defaultValue;
+    if (auto v = std::get_if<int64_t>(value)) return *v;
+    if (auto v = std::get_if<int32_t>(value)) return *v;
+    if (auto v = std::get_if<float>(value)) return static_cast<int64_t>(*v);
+    try {
+        return std::stoll(std::get<std::string>(*value));
+    }
+    catch (...) {
+        return defaultValue;
     }
-    return defaultValue;
 }
 
 float PlayerPrefs::GetFloat(const std::string& key, float defaultValue)
 {
-    Init();
-    if (prefs.find(key) != prefs.end()) {
-        try {
-            return std::stof(prefs[key]);
-        }
-        catch (...) {
-            return defaultValue;
-        }
+    const Value* value = FindValue(key);
+    if (!value) return defaultValue;
+    if (auto v = std::get_if<float>(value)) return *v;
+    if (auto v = std::get_if<int32_t>(value)) return static_cast<float>(*v);
+    if (auto v = std::get_if<int64_t>(value)) return static_cast<float>(*v);
+    try {
+        return std::stof(std::get<std::string>(*value));
+    }
+    catch (...) {
+        return defaultValue;
     }
-    return defaultValue;
 }
 
 std::string PlayerPrefs::GetString(const std::string& key, const std::string& defaultValue)
 {
-    Init();
-    auto it = prefs.find(key);
-    if (it != prefs.end()) {
-        try {
-            return it->second; // 擾ɃfR[h
-        }
-        catch (...) {
-            return defaultValue;
-        }
-    }
-    return defaultValue;
+    const Value* value = FindValue(key);
+    if (!value) return defaultValue;
+    if (auto v = std::get_if<std::string>(value)) return *v;
+    return std::visit([](const auto& v) -> std::string {
+        if constexpr (std::is_same_v<std::decay_t<decltype(v)>, std::string>) return v;
+        else return std::to_string(v);
+    }, *value);
 }
 
 bool PlayerPrefs::HasKey(const std::string& key)
 {
-    Init();
-    return prefs.find(key) != prefs.end();
+    return FindValue(key) != nullptr;
 }
 
 void PlayerPrefs::DeleteAll()
 {
     Init();
     prefs.clear();
+    dirtyKeys.clear();
+    pendingClear = true;
     needsSave = true;
     //Save();
 }
@@ -362,7 +759,8 @@ void PlayerPrefs::DeleteAll()
 void PlayerPrefs::DeleteKey(const std::string& key)
 {
     Init();
-    prefs.erase(key);
+    if (prefs.erase(key) == 0) return;
+    dirtyKeys.insert(key);
     needsSave = true;
     //Save();
 }
@@ -4,35 +4,56 @@
 */
 
 #include <string>
+#include <variant>
+#include <cstdint>
 #include <unordered_map>
+#include <unordered_set>
 
 /// <summary>
 /// f[^ۑ.
+/// l͌^tŎ, ۑ͕ύXݗpXbhɃW[iƂĒǋL.
+/// W[i傫ȂŜꎞt@CɏĒu (rŗĂȌԂc).
 /// </summary>
 class PlayerPrefs {
+public:
+    // т͕ۑ`̌^ԍƈv.
+    using Value = std::variant<int32_t, float, int64_t, std::string>;
+
 private:
-    static std::unordered_map<std::string, std::string> prefs;
+    static std::unordered_map<std::string, Value> prefs;
+    static std::unordered_set<std::string> dirtyKeys;  // O Save ȍ~ɕςL[.
     static std::string filename;
     static bool initialized;
     static bool needsSave;
+    static bool pendingClear;       // DeleteAll  Save ŋL^.
+    static bool needsCompact;       //  Save ̓W[iłȂŜ.
+    static size_t journalBytes;     // W[iɐς񂾗 (݈˗x[X).
+
+    static void SetValue(const std::string& key, Value value);
+    static const Value* FindValue(const std::string& key);
 
 public:
     // iLoadŌĂԁj
     static void Init();
 
-    // f[^ۑ
+    // f[^ۑ (݂͕ʃXbhōs, ł͑҂Ȃ)
     static void Save();
 
+    // ˗ς݂݂̏I܂ő҂
+    static void Flush();
+
     // f[^ǂݍ
     static void Load();
 
     // f[^Zbg
     static void SetInt(const std::string& key, int value);
+    static void SetInt64(const std::string& key, int64_t value);
     static void SetFloat(const std::string& key, float value);
     static void SetString(const std::string& key, const std::string& value);
 
-    // f[^擾
+    // f[^擾 (ۑƈႤ^Ŏoꍇ͕ϊ)
     static int GetInt(const std::string& key, int defaultValue = 0);
+    static int64_t GetInt64(const std::string& key, int64_t defaultValue = 0);
     static float GetFloat(const std::string& key, float defaultValue = 0.0f);
     static std::string GetString(const std::string& key, const std::string& defaultValue = "");
 
@@ -1,4 +1,5 @@
 #include "PowerManager.h"
+#include "SnapshotStream.h"
 #include <algorithm>
 
 void PowerManager::Add(float value) {
@@ -37,3 +38,11 @@ void PowerManager::Reset() {
 void PowerManager::SetPower(float pp) {
     power = pp;
 }
+
+void PowerManager::SaveState(SnapshotWriter& out) const {
+    out.Write(power);
+}
+
+void PowerManager::LoadState(SnapshotReader& in) {
+    in.Read(power);
+}
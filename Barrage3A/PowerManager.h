@@ -1,5 +1,8 @@
 #pragma once
 
+class SnapshotWriter;
+class SnapshotReader;
+
 class PowerManager {
 private:
     float power = 0.0f;
@@ -14,4 +17,8 @@ public:
     float GetMaxPower() const;
     void Reset();
     void SetPower(float pp);
+
+    // Ԃ̕ۑE.
+    void SaveState(SnapshotWriter& out) const;
+    void LoadState(SnapshotReader& in);
 };
\ No newline at end of file
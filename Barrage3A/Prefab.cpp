@@ -44,9 +44,9 @@ std::vector<std::shared_ptr<GameObject>> Prefab::Instantiate() {
     auto newObj = std::make_shared<GameObject>();
     newObj->transform = std::make_shared<Transform2D>(newObj);
     // W.
-    newObj->transform->position     = pos;
-    newObj->transform->scale        = size;
-    newObj->transform->rotation     = rot;
+    newObj->transform->SetPosition(pos);
+    newObj->transform->SetScale(size);
+    newObj->transform->SetRotation(rot);
 
     // vnu GameObject ɐVIuWFNg\
     newObj->SetName(name);
@@ -2,6 +2,7 @@
 #include "headers.h"
 #include "Layer.h"
 #include "GameObjectMgr.h"
+#include "Metrics.h"
 #include <string>
 #include <typeinfo>
 
@@ -133,6 +134,7 @@ public:
 
     // vnuVIuWFNg𐶐郁\bh(o^).
     std::vector<std::shared_ptr<GameObject>> Instantiate(const std::string& name) {
+        ALLOCATION_SCOPE("PrefabManager::Instantiate");
         auto prefab = GetPrefab(name);
         auto obj = prefab ? prefab->Instantiate() : std::vector<std::shared_ptr<GameObject>>{};
     
@@ -0,0 +1,215 @@
+#include "Project.h"
+#include "Profiler.h"
+#include "File.hpp"
+#include "Debug.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+
+namespace {
+    constexpr float NsToMs = 1.0f / 1000000.0f;
+
+    size_t PercentileIndex(size_t count, float p) {
+        const size_t index = static_cast<size_t>(p * static_cast<float>(count - 1) + 0.5f);
+        return std::min(index, count - 1);
+    }
+}
+
+// ---- Xbh --------------------------------------------------------------
+
+ProfileThreadBuffer* Profiler::RegisterThread() {
+    std::lock_guard<std::mutex> lock(threadMutex);
+    auto buffer = std::make_unique<ProfileThreadBuffer>();
+    buffer->threadId = static_cast<uint32_t>(threads.size());
+    threads.push_back(std::move(buffer));
+    // IXbh̕c邪,  JobSystem ̃[J[x.
+    return threads.back().get();
+}
+
+// ---- t[ --------------------------------------------------------------
+
+void Profiler::BeginFrame() {
+    if (!enabled) return;
+    GetThreadBuffer();          // CXbhɓo^ (threadId = 0).
+    frameBegin = Now();
+}
+
+void Profiler::EndFrame() {
+    if (!enabled) return;
+    const int64_t frameEnd = Now();
+    const bool capture = captureFramesLeft > 0;
+
+    frameTotals.fill(0);
+    frameTotals[static_cast<size_t>(ProfileZone::Frame)] = frameEnd - frameBegin;
+    if (capture) trace.push_back({ frameBegin, frameEnd, ProfileZone::Frame, 0 });
+
+    // eXbh̍t[̋L^W߂ (Xbh̓Ԃ͑킹).
+    {
+        std::lock_guard<std::mutex> lock(threadMutex);
+        for (auto& buffer : threads) {
+            const uint32_t n = buffer->count.load(std::memory_order_acquire);
+            for (uint32_t i = 0; i < n; ++i) {
+                const ProfileEvent& e = buffer->events[i];
+                frameTotals[static_cast<size_t>(e.zone)] += e.end - e.begin;
+                if (capture) trace.push_back({ e.begin, e.end, e.zone, buffer->threadId });
+            }
+            buffer->count.store(0, std::memory_order_release);
+        }
+    }
+
+    for (size_t z = 0; z < ZoneCount; ++z) {
+        history[z][historyHead] = static_cast<float>(frameTotals[z]) * NsToMs;
+    }
+    historyHead = (historyHead + 1) % HistorySize;
+    if (historyCount < HistorySize) ++historyCount;
+
+    if (++framesSinceStats >= statsInterval) {
+        framesSinceStats = 0;
+        UpdateStats();
+    }
+    if (capture && --captureFramesLeft == 0 && !capturePath.empty()) {
+        if (ExportChromeTrace(capturePath)) {
+            GameEngine::Debug::Log("g[Xo܂: {} ({:d} Cxg)", capturePath, trace.size());
+        }
+        capturePath.clear();
+    }
+}
+
+ProfileZoneStats Profiler::ComputeStats(std::vector<float>& samples) {
+    ProfileZoneStats s;
+    if (samples.empty()) return s;
+    std::sort(samples.begin(), samples.end());
+
+    double sum = 0.0;
+    for (float v : samples) sum += v;
+
+    const size_t n = samples.size();
+    s.average = static_cast<float>(sum / static_cast<double>(n));
+    s.p50 = samples[PercentileIndex(n, 0.50f)];
+    s.p95 = samples[PercentileIndex(n, 0.95f)];
+    s.p99 = samples[PercentileIndex(n, 0.99f)];
+    s.max = samples.back();
+    return s;
+}
+
+void Profiler::UpdateStats() {
+    if (historyCount == 0) return;
+    scratch.resize(historyCount);
+    for (size_t z = 0; z < ZoneCount; ++z) {
+        std::copy_n(history[z].begin(), historyCount, scratch.begin());
+        stats[z] = ComputeStats(scratch);
+    }
+}
+
+float Profiler::GetLastFrameMs(ProfileZone zone) const {
+    if (historyCount == 0) return 0.0f;
+    const size_t last = (historyHead + HistorySize - 1) % HistorySize;
+    return history[static_cast<size_t>(zone)][last];
+}
+
+uint32_t Profiler::GetDroppedEvents() const {
+    std::lock_guard<std::mutex> lock(threadMutex);
+    uint32_t total = 0;
+    for (const auto& buffer : threads) total += buffer->dropped;
+    return total;
+}
+
+// ---- Chrome g[X ------------------------------------------------------
+// {"traceEvents":[{"name","ph":"X","pid","tid","ts"(us),"dur"(us)}, ...]}
+
+void Profiler::StartCapture(uint32_t frames, const std::string& exportPath) {
+    trace.clear();
+    trace.reserve(static_cast<size_t>(frames) * 32);
+    captureFramesLeft = frames;
+    captureOrigin = Now();
+    capturePath = exportPath;
+}
+
+bool Profiler::StartFromCommandLine(const std::string& commandLine) {
+    std::istringstream iss(commandLine);
+    std::vector<std::string> args;
+    for (std::string arg; iss >> arg;) args.push_back(arg);
+
+    for (size_t i = 0; i < args.size(); ++i) {
+        if (args[i] != "-trace") continue;
+        //  '-' Ŏn܂Ȃ̂lƂĎ (-trace -bench ̂悤ȕтɑΉ).
+        const auto isValue = [&](size_t j) { return j < args.size() && !args[j].empty() && args[j][0] != '-'; };
+        const std::string output = isValue(i + 1) ? args[i + 1] : "trace.json";
+        uint32_t frames = 300;
+        if (isValue(i + 1) && isValue(i + 2)) {
+            try { frames = static_cast<uint32_t>(std::stoul(args[i + 2])); }
+            catch (const std::exception&) {}
+        }
+        enabled = true;
+        StartCapture(frames > 0 ? frames : 1, output);
+        return true;
+    }
+    return false;
+}
+
+bool Profiler::ExportChromeTrace(const std::string& path) const {
+    if (trace.empty()) return false;
+
+    std::string out;
+    out.reserve(trace.size() * 96 + 256);
+    out += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    char line[256];
+    uint32_t maxThread = 0;
+    for (const auto& e : trace) maxThread = std::max(maxThread, e.threadId);
+    for (uint32_t tid = 0; tid <= maxThread; ++tid) {
+        if (tid == 0) {
+            std::snprintf(line, sizeof(line),
+                "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"Main\"}},\n");
+        }
+        else {
+            std::snprintf(line, sizeof(line),
+                "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"Worker %u\"}},\n", tid, tid);
+        }
+        out += line;
+    }
+
+    for (const auto& e : trace) {
+        const double ts  = static_cast<double>(e.begin - captureOrigin) / 1000.0;
+        const double dur = static_cast<double>(e.end - e.begin) / 1000.0;
+        std::snprintf(line, sizeof(line),
+            "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f},\n",
+            ProfileZoneNames[static_cast<size_t>(e.zone)], e.threadId, ts, dur);
+        out += line;
+    }
+    out.resize(out.size() - 2);     //  ",\n"
+    out += "\n]}\n";
+
+    try {
+        System::IO::File::WriteAllText(path, out);
+    }
+    catch (const std::exception& e) {
+        GameEngine::Debug::ErrorLog("Profiler trace export failed: {}", e.what());
+        return false;
+    }
+    return true;
+}
+
+// ---- I[o[C ----------------------------------------------------------
+
+void Profiler::DrawOverlay(int x, int y) const {
+    if (!overlayVisible) return;
+
+    constexpr int LineHeight = 16;
+    constexpr int Width = 420;
+    const int height = static_cast<int>(ZoneCount + 1) * LineHeight + 8;
+    const unsigned int white = GetColor(255, 255, 255);
+
+    SetDrawBlendMode(DX_BLENDMODE_ALPHA, 160);
+    DrawBox(x, y, x + Width, y + height, GetColor(0, 0, 0), TRUE);
+    SetDrawBlendMode(DX_BLENDMODE_NOBLEND, 0);
+
+    int lineY = y + 4;
+    DrawFormatString(x + 4, lineY, white, "%-16s %7s %7s %7s %7s %7s (ms)", "zone", "avg", "p50", "p95", "p99", "max");
+    for (size_t z = 0; z < ZoneCount; ++z) {
+        lineY += LineHeight;
+        const ProfileZoneStats& s = stats[z];
+        DrawFormatString(x + 4, lineY, white, "%-16s %7.2f %7.2f %7.2f %7.2f %7.2f",
+            ProfileZoneNames[z], s.average, s.p50, s.p95, s.p99, s.max);
+    }
+}
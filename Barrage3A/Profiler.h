@@ -0,0 +1,216 @@
+/*
+    Profiler.h
+
+    :class
+        - ProfileScope
+        - Profiler
+
+    쐬         : 2026/10/19
+    ŏIύX     : 2026/10/19
+*/
+#pragma once
+
+#include <vector>
+#include <array>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include <iterator>
+
+// 0 ɂƌvR[hƏ (PROFILE_SCOPE ͋ɂȂ).
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 1
+#endif
+
+// v. O ProfileZoneNames Ɠɕׂ邱.
+enum class ProfileZone : uint16_t {
+    Frame,
+    FixedUpdate,
+    CheckCollisions,
+    ProcessInput,
+    Coroutine,
+    UpdateGameLogic,
+    Particles,
+    LateUpdate,
+    Render,
+    DestroyQueue,
+    Count
+};
+
+inline constexpr const char* ProfileZoneNames[] = {
+    "Frame",
+    "FixedUpdate",
+    "CheckCollisions",
+    "ProcessInput",
+    "Coroutine",
+    "UpdateGameLogic",
+    "Particles",
+    "LateUpdate",
+    "Render",
+    "DestroyQueue",
+};
+static_assert(std::size(ProfileZoneNames) == static_cast<size_t>(ProfileZone::Count), "ProfileZoneNames ̐Ȃ.");
+
+struct ProfileEvent {
+    int64_t begin;      // ns (steady_clock)
+    int64_t end;
+    ProfileZone zone;
+};
+
+// XbhƂ̋L^. ނ͎̂̃Xbĥ݂, ǂݏo Profiler::EndFrame (CXbh).
+// [J[̋L^ JobSystem::ParallelFor ߂_ŏIĂ̂, count 𓯊Ɏg.
+struct ProfileThreadBuffer {
+    static constexpr uint32_t Capacity = 4096;
+    std::array<ProfileEvent, Capacity> events;
+    std::atomic<uint32_t> count{ 0 };
+    uint32_t dropped = 0;               // eʕsŎ̂Ă (ݑ̂ݍXV).
+    uint32_t threadId = 0;              // o^ (0 CXbh).
+
+    void Push(const ProfileEvent& e) {
+        const uint32_t n = count.load(std::memory_order_relaxed);
+        if (n >= Capacity) {
+            ++dropped;
+            return;
+        }
+        events[n] = e;
+        count.store(n + 1, std::memory_order_release);
+    }
+};
+
+// ԂƂ̏Wv (ms).
+struct ProfileZoneStats {
+    float average = 0.0f;
+    float p50 = 0.0f;
+    float p95 = 0.0f;
+    float p99 = 0.0f;
+    float max = 0.0f;
+};
+
+/// <summary>
+/// t[Pʂ̌yʃvt@C (Release łL).
+/// PROFILE_SCOPE(ProfileZone::X) ŋԂv, XbhƂ̃obt@ɃbNȂŐς.
+/// t[̏IɋԂƂ̍v𗚗֑, p[Z^CI[o[C\.
+/// StartCapture ̃Cxg Chrome ̃g[X` (chrome://tracing, Perfetto) ŏo.
+/// </summary>
+class Profiler {
+public:
+    static constexpr size_t ZoneCount = static_cast<size_t>(ProfileZone::Count);
+    static constexpr size_t HistorySize = 240;      // WvɎgt[.
+
+    struct TraceEvent {
+        int64_t begin;
+        int64_t end;
+        ProfileZone zone;
+        uint32_t threadId;
+    };
+private:
+    bool enabled = true;
+    bool overlayVisible = false;
+
+    // Xbh̓o^ (̌v̂݃bN).
+    mutable std::mutex threadMutex;
+    std::vector<std::unique_ptr<ProfileThreadBuffer>> threads;
+
+    int64_t frameBegin = 0;
+    std::array<int64_t, ZoneCount> frameTotals{};   // t[̋ԂƂ̍v (ns).
+
+    //  (ms) Ƃ̏Wv.
+    std::array<std::array<float, HistorySize>, ZoneCount> history{};
+    size_t historyHead = 0;
+    size_t historyCount = 0;
+    std::array<ProfileZoneStats, ZoneCount> stats{};
+    uint32_t statsInterval = 30;                    // WvԊu (t[).
+    uint32_t framesSinceStats = 0;
+    std::vector<float> scratch;
+
+    // g[X̎荞.
+    std::vector<TraceEvent> trace;
+    uint32_t captureFramesLeft = 0;
+    int64_t captureOrigin = 0;
+    std::string capturePath;                        // 荞݂̏Iɏo (Ȃ珑oȂ).
+
+    Profiler() = default;
+    ~Profiler() = default;
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    ProfileThreadBuffer* RegisterThread();
+    void UpdateStats();
+public:
+    static Profiler& GetInstance() {
+        static Profiler instance;
+        return instance;
+    }
+
+    static int64_t Now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // ĂяoXbh̋L^.
+    ProfileThreadBuffer* GetThreadBuffer() {
+        thread_local ProfileThreadBuffer* buffer = nullptr;
+        if (!buffer) buffer = RegisterThread();
+        return buffer;
+    }
+
+    // Engine::Run ̃t[̐擪ƖŌĂ.
+    void BeginFrame();
+    void EndFrame();
+
+    // ȍ~ frames t[̃Cxg荞 (̎荞݂͎̂Ă).
+    // exportPath nƎ荞݂̏Iɂ Chrome g[Xo.
+    void StartCapture(uint32_t frames, const std::string& exportPath = "");
+    bool IsCapturing() const { return captureFramesLeft > 0; }
+    // 荞񂾃Cxg Chrome ̃g[X` (JSON) ŏo.
+    bool ExportChromeTrace(const std::string& path) const;
+    // N -trace [o.json] [t[] ŋNォ荞.  true.
+    bool StartFromCommandLine(const std::string& commandLine);
+
+    // ԂƂ̏Wvt[ɕ\. Engine::DrawScreen ̍ŌɌĂ.
+    void DrawOverlay(int x = 8, int y = 8) const;
+
+    void SetEnabled(bool enable) { enabled = enable; }
+    bool IsEnabled() const { return enabled; }
+    void SetOverlayVisible(bool visible) { overlayVisible = visible; }
+    bool IsOverlayVisible() const { return overlayVisible; }
+    void SetStatsInterval(uint32_t frames) { statsInterval = frames > 0 ? frames : 1; }
+
+    const ProfileZoneStats& GetStats(ProfileZone zone) const { return stats[static_cast<size_t>(zone)]; }
+    // Cӂ̃Tv (ms) ̏Wv. samples ͕ёւ.
+    static ProfileZoneStats ComputeStats(std::vector<float>& samples);
+    // Õt[̋Ԃ̍v (ms).
+    float GetLastFrameMs(ProfileZone zone) const;
+    uint32_t GetDroppedEvents() const;
+};
+
+// Ԃ̌v (XR[v̏I܂).
+class ProfileScope {
+private:
+    ProfileThreadBuffer* buffer = nullptr;
+    int64_t begin = 0;
+    ProfileZone zone;
+public:
+    explicit ProfileScope(ProfileZone _zone) : zone(_zone) {
+        Profiler& profiler = Profiler::GetInstance();
+        if (!profiler.IsEnabled()) return;
+        buffer = profiler.GetThreadBuffer();
+        begin = Profiler::Now();
+    }
+    ~ProfileScope() {
+        if (buffer) buffer->Push({ begin, Profiler::Now(), zone });
+    }
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+};
+
+#if PROFILER_ENABLED
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(zone) ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(zone)
+#else
+#define PROFILE_SCOPE(zone) ((void)0)
+#endif
@@ -37,9 +37,9 @@ public:
 
         // XP[ depth ɉĕ␳
         float scale = baseScale * depth;
-        transform->scale = { scale, scale };
+        transform->SetScale({ scale, scale });
         
-        transform->position.y -= 1;
+        transform->Translate(Vector2D(0, -1));
     }
 
     std::shared_ptr<AppBase> Clone() const override {
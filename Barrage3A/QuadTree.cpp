@@ -30,57 +30,60 @@ void QuadTree::Split() {
     nodes[3] = std::make_unique<QuadTree>(MyRectangle(x + subWidth, y + subHeight, subWidth, subHeight), maxObjects, maxLevels, level + 1);
 }
 
-void QuadTree::Insert(std::shared_ptr<Collider2D> collider) {
-    if (!bounds.Intersects(collider->GetBounds())) return; // ̈O
+void QuadTree::Insert(int index, const MyRectangle& area) {
+    Insert(Entry{ index, area });
+}
+
+void QuadTree::Insert(const Entry& entry) {
+    if (!bounds.Intersects(entry.bounds)) return; // ̈O
 
+    int indexes[4];
     if (nodes[0]) {
-        auto indexes = GetIndexes(collider->GetBounds());
-        for (int idx : indexes) {
-            nodes[idx]->Insert(collider);
+        int n = GetIndexes(entry.bounds, indexes);
+        for (int i = 0; i < n; ++i) {
+            nodes[indexes[i]]->Insert(entry);
         }
         return;
     }
 
-    objects.push_back(collider);
+    objects.push_back(entry);
 
     if (objects.size() > maxObjects && level < maxLevels) {
         if (!nodes[0]) Split();
 
         // ōĔzu
-        for (auto it = objects.begin(); it != objects.end();) {
-            if (auto col = it->lock()) {
-                auto indexes = GetIndexes(col->GetBounds());
-                if (!indexes.empty()) {
-                    for (int idx : indexes) {
-                        nodes[idx]->Insert(col);
-                    }
-                    it = objects.erase(it);
-                    continue;
-                }
+        size_t keep = 0;
+        for (size_t i = 0; i < objects.size(); ++i) {
+            int n = GetIndexes(objects[i].bounds, indexes);
+            if (n == 0) {
+                objects[keep++] = objects[i];
+                continue;
+            }
+            for (int j = 0; j < n; ++j) {
+                nodes[indexes[j]]->Insert(objects[i]);
             }
-            ++it;
         }
+        objects.erase(objects.begin() + keep, objects.end());
     }
 }
 
-void QuadTree::Retrieve(const MyRectangle& area, std::vector<std::shared_ptr<Collider2D>>& returnObjects) {
-    auto indexes = GetIndexes(area);
+void QuadTree::Retrieve(const MyRectangle& area, std::vector<int>& returnObjects) const {
+    int indexes[4];
+    int n = GetIndexes(area, indexes);
 
-    for (int idx : indexes) {
-        if (nodes[idx]) {
-            nodes[idx]->Retrieve(area, returnObjects);
+    for (int i = 0; i < n; ++i) {
+        if (nodes[indexes[i]]) {
+            nodes[indexes[i]]->Retrieve(area, returnObjects);
         }
     }
 
-    for (auto& weak : objects) {
-        if (auto obj = weak.lock()) {
-            returnObjects.push_back(obj);
-        }
+    for (const auto& entry : objects) {
+        returnObjects.push_back(entry.index);
     }
 }
 
-std::vector<int> QuadTree::GetIndexes(const MyRectangle& area) {
-    std::vector<int> indexes;
+int QuadTree::GetIndexes(const MyRectangle& area, int out[4]) const {
+    int count = 0;
     float verticalMidpoint = bounds.x + (bounds.width / 2);
     float horizontalMidpoint = bounds.y + (bounds.height / 2);
 
@@ -93,11 +96,11 @@ std::vector<int> QuadTree::GetIndexes(const MyRectangle& area) {
 
     for (int i = 0; i < 4; ++i) {
         if (quadrants[i].Intersects(area)) {
-            indexes.push_back(i);
+            out[count++] = i;
         }
     }
 
-    return indexes;
+    return count;
 }
 
 // Draw\bh̒`
@@ -47,11 +47,17 @@ public:
 };
 /// <summary>
 /// 蔻̏𕪉.
+/// vf CollisionManager ̌`z̃CfbNX,  AABB ŕێ.
 /// </summary>
 class QuadTree {
+public:
+    struct Entry {
+        int index;              // `z̃CfbNX
+        MyRectangle bounds;     // [h AABB
+    };
 private:
     MyRectangle bounds; // AABB;
-    std::vector<std::weak_ptr<Collider2D>> objects;
+    std::vector<Entry> objects;
     std::array<std::unique_ptr<QuadTree>, 4> nodes;
     int maxObjects;
     int maxLevels;
@@ -62,8 +68,8 @@ public:
 
     void Clear();
     void Split();
-    void Insert(std::shared_ptr<Collider2D> collider);
-    void Retrieve(const MyRectangle& area, std::vector<std::shared_ptr<Collider2D>>& returnObjects);
+    void Insert(int index, const MyRectangle& area);
+    void Retrieve(const MyRectangle& area, std::vector<int>& returnObjects) const;
     void Draw() const; // `惁\bh̐錾.
 
     // ׂẴ[tm[h擾郁\bh
@@ -85,11 +91,13 @@ public:
     }
 
     // GetObjects\bh: m[h̃IuWFNgԂ
-    const std::vector<std::weak_ptr<Collider2D>>& GetObjects() const {
+    const std::vector<Entry>& GetObjects() const {
         return objects;
     }
 private:
-    std::vector<int> GetIndexes(const MyRectangle& area);
+    void Insert(const Entry& entry);
+    // area ƌqm[hԍ out ɏ, Ԃ.
+    int GetIndexes(const MyRectangle& area, int out[4]) const;
 };
 
 
@@ -2,26 +2,27 @@
 
 #include <random>
 #include <chrono>
+#include <array>
+#include <cstdint>
 
-class Random {
+// ̌n. prƂɕ, ȍeEACěʂɉeȂ悤ɂ.
+enum class RandomStream : int {
+    Global,     //  (UI Ȃ)
+    Pattern,    // eEG̍s
+    Item,       // ACê΂܂
+    Effect,     // p[eBNEʗhȂǂ̉o
+    Count
+};
+
+// 1 n񕪂̗.
+class RandomGenerator {
 private:
     std::mt19937 engine;  // ZkEcCX^[@ɂ[.
 
-    // vCx[gRXgN^iVOgp^[j.
-    Random() {
-        // V[hݎɊÂĐݒ.
-        auto seed = std::chrono::high_resolution_clock::now().time_since_epoch().count();
-        engine = std::mt19937(static_cast<unsigned int>(seed));
-    }
-
-    Random(const Random&) = delete;
-    Random& operator=(const Random&) = delete;
-
 public:
-    // VOgCX^X̎擾.
-    static Random& Instance() {
-        static Random instance;
-        return instance;
+    // V[hݒ.
+    void Seed(uint32_t seed) {
+        engine.seed(seed);
     }
 
     // _͈̔̓_i[min, max)j
@@ -71,5 +72,53 @@ public:
     }
 };
 
+// ̌n (Global) Ɨprʂ̌n܂Ƃ߂Ď.
+class Random : public RandomGenerator {
+private:
+    std::array<RandomGenerator, static_cast<size_t>(RandomStream::Count)> streams;
+    uint32_t seed = 0;
+
+    // vCx[gRXgN^iVOgp^[j.
+    Random() {
+        // V[hݎɊÂĐݒ.
+        auto now = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        SetSeed(static_cast<uint32_t>(now));
+    }
+
+    Random(const Random&) = delete;
+    Random& operator=(const Random&) = delete;
+
+    // V[hƌnԍeñV[h.
+    static uint32_t DeriveSeed(uint32_t base, int stream) {
+        std::seed_seq seq{ base, static_cast<uint32_t>(stream) };
+        uint32_t out = 0;
+        seq.generate(&out, &out + 1);
+        return out;
+    }
+
+public:
+    // VOgCX^X̎擾.
+    static Random& Instance() {
+        static Random instance;
+        return instance;
+    }
+
+    // SnV[h珉 (vCł͋L^V[hn).
+    void SetSeed(uint32_t base) {
+        seed = base;
+        RandomGenerator::Seed(DeriveSeed(base, static_cast<int>(RandomStream::Global)));
+        for (int i = 0; i < static_cast<int>(RandomStream::Count); ++i) {
+            streams[i].Seed(DeriveSeed(base, i));
+        }
+    }
+    uint32_t GetSeed() const { return seed; }
+
+    // prʂ̌n擾 (Global ͎g).
+    RandomGenerator& Stream(RandomStream id) {
+        if (id == RandomStream::Global) return *this;
+        return streams[static_cast<size_t>(id)];
+    }
+};
+
 // _class;
-#define Random  Random::Instance()
\ No newline at end of file
+#define Random  Random::Instance()
@@ -24,11 +24,10 @@ void RectTransform2D::UpdateRectTransform(Vector2D parentSize) {
     Vector2D pos = anchorPosMin + position - pivotOffset;
 
     // Transform2Dのpositionに反映
-    this->position = pos;
+    SetPosition(pos);
 
     // width, heightを使う場合は以下のように設定
-    this->width = size.x;
-    this->height = size.y;
+    SetSize(size);
 }
 
 Vector2D RectTransform2D::CalculateSizeBasedOnStretch() const {
@@ -51,12 +50,12 @@ Vector2D RectTransform2D::CalculateSizeBasedOnStretch() const {
 }
 
 
-Vector2D RectTransform2D::GetWorldPosition() const {
-    if (auto p = parent.lock()) {
-        auto parentRect = std::dynamic_pointer_cast<RectTransform2D>(p);
-        if (!parentRect) return Transform2D::GetWorldPosition();
+Vector2D RectTransform2D::CalculateWorldPosition() const {
+    if (parentRaw) {
+        auto parentRect = dynamic_cast<const RectTransform2D*>(parentRaw);
+        if (!parentRect) return Transform2D::CalculateWorldPosition();
 
-        Vector2D parentPos = parentRect->GetWorldPosition();  // 中心
+        Vector2D parentPos = parentRect->worldCache.world.position;  // 中心 (更新済み)
         Vector2D parentSize(parentRect->width, parentRect->height);
 
         Vector2D pivotAdjusted = Vector2D(pivot.x, 1.0f - pivot.y);
@@ -95,6 +94,23 @@ Vector2D RectTransform2D::GetWorldPosition() const {
     return anchoredPosition;
 }
 
+bool RectTransform2D::SyncLocalState() const {
+    bool changed = Transform2D::SyncLocalState();
+    if (rectCache.anchoredPosition == anchoredPosition &&
+        rectCache.anchorMin == anchorMin && rectCache.anchorMax == anchorMax &&
+        rectCache.pivot == pivot &&
+        rectCache.width == width && rectCache.height == height) {
+        return changed;
+    }
+    rectCache.anchoredPosition = anchoredPosition;
+    rectCache.anchorMin = anchorMin;
+    rectCache.anchorMax = anchorMax;
+    rectCache.pivot     = pivot;
+    rectCache.width     = width;
+    rectCache.height    = height;
+    return true;
+}
+
 Quad2D RectTransform2D::GetWorldQuad() const {
    
     Vector2D center= GetWorldPosition();
@@ -128,9 +144,11 @@ Vector2D RectTransform2D::GetSize() {
 void RectTransform2D::SetSize(const Vector2D& size) {
     width  = size.x;
     height = size.y;
+    MarkWorldDirty();
 }
 
 void RectTransform2D::SetSize(float w, float h) {
     width  = w;
     height = h;
+    MarkWorldDirty();
 }
\ No newline at end of file
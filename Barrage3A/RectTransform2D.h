@@ -82,15 +82,35 @@ public:
 
     void UpdateRectTransform(Vector2D parentSize);
     Vector2D CalculateSizeBasedOnStretch() const;
-    Vector2D GetWorldPosition() const override;
     Quad2D GetWorldQuad() const;
 
     Vector2D GetSize();
 
 	void SetSize(const Vector2D& size);
     void SetSize(float w, float h);
+
+    // Rect ̃[Jl̕ύX (gƎq̃[hϊ𖳌).
+    void SetAnchoredPosition(const Vector2D& value) { anchoredPosition = value; MarkWorldDirty(); }
+    void SetAnchors(const Vector2D& min, const Vector2D& max) { anchorMin = min; anchorMax = max; MarkWorldDirty(); }
+    void SetPivot(const Vector2D& value) { pivot = value; MarkWorldDirty(); }
 protected:
     std::shared_ptr<AppBase> Clone() const override {
-        return std::make_shared<RectTransform2D>(*this);
+        auto clone = std::make_shared<RectTransform2D>(*this);
+        clone->worldDirty = true;   // ̃LbV͈pȂ.
+        return clone;
     }
+
+    Vector2D CalculateWorldPosition() const override;
+    bool SyncLocalState() const override;
+    // [ĝƂ anchoredPosition ̂܂܎g.
+    bool UsesWorldOffset() const override { return false; }
+private:
+    // [hϊLbVp (RectŗL̃[Jl).
+    struct RectCache {
+        Vector2D anchoredPosition;
+        Vector2D anchorMin, anchorMax;
+        Vector2D pivot;
+        float width = 0, height = 0;
+    };
+    mutable RectCache rectCache;
 };
@@ -1,261 +1,330 @@
 #pragma once
 #include <string>
+#include <string_view>
 #include <vector>
 #include <tuple>
 #include <array>
-#include <sstream>
+#include <map>
+#include <bit>
+#include <charconv>
+#include <cstdint>
 #include <type_traits>
 #include <stdexcept>
-#include <unordered_map> // ɕύX
+#include <utility>
+#include <unordered_map>
 #include "JsonValue.hpp"
 
-// Forward declaration
+// JSON(...) ^̃tB[h.
+// Öꗗƌ\̓RpCɍ, lւ std::tie ŒڐG (s̕╶񉻂͂Ȃ).
 template<typename T>
 struct Reflector;
 
-// toString֐Q
-// ǉ toString ev[giReflector oRj
-template <typename T>
-std::string toString(const T& obj) {
-    std::unordered_map<std::string, std::string> fieldMap;
-    Reflector<T>::Reflect(obj, fieldMap);
+namespace ReflectionDetail {
+    constexpr bool IsSpace(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
 
-    std::string result = "{";
-    for (auto it = fieldMap.begin(); it != fieldMap.end(); ++it) {
-        result += "\"" + it->first + "\":" + it->second;
-        auto next = it;
-        ++next;
-        if (next != fieldMap.end()) result += ",";
+    constexpr size_t CountFields(std::string_view list) {
+        size_t count = 1;
+        for (char c : list) if (c == ',') ++count;
+        return count;
     }
-    result += "}";
-    return result;
-}
-inline std::string toString(int value) { return std::to_string(value); }
-inline std::string toString(float value) { return std::to_string(value); }
-inline std::string toString(double value) { return std::to_string(value); }
-inline std::string toString(bool value) { return value ? "true" : "false"; }
-inline std::string toString(const std::string& value) {
-    std::string escaped = "\"";
-    for (char c : value) {
-        if (c == '\"') escaped += "\\\"";
-        else if (c == '\\') escaped += "\\\\";
-        else escaped += c;
+
+    // "a, b,c"  { "a", "b", "c" }.
+    template <size_t N>
+    constexpr std::array<std::string_view, N> SplitFieldNames(std::string_view list) {
+        std::array<std::string_view, N> names{};
+        size_t start = 0;
+        for (size_t i = 0; i < N; ++i) {
+            size_t end = list.find(',', start);
+            if (end == std::string_view::npos) end = list.size();
+            size_t first = start, last = end;
+            while (first < last && IsSpace(list[first])) ++first;
+            while (last > first && IsSpace(list[last - 1])) --last;
+            names[i] = list.substr(first, last - first);
+            start = end + 1;
+        }
+        return names;
     }
-    escaped += "\"";
-    return escaped;
-}
 
-template <typename T>
-std::string toString(const std::vector<T>& values) {
-    std::string result = "[";
-    for (const auto& val : values) {
-        result += toString(val) + ",";
+    constexpr uint32_t HashKey(std::string_view key, uint32_t seed) {
+        uint32_t h = 2166136261u ^ seed;
+        for (char c : key) {
+            h ^= static_cast<uint8_t>(c);
+            h *= 16777619u;
+        }
+        return h;
     }
-    if (!values.empty()) result.pop_back();
-    result += "]";
-    return result;
-}
 
-template <typename T, size_t N>
-std::string toString(const std::array<T, N>& a) {
-    std::string result = "[";
-    for (size_t i = 0; i < N; ++i) {
-        result += toString(a[i]);
-        if (i < N - 1) result += ",";
+    // tB[h  Y̊SnbV. Փ˂Ȃ seed RpCɒT.
+    // ̖OƏƍ̂, mȂL[ -1 ɂȂ.
+    template <size_t N>
+    struct FieldIndex {
+        static_assert(N < 255, "JSON: tB[h.");
+        static constexpr size_t TableSize = std::bit_ceil(N) * 8;
+
+        std::array<std::string_view, N> names{};
+        std::array<uint8_t, TableSize> slots{};     // 0 ͋, ȊO͓Y + 1.
+        uint32_t seed = 0;
+
+        constexpr int Find(std::string_view key) const {
+            const uint8_t slot = slots[HashKey(key, seed) & (TableSize - 1)];
+            return (slot != 0 && names[slot - 1] == key) ? slot - 1 : -1;
+        }
+    };
+
+    template <size_t N>
+    constexpr FieldIndex<N> MakeFieldIndex(const std::array<std::string_view, N>& names) {
+        FieldIndex<N> index;
+        index.names = names;
+        for (uint32_t seed = 0; seed < 4096; ++seed) {
+            index.slots = {};
+            index.seed = seed;
+            bool ok = true;
+            for (size_t i = 0; i < N && ok; ++i) {
+                uint8_t& slot = index.slots[HashKey(names[i], seed) & (FieldIndex<N>::TableSize - 1)];
+                if (slot != 0) ok = false;
+                else slot = static_cast<uint8_t>(i + 1);
+            }
+            if (ok) return index;
+        }
+        throw std::logic_error("JSON: tB[h̊SnbVȂ (Ȍd?).");
     }
-    result += "]";
-    return result;
-}
-template <typename K, typename V>
-std::string toString(const std::unordered_map<K, V>& m) {
-    std::string result = "{";
-    bool first = true;
-    for (const auto& [key, val] : m) {
-        if (!first) result += ",";
-        result += toString(key) + ":" + toString(val);
-        first = false;
+
+    // s̓Y index ̃tB[h f Kp (YƂ̕ɓWJ).
+    template <typename Tuple, typename F, size_t... Is>
+    bool VisitField(Tuple&& fields, int index, F&& f, std::index_sequence<Is...>) {
+        return ((index == static_cast<int>(Is) ? (f(std::get<Is>(fields)), true) : false) || ...);
     }
-    result += "}";
-    return result;
-}
 
-template <typename K, typename V>
-std::string toString(const std::map<K, V>& m) {
-    std::string result = "{";
-    bool first = true;
-    for (const auto& [key, val] : m) {
-        if (!first) result += ",";
-        result += toString(key) + ":" + toString(val);
-        first = false;
+    template <typename Tuple, typename F, size_t... Is>
+    void ForEachField(Tuple&& fields, const std::string_view* names, F&& f, std::index_sequence<Is...>) {
+        (f(names[Is], std::get<Is>(fields)), ...);
     }
-    result += "}";
-    return result;
 }
 
-// split֐iJ}؂ŕA󔒏j
-inline std::vector<std::string> split(const std::string& s, char delimiter) {
-    std::vector<std::string> tokens;
-    std::string token;
-    std::istringstream tokenStream(s);
-    while (std::getline(tokenStream, token, delimiter)) {
-        token.erase(0, token.find_first_not_of(" \t"));
-        token.erase(token.find_last_not_of(" \t") + 1);
-        tokens.push_back(token);
+// JSON}N
+// ^̒ɏ, tB[h̕\ (reflectFieldNames / reflectFieldIndex) ƎQƂ̑g (reflectFields) .
+#define JSON(...) \
+    static constexpr auto reflectFieldNames = \
+        ReflectionDetail::SplitFieldNames<ReflectionDetail::CountFields(#__VA_ARGS__)>(#__VA_ARGS__); \
+    static constexpr auto reflectFieldIndex = ReflectionDetail::MakeFieldIndex(reflectFieldNames); \
+    auto reflectFields() { return std::tie(__VA_ARGS__); } \
+    auto reflectFields() const { return std::tie(__VA_ARGS__); }
+
+template<typename T>
+concept Reflectable = requires(T & obj) {
+    T::reflectFieldNames;
+    T::reflectFieldIndex;
+    obj.reflectFields();
+};
+
+// Reflector ̒`
+// 񋓌^}bṽL[Ɏgꍇ Reflector<񋓌^>::FromString ꉻėpӂ邱.
+template<typename T>
+struct Reflector {
+    static constexpr size_t FieldCount() { return T::reflectFieldNames.size(); }
+    static constexpr std::string_view FieldName(size_t index) { return T::reflectFieldNames[index]; }
+    static constexpr int FindField(std::string_view key) { return T::reflectFieldIndex.Find(key); }
+
+    // f(O, tB[h̎Q) 錾ɌĂ.
+    template <typename Obj, typename F>
+    static void ForEach(Obj& obj, F&& f) {
+        ReflectionDetail::ForEachField(obj.reflectFields(), T::reflectFieldNames.data(), f,
+            std::make_index_sequence<T::reflectFieldNames.size()>{});
     }
-    return tokens;
-}
+    // L[ɈvtB[h f(tB[h̎Q) Ă true.
+    template <typename F>
+    static bool Visit(T& obj, std::string_view key, F&& f) {
+        const int index = FindField(key);
+        if (index < 0) return false;
+        return ReflectionDetail::VisitField(obj.reflectFields(), index, f,
+            std::make_index_sequence<T::reflectFieldNames.size()>{});
+    }
+};
 
-// reflectImpl wp[֐
-template <typename Tuple, size_t... Is>
-void reflectImpl(
-    const std::vector<std::string>& fields,
-    const Tuple& values,
-    std::unordered_map<std::string, std::string>& fieldMap,
-    std::index_sequence<Is...>
-) 
-{
-    ((fieldMap[fields[Is]] = toString(std::get<Is>(values))), ...);
+// ƎgCg
+template<typename T> struct is_std_vector : std::false_type {};
+template<typename T, typename A> struct is_std_vector<std::vector<T, A>> : std::true_type {};
+template<typename T> struct is_std_array : std::false_type {};
+template<typename T, size_t N> struct is_std_array<std::array<T, N>> : std::true_type {};
+template<typename T> struct is_std_map : std::false_type {};
+template<typename K, typename V, typename C, typename A> struct is_std_map<std::map<K, V, C, A>> : std::true_type {};
+template<typename K, typename V, typename H, typename E, typename A> struct is_std_map<std::unordered_map<K, V, H, E, A>> : std::true_type {};
+
+// ---- o (l out ̖ JSON ő) ----
+
+inline void WriteJsonString(std::string& out, std::string_view value) {
+    static constexpr char Hex[] = "0123456789abcdef";
+    out.push_back('"');
+    size_t run = 0;
+    for (size_t i = 0; i < value.size(); ++i) {
+        const unsigned char c = static_cast<unsigned char>(value[i]);
+        if (c >= 0x20 && c != '"' && c != '\\') continue;
+        out.append(value.data() + run, i - run);
+        run = i + 1;
+        switch (c) {
+        case '"' : out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n";  break;
+        case '\r': out += "\\r";  break;
+        case '\t': out += "\\t";  break;
+        case '\b': out += "\\b";  break;
+        case '\f': out += "\\f";  break;
+        default:
+            out += "\\u00";
+            out.push_back(Hex[c >> 4]);
+            out.push_back(Hex[c & 0xF]);
+            break;
+        }
+    }
+    out.append(value.data() + run, value.size() - run);
+    out.push_back('"');
 }
 
-template <typename Tuple>
-void reflectImpl(const std::vector<std::string>& fields, const Tuple& values, std::unordered_map<std::string, std::string>& fieldMap) {
-    reflectImpl(fields, values, fieldMap, std::make_index_sequence<std::tuple_size<Tuple>::value>{});
+template <typename T>
+void WriteJsonNumber(std::string& out, T value) {
+    if constexpr (std::is_floating_point_v<T>) {
+        // NaN /  JSON ɖ̂ null.
+        if (value != value || value - value != 0) { out += "null"; return; }
+    }
+    char buffer[32];
+    const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
 }
 
-// ƎgCgFstd::vector
-template<typename T> struct is_std_vector : std::false_type {};
-template<typename T, typename A> struct is_std_vector<std::vector<T, A>> : std::true_type {};
+template <typename T>
+void WriteJson(std::string& out, const T& value);
 
-// FromJsonValue
-template<typename T>
-T FromJsonValue(const JsonValue& v) {
-    if constexpr (std::is_same_v<T, int>) {
-        if (!v.IsPrimitive()) throw std::runtime_error("Expected int");
-        return static_cast<int>(std::get<double>(v.AsPrimitive()));
+template <typename K>
+void WriteJsonKey(std::string& out, const K& key) {
+    if constexpr (std::is_convertible_v<const K&, std::string_view>) {
+        WriteJsonString(out, key);
+    }
+    else {
+        // lE񋓌^̃L[͐l𕶎ɂ.
+        out.push_back('"');
+        if constexpr (std::is_enum_v<K>) WriteJsonNumber(out, static_cast<std::underlying_type_t<K>>(key));
+        else WriteJsonNumber(out, key);
+        out.push_back('"');
+    }
+}
+
+template <typename T>
+void WriteJson(std::string& out, const T& value) {
+    if constexpr (std::is_same_v<T, bool>) {
+        out += value ? "true" : "false";
     }
-    else if constexpr (std::is_same_v<T, float>) {
-        if (!v.IsPrimitive()) throw std::runtime_error("Expected float");
-        return static_cast<float>(std::get<double>(v.AsPrimitive()));
+    else if constexpr (std::is_enum_v<T>) {
+        WriteJsonNumber(out, static_cast<std::underlying_type_t<T>>(value));
     }
-    else if constexpr (std::is_same_v<T, double>) {
-        if (!v.IsPrimitive()) throw std::runtime_error("Expected double");
-        return std::get<double>(v.AsPrimitive());
+    else if constexpr (std::is_arithmetic_v<T>) {
+        WriteJsonNumber(out, value);
     }
-    else if constexpr (std::is_same_v<T, bool>) {
-        if (!v.IsPrimitive()) throw std::runtime_error("Expected bool");
-        return std::get<bool>(v.AsPrimitive());
+    else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+        WriteJsonString(out, value);
     }
-    else if constexpr (std::is_same_v<T, std::string>) {
-        if (!v.IsPrimitive()) throw std::runtime_error("Expected string");
-        return std::get<std::string>(v.AsPrimitive());
+    else if constexpr (is_std_vector<T>::value || is_std_array<T>::value) {
+        out.push_back('[');
+        bool first = true;
+        for (const auto& elem : value) {
+            if (!first) out.push_back(',');
+            WriteJson(out, elem);
+            first = false;
+        }
+        out.push_back(']');
     }
-    else if constexpr (is_std_vector<T>::value) {
-        if (!v.IsArray()) throw std::runtime_error("Expected array");
-        std::vector<typename T::value_type> result;
-        for (const auto& elem : v.AsArray()) {
-            result.push_back(FromJsonValue<typename T::value_type>(elem));
+    else if constexpr (is_std_map<T>::value) {
+        out.push_back('{');
+        bool first = true;
+        for (const auto& [key, val] : value) {
+            if (!first) out.push_back(',');
+            WriteJsonKey(out, key);
+            out.push_back(':');
+            WriteJson(out, val);
+            first = false;
         }
-        return result;
+        out.push_back('}');
     }
     else {
-        // \̂⃆[U[`^̏
-        if (!v.IsObject()) throw std::runtime_error("Expected object");
-        T obj;
-        Reflector<T>::From(obj, v.AsObject());
-        return obj;
+        static_assert(Reflectable<T>, "JSON(...) ̖^͏oȂ.");
+        out.push_back('{');
+        bool first = true;
+        Reflector<T>::ForEach(value, [&](std::string_view name, const auto& field) {
+            if (!first) out.push_back(',');
+            WriteJsonString(out, name);
+            out.push_back(':');
+            WriteJson(out, field);
+            first = false;
+        });
+        out.push_back('}');
     }
 }
 
-template<typename K, typename V>
-std::unordered_map<K, V> FromJsonValue(const JsonValue& v) {
-    if (!v.IsObject()) throw std::runtime_error("Expected object for unordered_map");
-    std::unordered_map<K, V> result;
-    for (const auto& [keyStr, valJson] : v.AsObject()) {
-        // L[ϊFL[͕Ȃ̂ŁAKvɉKɕϊ
-        if constexpr (std::is_same_v<K, std::string>) {
-            // ̂܂ܕg
-            result.emplace(keyStr, FromJsonValue<V>(valJson));
-        }
-        else if constexpr (std::is_enum_v<K>) {
-            // EnumȂ當enumϊWbNpӂiqj
-            K keyEnum = Reflector<K>::FromString(keyStr);
-            result.emplace(keyEnum, FromJsonValue<V>(valJson));
-        }
-        else {
-            // l^Ȃǂ stringlϊKvȂ炱Ŏ
-            std::istringstream iss(keyStr);
-            K key;
-            iss >> key;
-            if (iss.fail()) throw std::runtime_error("Key conversion failed");
-            result.emplace(key, FromJsonValue<V>(valJson));
-        }
-    }
-    return result;
-}
+// ---- ǂݍ (^Ȃ std::runtime_error) ----
+// JSON ɖtB[h͌̒l̂܂, ^ɖL[͖.
 
-template<typename K, typename V>
-std::map<K, V> FromJsonValue(const JsonValue& v) {
-    if (!v.IsObject()) throw std::runtime_error("Expected object for map");
-    std::map<K, V> result;
-    for (const auto& [keyStr, valJson] : v.AsObject()) {
-        if constexpr (std::is_same_v<K, std::string>) {
-            result.emplace(keyStr, FromJsonValue<V>(valJson));
-        }
-        else if constexpr (std::is_enum_v<K>) {
-            K keyEnum = Reflector<K>::FromString(keyStr);
-            result.emplace(keyEnum, FromJsonValue<V>(valJson));
-        }
-        else {
-            std::istringstream iss(keyStr);
-            K key;
-            iss >> key;
-            if (iss.fail()) throw std::runtime_error("Key conversion failed");
-            result.emplace(key, FromJsonValue<V>(valJson));
-        }
+template <typename T>
+void ReadJson(const JsonNode& node, T& out);
+
+template <typename K>
+K ReadJsonKey(std::string_view key) {
+    if constexpr (std::is_same_v<K, std::string>) {
+        return std::string(key);
+    }
+    else if constexpr (std::is_enum_v<K>) {
+        return Reflector<K>::FromString(std::string(key));
+    }
+    else {
+        K result{};
+        const auto [ptr, ec] = std::from_chars(key.data(), key.data() + key.size(), result);
+        if (ec != std::errc() || ptr != key.data() + key.size()) throw std::runtime_error("Key conversion failed");
+        return result;
     }
-    return result;
 }
 
-// setFromJsonpwp[֐
 template <typename T>
-void setFromJson(const std::string& fieldName, T& value, const std::unordered_map<std::string, JsonValue>& data) {
-    auto it = data.find(fieldName);
-    if (it != data.end()) {
-        value = FromJsonValue<T>(it->second);
+void ReadJson(const JsonNode& node, T& out) {
+    if constexpr (std::is_same_v<T, bool>) {
+        out = node.GetBool();
     }
-}
-
-// setClasswp[
-template <typename Tuple, size_t... Is>
-void setClass(
-    const std::vector<std::string>& fields,
-    Tuple& values,
-    const std::unordered_map<std::string, JsonValue>& data,
-    std::index_sequence<Is...>
-) {
-    (setFromJson(fields[Is], std::get<Is>(values), data), ...);
-}
-
-// JSON}N
-#define JSON(...) \
-    void reflect(std::unordered_map<std::string, std::string>& fieldMap) const { \
-        std::vector<std::string> fields = split(#__VA_ARGS__, ','); \
-        auto values = std::tie(__VA_ARGS__); \
-        reflectImpl(fields, values, fieldMap); \
-    } \
-    void from(const std::unordered_map<std::string, JsonValue>& jsonObject) { \
-        std::vector<std::string> fields = split(#__VA_ARGS__, ','); \
-        auto values = std::tie(__VA_ARGS__); \
-        setClass(fields, values, jsonObject, std::make_index_sequence<std::tuple_size<decltype(values)>::value>{}); \
+    else if constexpr (std::is_enum_v<T>) {
+        out = static_cast<T>(static_cast<std::underlying_type_t<T>>(node.GetNumber()));
     }
-
-// Reflector ̒`
-template<typename T>
-struct Reflector {
-    static void Reflect(const T& obj, std::unordered_map<std::string, std::string>& fieldMap) {
-        obj.reflect(fieldMap); // [U[` reflect \bh std::unordered_map 󂯎悤ɂ
+    else if constexpr (std::is_arithmetic_v<T>) {
+        out = static_cast<T>(node.GetNumber());
     }
-    static void From(T& obj, const std::unordered_map<std::string, JsonValue>& jsonObject) {
-        obj.from(jsonObject); // FromJson ͂̂̕܂ std::map  unordered_map ɍ킹
+    else if constexpr (std::is_same_v<T, std::string>) {
+        out.clear();
+        node.AppendString(out);
     }
-};
\ No newline at end of file
+    else if constexpr (is_std_vector<T>::value) {
+        if (!node.IsArray()) throw std::runtime_error("Expected array");
+        out.clear();
+        out.reserve(node.Size());
+        for (const JsonNode& elem : node.Items()) {
+            typename T::value_type value{};
+            ReadJson(elem, value);
+            out.push_back(std::move(value));
+        }
+    }
+    else if constexpr (is_std_array<T>::value) {
+        if (!node.IsArray()) throw std::runtime_error("Expected array");
+        const auto items = node.Items();
+        for (size_t i = 0; i < out.size() && i < items.size(); ++i) ReadJson(items[i], out[i]);
+    }
+    else if constexpr (is_std_map<T>::value) {
+        if (!node.IsObject()) throw std::runtime_error("Expected object for map");
+        out.clear();
+        for (const JsonMember& member : node.Members()) {
+            typename T::mapped_type value{};
+            ReadJson(member.value, value);
+            out.emplace(ReadJsonKey<typename T::key_type>(member.key), std::move(value));
+        }
+    }
+    else {
+        static_assert(Reflectable<T>, "JSON(...) ̖^͓ǂݍ߂Ȃ.");
+        if (!node.IsObject()) throw std::runtime_error("Expected object");
+        for (const JsonMember& member : node.Members()) {
+            Reflector<T>::Visit(out, member.key, [&](auto& field) { ReadJson(member.value, field); });
+        }
+    }
+}
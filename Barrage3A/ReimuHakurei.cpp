@@ -36,7 +36,7 @@ void ReimuHakurei::Shoot() {
 		int center = 2 / 2;
 		for (int i = 0; i < 2; ++i) {
 			auto bullet = GameObject::Instantiate("PlayerBullet");
-			bullet->transform->rotation = 90;
+			bullet->transform->SetRotation(90);
 			bullet->SetTag("PlayerBullet");
 			bullet->SetLayer(Layer::PlayerBullet);
 			auto b = bullet->AddAppBase<PlayerBullet>();
@@ -47,7 +47,7 @@ void ReimuHakurei::Shoot() {
 
 			// 偶数個のときは中心が左右の中間になるため微調整
 			if (2 % 2 == 0) offsetX += 20.0f / 2.0f;
-			bullet->transform->position = transform->position + Vector2D(offsetX, 15);
+			bullet->transform->SetPosition(transform->position + Vector2D(offsetX, 15));
 			auto sp = bullet->AddAppBase<SpriteRenderer>();
 			sp->SetSprite(t);
 			sp->SetLayer(-2);
@@ -69,16 +69,13 @@ void ReimuHakurei::Shoot() {
 		auto ms = MusicController::GetInstance();
 		if (ms)
 		{
-			auto se = ms->OneShotAudio(Sounds["player_shot"]->Clone());
-			if (se) {
-				float playAreaLeft = -WIDTH / 2.0f + 64.0f;
-				float playAreaRight = WIDTH / 2.0f - 350.0f;
-				float playAreaCenter = (playAreaLeft + playAreaRight) / 2.0f;
-				float playAreaWidth = playAreaRight - playAreaLeft;
-				float relativeX = transform->position.x - playAreaCenter;
-				float pan = relativeX / (playAreaWidth / 2.0f);
-				se->SetStereoPan(pan);
-			}
+			float playAreaLeft = -WIDTH / 2.0f + 64.0f;
+			float playAreaRight = WIDTH / 2.0f - 350.0f;
+			float playAreaCenter = (playAreaLeft + playAreaRight) / 2.0f;
+			float playAreaWidth = playAreaRight - playAreaLeft;
+			float relativeX = transform->position.x - playAreaCenter;
+			float pan = relativeX / (playAreaWidth / 2.0f);
+			ms->OneShotAudio(Sounds["player_shot"], ms->GetSEVolume(), pan);
 		}
 
 	}
@@ -92,7 +89,7 @@ void ReimuHakurei::OptionShot(const bool isFocused, const std::vector<Vector2D>&
 				int center = 2 / 2;
 				for (int i = 0; i < 2; ++i) {
 					auto bullet = GameObject::Instantiate("PlayerBullet");
-					bullet->transform->rotation = 90;
+					bullet->transform->SetRotation(90);
 					bullet->SetTag("PlayerBullet");
 					bullet->SetLayer(Layer::PlayerBullet);
 					auto b = bullet->AddAppBase<PlayerBullet>();
@@ -103,7 +100,7 @@ void ReimuHakurei::OptionShot(const bool isFocused, const std::vector<Vector2D>&
 
 					// 偶数個のときは中心が左右の中間になるため微調整
 					if (2 % 2 == 0) offsetX += 7.5f / 2.0f;
-					bullet->transform->position = pos + Vector2D(offsetX, 0);
+					bullet->transform->SetPosition(pos + Vector2D(offsetX, 0));
 					auto sp = bullet->AddAppBase<SpriteRenderer>();
 					sp->SetSprite(t);
 					sp->SetLayer(-2);
@@ -121,7 +118,7 @@ void ReimuHakurei::OptionShot(const bool isFocused, const std::vector<Vector2D>&
 						currentRot = transform->rotation;  // 現在の角度取得
 
 						// ランダム方向（+1 or -1）
-						float dir = (Random.Range(0, 1) == 0 ? 1.0f : -1.0f);
+						float dir = (Random.Stream(RandomStream::Pattern).Range(0, 1) == 0 ? 1.0f : -1.0f);
 
 						// ★ 最大 ±75° 回転
 						float deltaRot = 10.0f * dir;
@@ -166,8 +163,8 @@ void ReimuHakurei::OptionShot(const bool isFocused, const std::vector<Vector2D>&
 
 			if (auto t = Tex["Player/Bullet/霊夢:bl_0"]) {
 				auto bulletObj = GameObject::Instantiate("bulelt");
-				bulletObj->transform->position = pos;
-				bulletObj->transform->rotation = angle;
+				bulletObj->transform->SetPosition(pos);
+				bulletObj->transform->SetRotation(angle);
 
 				bulletObj->SetLayer(Layer::PlayerBullet);
 				bulletObj->SetTag("PlayerBullet");
@@ -213,7 +210,7 @@ void ReimuHakurei::OptionShot(const bool isFocused, const std::vector<Vector2D>&
 					currentRot = transform->rotation;  // 現在の角度取得
 
 					// ランダム方向（+1 or -1）
-					float dir = (Random.Range(0, 1) == 0 ? 1.0f : -1.0f);
+					float dir = (Random.Stream(RandomStream::Pattern).Range(0, 1) == 0 ? 1.0f : -1.0f);
 
 					// ★ 最大 ±75° 回転
 					float deltaRot = 75.0f * dir;
@@ -15,11 +15,13 @@
 #include <memory>
 #include <thread>
 #include <mutex>
+#include <unordered_set>
 
 #include "Linq.hpp"
 #include "IDraw.h"
 #include "GameEngine.h"
 #include "Application.hpp"
+#include "Metrics.h"
 #include "Canvas.h" 
 
 /// <summary>
@@ -30,6 +32,14 @@ private:
 
     std::vector<std::weak_ptr<IRendererDraw>> renderers;
 
+    bool bulkRemoving = false;                              // ꊇ폜
+    // ꊇ폜 Remove ꂽ. I܂ŎQƂĂ,
+    // ̊ԂɉꂽAhX֐V_[Ċ܂̂h.
+    std::unordered_set<std::shared_ptr<IRendererDraw>> bulkRemoved;
+
+    int addBatchDepth = 0;                                  // BeginBatch ̓q̐[
+    std::vector<std::weak_ptr<IRendererDraw>> pendingAdds;  // ob`ɒǉꂽ (EndBatch ł܂Ƃ߂ēo^)
+
     RendererManager() = default;
     ~RendererManager() = default;
 public:
@@ -39,14 +49,39 @@ public:
     }
 
     void AddRenderer(std::shared_ptr<IRendererDraw> renderer) {
+        if (addBatchDepth > 0) {
+            pendingAdds.push_back(renderer);
+            return;
+        }
         renderers.push_back(renderer);
     }
 
+    // ëꊇȂǂ̊Ԃ AddRenderer 𗭂߂, EndBatch  1 xɓo^.
+    void BeginBatch() { ++addBatchDepth; }
+    void EndBatch() {
+        if (addBatchDepth == 0 || --addBatchDepth > 0) return;
+        renderers.insert(renderers.end(), pendingAdds.begin(), pendingAdds.end());
+        pendingAdds.clear();
+    }
+
     bool IsAABBInsideScreen(const RectF& aabb, int screenW, int screenH) {
         return !(aabb.x + aabb.w < 0 || aabb.y + aabb.h < 0 || aabb.x > screenW || aabb.y > screenH);
     }
 
     void Remove(std::shared_ptr<IRendererDraw> renderer) {
+        if (bulkRemoving) {
+            bulkRemoved.insert(std::move(renderer));
+            return;
+        }
+        // ob`ɒǉĂ܂o^ĂȂ.
+        if (addBatchDepth > 0) {
+            auto pending = std::find_if(pendingAdds.begin(), pendingAdds.end(),
+                [&renderer](const std::weak_ptr<IRendererDraw>& w) { return w.lock() == renderer; });
+            if (pending != pendingAdds.end()) {
+                pendingAdds.erase(pending);
+                return;
+            }
+        }
         // std::find_if g renderer v weak_ptr 
         auto it = std::find_if(renderers.begin(), renderers.end(),
             [&renderer](const std::weak_ptr<IRendererDraw>& w) {
@@ -62,7 +97,22 @@ public:
         }
     }
 
+    // ʍ폜̊Ԃ Remove 𗭂߂, EndBulkRemove  1 xɋl߂ (jς݂̎QƂ).
+    void BeginBulkRemove() { bulkRemoving = true; }
+    void EndBulkRemove() {
+        bulkRemoving = false;
+        if (bulkRemoved.empty()) return;
+        renderers.erase(std::remove_if(renderers.begin(), renderers.end(),
+            [this](const std::weak_ptr<IRendererDraw>& w) {
+                auto spt = w.lock();
+                return !spt || bulkRemoved.count(spt) != 0;
+            }),
+            renderers.end());
+        bulkRemoved.clear();
+    }
+
     void Render() {
+        Metrics::GetInstance().Set(Metric::Renderers, renderers.size());
         std::vector<std::shared_ptr<IRendererDraw>> overlayRenderers;
         std::vector<std::shared_ptr<IRendererDraw>> cameraRenderers;
         std::vector<std::shared_ptr<IRendererDraw>> worldRenderers;
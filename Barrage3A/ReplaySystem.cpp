@@ -0,0 +1,367 @@
+#include "Project.h"
+#include "Vector.h"
+#include "GameEngine.h"
+#include "ReplaySystem.h"
+#include "GameObjectMgr.h"
+#include "File.hpp"
+#include "Debug.hpp"
+#include "SnapshotSystem.h"
+#include "SnapshotStream.h"
+#include "SceneManager.h"
+#include <cstring>
+#include <sstream>
+#include <cstdlib>
+
+static_assert(InputFrame::ByteSize <= 255, "̈ʒu 1 oCgŕ\傫ɂ邱.");
+
+namespace {
+    constexpr uint64_t FnvOffset = 1469598103934665603ull;
+    constexpr uint64_t FnvPrime  = 1099511628211ull;
+
+    void HashBytes(uint64_t& h, const void* data, size_t size) {
+        const uint8_t* p = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            h ^= p[i];
+            h *= FnvPrime;
+        }
+    }
+
+    template<typename T>
+    void HashValue(uint64_t& h, const T& value) {
+        HashBytes(h, &value, sizeof(T));
+    }
+
+    template<typename T>
+    void Append(std::string& out, const T& value) {
+        out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    bool Extract(const std::string& in, size_t& pos, T& value) {
+        if (pos + sizeof(T) > in.size()) return false;
+        std::memcpy(&value, in.data() + pos, sizeof(T));
+        pos += sizeof(T);
+        return true;
+    }
+}
+
+// ---- ZbV ------------------------------------------------------------
+
+void ReplaySystem::BeginSession(uint32_t _seed, float _step) {
+    seed = _seed;
+    step = _step;
+    frame = 0;
+    readPos = 0;
+    desyncFrame = -1;
+    verifyHash = true;
+    seekTarget = 0;
+    endStateHash = 0;
+    reachedEnd = false;
+    lastBytes.fill(0);
+
+    // nƎԂ̐iݕL^Ƒ.
+    Random.SetSeed(seed);
+    Time.SetFixedStep(true, step);
+    // XibvVbg̃t[ԍvC̃t[ɑ.
+    SnapshotSystem::GetInstance().Clear();
+}
+
+void ReplaySystem::EndSession() {
+    mode = Mode::Idle;
+    Time.SetFixedStep(false);
+    Engine::Instance().SetHeadless(false);
+}
+
+void ReplaySystem::StartRecording(uint32_t _seed, float _step) {
+    if (mode != Mode::Idle) EndSession();
+    stream.clear();
+    hashes.clear();
+    frameCount = 0;
+    BeginSession(_seed, _step);
+    mode = Mode::Recording;
+}
+
+void ReplaySystem::StopRecording() {
+    if (mode != Mode::Recording) return;
+    frameCount = frame;
+    EndSession();
+}
+
+bool ReplaySystem::StartPlayback(bool headless) {
+    if (mode == Mode::Recording) StopRecording();
+    if (frameCount == 0) return false;
+    BeginSession(seed, step);
+    mode = Mode::Playback;
+    playbackHeadless = headless;
+    Engine::Instance().SetHeadless(headless);
+    return true;
+}
+
+void ReplaySystem::StopPlayback() {
+    if (mode != Mode::Playback) return;
+    EndSession();
+    if (onFinished) onFinished(*this);
+}
+
+// ---- ͂̍k --------------------------------------------------------
+// 1 t[ = [ωoCg n] + n g [ʒu, l]. ͂ςȂ 1 oCg.
+
+void ReplaySystem::WriteFrame(const InputFrame& input) {
+    std::array<uint8_t, InputFrame::ByteSize> bytes;
+    input.ToBytes(bytes.data());
+
+    const size_t countPos = stream.size();
+    stream.push_back(0);
+    uint8_t changed = 0;
+    for (size_t i = 0; i < bytes.size(); ++i) {
+        if (bytes[i] == lastBytes[i]) continue;
+        stream.push_back(static_cast<uint8_t>(i));
+        stream.push_back(bytes[i]);
+        ++changed;
+    }
+    stream[countPos] = changed;
+    lastBytes = bytes;
+}
+
+bool ReplaySystem::ReadFrame(InputFrame& input) {
+    if (readPos >= stream.size()) return false;
+    const uint8_t changed = stream[readPos++];
+    if (readPos + changed * 2 > stream.size()) return false;
+    for (uint8_t i = 0; i < changed; ++i) {
+        uint8_t index = stream[readPos++];
+        uint8_t value = stream[readPos++];
+        if (index < lastBytes.size()) lastBytes[index] = value;
+    }
+    input.FromBytes(lastBytes.data());
+    return true;
+}
+
+// ---- t[ ----------------------------------------------------------
+
+void ReplaySystem::ProcessInput() {
+    switch (mode) {
+    case Mode::Recording:
+        Input.Update();
+        WriteFrame(Input.CaptureFrame());
+        break;
+    case Mode::Playback: {
+        InputFrame input;
+        if (frame < frameCount && ReadFrame(input)) {
+            Input.ApplyFrame(input);
+            break;
+        }
+        // f[^؂. ʏ̓͂ɖ߂.
+        StopPlayback();
+        Input.Update();
+        break;
+    }
+    default:
+        Input.Update();
+        break;
+    }
+}
+
+void ReplaySystem::EndFrame() {
+    if (mode == Mode::Recording) {
+        hashes.push_back(ComputeStateHash());
+        frameCount = ++frame;
+        if (recordLimit > 0 && frameCount >= recordLimit) {
+            StopRecording();
+            const bool saved = Save(commandLinePath);
+            GameEngine::Debug::Log("Replay recorded: {} ({:d} frames, {})", commandLinePath, frameCount, saved ? "saved" : "save failed");
+            recordLimit = 0;
+            GameEngine::Application::GetInstanse().Quit();
+        }
+        return;
+    }
+    if (mode != Mode::Playback) return;
+
+    const uint64_t hash = ComputeStateHash();
+    if (frame + 1 >= frameCount) {
+        endStateHash = hash;
+        reachedEnd = true;
+    }
+    if (verifyHash && frame < hashes.size() && hashes[frame] != hash && desyncFrame < 0) {
+        desyncFrame = frame;
+        GameEngine::Debug::WarningLog("Replay desync at frame {:d}", frame);
+        if (stopOnDesync) {
+            StopPlayback();
+            return;
+        }
+    }
+    if (++frame >= frameCount) {
+        StopPlayback();
+        return;
+    }
+    // ߂̏ꍇ͂̌̕ frame ߂̂, vI.
+    if (seekTarget > 0 && frame == seekTarget) {
+        seekTarget = 0;
+        Engine::Instance().SetHeadless(playbackHeadless);
+    }
+}
+
+// ---- V[N ------------------------------------------------------------------
+
+bool ReplaySystem::Seek(uint32_t targetFrame) {
+    if (mode != Mode::Playback) return false;
+    if (targetFrame >= frameCount) targetFrame = frameCount - 1;
+
+    if (targetFrame < frame) {
+        if (!SnapshotSystem::GetInstance().RequestRewind(targetFrame)) return false;
+    }
+    verifyHash = false;
+    if (targetFrame != frame) {
+        seekTarget = targetFrame;
+        Engine::Instance().SetHeadless(true);
+    }
+    return true;
+}
+
+void ReplaySystem::SaveState(SnapshotWriter& out) const {
+    out.Write(frame);
+    out.Write(static_cast<uint64_t>(readPos));
+    out.Write(lastBytes);
+}
+
+void ReplaySystem::LoadState(SnapshotReader& in) {
+    const uint32_t savedFrame = in.Read<uint32_t>();
+    const uint64_t savedPos = in.Read<uint64_t>();
+    const auto savedBytes = in.Read<std::array<uint8_t, InputFrame::ByteSize>>();
+
+    // L^Ɋ߂Ɛ擪̍ĐƈvȂȂ̂, L^͂Ŏ~߂.
+    if (mode == Mode::Recording) {
+        StopRecording();
+        return;
+    }
+    if (mode != Mode::Playback) return;
+    frame = savedFrame;
+    readPos = static_cast<size_t>(savedPos);
+    lastBytes = savedBytes;
+}
+
+uint64_t ReplaySystem::ComputeStateHash() const {
+    uint64_t h = FnvOffset;
+    HashValue(h, frame);
+
+    // o^ɕł̂ŏ݂ŏݍ (AhXʂԍ̐Βl͎gȂ).
+    for (const auto& obj : Object.GetGameObjectList()) {
+        if (!obj->IsActive()) continue;
+        HashValue(h, static_cast<int>(obj->GetLayer()));
+        if (obj->transform) {
+            HashValue(h, obj->transform->position.x);
+            HashValue(h, obj->transform->position.y);
+            HashValue(h, obj->transform->rotation);
+        }
+    }
+    for (const auto& source : hashSources) {
+        HashValue(h, source());
+    }
+    return h;
+}
+
+// ---- N ----------------------------------------------------------------
+
+bool ReplaySystem::StartFromCommandLine(const std::string& commandLine) {
+    std::istringstream iss(commandLine);
+    std::vector<std::string> args;
+    for (std::string arg; iss >> arg;) args.push_back(arg);
+
+    for (size_t i = 0; i + 1 < args.size(); ++i) {
+        if (args[i] == "-record") {
+            commandLinePath = args[i + 1];
+            recordLimit = i + 2 < args.size() ? static_cast<uint32_t>(std::strtoul(args[i + 2].c_str(), nullptr, 10)) : 0;
+            if (recordLimit == 0) recordLimit = 60 * 60;
+            const uint32_t recordSeed = i + 3 < args.size() ? static_cast<uint32_t>(std::strtoul(args[i + 3].c_str(), nullptr, 10)) : 1;
+            // V[h𑵂ĂXe[Wǂݍ (Đōs).
+            StartRecording(recordSeed);
+            SceneManager::GetInstance().LoadScene(SceneType::Game, true);
+            SceneManager::GetInstance().ApplySceneChange();
+            return true;
+        }
+        if (args[i] == "-replay") {
+            commandLinePath = args[i + 1];
+            if (!Load(commandLinePath)) {
+                GameEngine::Debug::ErrorLog("Replay not loaded: {}", commandLinePath);
+                verifyFailed = true;
+                GameEngine::Application::GetInstanse().Quit();
+                return false;
+            }
+            // rłĂŌ܂ŗ, ŏIt[̃nbVŔ肷.
+            SetStopOnDesync(false);
+            SetFinishedCallback([this](const ReplaySystem&) {
+                const bool matched = reachedEnd && endStateHash == GetRecordedEndStateHash();
+                verifyFailed = !matched;
+                GameEngine::Debug::Log("Replay {}: {} frames {:d}/{:d}, end hash {:016x} (recorded {:016x}), first desync {:d}",
+                    matched ? "matched" : "MISMATCH", commandLinePath, frame, frameCount,
+                    endStateHash, GetRecordedEndStateHash(), desyncFrame);
+                GameEngine::Application::GetInstanse().Quit();
+            });
+            StartPlayback(true);
+            SceneManager::GetInstance().LoadScene(SceneType::Game, true);
+            SceneManager::GetInstance().ApplySceneChange();
+            return true;
+        }
+    }
+    return false;
+}
+
+// ---- ۑEǂݍ --------------------------------------------------------
+// [Magic u32][Version u16][\ u16][Seed u32][Step f32][FrameCount u32][StreamSize u32]
+// [Stream][Hash u64 ~ FrameCount]
+
+bool ReplaySystem::Save(const std::string& path) const {
+    if (frameCount == 0) return false;
+    std::string out;
+    out.reserve(24 + stream.size() + hashes.size() * sizeof(uint64_t));
+    Append(out, Magic);
+    Append(out, Version);
+    Append(out, static_cast<uint16_t>(0));
+    Append(out, seed);
+    Append(out, step);
+    Append(out, frameCount);
+    Append(out, static_cast<uint32_t>(stream.size()));
+    out.append(reinterpret_cast<const char*>(stream.data()), stream.size());
+    out.append(reinterpret_cast<const char*>(hashes.data()), frameCount * sizeof(uint64_t));
+
+    try {
+        System::IO::File::WriteAllBytes(path, out);
+    }
+    catch (const std::exception& e) {
+        GameEngine::Debug::ErrorLog("Replay save failed: {}", e.what());
+        return false;
+    }
+    return true;
+}
+
+bool ReplaySystem::Load(const std::string& path) {
+    if (mode != Mode::Idle) return false;
+
+    std::string in;
+    try {
+        in = System::IO::File::ReadAllBytes(path);
+    }
+    catch (const std::exception& e) {
+        GameEngine::Debug::ErrorLog("Replay load failed: {}", e.what());
+        return false;
+    }
+
+    size_t pos = 0;
+    uint32_t magic = 0, streamSize = 0, frames = 0, fileSeed = 0;
+    uint16_t version = 0, reserved = 0;
+    float fileStep = 0.0f;
+    if (!Extract(in, pos, magic) || magic != Magic) return false;
+    if (!Extract(in, pos, version) || version != Version) return false;
+    if (!Extract(in, pos, reserved) || !Extract(in, pos, fileSeed) || !Extract(in, pos, fileStep) ||
+        !Extract(in, pos, frames) || !Extract(in, pos, streamSize)) return false;
+    if (pos + streamSize + static_cast<size_t>(frames) * sizeof(uint64_t) > in.size()) return false;
+
+    stream.assign(in.begin() + pos, in.begin() + pos + streamSize);
+    pos += streamSize;
+    hashes.resize(frames);
+    std::memcpy(hashes.data(), in.data() + pos, frames * sizeof(uint64_t));
+
+    seed = fileSeed;
+    step = fileStep;
+    frameCount = frames;
+    return true;
+}
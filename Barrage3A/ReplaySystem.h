@@ -0,0 +1,134 @@
+/*
+    ReplaySystem.h
+
+    :class
+        - ReplaySystem
+
+    쐬         : 2026/10/19
+    ŏIύX     : 2026/10/19
+*/
+#pragma once
+
+#include <vector>
+#include <string>
+#include <array>
+#include <cstdint>
+#include <functional>
+
+#include "InputSystem.h"
+
+class SnapshotWriter;
+class SnapshotReader;
+
+/// <summary>
+/// ͂̋L^ƍĐ.
+/// L^ 1 t[Ƃ̓͂Ot[Ƃ̍ŃoCgɋl, ԃnbVc.
+/// Đ̓foCXǂ܂ɋL^͂𗬂, t[̃nbVƍ.
+/// L^EĐƂŒXebv (Time.SetFixedStep) ƋL^V[hŗn.
+/// </summary>
+class ReplaySystem {
+public:
+    enum class Mode {
+        Idle,
+        Recording,
+        Playback,
+    };
+
+    static constexpr uint32_t Magic   = 0x594C5052;   // "RPLY"
+    static constexpr uint16_t Version = 1;
+
+    // ԃnbVɒl𑫂 (XRAȂǃQ[̏).
+    using HashSource = std::function<uint64_t()>;
+    // ĐI (ŏIt[܂Ői, ܂͂o).
+    using FinishedCallback = std::function<void(const ReplaySystem&)>;
+private:
+    Mode mode = Mode::Idle;
+    uint32_t seed = 0;
+    float step = 1.0f / 60.0f;
+
+    std::vector<uint8_t> stream;        // k.
+    std::vector<uint64_t> hashes;       // t[Ƃ̏ԃnbV.
+    std::array<uint8_t, InputFrame::ByteSize> lastBytes{};  // Ot[̓.
+
+    uint32_t frame = 0;                 // L^EĐ̃t[ԍ.
+    uint32_t frameCount = 0;            // L^ς݃t[.
+    size_t   readPos = 0;
+    int64_t  desyncFrame = -1;          // ŏɃnbVvȂt[ (-1 Ȃv).
+    bool     stopOnDesync = true;
+    bool     verifyHash = true;         // V[NœrĊJ͏ƍȂ.
+    bool     playbackHeadless = false;  // StartPlayback Ŏw肳ꂽ headless.
+    uint32_t seekTarget = 0;            // ̃t[܂ headless ő (0 Ȃ疳).
+    uint64_t endStateHash = 0;          // ĐōŏIt[ɒB̏ԃnbV.
+    bool     reachedEnd = false;
+
+    // N̋L^E (StartFromCommandLine).
+    std::string commandLinePath;
+    uint32_t recordLimit = 0;           // L^t[ (0 Ȃ疳).
+    bool     verifyFailed = false;
+
+    std::vector<HashSource> hashSources;
+    FinishedCallback onFinished;
+
+    ReplaySystem() = default;
+    ~ReplaySystem() = default;
+
+    void BeginSession(uint32_t _seed, float _step);
+    void EndSession();
+    void WriteFrame(const InputFrame& input);
+    bool ReadFrame(InputFrame& input);
+public:
+    static ReplaySystem& GetInstance() {
+        static ReplaySystem instance;
+        return instance;
+    }
+
+    // L^Jn. Xe[WJn (V[ǂݍ) ̒OɌĂ.
+    void StartRecording(uint32_t _seed, float _step = 1.0f / 60.0f);
+    void StopRecording();
+
+    // ĐJn. Load ς݂̃f[^擪痬. headless Ȃ`Eҋ@ȗčő呬xŐi߂.
+    bool StartPlayback(bool headless = false);
+    void StopPlayback();
+
+    // ĐɎwt[ֈړ. ߂ꍇ SnapshotSystem ̃O畜, c͑.
+    // rĊJ_ŏԃnbV̏ƍ͂߂ (@eȂǕۑΏۊȌԂ邽).
+    bool Seek(uint32_t targetFrame);
+
+    // Đʒu (XibvVbgp).
+    void SaveState(SnapshotWriter& out) const;
+    void LoadState(SnapshotReader& in);
+
+    bool Save(const std::string& path) const;
+    bool Load(const std::string& path);
+
+    // NŃQ[V[̋L^E؂s.
+    //   -record <o.rpl> [t[] [V[h] : wt[L^ĕۑI.
+    //   -replay <.rpl>                        : headless ōĐ, ŏIt[̏ԃnbVL^ƔׂďI.
+    bool StartFromCommandLine(const std::string& commandLine);
+    // -replay ̌ (nbVsv܂͓rŎ~܂).
+    bool HasVerifyFailed() const { return verifyFailed; }
+
+    // Engine 疈t[Ă.
+    void ProcessInput();    // ͍XV (Input.Update ̑)
+    void EndFrame();        // LateUpdate . nbV̋L^Eƍ.
+
+    // ݂̏ԃnbV (GameObject ̓o^EC[EW + HashSource).
+    uint64_t ComputeStateHash() const;
+
+    void AddHashSource(HashSource source) { hashSources.push_back(std::move(source)); }
+    void ClearHashSources() { hashSources.clear(); }
+    void SetFinishedCallback(FinishedCallback callback) { onFinished = std::move(callback); }
+    void SetStopOnDesync(bool enable) { stopOnDesync = enable; }
+
+    Mode     GetMode()        const { return mode; }
+    bool     IsRecording()    const { return mode == Mode::Recording; }
+    bool     IsPlaying()      const { return mode == Mode::Playback; }
+    uint32_t GetFrame()       const { return frame; }
+    uint32_t GetFrameCount()  const { return frameCount; }
+    uint32_t GetSeed()        const { return seed; }
+    int64_t  GetDesyncFrame() const { return desyncFrame; }
+    bool     HasReachedEnd()  const { return reachedEnd; }
+    uint64_t GetEndStateHash() const { return endStateHash; }
+    uint64_t GetRecordedEndStateHash() const { return hashes.empty() ? 0 : hashes.back(); }
+    size_t   GetStreamSize()  const { return stream.size(); }
+};
@@ -50,7 +50,7 @@ void RigidBody2D::FixedUpdate() {
         acceleration = Vector2D();
 
         if (gameObject && !isStatic) {
-            gameObject->transform->position = nextPosition;  // mʒuKp
+            gameObject->transform->SetPosition(nextPosition);  // mʒuKp
         }
     }
 }
@@ -0,0 +1,215 @@
+#include <DxLib.h>
+
+#include "SEVoicePool.h"
+#include "AudioMixer.h"
+#include "Project.h"
+#include "Vector.h"
+#include "GameEngine.h"
+#include "Debug.hpp"
+
+namespace GameEngine {
+
+    namespace {
+        constexpr float MinDuration = 0.05f;    // ȂNbv̌ς.
+
+        int ToDxVolume(float volume) {
+            return static_cast<int>(Mathf::Clamp01(volume) * 255.0f);
+        }
+    }
+
+    SEVoicePool::~SEVoicePool() {
+        for (ClipVoices& entry : clips) {
+            for (int& handle : entry.handles) {
+                if (handle != -1) DeleteSoundMem(handle);
+                handle = -1;
+            }
+        }
+    }
+
+    int SEVoicePool::FindOrAddClip(const std::shared_ptr<AudioClip>& clip) {
+        if (auto it = clipIndices.find(clip.get()); it != clipIndices.end()) return it->second;
+
+        int index;
+        if (!freeClips.empty()) {
+            index = freeClips.back();
+            freeClips.pop_back();
+            clips[index] = ClipVoices{};
+        }
+        else {
+            index = static_cast<int>(clips.size());
+            clips.emplace_back();
+        }
+        clips[index].clip = clip;
+        clipIndices.emplace(clip.get(), index);
+        return index;
+    }
+
+    int SEVoicePool::GetHandle(ClipVoices& entry, int slot) {
+        int& handle = entry.handles[slot];
+        if (handle == -1) {
+            // ̓NbvƂɍŏ limit 񂾂.
+            handle = DuplicateSoundMem(entry.clip->GetSoundHandle());
+            if (handle < 0) {
+                Debug::ErrorLog("SEVoicePool:  s [{}]", entry.clip->GetTitle());
+                handle = -1;
+            }
+        }
+        return handle;
+    }
+
+    void SEVoicePool::StopVoice(int voice) {
+        Voice& v = voices[voice];
+        if (v.clip < 0) return;
+        ClipVoices& entry = clips[v.clip];
+        if (v.mixerVoice != AudioMixer::InvalidVoice) AudioMixer::GetInstance().StopVoice(v.mixerVoice);
+        else if (entry.handles[v.slot] != -1) StopSoundMem(entry.handles[v.slot]);
+        v.mixerVoice = AudioMixer::InvalidVoice;
+        if (entry.lastVoice == voice) entry.lastVoice = -1;
+        v.clip = -1;
+    }
+
+    // 炷{CX߂. Ȃ -1.
+    int SEVoicePool::AcquireVoice(int clipIndex, int priority, float now) {
+        int sameClipCount = 0;
+        int oldestSameClip = -1;
+        int freeVoice = -1;
+        int victim = -1;
+        for (int i = 0; i < MaxVoices; ++i) {
+            Voice& v = voices[i];
+            if (v.clip >= 0 && now >= v.endTime) {     // IĂ.
+                v.clip = -1;
+                v.mixerVoice = AudioMixer::InvalidVoice;
+            }
+            if (v.clip < 0) {
+                if (freeVoice < 0) freeVoice = i;
+                continue;
+            }
+            if (v.clip == clipIndex) {
+                ++sameClipCount;
+                if (oldestSameClip < 0 || v.startTime < voices[oldestSameClip].startTime) oldestSameClip = i;
+            }
+            if (v.priority <= priority &&
+                (victim < 0 || v.priority < voices[victim].priority ||
+                 (v.priority == voices[victim].priority && v.startTime < voices[victim].startTime))) {
+                victim = i;
+            }
+        }
+
+        // Nbv̓ɒBĂ炻̃Nbv̈ԌÂ炵.
+        if (sameClipCount >= clips[clipIndex].limit && oldestSameClip >= 0) {
+            StopVoice(oldestSameClip);
+            ++stats.stolen;
+            return oldestSameClip;
+        }
+        if (freeVoice >= 0) return freeVoice;
+        if (victim < 0) return -1;
+        StopVoice(victim);
+        ++stats.stolen;
+        return victim;
+    }
+
+    bool SEVoicePool::Play(const std::shared_ptr<AudioClip>& clip, float volume, float pan, int priority) {
+        if (!clip || !clip->GetIsLoaded()) return false;
+        ++stats.requests;
+
+        volume = Mathf::Min(Mathf::Clamp01(volume), clip->GetMaxVolume());
+        const int clipIndex = FindOrAddClip(clip);
+        ClipVoices& entry = clips[clipIndex];
+        const int frame = Time.frameCount;
+        const float now = Time.unscaledTime;
+
+        // t[ 2 ڈȍ~͖Ẳʂグ邾 (d˂Ă 1 𒴂Ȃ).
+        if (entry.lastFrame == frame && entry.lastVoice >= 0) {
+            entry.lastVolume = Mathf::Min(1.0f - (1.0f - entry.lastVolume) * (1.0f - volume), clip->GetMaxVolume());
+            const Voice& v = voices[entry.lastVoice];
+            if (v.mixerVoice != AudioMixer::InvalidVoice) AudioMixer::GetInstance().SetVoiceVolume(v.mixerVoice, entry.lastVolume);
+            else ChangeVolumeSoundMem(ToDxVolume(entry.lastVolume), entry.handles[v.slot]);
+            if (priority > v.priority) voices[entry.lastVoice].priority = priority;
+            ++stats.merged;
+            return true;
+        }
+
+        const int voice = AcquireVoice(clipIndex, priority, now);
+        if (voice < 0) {
+            ++stats.dropped;
+            return false;
+        }
+
+        // ̃NbvŎgĂȂXbgI.
+        uint32_t usedSlots = 0;
+        for (const Voice& v : voices) {
+            if (v.clip == clipIndex) usedSlots |= 1u << v.slot;
+        }
+        int slot = 0;
+        while (slot < entry.limit - 1 && (usedSlots & (1u << slot))) ++slot;
+
+        AudioMixer& mixer = AudioMixer::GetInstance();
+        AudioMixer::VoiceId mixerVoice = AudioMixer::InvalidVoice;
+        if (mixer.IsStarted()) {
+            // GW̃~LT[Ŗ炷 (fR[h̓NbvƂ 1 x).
+            mixerVoice = mixer.Play(mixer.LoadPcm(*clip), AudioCategory::SE, volume, pan);
+            if (mixerVoice == AudioMixer::InvalidVoice) {
+                ++stats.dropped;
+                return false;
+            }
+        }
+        else {
+            const int handle = GetHandle(entry, slot);
+            if (handle == -1) {
+                ++stats.dropped;
+                return false;
+            }
+            ChangeVolumeSoundMem(ToDxVolume(volume), handle);
+            ChangePanSoundMem(static_cast<int>(Mathf::Clamp(pan, -1.0f, 1.0f) * 255.0f), handle);
+            PlaySoundMem(handle, DX_PLAYTYPE_BACK, TRUE);
+        }
+
+        Voice& v = voices[voice];
+        v.mixerVoice = mixerVoice;
+        v.clip = clipIndex;
+        v.slot = slot;
+        v.priority = priority;
+        v.startTime = now;
+        v.endTime = now + Mathf::Max(static_cast<float>(clip->GetDuration()), MinDuration);
+
+        entry.lastFrame = frame;
+        entry.lastVoice = voice;
+        entry.lastVolume = volume;
+        return true;
+    }
+
+    void SEVoicePool::SetClipLimit(const std::shared_ptr<AudioClip>& clip, int limit) {
+        if (!clip) return;
+        clips[FindOrAddClip(clip)].limit = Mathf::Clamp(limit, 1, MaxVoicesPerClip);
+    }
+
+    void SEVoicePool::StopAll() {
+        for (int i = 0; i < MaxVoices; ++i) StopVoice(i);
+    }
+
+    void SEVoicePool::Release(const AudioClip* clip) {
+        auto it = clipIndices.find(clip);
+        if (it == clipIndices.end()) return;
+        const int index = it->second;
+        for (int i = 0; i < MaxVoices; ++i) {
+            if (voices[i].clip == index) StopVoice(i);
+        }
+        for (int& handle : clips[index].handles) {
+            if (handle != -1) DeleteSoundMem(handle);
+            handle = -1;
+        }
+        AudioMixer::GetInstance().UnloadPcm(clip->GetPath());
+        clips[index].clip.reset();
+        clipIndices.erase(it);
+        freeClips.push_back(index);
+    }
+
+    int SEVoicePool::GetActiveVoiceCount() const {
+        const float now = Time.unscaledTime;
+        int count = 0;
+        for (const Voice& v : voices) {
+            if (v.clip >= 0 && now < v.endTime) ++count;
+        }
+        return count;
+    }
+}
@@ -0,0 +1,101 @@
+/*
+    SEVoicePool.h
+
+    :class
+        - SEVoicePool
+
+    쐬         : 2026/10/19
+    ŏIύX     : 2026/10/19
+*/
+#pragma once
+
+#include <array>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <cstdint>
+
+#include "AudioClip.h"
+
+namespace GameEngine {
+
+    /// <summary>
+    /// P SE ̔܂Ƃ߂Ď󂯎Œ萔̃{CX.
+    /// nh̓NbvƂɓԂ񂾂ŏɎgƂɕ, Ȍ͎g.
+    /// t[ɓNbvdȂꍇ 1 ̔ɂ܂Ƃ߂ĉʂ.
+    /// 󂫂Ƃ͗Dx̒Ⴂ (ȂÂ) {CX~߂Ďg.
+    /// AudioMixer ĂΔ̓~LT[̃{CXōs, nh͕Ȃ.
+    /// </summary>
+    class SEVoicePool {
+    public:
+        static constexpr int MaxVoices = 32;            // ɖ点 SE ̑.
+        static constexpr int MaxVoicesPerClip = 8;
+        static constexpr int DefaultClipLimit = 4;      // NbvƂ̓ (SetClipLimit ŕς).
+        static constexpr int DefaultPriority = 0;       // 傫قǎ~߂ɂ.
+
+        // v̏Wv (x`}[NEfobO\p).
+        struct Stats {
+            uint32_t requests = 0;      // Play ̌Ăяo.
+            uint32_t merged = 0;        // t[ł܂Ƃ߂.
+            uint32_t stolen = 0;        // Ă{CX~߂Ďg.
+            uint32_t dropped = 0;       // Dx肸炳Ȃ.
+        };
+    private:
+        struct ClipVoices {
+            std::shared_ptr<AudioClip> clip;
+            std::array<int, MaxVoicesPerClip> handles;  // -1 = ܂ĂȂ.
+            int limit = DefaultClipLimit;
+            int lastFrame = -1;         // Ōɖ炵t[, ̃{CXẺ.
+            int lastVoice = -1;
+            float lastVolume = 0.0f;
+
+            ClipVoices() { handles.fill(-1); }
+        };
+
+        struct Voice {
+            int clip = -1;              // clips ̓Y (-1 = ).
+            int slot = 0;               // ClipVoices::handles ̓Y.
+            int priority = DefaultPriority;
+            float startTime = 0.0f;
+            float endTime = 0.0f;       // Nbv̒猩ςI.
+            uint32_t mixerVoice = 0;    // AudioMixer Ŗ炵{CX (0 = nhŖ炵).
+        };
+
+        std::vector<ClipVoices> clips;
+        std::vector<int> freeClips;                                 // Release ŋ󂢂 clips ̓Y.
+        std::unordered_map<const AudioClip*, int> clipIndices;
+        std::array<Voice, MaxVoices> voices{};
+        Stats stats;
+
+        SEVoicePool() = default;
+
+        int FindOrAddClip(const std::shared_ptr<AudioClip>& clip);
+        int AcquireVoice(int clipIndex, int priority, float now);
+        void StopVoice(int voice);
+        int GetHandle(ClipVoices& entry, int slot);
+    public:
+        SEVoicePool(const SEVoicePool&) = delete;
+        SEVoicePool& operator=(const SEVoicePool&) = delete;
+        ~SEVoicePool();
+
+        static SEVoicePool& GetInstance() {
+            static SEVoicePool instance;
+            return instance;
+        }
+
+        // clip  Clone ɓo^ς݂̂̂n. 炳Ȃꍇ false.
+        bool Play(const std::shared_ptr<AudioClip>& clip, float volume, float pan = 0.0f, int priority = DefaultPriority);
+
+        // NbvƂ̓ (1 ` MaxVoicesPerClip).
+        void SetClipLimit(const std::shared_ptr<AudioClip>& clip, int limit);
+
+        // Ă SE ׂĎ~߂ (nh͎c).
+        void StopAll();
+        // NbvOɌĂ. nh.
+        void Release(const AudioClip* clip);
+
+        int GetActiveVoiceCount() const;
+        const Stats& GetStats() const { return stats; }
+        void ResetStats() { stats = Stats{}; }
+    };
+}
@@ -74,14 +74,14 @@ void SceneManager::Draw() {
 
     if (currentScene)   currentScene->Draw();
 
+    ApplySceneChange();
+}
 
-    if (scene != newScene || forceReload) {
-        if (transitor) if (!transitor->IsStart()) transitor->Start(); // ŕ`Jn
-    }
+void SceneManager::ApplySceneChange() {
+    if (scene == newScene && !forceReload) return;
 
-    if (scene != newScene || forceReload) {
-        Init(newScene);
-    }
+    if (transitor) if (!transitor->IsStart()) transitor->Start(); // ŕ`Jn
+    Init(newScene);
 }
 
 void SceneManager::DrawTransitor() {
@@ -33,6 +33,8 @@ public:
     void UpdateTransitor();
     void DrawTransitor();
     void Draw();
+    // ؂ւv΃V[؂ւ (Draw ̖. `悵Ȃ headless  Engine Ă).
+    void ApplySceneChange();
     void Release();
 
     template<
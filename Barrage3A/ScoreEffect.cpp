@@ -37,7 +37,7 @@ void ScoreEffect::Update() {
 
     // 浮かび上がる
     if (auto trs = transform.lock()) {
-        trs->position.y += floatSpeed * Time.deltaTime;
+        trs->Translate(Vector2D(0, floatSpeed * Time.deltaTime));
     }
 
     // Update内
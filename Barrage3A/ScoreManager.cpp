@@ -1,4 +1,9 @@
+#include "Project.h"
+#include "Vector.h"
+#include "GameEngine.h"
 #include "ScoreManager.h"
+#include "ReplaySystem.h"
+#include "SnapshotStream.h"
 
 void ScoreManager::Add(int64_t value) {
     currentScore += value;
@@ -43,25 +48,29 @@ void ScoreManager::OnEnemyHit() {
 }
 
 void ScoreManager::LoadHiScore() {
-    if (PlayerPrefs::HasKey(kHiScoreKey)) {
-        std::string str = PlayerPrefs::GetString(kHiScoreKey, "0");
-        try {
-            hiScore = std::stoll(str);
-        }
-        catch (...) {
-            hiScore = 0;
-        }
-    }
-    else {
-        hiScore = 0;
-    }
+    // ȑO͕ŕۑĂ GetInt64 ϊ.
+    hiScore = PlayerPrefs::GetInt64(kHiScoreKey, 0);
 }
 
+// lXV邾. t@Cւ̕ۑ̓Xe[WIEQ[I[o[EIɂ܂Ƃ߂čs.
+// vCĐwbhXs (x`}[N) ̃XRA͋L^Ȃ.
 void ScoreManager::SaveHiScore() {
-    PlayerPrefs::SetString(kHiScoreKey, std::to_string(hiScore));
+    if (ReplaySystem::GetInstance().IsPlaying() || Engine::Instance().IsHeadless()) return;
+    PlayerPrefs::SetInt64(kHiScoreKey, hiScore);
 }
 
 void ScoreManager::ClampBaseScore() {
     if (baseScorePerItem > kMaxBaseScorePerItem)
         baseScorePerItem = kMaxBaseScorePerItem;
 }
+
+// nCXRA PlayerPrefs Ȃ̂Ŋ܂߂Ȃ.
+void ScoreManager::SaveState(SnapshotWriter& out) const {
+    out.Write(currentScore);
+    out.Write(baseScorePerItem);
+}
+
+void ScoreManager::LoadState(SnapshotReader& in) {
+    in.Read(currentScore);
+    in.Read(baseScorePerItem);
+}
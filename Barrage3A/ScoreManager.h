@@ -3,6 +3,9 @@
 #include "PlayerPrefs.h"
 #include <cstdint>
 
+class SnapshotWriter;
+class SnapshotReader;
+
 class ScoreManager {
 private:
     static constexpr int64_t kScorePerHit = 20;
@@ -30,4 +33,8 @@ public:
 
     void LoadHiScore();
     void SaveHiScore();
+
+    // XibvVbg (߂EK[hp).
+    void SaveState(SnapshotWriter& out) const;
+    void LoadState(SnapshotReader& in);
 };
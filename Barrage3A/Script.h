@@ -1,473 +0,0 @@
-#pragma once
-#include "BulletScriptManager.h"
-#include "ShotScriptManager.h"
-#include "EnemyScriptManager.h"
-#include "BulletInstruction.h"
-#include "ShotInstruction.h"
-#include "EnemyInstruction.h"
-#include "EnemyScript.h"
-#include "MyBullet.h"
-#include "ShotScript.h"
-#include "Define.h"
-void RegisterBulletScripts() {
-    {
-        auto bulletScrip = std::make_shared<BulletScript>();
-        bulletScrip->AddInstruction(BulletInstruction::LerpVelocity(0, 120));
-        bulletScrip->AddInstruction(BulletInstruction::Wait(30));
-        bulletScrip->AddInstruction(BulletInstruction::RandomizeAngle(180));
-        bulletScrip->AddInstruction(BulletInstruction::SetPlayerSE("enemy_bullet_change", 0.35f));
-        bulletScrip->AddInstruction(BulletInstruction::LerpVelocity(5, 180));
-        bulletScrip->AddInstruction(BulletInstruction::AddRotateTo(10, 60));
-        BulletScriptManager::GetInstance().RegisterBulletScript("bullet01", bulletScrip);
-    }
-    {
-        auto bulletScript = std::make_shared<BulletScript>();
-        bulletScript->AddInstruction(BulletInstruction::LerpVelocity(3.f, 60));
-        bulletScript->AddInstruction(BulletInstruction::LerpVelocity(0.f, 60));
-        bulletScript->AddInstruction(BulletInstruction::AimAtPlayer());
-        bulletScript->AddInstruction(BulletInstruction::Wait(30));
-        bulletScript->AddInstruction(BulletInstruction::LerpVelocity(6.f, 120));
-        bulletScript->AddInstruction(BulletInstruction::End());
-        BulletScriptManager::GetInstance().RegisterBulletScript("bullet02", bulletScript);
-    }
-    {
-        auto bulletScript = std::make_shared<BulletScript>();
-        bulletScript->AddInstruction(BulletInstruction::Wait(30));
-        bulletScript->AddInstruction(BulletInstruction::LerpVelocity(1.f, 120));       // 
-        bulletScript->AddInstruction(BulletInstruction::AddRotateTo(45, 120));         // 120t[15x]igłC[Wj
-        bulletScript->AddInstruction(BulletInstruction::Wait(10));                     // 
-        bulletScript->AddInstruction(BulletInstruction::AddRotateTo(-45, 120));        // t։]i^j
-        bulletScript->AddInstruction(BulletInstruction::Wait(10));
-        bulletScript->AddInstruction(BulletInstruction::LoopStart(3));                 // g3JԂ
-        bulletScript->AddInstruction(BulletInstruction::AddRotateTo(45, 120));
-        bulletScript->AddInstruction(BulletInstruction::Wait(10));
-        bulletScript->AddInstruction(BulletInstruction::AddRotateTo(-45, 120));
-        bulletScript->AddInstruction(BulletInstruction::Wait(10));
-        bulletScript->AddInstruction(BulletInstruction::LoopEnd());
-        bulletScript->AddInstruction(BulletInstruction::LerpVelocity(6.f, 60));       // I
-        bulletScript->AddInstruction(BulletInstruction::End());
-        BulletScriptManager::GetInstance().RegisterBulletScript("bullet_wave_rotate", bulletScript);
-    }
-
-    {
-        auto bulletScript = std::make_shared<BulletScript>();
-        bulletScript->AddInstruction(BulletInstruction::Wait(60));
-        bulletScript->AddInstruction(BulletInstruction::LerpVelocity(1.f, 60));
-        bulletScript->AddInstruction(BulletInstruction::End());
-        BulletScriptManager::GetInstance().RegisterBulletScript("slowBullet", bulletScript);
-    }
-}
-
-void RegisterShotScripts() {
-    {
-        auto shotScript = std::make_shared<ShotScript>();
-        shotScript->AddInstruction(ShotInstruction::SetBulletDefault(BulletParentID::Crystal, BulletColor::VividRed)); // ftHgeݒ       
-        shotScript->AddInstruction(ShotInstruction::SetBulletScript("bullet01"));
-        shotScript->AddInstruction(ShotInstruction::LoopStart(10));
-        shotScript->AddInstruction(ShotInstruction::SetPlayerAngle());
-        shotScript->AddInstruction(ShotInstruction::FireMultiSpeed(0, { 2,3,4,5,6 }));
-        shotScript->AddInstruction(ShotInstruction::SetPlayerSE("enemy_shot", 0.6f));
-        shotScript->AddInstruction(ShotInstruction::Wait(5));
-        shotScript->AddInstruction(ShotInstruction::LoopEnd());
-        shotScript->AddInstruction(ShotInstruction::End()); // XNvgI
-        ShotScriptManager::GetInstance().RegisterShotScript("shot_aim", shotScript);
-    }
-    {
-        auto shotScript = std::make_shared<ShotScript>();
-        shotScript->AddInstruction(ShotInstruction::SetBulletDefault(BulletParentID::Knife, BulletColor::Gray));
-        shotScript->AddInstruction(ShotInstruction::SetPlayerAngle());
-        shotScript->AddInstruction(ShotInstruction::SetBulletScript("bullet02"));
-        shotScript->AddInstruction(ShotInstruction::LoopStart(1));
-        shotScript->AddInstruction(ShotInstruction::FireSpreadCentered(3, 0.f, 30.f, 5.f));  // 3ASp0xA30x͈́Ax5
-		shotScript->AddInstruction(ShotInstruction::SetPlayerSE("enemy_shot", 0.6f));
-		shotScript->AddInstruction(ShotInstruction::LoopEnd());
-        shotScript->AddInstruction(ShotInstruction::End());
-        ShotScriptManager::GetInstance().RegisterShotScript("simple_3way_shot", shotScript);
-    }
-    {
-        auto shotScript = std::make_shared<ShotScript>();
-        shotScript->AddInstruction(ShotInstruction::SetBulletDefault(BulletParentID::BigB4, BulletColor::Blue));
-        shotScript->AddInstruction(ShotInstruction::SetBulletScript("bullet03")); // ee̓i] or gjʃXNvg
-        shotScript->AddInstruction(ShotInstruction::LoopStart(20));     // 20񔭎
-        shotScript->AddInstruction(ShotInstruction::FireSpreadCentered(5, -0.f, 60.f, 3.f)); // 60x5
-		shotScript->AddInstruction(ShotInstruction::SetPlayerSE("enemy_shot", 0.5f));
-		shotScript->AddInstruction(ShotInstruction::AddBaseAngle(-10));  // 10x]
-        shotScript->AddInstruction(ShotInstruction::Wait(4));
-        shotScript->AddInstruction(ShotInstruction::LoopEnd());
-        shotScript->AddInstruction(ShotInstruction::End());
-        ShotScriptManager::GetInstance().RegisterShotScript("rotating_5way_shot", shotScript);
-    }
-    {
-        auto shotScript = std::make_shared<ShotScript>();
-        shotScript->AddInstruction(ShotInstruction::SetBulletDefault(BulletParentID::B5, BulletColor::Red)); // D݂Œ
-        shotScript->AddInstruction(ShotInstruction::SetBulletScript("bullet_nway")); // NWaypBulleti/]Ȃǁj
-        shotScript->AddInstruction(ShotInstruction::SetPlayerAngle()); // vC[𒆐S
-        shotScript->AddInstruction(ShotInstruction::FireSpreadCentered(5, 0.f, 60.f, 3.f)); // 5AS0xA60xAx3
-        shotScript->AddInstruction(ShotInstruction::SetPlayerSE("enemy_shot", 0.5f));
-        shotScript->AddInstruction(ShotInstruction::End());
-        ShotScriptManager::GetInstance().RegisterShotScript("nway_5_shot", shotScript);
-    }
-    {
-        auto shotScript = std::make_shared<ShotScript>();
-        shotScript->AddInstruction(ShotInstruction::SetBulletDefault(BulletParentID::Crystal, BulletColor::VividRed));
-        shotScript->AddInstruction(ShotInstruction::SetBulletScript("bullet_aimed")); // eii or głȂǁj
-        shotScript->AddInstruction(ShotInstruction::SetPlayerAngle());
-        shotScript->AddInstruction(ShotInstruction::Fire(0,4.5f)); // P e4.5
-        shotScript->AddInstruction(ShotInstruction::SetPlayerSE("enemy_shot", 0.4f));
-        shotScript->AddInstruction(ShotInstruction::End());
-        ShotScriptManager::GetInstance().RegisterShotScript("aimed_shot", shotScript);
-    }
-    {
-        auto shotScript = std::make_shared<ShotScript>();
-        shotScript->AddInstruction(ShotInstruction::SetBulletDefault(BulletParentID::B4, BulletColor::Purple));
-        shotScript->AddInstruction(ShotInstruction::SetBulletScript("bullet_wave_rotate")); // g{]XNvg
-        shotScript->AddInstruction(ShotInstruction::LoopStart(30));     // 30񃋁[v
-        shotScript->AddInstruction(ShotInstruction::AddBaseAngle(8));   // 8x]
-        shotScript->AddInstruction(ShotInstruction::FireSpreadCentered(7, 90.f, 70.f, 2.5f)); // 7way
-		shotScript->AddInstruction(ShotInstruction::SetPlayerSE("enemy_shot", 0.6f));
-		shotScript->AddInstruction(ShotInstruction::Wait(4));
-        shotScript->AddInstruction(ShotInstruction::LoopEnd());
-        shotScript->AddInstruction(ShotInstruction::End());
-        ShotScriptManager::GetInstance().RegisterShotScript("wave_rotating_7way", shotScript);
-    }
-    {
-        auto shotScript = std::make_shared<ShotScript>();
-        // eBigB4ł߁A]Ȃ瑽ɌC[W
-        shotScript->AddInstruction(ShotInstruction::SetBulletDefault(BulletParentID::BigB4, BulletColor::Blue));
-        //shotScript->AddInstruction(ShotInstruction::SetBulletScript("bullet_wave_rotate"));  // gł{]  
-        shotScript->AddInstruction(ShotInstruction::LoopStart(10));          // 30񃋁[v
-        shotScript->AddInstruction(ShotInstruction::FireSpreadCentered(36, 0.f, 360.f, 4.0f));  // 9way 90x x3.0f
-        shotScript->AddInstruction(ShotInstruction::SetPlayerSE("enemy_shot", 0.5f));
-        shotScript->AddInstruction(ShotInstruction::AddBaseAngle(1.5f));        // 5x]
-        shotScript->AddInstruction(ShotInstruction::Wait(5));
-        shotScript->AddInstruction(ShotInstruction::LoopEnd());
-        shotScript->AddInstruction(ShotInstruction::LoopStart(10));          // 30񃋁[v
-        shotScript->AddInstruction(ShotInstruction::FireSpreadCentered(36, 0.f, 360.f, 4.0f));  // 9way 90x x3.0f
-        shotScript->AddInstruction(ShotInstruction::SetPlayerSE("enemy_shot", 0.5f));
-        shotScript->AddInstruction(ShotInstruction::AddBaseAngle(-1.5f));        // 5x]
-        shotScript->AddInstruction(ShotInstruction::Wait(5));
-        shotScript->AddInstruction(ShotInstruction::LoopEnd());
-        shotScript->AddInstruction(ShotInstruction::End());
-        ShotScriptManager::GetInstance().RegisterShotScript("elite_enemy_rotating_wave_36way", shotScript);
-    }
-    {
-        auto shotScript = std::make_shared<ShotScript>();
-        // eBigB4ł߁A]Ȃ瑽ɌC[W
-        shotScript->AddInstruction(ShotInstruction::SetBulletDefault(BulletParentID::BigB4, BulletColor::Blue));
-        //shotScript->AddInstruction(ShotInstruction::SetBulletScript("bullet_wave_rotate"));  // gł{]  
-        shotScript->AddInstruction(ShotInstruction::LoopStart(10));          // 30񃋁[v
-        shotScript->AddInstruction(ShotInstruction::FireSpreadCentered(16, 0.f, 360.f, 4.0f));  // 9way 90x x3.0f
-        shotScript->AddInstruction(ShotInstruction::SetPlayerSE("enemy_shot", 0.5f));
-        shotScript->AddInstruction(ShotInstruction::AddBaseAngle(1.5f));        // 5x]
-        shotScript->AddInstruction(ShotInstruction::Wait(5));
-        shotScript->AddInstruction(ShotInstruction::LoopEnd());
-        shotScript->AddInstruction(ShotInstruction::LoopStart(10));          // 30񃋁[v
-        shotScript->AddInstruction(ShotInstruction::FireSpreadCentered(16, 0.f, 360.f, 4.0f));  // 9way 90x x3.0f
-        shotScript->AddInstruction(ShotInstruction::SetPlayerSE("enemy_shot", 0.5f));
-        shotScript->AddInstruction(ShotInstruction::AddBaseAngle(-1.5f));        // 5x]
-        shotScript->AddInstruction(ShotInstruction::Wait(5));
-        shotScript->AddInstruction(ShotInstruction::LoopEnd());
-        shotScript->AddInstruction(ShotInstruction::End());
-        ShotScriptManager::GetInstance().RegisterShotScript("elite_enemy_rotating_wave_16way", shotScript);
-    }
-    {
-        auto shotScript = std::make_shared<ShotScript>();
-        // eBigB4ł߁A]Ȃ瑽ɌC[W
-        shotScript->AddInstruction(ShotInstruction::SetBulletDefault(BulletParentID::BigB4, BulletColor::Blue));
-        shotScript->AddInstruction(ShotInstruction::SetBulletScript("slowBullet")); // XɌe
-        shotScript->AddInstruction(ShotInstruction::SetPlayerAngle()); // vC[𒆐S
-        shotScript->AddInstruction(ShotInstruction::LoopStart(6));
-        shotScript->AddInstruction(ShotInstruction::FireSpreadCentered(5, 0.f, 10.f, 2.5f)); // 5 x 6 = 30
-        shotScript->AddInstruction(ShotInstruction::AddBaseAngle(60)); // ]
-        shotScript->AddInstruction(ShotInstruction::LoopEnd());
-        shotScript->AddInstruction(ShotInstruction::SetPlayerSE("enemy_shot", 0.5f));
-        shotScript->AddInstruction(ShotInstruction::Wait(30));
-        shotScript->AddInstruction(ShotInstruction::SetBulletDefault(BulletParentID::Star, BulletColor::LemonYellow));
-        shotScript->AddInstruction(ShotInstruction::SetBulletScript("bullet01"));
-        shotScript->AddInstruction(ShotInstruction::SetPlayerAngle()); // vC[Ɍ
-        shotScript->AddInstruction(ShotInstruction::LoopStart(4));
-        shotScript->AddInstruction(ShotInstruction::LoopStart(12));
-        shotScript->AddInstruction(ShotInstruction::FireMultiSpeed(0, { 1.f, 2.0f, 3.0f, 4.0f }));
-        shotScript->AddInstruction(ShotInstruction::AddBaseAngle(30)); // ]Ă
-        shotScript->AddInstruction(ShotInstruction::LoopEnd());
-        shotScript->AddInstruction(ShotInstruction::SetPlayerSE("enemy_shot", 0.5f));
-		shotScript->AddInstruction(ShotInstruction::Wait(15));
-        shotScript->AddInstruction(ShotInstruction::AddBaseAngle(15)); // ]Ă
-        shotScript->AddInstruction(ShotInstruction::LoopEnd());
-        shotScript->AddInstruction(ShotInstruction::End());
-        ShotScriptManager::GetInstance().RegisterShotScript("elite_enemy", shotScript);
-    }
-    {
-        auto shotScript = std::make_shared<ShotScript>();
-        shotScript->AddInstruction(ShotInstruction::SetBulletDefault(BulletParentID::Crystal, BulletColor::Cyan));
-        shotScript->AddInstruction(ShotInstruction::LoopStart(30));
-        shotScript->AddInstruction(ShotInstruction::SetPlayerAngle());
-        shotScript->AddInstruction(ShotInstruction::Fire(0, 5.0f));
-        shotScript->AddInstruction(ShotInstruction::SetPlayerSE("enemy_shot", 0.4f));
-		shotScript->AddInstruction(ShotInstruction::Wait(15));
-		shotScript->AddInstruction(ShotInstruction::LoopEnd());
-        shotScript->AddInstruction(ShotInstruction::End());
-        ShotScriptManager::GetInstance().RegisterShotScript("30LoopShot", shotScript);
-    }
-}
-
-void RegisterEnemyScripts() {
-    {
-        // XNvg\z
-        std::shared_ptr<EnemyScript> enemy01 = std::make_shared<EnemyScript>();
-        enemy01->Add(EnemyInstruction::SetHp(40));
-        enemy01->Add(EnemyInstruction::AddDropItem(ItemType::Power, 1));
-        enemy01->Add(EnemyInstruction::MoveTo(Vector2D(-150, 250), 120));
-        enemy01->Add(EnemyInstruction::Wait(30)); 
-        enemy01->Add(EnemyInstruction::Fire("shot_aim"));
-        enemy01->Add(EnemyInstruction::Wait(30));
-        enemy01->Add(EnemyInstruction::MoveTo(Vector2D(100, 190), 120));
-        enemy01->Add(EnemyInstruction::LoopStart(5));
-        enemy01->Add(EnemyInstruction::Fire("simple_3way_shot"));
-        enemy01->Add(EnemyInstruction::Wait(30));
-        enemy01->Add(EnemyInstruction::LoopEnd());
-        enemy01->Add(EnemyInstruction::Wait(30));
-        enemy01->Add(EnemyInstruction::Accelerate({ -0.1f,0 }));
-        enemy01->Add(EnemyInstruction::End());
-        EnemyScriptManager::GetInstance().RegisterEnemyScript("Enemy01", enemy01);
-    }
-    {
-
-        std::shared_ptr<EnemyScript> enemy02 = std::make_shared<EnemyScript>();
-        enemy02->Add(EnemyInstruction::SetHp(60));
-        enemy02->Add(EnemyInstruction::AddDropItem(ItemType::Power, 2));
-        // ʏォo  
-        enemy02->Add(EnemyInstruction::MoveTo(Vector2D(0, 250), 60));
-        enemy02->Add(EnemyInstruction::Wait(20));
-        // EɈړȂˌJԂ
-        enemy02->Add(EnemyInstruction::LoopStart(3));
-        enemy02->Add(EnemyInstruction::MoveTo(Vector2D(-120, 200), 60));
-        enemy02->Add(EnemyInstruction::Fire("nway_5_shot"));  // 5WAYe
-        enemy02->Add(EnemyInstruction::Wait(20));
-        enemy02->Add(EnemyInstruction::MoveTo(Vector2D(120, 200), 60));
-        enemy02->Add(EnemyInstruction::Fire("nway_5_shot"));
-        enemy02->Add(EnemyInstruction::Wait(20));
-        enemy02->Add(EnemyInstruction::LoopEnd());
-        // z[~OړėE
-        enemy02->Add(EnemyInstruction::Accelerate(Vector2D(0.0f, -0.05f)));
-        enemy02->Add(EnemyInstruction::Wait(60));
-        enemy02->Add(EnemyInstruction::Accelerate(Vector2D(0.0f, 0.2f)));  // ʉ։
-        enemy02->Add(EnemyInstruction::End());
-        EnemyScriptManager::GetInstance().RegisterEnemyScript("Enemy02", enemy02);
-    }
-    {
-        std::shared_ptr<EnemyScript> enemy03 = std::make_shared<EnemyScript>();
-        enemy03->Add(EnemyInstruction::SetHp(50));
-        enemy03->Add(EnemyInstruction::AddDropItem(ItemType::Power, 1));
-        enemy03->Add(EnemyInstruction::AddDropItem(ItemType::Score, 2));
-
-        // ォASix = -150jɌĎ΂߂ɓ
-        enemy03->Add(EnemyInstruction::MoveTo(Vector2D(-150, 260), 60));
-        enemy03->Add(EnemyInstruction::Wait(20));
-
-        // ̏5Aˁi60FԊuŁj
-        enemy03->Add(EnemyInstruction::LoopStart(5));
-        enemy03->Add(EnemyInstruction::Fire("aimed_shot"));  // vC[_P
-        enemy03->Add(EnemyInstruction::Wait(60));
-        enemy03->Add(EnemyInstruction::LoopEnd());
-
-        // ނătF[hAEg or ֗
-        enemy03->Add(EnemyInstruction::MoveTo(Vector2D(-180, 300), 45));
-        enemy03->Add(EnemyInstruction::Accelerate(Vector2D(0, 0.2f)));  // ɉ
-
-        enemy03->Add(EnemyInstruction::End());
-        EnemyScriptManager::GetInstance().RegisterEnemyScript("Enemy03", enemy03);
-    }
-    {
-        std::shared_ptr<EnemyScript> enemy04 = std::make_shared<EnemyScript>();
-        enemy04->Add(EnemyInstruction::SetHp(70));
-        enemy04->Add(EnemyInstruction::AddDropItem(ItemType::Power, 2));
-        enemy04->Add(EnemyInstruction::AddDropItem(ItemType::Score, 3));
-
-        // ΂ߏォ x = -150 ɓ
-        enemy04->Add(EnemyInstruction::MoveTo(Vector2D(-150, 260), 60));
-        enemy04->Add(EnemyInstruction::Wait(15));
-
-        // ̏ŉ]5WAY΂Tirotating_5way_shotgpj
-        enemy04->Add(EnemyInstruction::LoopStart(1));
-        enemy04->Add(EnemyInstruction::Fire("rotating_5way_shot")); // 20 ~ 5WAY ~ ]
-        enemy04->Add(EnemyInstruction::Wait(90));  // ؂܂ő҂
-        enemy04->Add(EnemyInstruction::LoopEnd());
-
-        // ɔĂ牺֗
-        enemy04->Add(EnemyInstruction::MoveTo(Vector2D(-180, 300), 45));
-        enemy04->Add(EnemyInstruction::Accelerate(Vector2D(0, 0.15f)));
-
-        enemy04->Add(EnemyInstruction::End());
-        EnemyScriptManager::GetInstance().RegisterEnemyScript("Enemy04", enemy04);
-    }
-    {
-        std::shared_ptr<EnemyScript> enemy05 = std::make_shared<EnemyScript>();
-        enemy05->Add(EnemyInstruction::SetHp(80));
-        enemy05->Add(EnemyInstruction::AddDropItem(ItemType::Power, 1));
-        enemy05->Add(EnemyInstruction::AddDropItem(ItemType::Score, 3));
-
-        // ォ璆 x = -150 Ɉړ
-        enemy05->Add(EnemyInstruction::MoveTo(Vector2D(-150, 240), 60));
-        enemy05->Add(EnemyInstruction::Wait(20));
-
-        // g{]e΂T
-        enemy05->Add(EnemyInstruction::Fire("wave_rotating_7way"));
-        enemy05->Add(EnemyInstruction::Wait(90)); // ؂҂
-
-        // ƏeŒ
-        enemy05->Add(EnemyInstruction::LoopStart(3));
-        enemy05->Add(EnemyInstruction::Fire("aimed_shot"));
-        enemy05->Add(EnemyInstruction::Wait(45));
-        enemy05->Add(EnemyInstruction::LoopEnd());
-
-        // ɈړĂގU
-        enemy05->Add(EnemyInstruction::MoveTo(Vector2D(-180, 290), 45));
-        enemy05->Add(EnemyInstruction::Accelerate(Vector2D(0, 0.2f))); // ։ޏ
-
-        enemy05->Add(EnemyInstruction::End());
-        EnemyScriptManager::GetInstance().RegisterEnemyScript("Enemy05", enemy05);
-    }
-
-    {
-        std::shared_ptr<EnemyScript> enemy06 = std::make_shared<EnemyScript>();
-        enemy06->Add(EnemyInstruction::SetHp(20));
-        enemy06->Add(EnemyInstruction::AddDropItem(ItemType::Power, 1));
-        enemy06->Add(EnemyInstruction::FollowPath(4, 600));
-        enemy06->Add(EnemyInstruction::Die());
-        EnemyScriptManager::GetInstance().RegisterEnemyScript("Enemy06", enemy06);
-    }
-
-    {
-        std::shared_ptr<EnemyScript> enemyL = std::make_shared<EnemyScript>();
-        enemyL->Add(EnemyInstruction::SetHp(20));
-        enemyL->Add(EnemyInstruction::AddDropItem(ItemType::Power, 1));
-        enemyL->Add(EnemyInstruction::FollowPath(5, 600));
-        enemyL->Add(EnemyInstruction::Die());
-        EnemyScriptManager::GetInstance().RegisterEnemyScript("EnemyL", enemyL);
-    }
-
-    {
-        std::shared_ptr<EnemyScript> enemyR = std::make_shared<EnemyScript>();
-        enemyR->Add(EnemyInstruction::SetHp(20));
-        enemyR->Add(EnemyInstruction::AddDropItem(ItemType::Power, 1));
-        enemyR->Add(EnemyInstruction::FollowPath(6, 600));
-        enemyR->Add(EnemyInstruction::Die());
-        EnemyScriptManager::GetInstance().RegisterEnemyScript("EnemyR", enemyR);
-    }
-    {
-        std::shared_ptr<EnemyScript> enemyL = std::make_shared<EnemyScript>();
-        enemyL->Add(EnemyInstruction::SetHp(40));
-        enemyL->Add(EnemyInstruction::AddDropItem(ItemType::Power, 2));
-        enemyL->Add(EnemyInstruction::Fire("30LoopShot"));
-        enemyL->Add(EnemyInstruction::FollowPath(5, 400));
-        enemyL->Add(EnemyInstruction::Die());
-        EnemyScriptManager::GetInstance().RegisterEnemyScript("EnemyL1", enemyL);
-    }
-
-    {
-        std::shared_ptr<EnemyScript> enemyR = std::make_shared<EnemyScript>();
-        enemyR->Add(EnemyInstruction::SetHp(40));
-        enemyR->Add(EnemyInstruction::AddDropItem(ItemType::Power, 2));
-        enemyR->Add(EnemyInstruction::Fire("30LoopShot"));
-        enemyR->Add(EnemyInstruction::FollowPath(6, 400));
-        enemyR->Add(EnemyInstruction::Die());
-        EnemyScriptManager::GetInstance().RegisterEnemyScript("EnemyR1", enemyR);
-    }
-    {
-        std::shared_ptr<EnemyScript> enemy07 = std::make_shared<EnemyScript>();
-        enemy07->Add(EnemyInstruction::SetHp(45));
-        enemy07->Add(EnemyInstruction::AddDropItem(ItemType::Power, 1));
-
-        // ====== o ======
-        enemy07->Add(EnemyInstruction::Teleport(Vector2D(-200, 500))); // O肩o
-        enemy07->Add(EnemyInstruction::MoveTo(Vector2D(-150, 180), 90)); // ΂߂ɓ
-        enemy07->Add(EnemyInstruction::Wait(20));
-
-        // ====== _ ======
-        enemy07->Add(EnemyInstruction::Wait(15));
-        enemy07->Add(EnemyInstruction::Fire("shot_aim"));
-        enemy07->Add(EnemyInstruction::Wait(25));
-
-        // ====== EȂeT ======
-        enemy07->Add(EnemyInstruction::LoopStart(4));
-        // 
-        enemy07->Add(EnemyInstruction::MoveTo(Vector2D(-280, 200), 80));
-        enemy07->Add(EnemyInstruction::Fire("simple_3way_shot"));
-        enemy07->Add(EnemyInstruction::Wait(20));
-
-        // E
-        enemy07->Add(EnemyInstruction::MoveTo(Vector2D(-20, 200), 80));
-        enemy07->Add(EnemyInstruction::Fire("simple_5way_shot")); // Eł͂Ƌ
-        enemy07->Add(EnemyInstruction::Wait(20));
-        enemy07->Add(EnemyInstruction::LoopEnd());
-
-        // ====== ޏ ======
-        enemy07->Add(EnemyInstruction::Wait(20));
-        enemy07->Add(EnemyInstruction::Accelerate({ 0.0f, 0.15f })); // ɉđޏ
-        enemy07->Add(EnemyInstruction::End());
-
-        EnemyScriptManager::GetInstance().RegisterEnemyScript("Enemy07", enemy07);
-    }
-
-
-}
-
-void RegisterEliteEnemyScripts() {
-    // G[gG̃XNvgo^
-    {
-        std::shared_ptr<EnemyScript> eliteEnemy = std::make_shared<EnemyScript>();
-        eliteEnemy->Add(EnemyInstruction::SetHp(500));
-        eliteEnemy->Add(EnemyInstruction::Teleport(Vector2D(-150, 400)));
-        eliteEnemy->Add(EnemyInstruction::AddDropItem(ItemType::PowerBig, 3));
-        eliteEnemy->Add(EnemyInstruction::AddDropItem(ItemType::Score   ,10));
-        eliteEnemy->Add(EnemyInstruction::AddDropItem(ItemType::ScoreBig, 3));
-
-        eliteEnemy->Add(EnemyInstruction::MoveTo(Vector2D(-150, 200), 120));
-        eliteEnemy->Add(EnemyInstruction::LoopStart(3));
-        eliteEnemy->Add(EnemyInstruction::Wait(30));
-        eliteEnemy->Add(EnemyInstruction::Fire("elite_enemy"));
-        eliteEnemy->Add(EnemyInstruction::Wait(200));
-		eliteEnemy->Add(EnemyInstruction::LoopEnd());
-        eliteEnemy->Add(EnemyInstruction::Accelerate(Vector2D(0, -0.01f)));
-        eliteEnemy->Add(EnemyInstruction::End());
-        EnemyScriptManager::GetInstance().RegisterEnemyScript("EliteEnemy01", eliteEnemy);
-	}
-
-    {
-        std::shared_ptr<EnemyScript> eliteEnemy = std::make_shared<EnemyScript>();
-        eliteEnemy->Add(EnemyInstruction::SetHp(600));
-        eliteEnemy->Add(EnemyInstruction::AddDropItem(ItemType::PowerBig, 3));
-        eliteEnemy->Add(EnemyInstruction::AddDropItem(ItemType::Score,   12));
-        eliteEnemy->Add(EnemyInstruction::AddDropItem(ItemType::ScoreBig, 3));
-        eliteEnemy->Add(EnemyInstruction::SetVelocity(Vector2D(0, -3.f)));
-        eliteEnemy->Add(EnemyInstruction::Wait(90));
-        eliteEnemy->Add(EnemyInstruction::SetVelocity(Vector2D(0, 0)));
-        eliteEnemy->Add(EnemyInstruction::Wait(30));
-        eliteEnemy->Add(EnemyInstruction::Fire("elite_enemy_rotating_wave_16way"));
-        eliteEnemy->Add(EnemyInstruction::Wait(400));
-        eliteEnemy->Add(EnemyInstruction::Fire("elite_enemy_rotating_wave_16way"));
-        eliteEnemy->Add(EnemyInstruction::Wait(460));
-        eliteEnemy->Add(EnemyInstruction::Accelerate(Vector2D(0, -0.02f)));
-        eliteEnemy->Add(EnemyInstruction::End());
-        EnemyScriptManager::GetInstance().RegisterEnemyScript("EliteEnemy02", eliteEnemy);
-    }
-    {
-        std::shared_ptr<EnemyScript> eliteEnemy = std::make_shared<EnemyScript>();
-        eliteEnemy->Add(EnemyInstruction::SetHp(600));
-        eliteEnemy->Add(EnemyInstruction::AddDropItem(ItemType::PowerBig, 3));
-        eliteEnemy->Add(EnemyInstruction::AddDropItem(ItemType::Score, 12));
-        eliteEnemy->Add(EnemyInstruction::AddDropItem(ItemType::ScoreBig, 3));
-        eliteEnemy->Add(EnemyInstruction::SetVelocity(Vector2D(0, -3.f)));
-        eliteEnemy->Add(EnemyInstruction::Wait(90));
-        eliteEnemy->Add(EnemyInstruction::SetVelocity(Vector2D(0, 0)));
-        eliteEnemy->Add(EnemyInstruction::Wait(30));
-        eliteEnemy->Add(EnemyInstruction::Fire("elite_enemy_rotating_wave_36way"));
-        eliteEnemy->Add(EnemyInstruction::Wait(400));
-        eliteEnemy->Add(EnemyInstruction::Fire("elite_enemy_rotating_wave_36way"));
-        eliteEnemy->Add(EnemyInstruction::Wait(460));
-        eliteEnemy->Add(EnemyInstruction::Accelerate(Vector2D(0, -0.02f)));
-        eliteEnemy->Add(EnemyInstruction::End());
-        EnemyScriptManager::GetInstance().RegisterEnemyScript("EliteEnemy03", eliteEnemy);
-    }
-}
\ No newline at end of file
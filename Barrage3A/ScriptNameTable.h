@@ -0,0 +1,65 @@
+/*
+    ScriptNameTable.h
+
+    :class
+        - ScriptNameTable
+
+    쐬         : 2026/10/19
+    ŏIύX     : 2026/10/19
+*/
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <deque>
+#include <cstdint>
+
+/// <summary>
+/// GEVbgXNvggO (Vbg, SE , eXNvgȂ) ԍɒu\.
+/// o^ Intern Ă, s͔ԍ邾ŕ̕NȂ.
+/// ԍ͓o^, xÛ͏Ȃ.
+/// </summary>
+class ScriptNameTable {
+public:
+    static constexpr uint32_t NoName = 0xFFFFFFFF;
+private:
+    struct Hash {
+        using is_transparent = void;
+        size_t operator()(std::string_view s) const { return std::hash<std::string_view>{}(s); }
+    };
+
+    std::deque<std::string> names;     // Y = ԍ (deque Ȃ̂ŎQƂȂ).
+    std::unordered_map<std::string_view, uint32_t, Hash, std::equal_to<>> ids;
+
+    ScriptNameTable() = default;
+public:
+    ScriptNameTable(const ScriptNameTable&) = delete;
+    ScriptNameTable& operator=(const ScriptNameTable&) = delete;
+
+    static ScriptNameTable& GetInstance() {
+        static ScriptNameTable instance;
+        return instance;
+    }
+
+    // 󕶎 NoName.
+    uint32_t Intern(std::string_view name) {
+        if (name.empty()) return NoName;
+        if (auto it = ids.find(name); it != ids.end()) return it->second;
+        const uint32_t id = static_cast<uint32_t>(names.size());
+        const std::string& stored = names.emplace_back(name);
+        ids.emplace(std::string_view(stored), id);
+        return id;
+    }
+
+    // o^ς݂łȂ NoName.
+    uint32_t Find(std::string_view name) const {
+        auto it = ids.find(name);
+        return it != ids.end() ? it->second : NoName;
+    }
+
+    const std::string& Get(uint32_t id) const {
+        static const std::string empty;
+        return id < names.size() ? names[id] : empty;
+    }
+};
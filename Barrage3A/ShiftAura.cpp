@@ -75,15 +75,15 @@ void ShiftAura::Tick() {
         scale = startScale + (endScale - startScale) * easeT;
         float alpha = startA + (endA - startA) * easeT;
 
-        transform->scale = Vector2D(scale, scale);
+        transform->SetScale(Vector2D(scale, scale));
         renderer->GetColor().a = alpha;
 
         float currentAngle = startAngle + (endAngle - startAngle) * angleT;
-        transform->rotation = currentAngle;
+        transform->SetRotation(currentAngle);
 
         if (t >= 1.0f) {
             state = AuraState::Active;
-            transform->scale = Vector2D(endScale, endScale);
+            transform->SetScale(Vector2D(endScale, endScale));
             renderer->GetColor().a = endA;
             angle = endAngle; // 回転開始用に記録
         }
@@ -94,7 +94,7 @@ void ShiftAura::Tick() {
         // 回転
         angle += angleSpeed * Time.deltaTime;
         angle = Mathf::NormalizeAngle180(angle);
-        transform->rotation = startAngle + angle;
+        transform->SetRotation(startAngle + angle);
 
         if (!trigger) {
             state = AuraState::Disappearing;
@@ -111,12 +111,12 @@ void ShiftAura::Tick() {
         scale = startScale + (endScale - startScale) * easeT;
         float alpha = startA + (endA - startA) * easeT;
 
-        transform->scale = Vector2D(scale, scale);
+        transform->SetScale(Vector2D(scale, scale));
         renderer->GetColor().a = alpha;
 
         if (t >= 1.0f) {
             state = AuraState::Hidden;
-            transform->scale = Vector2D(startScale, startScale);
+            transform->SetScale(Vector2D(startScale, startScale));
             renderer->GetColor().a = startA;
         }
         break;
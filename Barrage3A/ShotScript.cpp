@@ -4,29 +4,71 @@
 #include "AudioResourceShortcut.hpp"
 #include "BulletType.h"  // CreateBullet̂߂ɕKv
 #include "BulletScriptManager.h"
+#include "SnapshotStream.h"
 #include <cstdlib>              // rand(), RAND_MAX
 #include <cmath>
+#include <algorithm>
+
+void ShotProgram::AddInstruction(const ShotInstruction& instr) {
+    ShotOp op;
+    op.type       = instr.type;
+    op.count      = instr.count;
+    op.angle      = instr.angle;
+    op.totalAngle = instr.totalAngle;
+    op.speed      = instr.speed;
+    op.slot       = instr.slot;
+    op.extra      = instr.extra;
+    op.angle2     = instr.angle2;
+    op.maxOffset  = instr.maxOffset;
+    op.volume     = instr.volume;
+
+    auto& names = ScriptNameTable::GetInstance();
+    if (instr.type == ShotInstruction::Type::SetBulletScript) op.name = names.Intern(instr.label);
+    else if (instr.type == ShotInstruction::Type::PlaySE)     op.name = names.Intern(instr.soundName);
+
+    if (instr.type == ShotInstruction::Type::FireMultiSpeed) {
+        // x葽 count ͓ǂ߂Ȃ̂ŋl߂.
+        op.firstSpeed = static_cast<uint32_t>(speedTable.size());
+        op.count = std::clamp(instr.count, 0, static_cast<int>(instr.speeds.size()));
+        speedTable.insert(speedTable.end(), instr.speeds.begin(), instr.speeds.begin() + op.count);
+    }
+    ops.push_back(op);
+}
 
-void ShotScript::AddInstruction(const ShotInstruction& instr) {
-    instructions.push_back(instr);
+void ShotScript::Start(const ShotProgram* _program) {
+    program = _program;
+    loopDepth = 0;
+    registeredMask = 0;
+    defaultTemplateId = BulletParentID::B1;
+    defaultColorId = BulletColor::Red;
+    control = program ? program->GetBulletScript() : nullptr;
+    ip = 0;
+    frame = 0;
+    finished = false;
+    randomAngleRange = 0.f;
+    defaultAngularVelocity = 0.f;
+    defaultAcceleration = 0.f;
+    baseAngle = 0.f;
 }
 
 void ShotScript::Update(Vector2D position) {
-    if (finished) return;
+    if (finished || !program) return;
+    const std::vector<ShotOp>& ops = program->GetOps();
 
     while (true) {
-        if (ip >= instructions.size()) {
+        if (ip >= ops.size()) {
             finished = true;
             return;
         }
 
-        const auto& instr = instructions[ip];
+        const ShotOp& instr = ops[ip];
         switch (instr.type) {
         //  ݒn 
         case ShotInstruction::Type::SetEnemyBulletType: {
-            RegisteredBullet& rb = registeredBullets[instr.slot];
-            rb.templateId   = instr.count;
-            rb.colorId      = instr.extra;
+            if (RegisteredBullet* rb = RegisterSlot(instr.slot)) {
+                rb->templateId  = instr.count;
+                rb->colorId     = instr.extra;
+            }
             ip++;
             break;
         }
@@ -38,10 +80,10 @@ void ShotScript::Update(Vector2D position) {
         }
         // ------ ANVn --------------------------------------------------------------------------
         case ShotInstruction::Type::PlaySE: {
-            auto clip = Sounds[instr.soundName];
+            auto clip = Sounds[ScriptNameTable::GetInstance().Get(instr.name)];
             auto scn = MusicController::GetInstance();
 
-            if (scn && clip) scn->OneShotAudio(clip->Clone(), instr.volume);
+            if (scn && clip) scn->OneShotAudio(clip, instr.volume);
 
             ip++;
             break;
@@ -54,8 +96,7 @@ void ShotScript::Update(Vector2D position) {
             break;
         }
         case ShotInstruction::Type::Offset: {
-            RegisteredBullet& rb = registeredBullets[instr.slot];
-            rb.offset = { instr.angle, instr.speed };
+            if (RegisteredBullet* rb = RegisterSlot(instr.slot)) rb->offset = { instr.angle, instr.speed };
             ip++;
             break;
         }
@@ -66,8 +107,7 @@ void ShotScript::Update(Vector2D position) {
             break;
         }
         case ShotInstruction::Type::EmitSpeedUp: {
-            RegisteredBullet& rb = registeredBullets[instr.slot];
-            rb.speed += instr.speed * (instr.angle2 > 0 ? 1 : -1);
+            if (RegisteredBullet* rb = RegisterSlot(instr.slot)) rb->speed += instr.speed * (instr.angle2 > 0 ? 1 : -1);
             ip++;
             break;
         }
@@ -77,7 +117,8 @@ void ShotScript::Update(Vector2D position) {
             break;
         }
         case ShotInstruction::Type::SetBulletScript: {
-			control = BulletScriptManager::GetInstance().CloneBulletScript(instr.label);
+            // eƂ̕ BulletManager ̂, o^ꂽ̂̂܂ܓn.
+            control = BulletScriptManager::GetInstance().FindBulletScript(ScriptNameTable::GetInstance().Get(instr.name));
             ip++;
             break;
         }
@@ -91,31 +132,18 @@ void ShotScript::Update(Vector2D position) {
             break;
         }
         case ShotInstruction::Type::FireMultiSpeed: {
-            for (int i = 0; i < instr.count; ++i) {
-                float speed = instr.speeds[i];
-                FireBullet(position, baseAngle + instr.angle, speed);
+            spawnScratch.clear();
+            for (float speed : program->GetSpeeds(instr)) {
+                spawnScratch.push_back({ position, baseAngle + instr.angle, speed });
             }
+            FireBatch(-1);
             ++ip;
             break;
         }
         case ShotInstruction::Type::FireSpread: {
-            int slot = instr.slot;
-            float startAngle = baseAngle + instr.angle;
-            float speed = instr.speed;
-            int count = instr.count;
-            float totalAngle = instr.totalAngle;
-
-            for (int i = 0; i < count; ++i) {
-                float angle;
-                if (std::fabs(totalAngle - 360.0f) < 0.001f) {
-                    angle = startAngle + (totalAngle / count) * i;
-                }
-                else {
-                    angle = startAngle + (totalAngle / (count - 1)) * i;
-                }
-
-                FireBullet(position, angle, speed, -1);
-            }
+            spawnScratch.clear();
+            PushSpread(position, baseAngle + instr.angle, instr.totalAngle, instr.count, instr.speed);
+            FireBatch(-1);
 
             ip++;
             break;
@@ -132,48 +160,28 @@ void ShotScript::Update(Vector2D position) {
                 break;
             }
 
+            spawnScratch.clear();
             if (count == 1) {
-                FireBullet(position, startAngle, speed, slot);
+                spawnScratch.push_back({ position, startAngle, speed });
             }
             else {
                 float angleStep = totalAngle / (count - 1);
                 float beginAngle = startAngle - totalAngle * 0.5f;
 
                 for (int i = 0; i < count; ++i) {
-                    float angle = beginAngle + i * angleStep;
-                    FireBullet(position, angle, speed, slot);
+                    spawnScratch.push_back({ position, beginAngle + i * angleStep, speed });
                 }
             }
+            FireBatch(slot);
 
             ip++;
             break;
         }
         case ShotInstruction::Type::FireSpreadShuffled: {
-            int slot = instr.slot;
-            float startAngle = baseAngle + instr.angle;
-            float speed = instr.speed;
-            int count = instr.count;
-            float totalAngle = instr.totalAngle;
-
-            std::vector<float> angles;
-            angles.reserve(count);
-
-            for (int i = 0; i < count; ++i) {
-                float angle;
-                if (std::fabs(totalAngle - 360.0f) < 0.001f) {
-                    angle = startAngle + (totalAngle / count) * i;
-                }
-                else {
-                    angle = startAngle + (totalAngle / (count - 1)) * i;
-                }
-                angles.push_back(angle);
-            }
-
-            std::shuffle(angles.begin(), angles.end(),Random.GetEngine());
-
-            for (float angle : angles) {
-                FireBullet(position, angle, speed, slot);
-            }
+            spawnScratch.clear();
+            PushSpread(position, baseAngle + instr.angle, instr.totalAngle, instr.count, instr.speed);
+            std::shuffle(spawnScratch.begin(), spawnScratch.end(), Random.Stream(RandomStream::Pattern).GetEngine());
+            FireBatch(instr.slot);
 
             ip++;
             break;
@@ -184,31 +192,32 @@ void ShotScript::Update(Vector2D position) {
             int count = instr.count;
             float speed = instr.speed;
 
+            spawnScratch.clear();
             for (int i = 0; i < count; ++i) {
                 // 0`1͈̔͂Ń_ɂ΂
-                float randT = Random.Value(); // 0.0`1.0̗Ԃ֐
+                float randT = Random.Stream(RandomStream::Pattern).Value(); // 0.0`1.0̗Ԃ֐
                 float angle = centerAngle - totalAngle * 0.5f + totalAngle * randT;
 
-                FireBullet(position, angle, speed, -1);
+                spawnScratch.push_back({ position, angle, speed });
             }
+            FireBatch(-1);
 
             ip++;
             break;
         }
         case ShotInstruction::Type::RegisterBullet: {
-            RegisteredBullet& rb = registeredBullets[instr.slot];
-            rb.speed = instr.speed;
-            rb.angle = instr.angle;
+            if (RegisteredBullet* rb = RegisterSlot(instr.slot)) {
+                rb->speed = instr.speed;
+                rb->angle = instr.angle;
+            }
             ip++;
             break;
         }
         case ShotInstruction::Type::OnFire: {
-            auto it = registeredBullets.find(instr.slot);
-            if (it != registeredBullets.end()) {
-                const auto& rb = it->second;
+            if (const RegisteredBullet* rb = FindSlot(instr.slot)) {
                 FireBullet(position,
-                    baseAngle + rb.angle,
-                    rb.speed,
+                    baseAngle + rb->angle,
+                    rb->speed,
                     instr.slot);
             }
             ip++;
@@ -220,9 +229,8 @@ void ShotScript::Update(Vector2D position) {
             if (instr.slot < 0) {
                 defaultAngularVelocity = instr.angle;
             }
-            else {
-                RegisteredBullet& rb = registeredBullets[instr.slot];
-                rb.angularVelocity = instr.angle;
+            else if (RegisteredBullet* rb = RegisterSlot(instr.slot)) {
+                rb->angularVelocity = instr.angle;
             }
             ip++;
             break;
@@ -231,9 +239,8 @@ void ShotScript::Update(Vector2D position) {
             if (instr.slot < 0) {
                 defaultAcceleration = instr.speed;
             }
-            else {
-                RegisteredBullet& rb = registeredBullets[instr.slot];
-                rb.acceleration = instr.speed;
+            else if (RegisteredBullet* rb = RegisterSlot(instr.slot)) {
+                rb->acceleration = instr.speed;
             }
             ip++;
             break;
@@ -255,18 +262,23 @@ void ShotScript::Update(Vector2D position) {
         }
         //  [vEҋ@EI 
         case ShotInstruction::Type::LoopStart:
-            loopStack.push_back({ ip, instr.count });
+            if (loopDepth >= MaxLoopDepth) {
+                // q[. Ή̂Ŏ~߂.
+                finished = true;
+                return;
+            }
+            loopStack[loopDepth++] = { static_cast<uint32_t>(ip), instr.count };
             ip++;
             break;
 
         case ShotInstruction::Type::LoopEnd: {
-            if (loopStack.empty()) { ip++; break; }
-            auto& top = loopStack.back();
+            if (loopDepth == 0) { ip++; break; }
+            auto& top = loopStack[loopDepth - 1];
             if (--top.remainingCount > 0) {
                 ip = top.startIp + 1;
             }
             else {
-                loopStack.pop_back();
+                --loopDepth;
                 ip++;
             }
             break;
@@ -291,77 +303,107 @@ void ShotScript::Update(Vector2D position) {
     }
 }
 
-std::shared_ptr<ShotScript> ShotScript::Clone() const {
-    auto clone = std::make_shared<ShotScript>();
-    clone->instructions = this->instructions;
-    clone->defaultTemplateId = this->defaultTemplateId;
-    clone->defaultColorId = this->defaultColorId;
-    clone->control = this->control;
-    // ԃNA
-    clone->ip = 0;
-    clone->frame = 0;
-    clone->finished = false;
-    clone->loopStack.clear();
-    clone->registeredBullets.clear();
-    clone->randomAngleRange = 0.f;
-    return clone;
-}
-
-void ShotScript::SetBulletScript(const std::shared_ptr<BulletScript> _control) {
-    control = _control;
-}
-
 void ShotScript::ApplyRandomAngle(float& angle) {
     if (randomAngleRange > 0.f) {
-        float t = Random.Value();
+        float t = Random.Stream(RandomStream::Pattern).Value();
         float delta = (t * 2.f - 1.f) * randomAngleRange;    // [-range, +range]
         angle += delta;
     }
 }
 
+void ShotScript::PushSpread(Vector2D pos, float startAngle, float totalAngle, int count, float speed) {
+    // 360xȂI[d˂Ȃ
+    const bool fullCircle = std::fabs(totalAngle - 360.0f) < 0.001f;
+    for (int i = 0; i < count; ++i) {
+        float angle;
+        if (fullCircle) {
+            angle = startAngle + (totalAngle / count) * i;
+        }
+        else {
+            angle = startAngle + (totalAngle / (count - 1)) * i;
+        }
+        spawnScratch.push_back({ pos, angle, speed });
+    }
+}
+
 void ShotScript::FireBullet(Vector2D pos, float angle, float speed, int slot) {
-    RegisteredBullet bulletInfo;
+    spawnScratch.clear();
+    spawnScratch.push_back({ pos, angle, speed });
+    FireBatch(slot);
+}
+
+void ShotScript::FireBatch(int slot) {
+    if (spawnScratch.empty()) return;
+
+    BulletSpawnDesc desc;
+    desc.program = control;
+
     if (slot >= 0) {
-        auto it = registeredBullets.find(slot);
-        if (it == registeredBullets.end()) return;
-        bulletInfo = it->second;
+        const RegisteredBullet* bulletInfo = FindSlot(slot);
+        if (!bulletInfo) return;
+
+        desc.type            = static_cast<BulletParentID>(bulletInfo->templateId);
+        desc.color           = static_cast<BulletColor>(bulletInfo->colorId);
+        desc.angularVelocity = bulletInfo->angularVelocity;
+        desc.acceleration    = bulletInfo->acceleration;
+        desc.bulletSpeed     = bulletInfo->speed;   // o^e͓o^̑xňړ
+
+        // ˈʒuItZbgf
+        for (auto& spawn : spawnScratch) spawn.position += bulletInfo->offset;
     }
     else {
         // ftHg
-        bulletInfo.angle = 0.f;
-        bulletInfo.speed = speed;
-        bulletInfo.templateId = static_cast<int>(defaultTemplateId);
-        bulletInfo.colorId = static_cast<int>(defaultColorId);
+        desc.type            = defaultTemplateId;
+        desc.color           = defaultColorId;
+        desc.angularVelocity = defaultAngularVelocity;
+        desc.acceleration    = defaultAcceleration;
     }
 
-    // ˈʒuItZbgf
-    pos += bulletInfo.offset;
-
-    // x[XRandommCY𔽉f
-    ApplyRandomAngle(angle);
-
-    // e̐
-    BulletParentID typeId = static_cast<BulletParentID>(bulletInfo.templateId);
-    BulletColor    colorId = static_cast<BulletColor>(bulletInfo.colorId);
-    auto bulletGO = BulletTypeManager::GetInstance().CreateBullet(typeId, colorId);
-    if (!bulletGO) return;
-
-    bulletGO->transform->position = pos;
-    bulletGO->transform->rotation = angle;
-
-    // eR|[lgݒ
-    auto bullet = bulletGO->AddAppBase<EnemyBullet>();
-    bullet->SetSpeed(bulletInfo.speed);
-    // FireBullet 
-    bullet->SetRotationRate(slot >= 0 ? bulletInfo.angularVelocity : defaultAngularVelocity);
-    bullet->SetAcceleration(slot >= 0 ? bulletInfo.acceleration : defaultAcceleration);
-
-    if (control) {
-        auto bs = control->Clone();
-        bs->InitSpeed(speed);
-        bs->InitAngle(angle);
-        bullet->SetBulletControllerInstance(bs);
-    }
+    // x[XRandommCY𔽉f (ŏ 1 ̂)
+    ApplyRandomAngle(spawnScratch.front().angle);
     // ZbgFˊpxmCY1xKpƂAe͍Đݒ薽ߑ҂
     randomAngleRange = 0.f;
+
+    BulletManager::Instance().SpawnBatch(desc, spawnScratch);
+}
+
+void ShotScript::SaveState(SnapshotWriter& out) const {
+    out.Write(static_cast<uint32_t>(ip));
+    out.Write(frame);
+    out.Write(finished);
+    out.Write(defaultTemplateId);
+    out.Write(defaultColorId);
+    out.Write(randomAngleRange);
+    out.Write(defaultAngularVelocity);
+    out.Write(defaultAcceleration);
+    out.Write(baseAngle);
+    out.Write(loopDepth);
+    for (int i = 0; i < loopDepth; ++i) out.Write(loopStack[i]);
+
+    out.Write(registeredMask);
+    for (int slot = 0; slot < MaxSlots; ++slot) {
+        if (registeredMask & (1u << slot)) out.Write(registeredBullets[slot]);
+    }
+    out.Write(control ? control->GetProgramId() : BulletScript::NoProgram);
+}
+
+void ShotScript::LoadState(SnapshotReader& in) {
+    ip = in.Read<uint32_t>();
+    in.Read(frame);
+    in.Read(finished);
+    in.Read(defaultTemplateId);
+    in.Read(defaultColorId);
+    in.Read(randomAngleRange);
+    in.Read(defaultAngularVelocity);
+    in.Read(defaultAcceleration);
+    in.Read(baseAngle);
+    loopDepth = std::clamp(in.Read<int>(), 0, MaxLoopDepth);
+    for (int i = 0; i < loopDepth; ++i) in.Read(loopStack[i]);
+
+    in.Read(registeredMask);
+    for (int slot = 0; slot < MaxSlots; ++slot) {
+        if (registeredMask & (1u << slot)) in.Read(registeredBullets[slot]);
+    }
+    const uint32_t controlId = in.Read<uint32_t>();
+    control = BulletScriptManager::GetInstance().GetBulletScript(controlId);
 }
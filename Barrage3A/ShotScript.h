@@ -3,15 +3,78 @@
 #include "ShotInstruction.h"
 #include "BulletType.h"
 #include "BulletScript.h"
+#include "BulletManager.h"
+#include "ScriptNameTable.h"
 #include <memory>
 #include <vector>
-#include <map>
+#include <array>
+#include <span>
 #include <cmath>
+#include <cstdint>
 
+class SnapshotWriter;
+class SnapshotReader;
+
+// ShotInstruction 當Ƒx𔲂sp̖.
+struct ShotOp {
+    ShotInstruction::Type type = ShotInstruction::Type::End;
+    int count = 0;
+    float angle = 0.f;
+    float totalAngle = 0.f;
+    float speed = 0.f;
+    int slot = -1;
+    int extra = 0;
+    float angle2 = 0.f;
+    float maxOffset = 0.f;
+    uint32_t name = ScriptNameTable::NoName;    // SetBulletScript ̒eXNvg, PlaySE  SE .
+    uint32_t firstSpeed = 0;                    // FireMultiSpeed ̑x (ShotProgram ̑x\̈ʒu.  count).
+    float volume = 1.0f;
+};
+
+/// <summary>
+/// o^ɈxgݗĂVbgXNvg̖ߗ.
+/// FireMultiSpeed ̑xׂ͂ 1 {̕\ɋl߂Ď.
+/// </summary>
+class ShotProgram {
+public:
+    static constexpr uint32_t NoProgram = 0xFFFFFFFF;
+private:
+    uint32_t programId = NoProgram;             // ShotScriptManager ̓o^ԍ
+    std::vector<ShotOp> ops;
+    std::vector<float> speedTable;
+    std::shared_ptr<BulletScript> control;      // sJn̒eXNvg
+public:
+    // ߂ǉ
+    void AddInstruction(const ShotInstruction& instr);
+    void SetBulletScript(const std::shared_ptr<BulletScript> _control) { control = _control; }
+
+    const std::vector<ShotOp>& GetOps() const { return ops; }
+    const std::vector<float>& GetSpeedTable() const { return speedTable; }
+    // gݗčς݂̖ߗƑx\̂܂܎ (p^[LbV̓ǂݍݗp).
+    void SetOps(std::vector<ShotOp> _ops, std::vector<float> _speedTable) {
+        ops = std::move(_ops);
+        speedTable = std::move(_speedTable);
+    }
+    std::span<const float> GetSpeeds(const ShotOp& op) const {
+        return { speedTable.data() + op.firstSpeed, static_cast<size_t>(op.count) };
+    }
+    const std::shared_ptr<BulletScript>& GetBulletScript() const { return control; }
+
+    uint32_t GetProgramId() const { return programId; }
+    void SetProgramId(uint32_t id) { programId = id; }
+};
+
+/// <summary>
+/// Vbg 1 {Ԃ̎s. o^ẽXbgƃ[v͌Œ蒷Ŏ.
+/// </summary>
 class ShotScript {
+public:
+    static constexpr uint32_t NoProgram = ShotProgram::NoProgram;
+    static constexpr int MaxSlots = 16;
+    static constexpr int MaxLoopDepth = 8;
 private:
     struct LoopInfo {
-        size_t startIp;       // [vJnʒu̖߃|C^
+        uint32_t startIp;     // [vJnʒu̖߃|C^
         int remainingCount;   // c胋[v
     };
 
@@ -25,9 +88,11 @@ private:
         float acceleration = 0.f;     // x
     };
 
-    std::vector<ShotInstruction> instructions;          // ߗ
-    std::vector<LoopInfo> loopStack;                    // [vԃX^bN
-    std::map<int, RegisteredBullet> registeredBullets;  // o^eǗ
+    const ShotProgram* program = nullptr;
+    std::array<LoopInfo, MaxLoopDepth> loopStack{};     // [vԃX^bN
+    int loopDepth = 0;
+    std::array<RegisteredBullet, MaxSlots> registeredBullets{};     // o^eǗ (slot ԍY)
+    uint32_t registeredMask = 0;                                    // o^ς݂̃Xbg
 
     BulletParentID defaultTemplateId = BulletParentID::B1;  // ftHge
     BulletColor defaultColorId       = BulletColor::Red;    // ftHgF
@@ -43,26 +108,49 @@ private:
     float defaultAcceleration = 0.f;
 
     float baseAngle = 0.f;
+
+    // ꊇ˗p̍Ɨ̈. ˂ 1 XbhŏɍŝőSCX^XŎg.
+    inline static std::vector<BulletSpawn> spawnScratch;
 public:
-    // ߂ǉ
-    void AddInstruction(const ShotInstruction& instr);
+    // Ԃ program s. nullptr Ȃ~܂܂.
+    void Start(const ShotProgram* _program);
 
     // ߎs XV
     void Update(Vector2D position);
 
-    // N[쐬iԂ͏j
-    std::shared_ptr<ShotScript> Clone() const;
-
-    void SetBulletScript(const std::shared_ptr<BulletScript> _control);
-
     // XNvgI
     bool IsFinished() const {
         return finished;
     }
+    bool IsRunning() const { return program && !finished; }
+
+    uint32_t GetProgramId() const { return program ? program->GetProgramId() : NoProgram; }
+
+    // sԂƓo^e. e̐XNvg programId Ŏ.
+    void SaveState(SnapshotWriter& out) const;
+    void LoadState(SnapshotReader& in);
 
 private:
+    // Xbgo^ς݂ɂĕԂ. ͈͊OȂ nullptr.
+    RegisteredBullet* RegisterSlot(int slot) {
+        if (slot < 0 || slot >= MaxSlots) return nullptr;
+        const uint32_t bit = 1u << slot;
+        if (!(registeredMask & bit)) {
+            registeredBullets[slot] = RegisteredBullet{};
+            registeredMask |= bit;
+        }
+        return &registeredBullets[slot];
+    }
+    const RegisteredBullet* FindSlot(int slot) const {
+        if (slot < 0 || slot >= MaxSlots || !(registeredMask & (1u << slot))) return nullptr;
+        return &registeredBullets[slot];
+    }
     // eˏ
     void FireBullet(Vector2D pos, float angle, float speed, int slot = -1);
+    // spawnScratch ɋl߂e܂Ƃ߂Ĕ (ʒu͔ˌ, ItZbg͂ŉZ)
+    void FireBatch(int slot = -1);
+    // ̊px spawnScratch ɒǉ
+    void PushSpread(Vector2D pos, float startAngle, float totalAngle, int count, float speed);
     float CalculateAngleToPlayer(Vector2D from, Vector2D to) const {
         Vector2D diff = to - from;
         return std::atan2(diff.y, diff.x) * 180.f / 3.14159265f;
@@ -4,11 +4,14 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 class ShotScriptManager {
 private:
-    std::unordered_map<std::string, std::shared_ptr<ShotScript>> scripts;
+    std::unordered_map<uint32_t, uint32_t> byName;             // Oԍ  programId
+    std::vector<std::shared_ptr<ShotProgram>> programs;        // o^ (Y = programId)
 
 public:
     static ShotScriptManager& GetInstance() {
@@ -16,25 +19,46 @@ public:
         return instance;
     }
 
-    std::shared_ptr<ShotScript> CloneShotScript(const std::string& id) {
-        auto it = scripts.find(id);
-        if (it == scripts.end()) return nullptr;
-        return it->second->Clone();
+    // Ȃ nullptr.
+    const ShotProgram* FindProgram(std::string_view id) const {
+        return FindProgram(ScriptNameTable::GetInstance().Find(id));
+    }
+    const ShotProgram* FindProgram(uint32_t nameId) const {
+        auto it = byName.find(nameId);
+        return it != byName.end() ? programs[it->second].get() : nullptr;
+    }
+
+    // o^ԍ (XibvVbg̕p).
+    const ShotProgram* GetProgram(uint32_t programId) const {
+        return programId < programs.size() ? programs[programId].get() : nullptr;
     }
 
 
-    void RegisterShotScript(const std::string& id, std::shared_ptr<ShotScript> script) {
+    void RegisterShotScript(const std::string& id, std::shared_ptr<ShotProgram> program) {
         
-        if (id.empty() || !script) {
+        if (id.empty() || !program) {
             return; // ID܂̓XNvgȏꍇ͉Ȃ
         }
 
         // łɓo^ĂȂΑ}
-        auto it = scripts.find(id);
+        const uint32_t nameId = ScriptNameTable::GetInstance().Intern(id);
+        if (byName.contains(nameId)) {
+            return;
+        }
+        program->SetProgramId(static_cast<uint32_t>(programs.size()));
+        byName[nameId] = program->GetProgramId();
+        programs.push_back(std::move(program));
+    }
 
-        if (it != scripts.end()) {
+    // o^Ȃo^, o^ς݂Ȃ programId ۂ܂ܒgւ.
+    void ReplaceShotScript(const std::string& id, std::shared_ptr<ShotProgram> program) {
+        if (id.empty() || !program) return;
+        auto it = byName.find(ScriptNameTable::GetInstance().Intern(id));
+        if (it == byName.end()) {
+            RegisterShotScript(id, std::move(program));
             return;
         }
-        scripts[id] = script;
+        program->SetProgramId(it->second);
+        *programs[it->second] = std::move(*program);
     }
 };
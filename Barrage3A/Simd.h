@@ -0,0 +1,14 @@
+﻿/*
+    Simd.h
+
+    作成日         : 2026/10/19
+    最終変更日     : 2026/10/19
+*/
+#pragma once
+
+// SSE2 が使える環境でのみ USE_SIMD を定義して組み込み関数のヘッダーを読む.
+// 使う側は #ifdef USE_SIMD の中だけで _mm_* を使い, それ以外はスカラーで処理する.
+#if defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__) || defined(__AVX__)
+#define USE_SIMD
+#include <emmintrin.h>
+#endif
@@ -0,0 +1,146 @@
+/*
+    SnapshotStream.h
+
+    :class
+        - SnapshotWriter
+        - SnapshotReader
+
+    쐬         : 2026/10/19
+    ŏIύX     : 2026/10/19
+*/
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// XibvVbgp̃oCg񏑂.
+// l^͂̂܂ memcpy ŋl߂ (GfBAEpfBO݂œrhł̂ݗL).
+class SnapshotWriter {
+private:
+    std::vector<uint8_t>& buffer;
+public:
+    explicit SnapshotWriter(std::vector<uint8_t>& out) : buffer(out) {}
+
+    void WriteBytes(const void* data, size_t size) {
+        if (size == 0) return;
+        const size_t pos = buffer.size();
+        buffer.resize(pos + size);
+        std::memcpy(buffer.data() + pos, data, size);
+    }
+
+    template<typename T>
+    void Write(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "Write  memcpy \Ȍ^̂.");
+        WriteBytes(&value, sizeof(T));
+    }
+
+    // vf (u32) + vf.
+    template<typename T>
+    void WriteArray(const T* data, size_t count) {
+        static_assert(std::is_trivially_copyable_v<T>, "WriteArray  memcpy \Ȍ^̂.");
+        Write(static_cast<uint32_t>(count));
+        WriteBytes(data, count * sizeof(T));
+    }
+
+    template<typename T>
+    void WriteVector(const std::vector<T>& values) {
+        WriteArray(values.data(), values.size());
+    }
+
+    void WriteString(const std::string& value) {
+        WriteArray(value.data(), value.size());
+    }
+
+    // tubN. g𕜌łȂꍇɓǂݑۂƓǂݔ΂.
+    size_t BeginBlock() {
+        Write(static_cast<uint32_t>(0));
+        return buffer.size();
+    }
+    void EndBlock(size_t start) {
+        const uint32_t length = static_cast<uint32_t>(buffer.size() - start);
+        std::memcpy(buffer.data() + start - sizeof(uint32_t), &length, sizeof(uint32_t));
+    }
+
+    size_t Size() const { return buffer.size(); }
+};
+
+// SnapshotWriter ŏoCg̓ǂݏo.
+// ͈͊OǂƂ_ŎsԂɂȂ, ȍ~̓ǂݏo͑SĊlԂ.
+class SnapshotReader {
+private:
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    size_t pos = 0;
+    bool failed = false;
+public:
+    SnapshotReader(const uint8_t* _data, size_t _size) : data(_data), size(_size) {}
+    explicit SnapshotReader(const std::vector<uint8_t>& in) : data(in.data()), size(in.size()) {}
+
+    bool ReadBytes(void* out, size_t count) {
+        if (failed || pos + count > size) {
+            failed = true;
+            return false;
+        }
+        if (count > 0) std::memcpy(out, data + pos, count);
+        pos += count;
+        return true;
+    }
+
+    template<typename T>
+    T Read() {
+        static_assert(std::is_trivially_copyable_v<T>, "Read  memcpy \Ȍ^̂.");
+        T value{};
+        ReadBytes(&value, sizeof(T));
+        return value;
+    }
+
+    template<typename T>
+    void Read(T& value) {
+        value = Read<T>();
+    }
+
+    template<typename T>
+    void ReadVector(std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable_v<T>, "ReadVector  memcpy \Ȍ^̂.");
+        const uint32_t count = Read<uint32_t>();
+        if (failed || pos + static_cast<size_t>(count) * sizeof(T) > size) {
+            failed = true;
+            values.clear();
+            return;
+        }
+        values.resize(count);
+        ReadBytes(values.data(), count * sizeof(T));
+    }
+
+    void ReadString(std::string& value) {
+        const uint32_t count = Read<uint32_t>();
+        if (failed || pos + count > size) {
+            failed = true;
+            value.clear();
+            return;
+        }
+        value.assign(reinterpret_cast<const char*>(data + pos), count);
+        pos += count;
+    }
+
+    // BeginBlock / EndBlock ŏubN̒ƏI[ʒu.
+    size_t BeginBlock() {
+        const uint32_t length = Read<uint32_t>();
+        return pos + length;
+    }
+    // ubN̏I[ֈړ (ǂݎcEǂ݉߂z).
+    void EndBlock(size_t end) {
+        if (failed || end > size) {
+            failed = true;
+            return;
+        }
+        pos = end;
+    }
+
+    size_t Position() const { return pos; }
+    bool IsFailed() const { return failed; }
+    bool IsEnd() const { return pos >= size; }
+};
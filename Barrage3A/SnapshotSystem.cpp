@@ -0,0 +1,221 @@
+#include "SnapshotSystem.h"
+#include "SnapshotStream.h"
+#include "GameObjectMgr.h"
+#include "GameManager.h"
+#include "PlayerBase.h"
+#include "EnemyManager.h"
+#include "BulletManager.h"
+#include "ItemManager.h"
+#include "ReplaySystem.h"
+#include "Random.h"
+#include "Debug.hpp"
+#include <chrono>
+#include <type_traits>
+
+static_assert(std::is_trivially_copyable_v<std::mt19937>, "GW memcpy ŕۑ.");
+
+namespace {
+    double ElapsedMs(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    bool IsSnapshotLayer(Layer layer) {
+        return layer == Layer::Enemy || layer == Layer::EnemyBullet ||
+               layer == Layer::Item  || layer == Layer::PlayerBullet;
+    }
+
+    std::shared_ptr<PlayerBase> GetPlayer() {
+        auto player = GameManager::GetInstance().GetPlayer();
+        return player ? player->GetAppBase<PlayerBase>() : nullptr;
+    }
+}
+
+// ---- ۑE ------------------------------------------------------------
+// [Magic u32][Version u16][\ u16][Frame u32]
+// [Random][GameManager][Player][EnemyManager][BulletManager][ItemManager][ReplaySystem]
+
+void SnapshotSystem::Capture(GameSnapshot& out) {
+    const auto start = std::chrono::steady_clock::now();
+
+    out.data.clear();
+    SnapshotWriter writer(out.data);
+    writer.Write(Magic);
+    writer.Write(Version);
+    writer.Write(static_cast<uint16_t>(0));
+    writer.Write(frame);
+
+    writer.Write(Random.GetSeed());
+    writer.Write(Random.GetEngine());
+    for (int i = 1; i < static_cast<int>(RandomStream::Count); ++i) {
+        writer.Write(Random.Stream(static_cast<RandomStream>(i)).GetEngine());
+    }
+
+    GameManager::GetInstance().SaveState(writer);
+
+    const size_t playerBlock = writer.BeginBlock();
+    if (auto player = GetPlayer()) player->SaveState(writer);
+    writer.EndBlock(playerBlock);
+
+    EnemyManager::GetInstance().SaveState(writer);
+    BulletManager::Instance().SaveState(writer);
+    ItemManager::GetInstance().SaveState(writer);
+    ReplaySystem::GetInstance().SaveState(writer);
+
+    out.frame = frame;
+    out.valid = true;
+    lastCaptureMs = ElapsedMs(start);
+}
+
+void SnapshotSystem::ClearField() {
+    // t[ɐꂽ̂Ώۂɂ邽ߐɓo^m.
+    Object.ProcessNewObjects();
+    Object.DestroyWhere([](const GameObject& obj) { return IsSnapshotLayer(obj.GetLayer()); });
+    Object.ProcessDestroyQueue();
+}
+
+bool SnapshotSystem::Restore(const GameSnapshot& in) {
+    if (!in.valid) return false;
+    const auto start = std::chrono::steady_clock::now();
+
+    SnapshotReader reader(in.data);
+    if (reader.Read<uint32_t>() != Magic || reader.Read<uint16_t>() != Version) {
+        GameEngine::Debug::ErrorLog("Snapshot: unknown format");
+        return false;
+    }
+    reader.Read<uint16_t>();
+    const uint32_t snapshotFrame = reader.Read<uint32_t>();
+
+    ClearField();
+
+    const uint32_t seed = reader.Read<uint32_t>();
+    Random.SetSeed(seed);
+    reader.Read(Random.GetEngine());
+    for (int i = 1; i < static_cast<int>(RandomStream::Count); ++i) {
+        reader.Read(Random.Stream(static_cast<RandomStream>(i)).GetEngine());
+    }
+
+    GameManager::GetInstance().LoadState(reader);
+
+    // @Ȃ (܂͕ۑɂȂ) ꍇ͓ǂݔ΂.
+    const size_t playerEnd = reader.BeginBlock();
+    auto player = GetPlayer();
+    if (player && reader.Position() < playerEnd) player->LoadState(reader);
+    reader.EndBlock(playerEnd);
+
+    EnemyManager::GetInstance().LoadState(reader);
+    BulletManager::Instance().LoadState(reader);
+    ItemManager::GetInstance().LoadState(reader);
+    ReplaySystem::GetInstance().LoadState(reader);
+
+    // 蒼IuWFNg̓o^ɕׂ.
+    Object.ProcessNewObjects();
+    Object.SortByInstanceID();
+
+    frame = snapshotFrame;
+    lastRestoreMs = ElapsedMs(start);
+
+    if (reader.IsFailed()) {
+        GameEngine::Debug::ErrorLog("Snapshot: data truncated (frame {:d})", snapshotFrame);
+        return false;
+    }
+    return true;
+}
+
+// ---- v --------------------------------------------------------------------
+
+const GameSnapshot* SnapshotSystem::FindRingSnapshot(uint32_t targetFrame) const {
+    const GameSnapshot* best = nullptr;
+    for (const auto& snapshot : ring) {
+        if (!snapshot.valid || snapshot.frame > targetFrame) continue;
+        if (!best || snapshot.frame > best->frame) best = &snapshot;
+    }
+    return best;
+}
+
+bool SnapshotSystem::RequestRewind(uint32_t targetFrame) {
+    const GameSnapshot* snapshot = FindRingSnapshot(targetFrame);
+    if (!snapshot) return false;
+    pendingRestore = snapshot;
+    return true;
+}
+
+void SnapshotSystem::RequestSpawnPoint(int row) {
+    const int csvIndex = EnemyManager::GetInstance().GetCurrentCsvIndex();
+    auto it = spawnPoints.find(SpawnKey(csvIndex, row));
+    if (it != spawnPoints.end()) {
+        pendingRestore = &it->second;
+        return;
+    }
+    pendingSpawnRow = row;
+}
+
+bool SnapshotSystem::HasSpawnPoint(int row) const {
+    const int csvIndex = EnemyManager::GetInstance().GetCurrentCsvIndex();
+    return spawnPoints.count(SpawnKey(csvIndex, row)) > 0;
+}
+
+// ---- t[ ----------------------------------------------------------
+
+void SnapshotSystem::CaptureSpawnPoints() {
+    const auto& rows = EnemyManager::GetInstance().GetSpawnedRows();
+    if (rows.empty()) return;
+
+    const int csvIndex = EnemyManager::GetInstance().GetCurrentCsvIndex();
+    const GameSnapshot* captured = nullptr;
+    for (int row : rows) {
+        auto& snapshot = spawnPoints[SpawnKey(csvIndex, row)];
+        if (snapshot.valid) continue;           // ŏɓB̂
+        // t[ɏos 1 ̕ۑL.
+        if (captured) snapshot = *captured;
+        else {
+            Capture(snapshot);
+            captured = &snapshot;
+        }
+    }
+}
+
+void SnapshotSystem::EndFrame() {
+    ++frame;
+
+    if (pendingRestore) {
+        const GameSnapshot* snapshot = pendingRestore;
+        pendingRestore = nullptr;
+        pendingSpawnRow = -1;
+        if (Restore(*snapshot)) {
+            // ߂̃O͕ʂ̎ԎɂȂ̂Ŏ̂Ă.
+            for (auto& entry : ring) {
+                if (entry.frame > frame) entry.valid = false;
+            }
+        }
+        return;     // t[͋L^Ȃ
+    }
+    if (pendingSpawnRow >= 0) {
+        ClearField();
+        EnemyManager::GetInstance().SeekSpawn(pendingSpawnRow);
+        pendingSpawnRow = -1;
+        return;
+    }
+
+    if (spawnPointEnabled) CaptureSpawnPoints();
+
+    if (ringEnabled && !ring.empty() && frame % interval == 0) {
+        Capture(ring[ringHead]);
+        ringHead = (ringHead + 1) % ring.size();
+    }
+}
+
+void SnapshotSystem::Clear() {
+    frame = 0;
+    ringHead = 0;
+    for (auto& entry : ring) entry.valid = false;
+    spawnPoints.clear();
+    pendingRestore = nullptr;
+    pendingSpawnRow = -1;
+}
+
+void SnapshotSystem::SetRingCapacity(size_t count) {
+    pendingRestore = nullptr;   // OwĂ\
+    ring.resize(count > 0 ? count : 1);
+    ringHead = 0;
+    for (auto& entry : ring) entry.valid = false;
+}
@@ -0,0 +1,101 @@
+/*
+    SnapshotSystem.h
+
+    :class
+        - GameSnapshot
+        - SnapshotSystem
+
+    쐬         : 2026/10/19
+    ŏIύX     : 2026/10/19
+*/
+#pragma once
+
+#include <vector>
+#include <map>
+#include <cstdint>
+#include <cstddef>
+
+// 鎞_̃Q[ 1 . data ͎g񂷂̂ŎB蒼ĂĊmۂȂ.
+struct GameSnapshot {
+    uint32_t frame = 0;             // SnapshotSystem ̃t[ԍ.
+    bool valid = false;
+    std::vector<uint8_t> data;
+};
+
+/// <summary>
+/// Q[is̕ۑƕ.
+/// EGameManager ̃Xe[^XE@EoisEGEGeEACeEvC̈ʒu
+/// 1 {̃oCgɏo, t[ƂɃO֎c (߂EvC̃V[Np).
+/// G̏o (EnemySpawn ̊es) ƂɂۑĂ, K[hł̒n_ĊJł.
+/// ̓t[̓rōsȂ̂, v󂯂 EndFrame ł܂Ƃ߂čs.
+/// @̒eEopIuWFNgER[`͊܂߂Ȃ (Ɏ@e͏).
+/// </summary>
+class SnapshotSystem {
+public:
+    static constexpr uint32_t Magic   = 0x50414E53;   // "SNAP"
+    static constexpr uint16_t Version = 2;
+private:
+    uint32_t frame = 0;
+
+    // ߂p̃O.
+    std::vector<GameSnapshot> ring;
+    size_t ringHead = 0;
+    uint32_t interval = 30;             // t[ƂɎc.
+    bool ringEnabled = false;
+
+    // on_ (L[: CSV ԍ << 32 | s).
+    std::map<uint64_t, GameSnapshot> spawnPoints;
+    bool spawnPointEnabled = false;
+
+    // EndFrame ōs.
+    const GameSnapshot* pendingRestore = nullptr;
+    int pendingSpawnRow = -1;           // XibvVbgon_ւ̓o.
+
+    // v (߂ 1 ).
+    double lastCaptureMs = 0.0;
+    double lastRestoreMs = 0.0;
+
+    SnapshotSystem() { SetRingCapacity(20); }
+    ~SnapshotSystem() = default;
+
+    static uint64_t SpawnKey(int csvIndex, int row) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(csvIndex)) << 32) | static_cast<uint32_t>(row);
+    }
+    // ۑΏۂ̃IuWFNg (GEGeEACeE@e) ꂩ.
+    void ClearField();
+    void CaptureSpawnPoints();
+    const GameSnapshot* FindRingSnapshot(uint32_t targetFrame) const;
+public:
+    static SnapshotSystem& GetInstance() {
+        static SnapshotSystem instance;
+        return instance;
+    }
+
+    // ݂̏Ԃo / ߂. Restore ̓t[̋ (EndFrame) ȊOŌĂ΂Ȃ.
+    void Capture(GameSnapshot& out);
+    bool Restore(const GameSnapshot& in);
+
+    // ̗v. s͍t[ EndFrame. nXibvVbg͂܂ŕێ邱.
+    void RequestRestore(const GameSnapshot& snapshot) { pendingRestore = &snapshot; }
+    // O targetFrame ȑO̍ŐV֖߂. Ȃ false.
+    bool RequestRewind(uint32_t targetFrame);
+    bool RequestRewindFrames(uint32_t frames) { return RequestRewind(frames < frame ? frame - frames : 0); }
+    // K[h. ݂ CSV ̎wsĊJ (B̍s͓ô).
+    void RequestSpawnPoint(int row);
+
+    // Engine::LateUpdate ̍ŌɌĂ.
+    void EndFrame();
+
+    // OEon_̋L^̂Ăăt[ԍ 0 ɖ߂ (Xe[WJnEvCJn).
+    void Clear();
+
+    void SetRingCapacity(size_t count);
+    void SetInterval(uint32_t frames) { interval = frames > 0 ? frames : 1; }
+    void SetRingEnabled(bool enable) { ringEnabled = enable; }
+    void SetSpawnPointEnabled(bool enable) { spawnPointEnabled = enable; }
+
+    bool HasSpawnPoint(int row) const;
+    uint32_t GetFrame() const { return frame; }
+    double GetLastCaptureMs() const { return lastCaptureMs; }
+    double GetLastRestoreMs() const { return lastRestoreMs; }
+};
@@ -0,0 +1,74 @@
+/*
+    SpscQueue.hpp
+
+    :class
+        - SpscQueue
+
+    쐬         : 2026/10/19
+    ŏIύX     : 2026/10/19
+*/
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+
+namespace System {
+
+    //  1 XbhEǂݏo 1 Xbhp̌Œ蒷Oobt@ (bNȂ).
+    // Capacity  2 ׂ̂. tȂ Push ͎s (҂Ȃ).
+    template<typename T, size_t Capacity>
+    class SpscQueue {
+        static_assert((Capacity & (Capacity - 1)) == 0, "Capacity  2 ׂ̂");
+        static_assert(std::is_trivially_copyable_v<T>, "vf͂̂܂܃Rs[ł^Ɍ");
+    private:
+        static constexpr size_t Mask = Capacity - 1;
+
+        std::array<T, Capacity> items{};
+        alignas(64) std::atomic<size_t> head{ 0 };      // ɓǂވʒu (ǂݏoXV).
+        alignas(64) std::atomic<size_t> tail{ 0 };      // ɏʒu (ݑXV).
+    public:
+        bool TryPush(const T& item) {
+            const size_t t = tail.load(std::memory_order_relaxed);
+            if (t - head.load(std::memory_order_acquire) >= Capacity) return false;
+            items[t & Mask] = item;
+            tail.store(t + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool TryPop(T& item) {
+            const size_t h = head.load(std::memory_order_relaxed);
+            if (h == tail.load(std::memory_order_acquire)) return false;
+            item = items[h & Mask];
+            head.store(h + 1, std::memory_order_release);
+            return true;
+        }
+
+        // ܂Ƃ߂ď. Ԃ.
+        size_t Push(const T* src, size_t count) {
+            const size_t t = tail.load(std::memory_order_relaxed);
+            count = (std::min)(count, Capacity - (t - head.load(std::memory_order_acquire)));
+            for (size_t i = 0; i < count; ++i) items[(t + i) & Mask] = src[i];
+            tail.store(t + count, std::memory_order_release);
+            return count;
+        }
+
+        // ܂Ƃ߂ēǂ. ǂ߂Ԃ.
+        size_t Pop(T* dst, size_t count) {
+            const size_t h = head.load(std::memory_order_relaxed);
+            count = (std::min)(count, tail.load(std::memory_order_acquire) - h);
+            for (size_t i = 0; i < count; ++i) dst[i] = items[(h + i) & Mask];
+            head.store(h + count, std::memory_order_release);
+            return count;
+        }
+
+        // ʃXbh猩T.
+        size_t Size() const {
+            return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+        }
+        size_t FreeSpace() const { return Capacity - Size(); }
+        static constexpr size_t GetCapacity() { return Capacity; }
+    };
+}
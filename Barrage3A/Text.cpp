@@ -65,25 +65,31 @@ void Text::OnUiDraw(const Quad2D& quad, const std::shared_ptr<Canvas>& rect) {
     float width  = quad.topRight.x - quad.topLeft.x;
     float height = quad.bottomLeft.y - quad.topLeft.y;
 
-    // 2) ラップして描画する行を取得
-    auto lines      = PrepareLines(text, width);
-
-    // 3) 描画用寸法・スケールを計算
-    TextLayout layout = ComputeLayout(lines, quad, width, height);
+    // 2) 入力が変わった時のみレイアウトを作り直す (位置の移動だけなら再利用)
+    Vector2D ts = transform->GetWorldScale();
+    if (!cache.valid || cache.width != width || cache.height != height || cache.worldScale != ts) {
+        BuildLayout(width, height, ts);
+    }
 
-    // 4) 実際の描画
+    // 3) キャッシュを再生して描画
     SetDrawBlendMode(DX_BLENDMODE_ALPHA, color.A255());
     if (spriteFont) {
-        DrawWithSpriteFont(lines, layout);
-    }
-    else if(font) {
-        DrawWithDxFont(lines, layout);
+        DrawCachedGlyphs(quad.topLeft);
     }
     else {
-        DrawFallbackText(lines, quad);
+        DrawCachedLines(quad.topLeft);
     }
     SetDrawBlendMode(DX_BLENDMODE_NOBLEND, 0);
 }
+
+void Text::SetText(const std::string& t) {
+    if (t == text) return;
+    if (!TryUpdateDigitsInPlace(t)) {
+        cache.valid = false;
+    }
+    text = t;
+}
+
 /*
 // --- OnUiDraw 実装 ---
 void Text::OnUiDraw(const Quad2D& quad, const std::shared_ptr<Canvas>& rect) {
@@ -238,28 +244,42 @@ void Text::OnUiDraw(const Quad2D& quad, const std::shared_ptr<Canvas>& rect) {
 }
 */
 
+// Shift-JIS の1文字分のバイト数.
+static size_t CharByteLength(const std::string& str, size_t i) {
+    unsigned char c = static_cast<unsigned char>(str[i]);
+    bool lead = (c >= 0x81 && c <= 0x9F) || (c >= 0xE0 && c <= 0xFC);
+    return (lead && i + 1 < str.size()) ? 2 : 1;
+}
+
 // --- 既存 WrapText（単純文字列） ---
+// 文字幅を1文字ずつ加算する (行全体を毎回測り直さない).
 std::vector<std::string> Text::WrapText(const std::string& text, int fontHandle, float maxWidth) {
     std::vector<std::string> lines;
     std::string currentLine;
+    int lineWidth = 0;
 
-    for (char c : text) {
-        if (c == '\n') {
+    for (size_t i = 0; i < text.size();) {
+        if (text[i] == '\n') {
             lines.push_back(currentLine);
             currentLine.clear();
+            lineWidth = 0;
+            ++i;
             continue;
         }
 
-        std::string trialLine = currentLine + c;
-        int w = GetDrawStringWidthToHandle(trialLine.c_str(), (int)trialLine.size(), fontHandle);
+        size_t len = CharByteLength(text, i);
+        int w = GetDrawStringWidthToHandle(text.c_str() + i, (int)len, fontHandle);
 
-        if (w > maxWidth && !currentLine.empty()) {
+        if (lineWidth + w > maxWidth && !currentLine.empty()) {
             lines.push_back(currentLine);
-            currentLine = c;
+            currentLine.assign(text, i, len);
+            lineWidth = w;
         }
         else {
-            currentLine += c;
+            currentLine.append(text, i, len);
+            lineWidth += w;
         }
+        i += len;
     }
 
     if (!currentLine.empty()) {
@@ -282,12 +302,16 @@ int Text::GetMaxLineWidth(const std::vector<std::string>& lines, int fontHandle)
 // --- 指定幅に収まるようにテキストを途中で切る ---
 std::string Text::TruncateTextToWidth(const std::string& text, int fontHandle, float maxWidth) {
     std::string result;
-    for (size_t i = 0; i < text.size(); ++i) {
-        std::string candidate = result + text[i];
-        if (GetDrawStringWidthToHandle(candidate.c_str(), (int)candidate.size(), fontHandle) > maxWidth) {
+    int width = 0;
+    for (size_t i = 0; i < text.size();) {
+        size_t len = CharByteLength(text, i);
+        int w = GetDrawStringWidthToHandle(text.c_str() + i, (int)len, fontHandle);
+        if (width + w > maxWidth) {
             break;
         }
-        result.push_back(text[i]);
+        result.append(text, i, len);
+        width += w;
+        i += len;
     }
     return result;
 }
@@ -353,7 +377,34 @@ TextLayout Text::ComputeLayout(
     return lo;
 }
 
-void Text::DrawWithDxFont(
+void Text::BuildLayout(float width, float height, const Vector2D& worldScale) {
+    cache.lines.clear();
+    cache.params.clear();
+    cache.inheritColor.clear();
+    cache.glyphs.clear();
+    cache.width      = width;
+    cache.height     = height;
+    cache.worldScale = worldScale;
+
+    // 表示領域の左上を原点としたローカル矩形でレイアウトする.
+    Quad2D local{ Vector2D(0, 0), Vector2D(width, 0), Vector2D(0, height), Vector2D(width, height) };
+
+    auto lines = PrepareLines(text, width);
+    if (spriteFont) {
+        cache.layout = ComputeLayout(lines, local, width, height);
+        LayoutSpriteFont(lines, cache.layout);
+    }
+    else if (font) {
+        cache.layout = ComputeLayout(lines, local, width, height);
+        LayoutDxFont(lines, cache.layout);
+    }
+    else {
+        LayoutFallbackText(lines, width, height);
+    }
+    cache.valid = true;
+}
+
+void Text::LayoutDxFont(
     const std::vector<std::string>& lines,
     const TextLayout& lo)
 {
@@ -383,26 +434,11 @@ void Text::DrawWithDxFont(
 
         float dy = lo.baseY + i * lo.lineHeight * lineSpacing * lo.scaleY;
 
-        if (lo.fontHandle >= 0) {
-            DrawExtendStringToHandle(
-                (int)dx, (int)dy,
-                lo.scaleX, lo.scaleY,
-                line.c_str(),
-                color.ToPackedRGB(),
-                lo.fontHandle
-            );
-        }
-        else {
-            DrawString(
-                (int)dx, (int)dy,
-                line.c_str(),
-                color.ToPackedRGB()
-            );
-        }
+        cache.lines.push_back({ line, dx, dy });
     }
 }
 
-void Text::DrawWithSpriteFont(const std::vector<std::string>& lines, const TextLayout& lo) {
+void Text::LayoutSpriteFont(const std::vector<std::string>& lines, const TextLayout& lo) {
     GameEngine::SpriteFont::DrawParam baseParam;
     baseParam.fontSize = static_cast<float>(fontSize);
     baseParam.scale = spriteFont->ComputeScale(baseParam.fontSize);
@@ -438,7 +474,7 @@ void Text::DrawWithSpriteFont(const std::vector<std::string>& lines, const TextL
         // --- 4. ペン初期化
         float penX = drawX;
 
-        // --- 5. セグメント描画
+        // --- 5. セグメントをグリフ列として配置
         for (const auto& seg : segments) {
             GameEngine::SpriteFont::DrawParam param = baseParam;
             param.fontSize *= seg.sizePercent / 100.f;
@@ -450,6 +486,10 @@ void Text::DrawWithSpriteFont(const std::vector<std::string>& lines, const TextL
             param.italic = seg.italic;
             param.outlineWidth = seg.outlineWidth;
 
+            int paramIndex = static_cast<int>(cache.params.size());
+            cache.params.push_back(param);
+            cache.inheritColor.push_back(seg.color == -1);
+
             float offsetY = spriteFont->GetGlyphHeight() * (baseParam.scale - param.scale);
             float offsetX = spriteFont->GetCharPixelWidth(' ') * (baseParam.scale - param.scale) * 0.5f;
 
@@ -459,7 +499,7 @@ void Text::DrawWithSpriteFont(const std::vector<std::string>& lines, const TextL
                 float dx = penX + ox * param.scale + offsetX;
                 float dy = drawY + oy * param.scale + offsetY;
 
-                spriteFont->DrawGlyph(dx, dy, c, param);
+                cache.glyphs.push_back({ dx, dy, c, paramIndex });
 
                 float advance = (spriteFont->GetCharPixelWidth(c) + param.letterSpacing + spriteFont->GetCharKerning(c)) * param.scale;
                 penX += advance;
@@ -468,13 +508,11 @@ void Text::DrawWithSpriteFont(const std::vector<std::string>& lines, const TextL
     }
 }
 
-// フォント未設定時のフォールバック描画
-void Text::DrawFallbackText(const std::vector<std::string>& lines, const Quad2D& quad) {
+// フォント未設定時のフォールバック配置
+void Text::LayoutFallbackText(const std::vector<std::string>& lines, float width, float height) {
     const int defaultFontHeight = static_cast<int>(fontSize * lineSpacing);
-    float width = quad.topRight.x - quad.topLeft.x;
-    float height = quad.bottomLeft.y - quad.topLeft.y;
 
-    float baseY = quad.topLeft.y;
+    float baseY = 0.0f;
 
     if (anchor == TextAnchor::MiddleLeft || anchor == TextAnchor::MiddleCenter || anchor == TextAnchor::MiddleRight)
         baseY += (height - defaultFontHeight * lines.size()) / 2.f;
@@ -485,7 +523,7 @@ void Text::DrawFallbackText(const std::vector<std::string>& lines, const Quad2D&
         const std::string& line = lines[i];
         int lineWidth = GetDrawStringWidth(line.c_str(), (int)line.size());
 
-        float drawX = quad.topLeft.x;
+        float drawX = 0.0f;
         if (anchor == TextAnchor::UpperCenter || anchor == TextAnchor::MiddleCenter || anchor == TextAnchor::LowerCenter) {
             drawX += (width - lineWidth) / 2.f;
         }
@@ -496,12 +534,72 @@ void Text::DrawFallbackText(const std::vector<std::string>& lines, const Quad2D&
 
         float drawY = baseY + i * defaultFontHeight;
 
-        DrawString(
-            static_cast<int>(drawX),
-            static_cast<int>(drawY),
-            line.c_str(),
-            color.ToPackedRGB()
-        );
+        cache.lines.push_back({ line, drawX, drawY });
+    }
+}
+
+// 同じ送り幅・オフセットを持つ文字か (差し替えても配置が変わらない).
+static bool IsSameGlyphMetrics(const GameEngine::SpriteFont& sf, char a, char b) {
+    return sf.GetCharPixelWidth(a) == sf.GetCharPixelWidth(b)
+        && sf.GetCharKerning(a)    == sf.GetCharKerning(b)
+        && sf.GetCharOffset(a)     == sf.GetCharOffset(b);
+}
+
+// HUD のカウンタ等、桁数が変わらない数字の更新はグリフの文字だけ差し替える.
+bool Text::TryUpdateDigitsInPlace(const std::string& next) {
+    if (!cache.valid || !spriteFont || bestFit) return false;
+    if (next.size() != text.size()) return false;
+    // タグ内の数字は対象外.
+    if (text.find('<') != std::string::npos || next.find('<') != std::string::npos) return false;
+
+    auto isDigit = [](char c) { return c >= '0' && c <= '9'; };
+    for (size_t i = 0; i < next.size(); ++i) {
+        char a = text[i], b = next[i];
+        if (a == b) continue;
+        if (!isDigit(a) || !isDigit(b)) return false;
+        if (!IsSameGlyphMetrics(*spriteFont, a, b)) return false;
+    }
+
+    // 数字グリフは元テキストの数字と同じ順で並んでいる (カンマは数字以外).
+    size_t src = 0;
+    for (auto& glyph : cache.glyphs) {
+        if (!isDigit(glyph.c)) continue;
+        while (src < next.size() && !isDigit(next[src])) ++src;
+        if (src >= next.size()) break;
+        glyph.c = next[src++];
     }
+    return true;
 }
 
+void Text::DrawCachedLines(const Vector2D& origin) const {
+    const TextLayout& lo = cache.layout;
+    for (const auto& run : cache.lines) {
+        int dx = (int)(origin.x + run.x);
+        int dy = (int)(origin.y + run.y);
+        if (font && lo.fontHandle >= 0) {
+            DrawExtendStringToHandle(
+                dx, dy,
+                lo.scaleX, lo.scaleY,
+                run.text.c_str(),
+                color.ToPackedRGB(),
+                lo.fontHandle
+            );
+        }
+        else {
+            DrawString(dx, dy, run.text.c_str(), color.ToPackedRGB());
+        }
+    }
+}
+
+void Text::DrawCachedGlyphs(const Vector2D& origin) const {
+    GameEngine::SpriteFont::DrawParam param;
+    int current = -1;
+    for (const auto& glyph : cache.glyphs) {
+        if (glyph.paramIndex != current) {
+            current = glyph.paramIndex;
+            param = cache.params[current];
+            if (cache.inheritColor[current]) param.color = color;   // 色はレイアウト外.
+        }
+        spriteFont->DrawGlyph(origin.x + glyph.x, origin.y + glyph.y, glyph.c, param);
+    }
+}
@@ -50,6 +50,32 @@ struct TextLayout {
     float  width;
 };
 
+// 配置済みのグリフ (SpriteFont 用). 座標は表示領域左上からの相対.
+struct TextGlyph {
+    float x, y;
+    char  c;
+    int   paramIndex;       // TextLayoutCache::params の添字.
+};
+
+// 配置済みの行 (DxLib フォント / フォールバック用). 座標は表示領域左上からの相対.
+struct TextLineRun {
+    std::string text;
+    float x, y;
+};
+
+// Text の描画キャッシュ. テキスト・フォント・サイズ・矩形が変わった時のみ再構築.
+struct TextLayoutCache {
+    bool     valid = false;
+    float    width = 0.0f, height = 0.0f;   // 構築時の表示領域サイズ.
+    Vector2D worldScale;                    // 構築時のワールドスケール.
+    TextLayout layout{};
+
+    std::vector<TextLineRun> lines;
+    std::vector<GameEngine::SpriteFont::DrawParam> params;
+    std::vector<bool>        inheritColor;  // params ごとに Text の色を使うか.
+    std::vector<TextGlyph>   glyphs;
+};
+
 // Text class and AppBase class
 class Text : public UiBase {
 private:    // 非公開.
@@ -69,38 +95,41 @@ private:    // 非公開.
     float maxSize = 64.0f; // 最大フォントサイズ
     bool autoComma = false; // 自動カンマ挿入を有効にする
 
+    TextLayoutCache cache;  // 描画レイアウトのキャッシュ.
+
 public:     // 公開.
     // コンストラクタ.
     Text();
     Text(std::shared_ptr<GameObject>);
 
-    void SetText(const std::string& t) { text = t; }
+    // 数字のみの変化は可能ならレイアウトを作り直さず差し替える.
+    void SetText(const std::string& t);
     const std::string& GetText() const { return text; }
 
-    void SetFont(const std::shared_ptr<Font>& f) { font = f; }
+    void SetFont(const std::shared_ptr<Font>& f) { font = f; cache.valid = false; }
     const std::shared_ptr<Font>& GetFont() const { return font; }
 
-    void SetSpriteFont(const std::shared_ptr<GameEngine::SpriteFont>& f) { spriteFont = f; }
+    void SetSpriteFont(const std::shared_ptr<GameEngine::SpriteFont>& f) { spriteFont = f; cache.valid = false; }
     const std::shared_ptr<GameEngine::SpriteFont>& GetSpriteFont() const { return spriteFont; }
 
-	void SetLineSpacing(float spacing) { lineSpacing =  spacing; }
+	void SetLineSpacing(float spacing) { lineSpacing =  spacing; cache.valid = false; }
 
     void SetColor(const Color& c) { color = c; }
     const Color& GetColor() const { return color; }
 
-    void SetTextAnchor(TextAnchor align) { anchor = align; }
+    void SetTextAnchor(TextAnchor align) { anchor = align; cache.valid = false; }
 
-    void SetHorizontalOverflow(HorizontalOverflow val) { hOverflow = val; }
-    void SetVerticalOverflow(VerticalOverflow val) { vOverflow = val; }
+    void SetHorizontalOverflow(HorizontalOverflow val) { hOverflow = val; cache.valid = false; }
+    void SetVerticalOverflow(VerticalOverflow val) { vOverflow = val; cache.valid = false; }
 
-	void SetBestFit(bool fit)   { bestFit = fit;  }
+	void SetBestFit(bool fit)   { bestFit = fit; cache.valid = false; }
 	bool GetBestFit() const     { return bestFit; }
-	void SetMinSize(float size) { minSize = size; }
+	void SetMinSize(float size) { minSize = size; cache.valid = false; }
 	float GetMinSize() const    { return minSize; }
-	void SetMaxSize(float size) { maxSize = size; }
+	void SetMaxSize(float size) { maxSize = size; cache.valid = false; }
 	float GetMaxSize() const    { return maxSize; }
 
-    void SetFontSize(int size)  { fontSize = size;}
+    void SetFontSize(int size)  { fontSize = size; cache.valid = false; }
 
     void Awake() override;
 private:
@@ -114,9 +143,17 @@ private:
     TextLayout ComputeLayout(const std::vector<std::string>& lines, const Quad2D& quad, float width, float height);
     
     std::vector<std::string> PrepareLines(const std::string& text, float width);
-    void DrawWithDxFont(const std::vector<std::string>& lines, const TextLayout& lo);
-    void DrawWithSpriteFont(const std::vector<std::string>& lines, const TextLayout& lo);
-    void DrawFallbackText(const std::vector<std::string>& lines, const Quad2D& quad);
+
+    // レイアウト構築 (キャッシュへ書き込む).
+    void BuildLayout(float width, float height, const Vector2D& worldScale);
+    void LayoutDxFont(const std::vector<std::string>& lines, const TextLayout& lo);
+    void LayoutSpriteFont(const std::vector<std::string>& lines, const TextLayout& lo);
+    void LayoutFallbackText(const std::vector<std::string>& lines, float width, float height);
+    bool TryUpdateDigitsInPlace(const std::string& next);
+
+    // キャッシュの再生.
+    void DrawCachedLines(const Vector2D& origin) const;
+    void DrawCachedGlyphs(const Vector2D& origin) const;
 protected:
     std::shared_ptr<AppBase> Clone() const override {
         return std::make_shared<Text>(*this);
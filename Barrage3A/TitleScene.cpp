@@ -62,10 +62,10 @@ void TitleScene::Init() {
 	// ^Cg̉o.
 	{
 		var effectObj = GameObject::Instantiate("Effect");
-		effectObj->transform->rotation = 10;
+		effectObj->transform->SetRotation(10);
 		//float offset   = HEIGHT * 0.75f;
 		float CENTER_Y = -HEIGHT / 2.0f;
-		effectObj->transform->position.y = CENTER_Y - 250;
+		effectObj->transform->SetPosition(Vector2D(effectObj->transform->position.x, CENTER_Y - 250));
 		var effect = effectObj->AddAppBase<ParticleSystem>();
 		effect->SetSprite(Tex["Effects/Effect:effect000"]);
 		effect->SetRenderMode(RenderMode::ScreenSpaceOverlay);
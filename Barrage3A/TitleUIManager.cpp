@@ -204,12 +204,12 @@ System::Coroutine TitleUIManager::Move(std::shared_ptr<Image> img) {
     while (t < 0.1f) {
         float offsetX = Random.Range(-3.0f, 3.0f); // X方向の振動（振幅2px）
         float offsetY = Random.Range(-2.5f, 1.5f); // Y方向の振動（振幅1.5px）
-        rectTransform->anchoredPosition = basePos + Vector2D(offsetX, offsetY);
+        rectTransform->SetAnchoredPosition(basePos + Vector2D(offsetX, offsetY));
         _yield null;
         t += Time.deltaTime;
     }
 
-    rectTransform->anchoredPosition = basePos;
+    rectTransform->SetAnchoredPosition(basePos);
 }
 
 // AppBase Event.
@@ -3,7 +3,6 @@
 */
 #include "Transform2D.h"
 #include "GameObject.h"
-#include "GameWorldManager.hpp"
 #include <sstream>
 
 // OŎq Transform2D 
@@ -53,17 +52,58 @@ std::shared_ptr<Transform2D> Transform2D::FindByPath(const std::string& path) co
     return std::const_pointer_cast<Transform2D>(current);
 }
 
-Vector2D Transform2D::GetWorldPosition() const{
-    if (auto p = parent.lock()) {
-        return position + p->GetWorldPosition();
+Vector2D Transform2D::CalculateWorldPosition() const {
+    if (parentRaw) {
+        return position + parentRaw->worldCache.world.position;
     }
-    Vector2D offset = GameEngine::GameWorldManager::GetInstance().WorldOffSet();
-
     // Y]
     Vector2D pos = position;
     pos.y = -pos.y;
 
-    return offset + pos;
+    return worldOffset + pos;
+}
+
+bool Transform2D::SyncLocalState() const {
+    if (worldCache.localPosition == position &&
+        worldCache.localScale    == scale    &&
+        worldCache.localRotation == rotation) {
+        return false;
+    }
+    worldCache.localPosition = position;
+    worldCache.localScale    = scale;
+    worldCache.localRotation = rotation;
+    return true;
+}
+
+void Transform2D::RefreshWorldCache() const {
+    // eȂe (c悪LɂȂ_ōċA͎~܂).
+    if (parentRaw) parentRaw->ValidateWorldCache();
+    SyncLocalState();
+
+    WorldTransform2D& world = worldCache.world;
+    if (parentRaw) {
+        const WorldTransform2D& pw = parentRaw->worldCache.world;
+        world.scale    = Vector2D(scale.x * pw.scale.x, scale.y * pw.scale.y);
+        world.rotation = rotation + pw.rotation;
+    }
+    else {
+        world.scale    = scale;
+        world.rotation = rotation;
+    }
+    world.position = CalculateWorldPosition();
+
+    worldCache.offsetStamp = worldOffsetStamp;
+    worldDirty = false;
+    ++worldVersion;
+}
+
+void Transform2D::UpdateWorldTransformHierarchy() const {
+    // tB[h𒼐ڏ͂ŌoĎqɓ`.
+    if (SyncLocalState()) MarkWorldDirty();
+    ValidateWorldCache();
+    for (const auto& child : children) {
+        child->UpdateWorldTransformHierarchy();
+    }
 }
 
 Vector2D Transform2D::GetLocalPosition() const {
@@ -14,7 +14,45 @@ protected:
     std::weak_ptr<Transform2D> parent;
     // q Transform2D ێ郊Xg.
     std::vector<std::shared_ptr<Transform2D>> children;
+    // e̐|C^ ([hϊ̎QƗp. lock() oRȂ).
+    Transform2D* parentRaw = nullptr;
+
+public:
+    // [hϊ (GetWorldTransform2D ̖߂l).
+    struct WorldTransform2D {
+        Vector2D position;
+        Vector2D scale;
+        float    rotation = 0;
+    };
+protected:
+    // [hϊLbV.
+    struct WorldCache {
+        Vector2D localPosition;     // vZ̃[JW (ڏ̌op).
+        Vector2D localScale;        // vZ̃[JXP[.
+        float    localRotation = 0; // vZ̃[J].
+        uint32_t offsetStamp = 0;   // vZ̃[hItZbg̃X^v.
+
+        WorldTransform2D world;
+    };
+    mutable WorldCache worldCache;
+    // gc悪ς. ĂƂ͎qɂ` (Ă鏊Ŏ~߂) ̂,
+    // QƎ͎g̃tO邾ł悢.
+    mutable bool       worldDirty   = true;
+    mutable uint32_t   worldVersion = 0;        // ČvZƂɑ.
+
+    // ύX̃X^v ([g̒l̂ݎg). gȉ̂ǂςƃ[gɐVX^vU.
+    // X^v͑ŜŒPȂ̂, tւŕʂ̃[gɈڂĂÂlƈvȂ.
+    uint32_t         hierarchyStamp = 0;        // eqELԁEAppBase\.
+    mutable uint32_t worldStamp     = 0;        // [Jl ([hϊ).
+    inline static uint32_t stampCounter = 0;
+    static uint32_t NextStamp() { return ++stampCounter; }
+
+    // [gɉ郏[hItZbg (JEʗh). ςƃX^viݑŜČvZ.
+    inline static Vector2D worldOffset;
+    inline static uint32_t worldOffsetStamp = 0;
 public:     // J <oϐ>.
+    // [Jl. ڏꍇ͎ UpdateWorldTransforms ܂Ń[hϊɔfȂ̂,
+    // t[Ń[hWgȂ SetPosition / Translate Ȃǂg.
     // W.
     Vector2D position;
     // XP[.
@@ -42,6 +80,9 @@ public:     // 
         // q Transform2D ̐e nullptr ɐݒ肵AqXgNA.
         for (auto& child : children) {
             child->parent.reset(); // shared_ptr ɂǗɕύX.
+            child->parentRaw = nullptr;
+            child->MarkWorldDirty();
+            child->NotifyHierarchyChanged();
         }
         children.clear(); // Clear the children vector
     }
@@ -70,15 +111,27 @@ public:     // 
             SetLocalPositionFromWorld(worldPos); // [hWێ悤[JW␳
         }
     }
+
+    // [Jl̕ύX (gƎq̃[hϊ𖳌).
+    void SetPosition(const Vector2D& value) { position = value; MarkWorldDirty(); }
+    void Translate(const Vector2D& delta)   { position += delta; MarkWorldDirty(); }
+    void SetRotation(float value)           { rotation = value; MarkWorldDirty(); }
+    void Rotate(float delta)                { rotation += delta; MarkWorldDirty(); }
+    void SetScale(const Vector2D& value)    { scale = value; MarkWorldDirty(); }
     
     // ݂̐e擾
     std::shared_ptr<Transform2D> GetParent() const { return parent.lock(); }
+    // e (lock() Ȃ).
+    bool HasParent() const { return parentRaw != nullptr; }
 
     // q Transform2D ǉ
     void AddChild(std::shared_ptr<Transform2D> child) {
         if (child) {
             children.push_back(child);
             child->parent = shared_from_this(); // Update parent
+            child->parentRaw = this;
+            child->MarkWorldDirty();
+            NotifyHierarchyChanged();
         }
     }
 
@@ -87,6 +140,10 @@ public:     // 
         if (child) {
             children.erase(std::remove(children.begin(), children.end(), child), children.end());
             child->parent.reset(); // Remove parent reference
+            child->parentRaw = nullptr;
+            child->MarkWorldDirty();
+            child->NotifyHierarchyChanged();
+            NotifyHierarchyChanged();
         }
     }
     void RemoveChild(Transform2D* child) {
@@ -99,46 +156,65 @@ public:     // 
             );
             // e̎QƂNA
             child->parent.reset();
+            child->parentRaw = nullptr;
+            child->MarkWorldDirty();
+            child->NotifyHierarchyChanged();
+            NotifyHierarchyChanged();
         }
     }
-    // [hW擾
-    virtual Vector2D GetWorldPosition() const;
+    // [hW擾 (LbVς݂̒lԂ).
+    const Vector2D& GetWorldPosition() const {
+        ValidateWorldCache();
+        return worldCache.world.position;
+    }
 
     // [hXP[擾
-    Vector2D GetWorldScale() const {
-        Vector2D worldScale = scale;
-        if (auto p = parent.lock()) {
-            Vector2D parentScale = p->GetWorldScale();
-            worldScale.x *= parentScale.x;
-            worldScale.y *= parentScale.y;
-        }
-        return worldScale;
+    const Vector2D& GetWorldScale() const {
+        ValidateWorldCache();
+        return worldCache.world.scale;
     }
 
-    Transform2D GetWorldTransform2D() {
-        Transform2D worldTransform = *this;
-
-        // [hʒu擾
-        worldTransform.position = GetWorldPosition();
+    const WorldTransform2D& GetWorldTransform2D() const {
+        ValidateWorldCache();
+        return worldCache.world;
+    }
 
-        // [hXP[擾
-        worldTransform.scale = GetWorldScale();
+    // [h]擾
+    float GetWorldRotation() const {
+        ValidateWorldCache();
+        return worldCache.world.rotation;
+    }
 
-        // [h]擾
-        worldTransform.rotation = GetWorldRotation();
+    // gƎq̃LbV𖳌 (QƎɍČvZ).
+    void MarkWorldDirty() const {
+        GetRootRaw()->worldStamp = NextStamp();
+        MarkWorldDirtyDown();
+    }
+    // [hϊ̃o[W (lς΃[hϊČvZĂ).
+    uint32_t GetWorldVersion() const {
+        ValidateWorldCache();
+        return worldVersion;
+    }
 
-        return worldTransform;
+    // [gɉItZbgݒ (GameWorldManager ).
+    static void SetWorldOffset(const Vector2D& offset) {
+        if (offset == worldOffset) return;
+        worldOffset = offset;
+        worldOffsetStamp = NextStamp();
     }
 
-    // [h]擾
-    float GetWorldRotation() const {
-        float worldRotation = rotation;
-        if (auto p = parent.lock()) {
-            worldRotation += p->GetWorldRotation();
-        }
-        return worldRotation;
+    // [g̉̊Kw\ (eqELԁEAppBase\) ςƒlς.
+    uint32_t GetHierarchyVersion() const { return GetRootRaw()->hierarchyStamp; }
+    void NotifyHierarchyChanged() { GetRootRaw()->hierarchyStamp = NextStamp(); }
+    // [g̉̂ꂩ̃[hϊςƒlς ([hItZbg̕ω܂).
+    uint32_t GetHierarchyWorldVersion() const {
+        const Transform2D* root = GetRootRaw();
+        return root->UsesWorldOffset() ? (std::max)(root->worldStamp, worldOffsetStamp) : root->worldStamp;
     }
 
+    // gƎq̃[hϊKwɂ܂Ƃ߂čXV (ڏꂽ[JlŏE).
+    void UpdateWorldTransformHierarchy() const;
+
     // Transform2D̎qIuWFNg擾
     std::shared_ptr<Transform2D> GetChild(size_t index) const {
         if (index < children.size()) {
@@ -157,23 +233,31 @@ public:     // 
     template <typename T, typename = std::enable_if_t<std::is_base_of_v<AppBase, T>>>
     std::vector<std::shared_ptr<T>> GetAppBasesInChildren(bool all = false) const {
         std::vector<std::shared_ptr<T>> appBases;
+        CollectAppBasesInChildren<T>(appBases, all);
+        return appBases;
+    }
 
-        for (auto&& app : GetGameObject()->GetAppBases()) {
+    // GetAppBasesInChildren ̒ǋL (KwƂ vector 𐶐Ȃ).
+    template <typename T, typename = std::enable_if_t<std::is_base_of_v<AppBase, T>>>
+    void CollectAppBasesInChildren(std::vector<std::shared_ptr<T>>& appBases, bool all = false) const {
+        auto go = GetGameObject();
+        for (auto&& app : go->appBases) {
+            if (auto result = std::dynamic_pointer_cast<T>(app)) {
+                appBases.push_back(result);
+            }
+        }
+        for (auto&& app : go->newAppBaseList) {
             if (auto result = std::dynamic_pointer_cast<T>(app)) {
                 appBases.push_back(result);
             }
         }
-
 
         // qIuWFNgċAIɒT
         for (const auto& child : children) {
             if (!child->IsInHierarchy() && !all) continue;
-            // ċAIɎqT
-            auto childComponents = child->GetAppBasesInChildren<T>();
-            appBases.insert(appBases.end(), childComponents.begin(), childComponents.end());
+            // ċAIɎqT
+            child->CollectAppBasesInChildren<T>(appBases);
         }
-
-        return appBases;
     }
 
     template <typename T, typename = std::enable_if_t<std::is_base_of_v<AppBase, T>>>
@@ -202,8 +286,34 @@ public:     // 
     Vector2D GetLocalPosition() const;
 protected:
     std::shared_ptr<AppBase> Clone() const override {
-        return std::make_shared<Transform2D>(*this);
+        auto clone = std::make_shared<Transform2D>(*this);
+        clone->worldDirty = true;   // ̃LbV͈pȂ.
+        return clone;
+    }
+
+    // emς݂̏ԂŃ[hWvZ (hNXŏ㏑).
+    virtual Vector2D CalculateWorldPosition() const;
+    // LbṼL[ƂȂ郍[JlrEL^AωĂ true.
+    virtual bool SyncLocalState() const;
+    // [ĝƂɃ[hItZbgg (RectTransform2D ͎gȂ).
+    virtual bool UsesWorldOffset() const { return true; }
+    // [hϊLbV؂AKvȂČvZ.
+    void ValidateWorldCache() const {
+        if (worldDirty || worldCache.offsetStamp != worldOffsetStamp) RefreshWorldCache();
+    }
+private:
+    Transform2D* GetRootRaw() const {
+        const Transform2D* root = this;
+        while (root->parentRaw) root = root->parentRaw;
+        return const_cast<Transform2D*>(root);
+    }
+    void MarkWorldDirtyDown() const {
+        if (worldDirty) return;     // ĂΎqĂ.
+        worldDirty = true;
+        for (const auto& child : children) child->MarkWorldDirtyDown();
     }
+    // ȑcɊm肳Ă玩gČvZ.
+    void RefreshWorldCache() const;
 
 
 private:
@@ -215,5 +325,6 @@ private:
             else {
                 position = worldPosition;
             }
+            MarkWorldDirty();
         }
 };
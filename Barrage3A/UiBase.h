@@ -4,6 +4,16 @@
 #include "RectTransform2D.h"
 #define UI_BASE_ON_EVENT_MESSAGE (false)
 
+// UI ̕RXgEԍ̃LbV̗p (vp).
+struct UiCacheStats {
+    uint64_t hits   = 0;
+    uint64_t misses = 0;
+    double HitRate() const {
+        const uint64_t total = hits + misses;
+        return total ? static_cast<double>(hits) / static_cast<double>(total) : 0.0;
+    }
+};
+
 // UiBase class and AppBase class
 class UiBase : public AppBase {
     friend class GraphicRaycaster;
@@ -6,9 +6,10 @@
 #include <iostream>
 #include "Reflection.h"  // قǂReflectionwb_
 #include "Vector.h"
+#include "IDraw.h"
 
 struct GameObjectData {
-    bool isActive;
+    bool isActive = true;
     std::string name;
     std::string tag;
     Vector3D position;
@@ -47,4 +48,76 @@ struct UI {
     std::vector<UIElement> elements;
 
     JSON(elements)
-};
\ No newline at end of file
+};
+
+// ---- R|[lgƂ̃f[^ (ComponentData::json ̒g) ----
+
+struct TextData {
+    std::string text = "";
+    Color color{};
+    int fontSize = 0;
+
+    int alignment = 0;
+	int horizontalOverflow = 0;
+    int verticalOverflow = 0;
+    float lineSpacing = 0.0f;
+    int fontStyle = 0;
+
+    std::string systemFontName = "";
+
+	JSON(text, color, fontSize, alignment, horizontalOverflow, verticalOverflow, lineSpacing, fontStyle, systemFontName)
+};
+
+// C++  FontStyle enum `i
+enum class FontStyle : int {
+    Normal = 0,
+    Bold = 1,
+    Italic = 2,
+    BoldAndItalic = 3
+};
+
+struct ColorBlockData {
+    Color normalColor		= Color(0xFFFFFFFF);
+    Color highlightedColor	= Color(0xFFFFFFFF);
+    Color pressedColor		= Color(0xFFFFFFFF);
+    Color disabledColor		= Color(0xFFFFFFFF);
+    float colorMultiplier = 0;
+    float fadeDuration = 0;
+	JSON(normalColor, highlightedColor, pressedColor, disabledColor, colorMultiplier, fadeDuration)
+};
+
+struct ButtonData {
+    bool interactable = 0;
+    Color color;
+    int transition = 0;
+    ColorBlockData colors;
+	JSON(interactable, color, transition, colors)
+};
+
+
+struct PasKeyData
+{
+    std::string pathKey = "";    // fBNgȂǂɎgL[
+    std::string key = "";        // \[X̃L[
+    std::string textKey = "";    // \peLXgL[
+    std::string spritePath = ""; // XvCg\[X̃pX
+	JSON(pathKey, key, textKey, spritePath)
+};
+
+struct ImageData
+{
+    Color color = Color(0xFFFFFFFF);
+    PasKeyData imgKey;      // PasKeyf[^CX^X
+    int type = 0;               // Image.Type  int ɂĊi[
+    bool preserveAspect = false;
+	JSON(color, imgKey, type, preserveAspect)
+};
+
+struct CanvasData {
+    int canvasOrder = 0;
+    int renderMode = 0;  // RenderMode enum  int ɕϊiFScreenSpaceOverlay = 0 j
+    int scaleMode = 0;   // CanvasScaler::ScaleMode enum  int
+    Vector2D referenceResolution = { 800.0f, 600.0f };
+
+    JSON(canvasOrder, renderMode, scaleMode, referenceResolution)
+};
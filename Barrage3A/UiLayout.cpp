@@ -0,0 +1,101 @@
+#include "Project.h"
+#include "UiLayout.h"
+#include "JsonDocument.h"
+#include "File.hpp"
+#include "Debug.hpp"
+
+namespace {
+    class UiLayoutReader {
+    private:
+        std::vector<UiLayout::Node>& nodes;
+        std::vector<UiComponentData>& components;
+        // R|[lg JSON p. ƕg.
+        std::string componentText;
+        JsonDocument componentDocument;
+
+        void ReadComponent(const JsonNode& comp) {
+            const JsonNode* type = comp.Find("type");
+            if (!type || !type->IsString()) return;
+            const std::string_view name = type->GetRawString();
+
+            if (name == "GraphicRaycaster") {
+                components.emplace_back(GraphicRaycasterData{});
+                return;
+            }
+            if (name != "Canvas" && name != "Image" && name != "Button" && name != "Text") return;   // sȃR|[lg.
+
+            const JsonNode* json = comp.Find("json");
+            if (!json || !json->IsString()) return;
+            componentText.clear();
+            json->AppendString(componentText);
+            const JsonNode& data = componentDocument.Parse(std::string_view(componentText));
+            if (!data.IsObject()) return;
+
+            if (name == "Canvas")      ReadJson(data, components.emplace_back().emplace<CanvasData>());
+            else if (name == "Image")  ReadJson(data, components.emplace_back().emplace<ImageData>());
+            else if (name == "Button") ReadJson(data, components.emplace_back().emplace<ButtonData>());
+            else                       ReadJson(data, components.emplace_back().emplace<TextData>());
+        }
+    public:
+        UiLayoutReader(std::vector<UiLayout::Node>& _nodes, std::vector<UiComponentData>& _components)
+            : nodes(_nodes), components(_components) {}
+
+        void ReadElement(const JsonNode& element, int32_t parent) {
+            const int32_t index = static_cast<int32_t>(nodes.size());
+            nodes.emplace_back();
+            {
+                UiLayout::Node& node = nodes.back();
+                node.parent = parent;
+                if (const JsonNode* go = element.Find("gameObject")) ReadJson(*go, node.gameObject);
+                if (const JsonNode* rect = element.Find("rectTransform")) ReadJson(*rect, node.rectTransform);
+            }
+
+            const uint32_t first = static_cast<uint32_t>(components.size());
+            if (const JsonNode* comps = element.Find("components"); comps && comps->IsArray()) {
+                for (const JsonNode& comp : comps->Items()) {
+                    if (comp.IsObject()) ReadComponent(comp);
+                }
+            }
+            // qǂނ nodes Lт̂, ݂͓Yōs.
+            nodes[index].firstComponent = first;
+            nodes[index].componentCount = static_cast<uint32_t>(components.size()) - first;
+
+            if (const JsonNode* children = element.Find("children"); children && children->IsArray()) {
+                for (const JsonNode& child : children->Items()) {
+                    if (child.IsObject()) ReadElement(child, index);
+                }
+            }
+        }
+    };
+}
+
+std::shared_ptr<UiLayout> UiLayout::Load(const std::string& path) {
+    return FromJson(System::IO::File::ReadAllText(path));
+}
+
+std::shared_ptr<UiLayout> UiLayout::FromJson(std::string&& jsonText) {
+    JsonDocument document;
+    const JsonNode& root = document.Parse(std::move(jsonText));
+
+    auto layout = std::make_shared<UiLayout>();
+    const JsonNode* elements = root.Find("elements");
+    if (!elements || !elements->IsArray() || elements->Size() == 0) return layout;
+
+    UiLayoutReader reader(layout->nodes, layout->components);
+    const JsonNode& first = (*elements)[0];
+    if (first.IsObject()) reader.ReadElement(first, -1);
+    return layout;
+}
+
+std::shared_ptr<const UiLayout> UiLayoutManager::Get(const std::string& path) {
+    if (auto it = layouts.find(path); it != layouts.end()) return it->second;
+    try {
+        std::shared_ptr<const UiLayout> layout = UiLayout::Load(path);
+        layouts.emplace(path, layout);
+        return layout;
+    }
+    catch (const std::exception& e) {
+        GameEngine::Debug::ErrorLog("Failed to load UI layout: {} ({})", path, e.what());
+        return nullptr;
+    }
+}
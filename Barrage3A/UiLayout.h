@@ -0,0 +1,77 @@
+/*
+    UiLayout.h
+
+    :class
+        - UiLayout
+        - UiLayoutManager
+
+    쐬         : 2026/10/19
+    ŏIύX     : 2026/10/19
+*/
+#pragma once
+
+#include <string>
+#include <vector>
+#include <variant>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <cstdint>
+
+#include "UiJsonCommon.hpp"
+
+// GraphicRaycaster ͐ݒlȂ.
+struct GraphicRaycasterData {};
+
+using UiComponentData = std::variant<CanvasData, GraphicRaycasterData, ImageData, ButtonData, TextData>;
+
+/// <summary>
+/// UI vnu (Canvas/*.json) ǂݍ񂾌^t̖.
+/// vf͐[D (eqO) ŕɕ, e͓YŎ.
+/// ComponentData::json ̕ǂݍݎ 1 x߂Ă̂, ɂ JSON GȂ.
+/// </summary>
+class UiLayout {
+public:
+    struct Node {
+        GameObjectData gameObject;
+        RectTransformData rectTransform;
+        int32_t parent = -1;            //  -1.
+        uint32_t firstComponent = 0;
+        uint32_t componentCount = 0;
+    };
+private:
+    std::vector<Node> nodes;
+    std::vector<UiComponentData> components;
+public:
+    // t@C̐擪̗vf (elements[0]) ȉǂݍ. sƗO𓊂.
+    static std::shared_ptr<UiLayout> Load(const std::string& path);
+    static std::shared_ptr<UiLayout> FromJson(std::string&& jsonText);
+
+    bool IsEmpty() const { return nodes.empty(); }
+    const std::vector<Node>& GetNodes() const { return nodes; }
+    std::span<const UiComponentData> GetComponents(const Node& node) const {
+        return { components.data() + node.firstComponent, node.componentCount };
+    }
+};
+
+// ǂݍ UiLayout pXƂɎĂ (V[ɓ蒼ĂǂݒȂ).
+class UiLayoutManager {
+private:
+    std::unordered_map<std::string, std::shared_ptr<const UiLayout>> layouts;
+
+    UiLayoutManager() = default;
+    ~UiLayoutManager() = default;
+public:
+    UiLayoutManager(const UiLayoutManager&) = delete;
+    UiLayoutManager& operator=(const UiLayoutManager&) = delete;
+
+    static UiLayoutManager& GetInstance() {
+        static UiLayoutManager instance;
+        return instance;
+    }
+
+    // 񂾂t@Cǂ. ǂ߂Ȃ nullptr (Oo).
+    std::shared_ptr<const UiLayout> Get(const std::string& path);
+    void Unload(const std::string& path) { layouts.erase(path); }
+    void Clear() { layouts.clear(); }
+};
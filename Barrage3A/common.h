@@ -30,9 +30,15 @@ inline const fs::path LoadItemImageCSV		= FilePatchCSV / "ItemImagesPatch.csv";
 inline const fs::path LoadAudioSE_CSV	= FilePatchCSV / "AudioSE_Patch.csv";	
 inline const fs::path LoadAudioBGM_CSV	= FilePatchCSV / "AudioBGM_Patch.csv";
 
+// t@C̒Ȃǂ̉͌ (AudioInfoCache). ΍蒼.
+inline const fs::path AudioInfoCacheFile = SoundsFilePath / "AudioInfo.bin";
+
 // ẻ摜orFor蔻܂Ƃ߂f[^.
 inline const fs::path LoadBulletTypeDataJson = LoadFilePath / "BulletTypeData.json";
 
+// eEVbgEG̓̒` (PatternCompiler ̏).
+inline const fs::path LoadPatternScript = LoadFilePath / "Patterns.pat";
+
 // Xe[W1̓Gof[^iCSV`j
 inline const fs::path LoadStage1CSV = LoadFilePath / "EnemySpawn.csv";
 inline const fs::path LoadStage2CSV = LoadFilePath / "EnemySpawn2.csv";